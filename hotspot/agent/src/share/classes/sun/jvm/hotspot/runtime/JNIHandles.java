@@ -29,7 +29,8 @@ import sun.jvm.hotspot.debugger.*;
 import sun.jvm.hotspot.types.*;
 
 public class JNIHandles {
-  private static AddressField      globalHandlesField;
+  private static Address           globalHandlesAddress;
+  private static int               globalStripeCount;
   private static AddressField      weakGlobalHandlesField;
   private static OopField          deletedHandleField;
 
@@ -44,7 +45,8 @@ public class JNIHandles {
   private static synchronized void initialize(TypeDataBase db) {
     Type type = db.lookupType("JNIHandles");
 
-    globalHandlesField = type.getAddressField("_global_handles");
+    globalHandlesAddress = type.getAddressField("_global_handles[0]").getStaticFieldAddress();
+    globalStripeCount = db.lookupIntConstant("JNIHandles::global_stripe_count").intValue();
     weakGlobalHandlesField = type.getAddressField("_weak_global_handles");
     deletedHandleField = type.getOopField("_deleted_handle");
 
@@ -53,8 +55,15 @@ public class JNIHandles {
   public JNIHandles() {
   }
 
-  public JNIHandleBlock globalHandles() {
-    Address handleAddr  = globalHandlesField.getValue();
+  /** Number of independent global handle chains (stripes) */
+  public int globalHandleStripeCount() {
+    return globalStripeCount;
+  }
+
+  /** First block of the given global handle stripe */
+  public JNIHandleBlock globalHandles(int stripe) {
+    if (stripe < 0 || stripe >= globalStripeCount) throw new IndexOutOfBoundsException("bad stripe " + stripe);
+    Address handleAddr = globalHandlesAddress.getAddressAt(stripe * VM.getVM().getAddressSize());
     if (handleAddr == null) {
       return null;
     }
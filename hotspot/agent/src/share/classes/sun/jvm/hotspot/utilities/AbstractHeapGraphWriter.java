@@ -145,7 +145,12 @@ public abstract class AbstractHeapGraphWriter implements HeapGraphWriter {
 
     protected void writeGlobalJNIHandles() throws IOException {
         JNIHandles handles = VM.getVM().getJNIHandles();
-        JNIHandleBlock blk = handles.globalHandles();
+        for (int i = 0; i < handles.globalHandleStripeCount(); i++) {
+            writeGlobalJNIHandleBlock(handles.globalHandles(i));
+        }
+    }
+
+    private void writeGlobalJNIHandleBlock(JNIHandleBlock blk) throws IOException {
         if (blk != null) {
             try {
                 blk.oopsDo(new AddressVisitor() {
@@ -108,9 +108,12 @@ public class PointerFinder {
 
     // Check JNIHandles; both local and global
     JNIHandles handles = VM.getVM().getJNIHandles();
-    JNIHandleBlock handleBlock = handles.globalHandles();
-    if (handleBlock != null) {
-      handleBlock = handleBlock.blockContainingHandle(a);
+    JNIHandleBlock handleBlock = null;
+    for (int i = 0; i < handles.globalHandleStripeCount() && handleBlock == null; i++) {
+      JNIHandleBlock stripe = handles.globalHandles(i);
+      if (stripe != null) {
+        handleBlock = stripe.blockContainingHandle(a);
+      }
     }
     if (handleBlock != null) {
       loc.inStrongGlobalJNIHandleBlock = true;
@@ -107,8 +107,10 @@ public class ReversePtrsAnalysis {
 
     // Do global JNI handles
     JNIHandles handles = VM.getVM().getJNIHandles();
-    doJNIHandleBlock(handles.globalHandles(),
-                     new RootVisitor("Global JNI handle root"));
+    for (int i = 0; i < handles.globalHandleStripeCount(); i++) {
+      doJNIHandleBlock(handles.globalHandles(i),
+                       new RootVisitor("Global JNI handle root"));
+    }
     doJNIHandleBlock(handles.weakGlobalHandles(),
                      new RootVisitor("Weak global JNI handle root"));
 
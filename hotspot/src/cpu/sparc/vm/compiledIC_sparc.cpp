@@ -54,7 +54,7 @@ bool CompiledIC::is_icholder_call_site(virtual_call_Relocation* call_site) {
 // High-level access to an inline cache. Guaranteed to be MT-safe.
 
 CompiledIC::CompiledIC(nmethod* nm, NativeCall* call)
-  : _ic_call(call)
+  : _nm(nm), _ic_call(call)
 {
   address ic_call = call->instruction_address();
 
@@ -157,7 +157,7 @@ void CompiledStaticCall::set_to_interpreted(methodHandle callee, address entry)
 }
 
 void CompiledStaticCall::set_stub_to_clean(static_stub_Relocation* static_stub) {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "mt unsafe call");
+  assert (CompiledIC::ic_lock_for(static_stub->addr())->is_locked() || SafepointSynchronize::is_at_safepoint(), "mt unsafe call");
   // Reset stub.
   address stub = static_stub->addr();
   assert(stub != NULL, "stub not found");
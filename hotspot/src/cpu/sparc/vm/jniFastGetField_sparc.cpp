@@ -263,3 +263,38 @@ address JNI_FastGetField::generate_fast_get_float_field() {
 address JNI_FastGetField::generate_fast_get_double_field() {
   return generate_fast_get_float_field0(T_DOUBLE);
 }
+
+// Fast array region copies are not implemented on sparc; the slow
+// versions are kept.
+
+address JNI_FastGetField::generate_fast_get_boolean_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_byte_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_char_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_short_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_int_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_long_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_float_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_double_array_region() {
+  return (address)-1;
+}
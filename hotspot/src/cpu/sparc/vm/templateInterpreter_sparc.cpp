@@ -703,13 +703,13 @@ address InterpreterGenerator::generate_accessor_entry(void) {
     __ cmp(G1_scratch, ctos);
     __ br(Assembler::equal, true, Assembler::pt, xreturn_path);
     __ delayed()->lduh(Otos_i, G3_scratch, Otos_i);
-#ifdef ASSERT
     __ cmp(G1_scratch, btos);
     __ br(Assembler::equal, true, Assembler::pt, xreturn_path);
     __ delayed()->ldsb(Otos_i, G3_scratch, Otos_i);
-    __ should_not_reach_here();
-#endif
-    __ ldsb(Otos_i, G3_scratch, Otos_i);
+    // Long, float and double getters also get the accessor entry point;
+    // their results do not fit the single-register return here, so they
+    // take the slow path.
+    __ ba_short(slow_path);
     __ bind(xreturn_path);
 
     // _ireturn/_areturn
@@ -682,6 +682,7 @@ void TemplateTable::aload_0() {
   // _aload_0, _fast_igetfield (itos)
   // _aload_0, _fast_agetfield (atos)
   // _aload_0, _fast_fgetfield (ftos)
+  // _aload_0, _fast_lgetfield (ltos)
   //
   // occur frequently. If RewriteFrequentPairs is set, the (slow) _aload_0
   // bytecode checks the next bytecode and then rewrites the current
@@ -718,6 +719,12 @@ void TemplateTable::aload_0() {
     __ br(Assembler::equal, false, Assembler::pn, rewrite);
     __ delayed()->set(Bytecodes::_fast_faccess_0, G4_scratch);
 
+    // if _lgetfield then rewrite to _fast_laccess_0
+    assert(Bytecodes::java_code(Bytecodes::_fast_laccess_0) == Bytecodes::_aload_0, "adjust fast bytecode def");
+    __ cmp(G3_scratch, (int)Bytecodes::_fast_lgetfield);
+    __ br(Assembler::equal, false, Assembler::pn, rewrite);
+    __ delayed()->set(Bytecodes::_fast_laccess_0, G4_scratch);
+
     // else rewrite to _fast_aload0
     assert(Bytecodes::java_code(Bytecodes::_fast_aload_0) == Bytecodes::_aload_0, "adjust fast bytecode def");
     __ set(Bytecodes::_fast_aload_0, G4_scratch);
@@ -2840,6 +2847,8 @@ void TemplateTable::fast_xaccess(TosState state) {
     __ ld (Rreceiver, Roffset, Otos_i) ;
   } else if (state == ftos) {
     __ ldf(FloatRegisterImpl::S, Rreceiver, Roffset, Ftos_f);
+  } else if (state == ltos) {
+    __ ld_long(Rreceiver, Roffset, Otos_l);
   } else {
     ShouldNotReachHere();
   }
@@ -2616,6 +2616,12 @@ void Assembler::rep_mov() {
   emit_int8((unsigned char)0xA5);
 }
 
+// copies rcx bytes from [esi] to [edi]
+void Assembler::rep_movb() {
+  emit_int8((unsigned char)0xF3); // REP
+  emit_int8((unsigned char)0xA4); // MOVSB
+}
+
 // sets rcx bytes with rax, value at [edi]
 void Assembler::rep_stosb() {
   emit_int8((unsigned char)0xF3); // REP
@@ -3690,6 +3696,26 @@ void Assembler::vextractf128h(Address dst, XMMRegister src) {
   emit_int8(0x01);
 }
 
+void Assembler::vextractf128h(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_avx(), "");
+  bool vector256 = true;
+  int encode = vex_prefix_and_encode(src, xnoreg, dst, VEX_SIMD_66, vector256, VEX_OPCODE_0F_3A);
+  emit_int8(0x19);
+  emit_int8((unsigned char)(0xC0 | encode));
+  // 0x01 - extract from upper 128 bits
+  emit_int8(0x01);
+}
+
+void Assembler::vextracti128h(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_avx2(), "");
+  bool vector256 = true;
+  int encode = vex_prefix_and_encode(src, xnoreg, dst, VEX_SIMD_66, vector256, VEX_OPCODE_0F_3A);
+  emit_int8(0x39);
+  emit_int8((unsigned char)(0xC0 | encode));
+  // 0x01 - extract from upper 128 bits
+  emit_int8(0x01);
+}
+
 void Assembler::vinserti128h(XMMRegister dst, XMMRegister nds, XMMRegister src) {
   assert(VM_Version::supports_avx2(), "");
   bool vector256 = true;
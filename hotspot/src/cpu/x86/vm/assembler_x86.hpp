@@ -832,6 +832,7 @@ private:
 
   // These do register sized moves/scans
   void rep_mov();
+  void rep_movb();
   void rep_stos();
   void rep_stosb();
   void repne_scan();
@@ -1768,6 +1769,10 @@ private:
   void vinsertf128h(XMMRegister dst, XMMRegister nds, XMMRegister src);
   void vinserti128h(XMMRegister dst, XMMRegister nds, XMMRegister src);
 
+  // Copy high 128bit into low 128bit of YMM registers.
+  void vextractf128h(XMMRegister dst, XMMRegister src);
+  void vextracti128h(XMMRegister dst, XMMRegister src);
+
   // Load/store high 128bit of YMM registers which does not destroy other half.
   void vinsertf128h(XMMRegister dst, Address src);
   void vinserti128h(XMMRegister dst, Address src);
@@ -907,17 +907,17 @@ address InterpreterGenerator::generate_accessor_entry(void) {
     __ jmp(xreturn_path);
 
     __ bind(notChar);
-#ifdef ASSERT
+    // Long, float and double getters also get the accessor entry point;
+    // their results do not fit the single-register return here, so they
+    // take the slow path.
     Label okay;
 #ifndef _LP64
     __ cmpl(rdx, atos);
     __ jcc(Assembler::equal, okay);
 #endif // _LP64
     __ cmpl(rdx, itos);
-    __ jcc(Assembler::equal, okay);
-    __ stop("what type is this?");
+    __ jcc(Assembler::notEqual, slow_path);
     __ bind(okay);
-#endif // ASSERT
     // All the rest are a 32 bit wordsize
     __ movl(rax, field_address);
 
@@ -366,3 +366,39 @@ address JNI_FastGetField::generate_fast_get_float_field() {
 address JNI_FastGetField::generate_fast_get_double_field() {
   return generate_fast_get_float_field0(T_DOUBLE);
 }
+
+// Fast array region copies are only implemented on amd64; the 32-bit
+// port (which would also need SEH wrappers on windows) keeps the slow
+// versions.
+
+address JNI_FastGetField::generate_fast_get_boolean_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_byte_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_char_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_short_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_int_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_long_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_float_array_region() {
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_double_array_region() {
+  return (address)-1;
+}
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "asm/macroAssembler.hpp"
 #include "memory/resourceArea.hpp"
+#include "oops/arrayOop.hpp"
 #include "prims/jniFastGetField.hpp"
 #include "prims/jvm_misc.hpp"
 #include "runtime/safepoint.hpp"
@@ -96,6 +97,11 @@ address JNI_FastGetField::generate_fast_get_int_field0(BasicType type) {
     default:        ShouldNotReachHere();
   }
 
+  // jfieldIDs do not record volatility, so this path also services
+  // volatile field reads. Those need acquire semantics; plain loads
+  // provide them on x86, so the membar emits no code here.
+  __ membar(Assembler::Membar_mask_bits(Assembler::LoadLoad | Assembler::LoadStore));
+
   if (os::is_MP()) {
     __ lea(rcounter_addr, counter);
     // ca is data dependent on rax.
@@ -190,6 +196,9 @@ address JNI_FastGetField::generate_fast_get_float_field0(BasicType type) {
     default:        ShouldNotReachHere();
   }
 
+  // Acquire semantics for volatile field reads; no code on x86.
+  __ membar(Assembler::Membar_mask_bits(Assembler::LoadLoad | Assembler::LoadStore));
+
   if (os::is_MP()) {
     __ lea(rcounter_addr, counter);
     __ movdq (rax, xmm0);
@@ -226,3 +235,154 @@ address JNI_FastGetField::generate_fast_get_float_field() {
 address JNI_FastGetField::generate_fast_get_double_field() {
   return generate_fast_get_float_field0(T_DOUBLE);
 }
+
+// Fast path for small Get<Primitive>ArrayRegion copies (see
+// jniFastGetField.hpp for the speculation scheme). Copies at most
+// small_copy_limit bytes; anything larger goes to the slow version
+// up front since re-copying it on a safepoint collision would cost
+// more than the call transition the fast path saves.
+//
+// Register usage:
+// c_rarg0:    jni env (dead after entry, reused as scratch)
+// c_rarg1:    array handle (reused as copy source)
+// c_rarg2:    start index
+// c_rarg3:    element count (reused as byte count for the copy)
+// c_rarg4:    caller buffer (copy destination)
+
+static const int small_copy_limit = 256;
+
+address JNI_FastGetField::generate_fast_get_array_region0(BasicType type) {
+#ifdef _WIN64
+  // The buffer argument arrives on the stack on win64 and the copy
+  // would also need an SEH wrapper; keep the slow versions there.
+  return (address)-1;
+#else
+  const char *name;
+  switch (type) {
+    case T_BOOLEAN: name = "jni_fast_GetBooleanArrayRegion"; break;
+    case T_BYTE:    name = "jni_fast_GetByteArrayRegion";    break;
+    case T_CHAR:    name = "jni_fast_GetCharArrayRegion";    break;
+    case T_SHORT:   name = "jni_fast_GetShortArrayRegion";   break;
+    case T_INT:     name = "jni_fast_GetIntArrayRegion";     break;
+    case T_LONG:    name = "jni_fast_GetLongArrayRegion";    break;
+    case T_FLOAT:   name = "jni_fast_GetFloatArrayRegion";   break;
+    case T_DOUBLE:  name = "jni_fast_GetDoubleArrayRegion";  break;
+    default:        ShouldNotReachHere();
+  }
+  ResourceMark rm;
+  BufferBlob* blob = BufferBlob::create(name, BUFFER_SIZE);
+  CodeBuffer cbuf(blob);
+  MacroAssembler* masm = new MacroAssembler(&cbuf);
+  address fast_entry = __ pc();
+
+  Label slow;
+
+  const int shift = exact_log2(type2aelembytes(type));
+  const Register rarray = r9;
+
+  ExternalAddress counter(SafepointSynchronize::safepoint_counter_addr());
+  __ mov32 (rcounter, counter);
+  __ mov   (rarray, c_rarg1);
+  __ testb (rcounter, 1);
+  __ jcc   (Assembler::notZero, slow);
+  if (os::is_MP()) {
+    __ xorptr(rarray, rcounter);
+    __ xorptr(rarray, rcounter);               // array, since
+                                               // rarray ^ rcounter ^ rcounter == rarray
+                                               // rarray is data dependent on rcounter.
+  }
+  __ movptr(rarray, Address(rarray, 0));       // *array
+
+  __ movl  (rax, c_rarg3);                     // len, zero-extended
+  __ testl (rax, rax);
+  __ jcc   (Assembler::negative, slow);        // len < 0: slow path throws
+  __ cmpl  (rax, small_copy_limit >> shift);
+  __ jcc   (Assembler::above, slow);           // too big to re-copy on a collision
+  __ testl (c_rarg2, c_rarg2);
+  __ jcc   (Assembler::negative, slow);        // start < 0: slow path throws
+  __ movl  (c_rarg2, c_rarg2);                 // start, zero-extended
+  __ lea   (roffset, Address(c_rarg2, rax, Address::times_1));  // start + len
+
+  // The length load and the copy are both speculative heap accesses
+  // and may fault if a GC moved the array, so each gets a pclist entry.
+  assert(count < LIST_CAPACITY-1, "LIST_CAPACITY too small");
+  speculative_load_pclist[count++] = __ pc();
+  __ movl  (c_rarg0, Address(rarray, arrayOopDesc::length_offset_in_bytes()));
+  __ cmpq  (roffset, c_rarg0);                 // start + len vs. length, both zero-extended
+  __ jcc   (Assembler::above, slow);
+
+  __ lea   (c_rarg1, Address(rarray, c_rarg2, (Address::ScaleFactor)shift,
+                             arrayOopDesc::base_offset_in_bytes(type)));  // copy source
+  __ mov   (c_rarg0, c_rarg4);                 // caller buffer
+  if (shift > 0) {
+    __ shlq(rax, shift);
+  }
+  __ mov   (c_rarg3, rax);                     // byte count
+  speculative_load_pclist[count] = __ pc();
+  __ rep_movb();
+
+  // The copied data went through memory, so the usual data dependency
+  // on the result cannot order the counter re-load here; pay the lfence.
+  if (os::is_MP()) {
+    __ lfence();
+  }
+  __ lea   (rcounter_addr, counter);
+  __ cmpl  (rcounter, Address(rcounter_addr, 0));
+  __ jcc   (Assembler::notEqual, slow);
+
+  __ ret (0);
+
+  slowcase_entry_pclist[count-1] = __ pc();
+  slowcase_entry_pclist[count++] = __ pc();
+  __ bind (slow);
+  address slow_case_addr;
+  switch (type) {
+    case T_BOOLEAN: slow_case_addr = jni_GetBooleanArrayRegion_addr(); break;
+    case T_BYTE:    slow_case_addr = jni_GetByteArrayRegion_addr();    break;
+    case T_CHAR:    slow_case_addr = jni_GetCharArrayRegion_addr();    break;
+    case T_SHORT:   slow_case_addr = jni_GetShortArrayRegion_addr();   break;
+    case T_INT:     slow_case_addr = jni_GetIntArrayRegion_addr();     break;
+    case T_LONG:    slow_case_addr = jni_GetLongArrayRegion_addr();    break;
+    case T_FLOAT:   slow_case_addr = jni_GetFloatArrayRegion_addr();   break;
+    case T_DOUBLE:  slow_case_addr = jni_GetDoubleArrayRegion_addr();
+  }
+  // tail call
+  __ jump (ExternalAddress(slow_case_addr));
+
+  __ flush ();
+
+  return fast_entry;
+#endif // _WIN64
+}
+
+address JNI_FastGetField::generate_fast_get_boolean_array_region() {
+  return generate_fast_get_array_region0(T_BOOLEAN);
+}
+
+address JNI_FastGetField::generate_fast_get_byte_array_region() {
+  return generate_fast_get_array_region0(T_BYTE);
+}
+
+address JNI_FastGetField::generate_fast_get_char_array_region() {
+  return generate_fast_get_array_region0(T_CHAR);
+}
+
+address JNI_FastGetField::generate_fast_get_short_array_region() {
+  return generate_fast_get_array_region0(T_SHORT);
+}
+
+address JNI_FastGetField::generate_fast_get_int_array_region() {
+  return generate_fast_get_array_region0(T_INT);
+}
+
+address JNI_FastGetField::generate_fast_get_long_array_region() {
+  return generate_fast_get_array_region0(T_LONG);
+}
+
+address JNI_FastGetField::generate_fast_get_float_array_region() {
+  return generate_fast_get_array_region0(T_FLOAT);
+}
+
+address JNI_FastGetField::generate_fast_get_double_array_region() {
+  return generate_fast_get_array_region0(T_DOUBLE);
+}
@@ -3967,6 +3967,28 @@ void MacroAssembler::lookup_interface_method(Register recv_klass,
   Address::ScaleFactor times_vte_scale = Address::times_ptr;
   assert(vte_size == wordSize, "else adjust times_vte_scale");
 
+  Label search, found_method;
+
+  if (itable_index.is_constant()) {
+    // Probe the one-entry lookup hint stored in the receiver klass: the byte
+    // offset of the itableOffsetEntry matched by the last lookup.  Hints are
+    // only ever written with offsets of real entries of this itable, so a
+    // stale value at worst fails the interface compare and we fall through
+    // to the scan.  Itable stubs pass a constant index, so method_result is
+    // free for use as a temp here (see the assert above).
+    Label hint_miss;
+    movl(method_result, Address(recv_klass, in_bytes(InstanceKlass::itable_lookup_hint_offset())));
+    testl(method_result, method_result);
+    jccb(Assembler::zero, hint_miss);
+    lea(scan_temp, Address(recv_klass, method_result, Address::times_1));
+    cmpptr(intf_klass, Address(scan_temp, itableOffsetEntry::interface_offset_in_bytes()));
+    jccb(Assembler::notEqual, hint_miss);
+    // The hinted entry is for intf_klass; skip the scan.
+    lea(recv_klass, Address(recv_klass, itable_index, Address::times_ptr, itentry_off));
+    jmp(found_method);
+    bind(hint_miss);
+  }
+
   movl(scan_temp, Address(recv_klass, InstanceKlass::vtable_length_offset() * wordSize));
 
   // %%% Could store the aligned, prescaled offset in the klassoop.
@@ -3986,17 +4008,17 @@ void MacroAssembler::lookup_interface_method(Register recv_klass,
   //     result = (klass + scan->offset() + itable_index);
   //   }
   // }
-  Label search, found_method;
+  Label scan_found;
 
   for (int peel = 1; peel >= 0; peel--) {
     movptr(method_result, Address(scan_temp, itableOffsetEntry::interface_offset_in_bytes()));
     cmpptr(intf_klass, method_result);
 
     if (peel) {
-      jccb(Assembler::equal, found_method);
+      jccb(Assembler::equal, scan_found);
     } else {
       jccb(Assembler::notEqual, search);
-      // (invert the test to fall through to found_method...)
+      // (invert the test to fall through to scan_found...)
     }
 
     if (!peel)  break;
@@ -4011,6 +4033,20 @@ void MacroAssembler::lookup_interface_method(Register recv_klass,
     addptr(scan_temp, scan_step);
   }
 
+  bind(scan_found);
+
+  if (itable_index.is_constant()) {
+    // Remember which entry matched so the next lookup on this klass can
+    // skip the scan.  The store only happens on the scan path - hint hits
+    // jump straight to found_method and leave the klass line clean.
+    // recv_klass was advanced past the klass base by entry_adj above.
+    int entry_adj = itentry_off + itable_index.as_constant() * wordSize;
+    movptr(method_result, scan_temp);
+    subptr(method_result, recv_klass);
+    addptr(method_result, entry_adj);
+    movl(Address(recv_klass, in_bytes(InstanceKlass::itable_lookup_hint_offset()) - entry_adj), method_result);
+  }
+
   bind(found_method);
 
   // Got a hit.
@@ -4195,6 +4231,25 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
   LP64_ONLY( incrementl(Address(rcx, 0)) );
 #endif //PRODUCT
 
+  // Consult the hash filter first: a clear bit for the super's hash
+  // proves it is not on the list, which ends most failing checks without
+  // scanning the array (negative results are never cached, so megamorphic
+  // failures would otherwise scan every time).
+  Label L_scan, L_done_scan;
+  mov(rcx, rax);
+  shrptr(rcx, Klass::_secondary_supers_bitmap_shift);
+  movptr(rdi, Address(sub_klass, in_bytes(Klass::secondary_supers_bitmap_offset())));
+  shrptr(rdi);  // by cl; the hardware takes the count modulo the word size
+  testptr(rdi, 1);
+  jccb(Assembler::notZero, L_scan);
+  // Definitive miss.  Set Z = 0 (not equal), as the failed scan would have.
+  testptr(rax, rax);
+  if (set_cond_codes) {
+    mov(rdi, rax);  // the AD files expect rdi to be left non-zero
+  }
+  jmpb(L_done_scan);
+
+  bind(L_scan);
   // We will consult the secondary-super array.
   movptr(rdi, secondary_supers_addr);
   // Load the array length.  (Positive movl does right thing on LP64.)
@@ -4211,6 +4266,8 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
     testptr(rax,rax); // Set Z = 0
     repne_scan();
 
+  bind(L_done_scan);
+
   // Unspill the temp. registers:
   if (pushed_rdi)  pop(rdi);
   if (pushed_rcx)  pop(rcx);
@@ -5927,15 +5984,15 @@ void MacroAssembler::string_compare(Register str1, Register str2,
   bind(DONE_LABEL);
 }
 
-// Compare char[] arrays aligned to 4 bytes or substrings.
-void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Register ary2,
-                                        Register limit, Register result, Register chr,
-                                        XMMRegister vec1, XMMRegister vec2) {
+// Compare char[] or byte[] arrays aligned to 4 bytes or substrings.
+void MacroAssembler::arrays_equals(bool is_array_equ, Register ary1, Register ary2,
+                                   Register limit, Register result, Register chr,
+                                   XMMRegister vec1, XMMRegister vec2, bool is_char) {
   ShortBranchVerifier sbv(this);
-  Label TRUE_LABEL, FALSE_LABEL, DONE, COMPARE_VECTORS, COMPARE_CHAR;
+  Label TRUE_LABEL, FALSE_LABEL, DONE, COMPARE_VECTORS, COMPARE_CHAR, COMPARE_BYTE;
 
   int length_offset  = arrayOopDesc::length_offset_in_bytes();
-  int base_offset    = arrayOopDesc::base_offset_in_bytes(T_CHAR);
+  int base_offset    = arrayOopDesc::base_offset_in_bytes(is_char ? T_CHAR : T_BYTE);
 
   // Check the input args
   cmpptr(ary1, ary2);
@@ -5964,7 +6021,9 @@ void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Regist
     lea(ary2, Address(ary2, base_offset));
   }
 
-  shll(limit, 1);      // byte count != 0
+  if (is_char) {
+    shll(limit, 1);      // byte count != 0
+  }
   movl(result, limit); // copy
 
   if (UseAVX >= 2) {
@@ -5972,7 +6031,7 @@ void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Regist
     Label COMPARE_WIDE_VECTORS, COMPARE_TAIL;
 
     // Compare 32-byte vectors
-    andl(result, 0x0000001e);  //   tail count (in bytes)
+    andl(result, is_char ? 0x0000001e : 0x0000001f);  //   tail count (in bytes)
     andl(limit, 0xffffffe0);   // vector count (in bytes)
     jccb(Assembler::zero, COMPARE_TAIL);
 
@@ -6009,7 +6068,7 @@ void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Regist
     Label COMPARE_WIDE_VECTORS, COMPARE_TAIL;
 
     // Compare 16-byte vectors
-    andl(result, 0x0000000e);  //   tail count (in bytes)
+    andl(result, is_char ? 0x0000000e : 0x0000000f);  //   tail count (in bytes)
     andl(limit, 0xfffffff0);   // vector count (in bytes)
     jccb(Assembler::zero, COMPARE_TAIL);
 
@@ -6061,12 +6120,27 @@ void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Regist
   // Compare trailing char (final 2 bytes), if any
   bind(COMPARE_CHAR);
   testl(result, 0x2);   // tail  char
-  jccb(Assembler::zero, TRUE_LABEL);
+  jccb(Assembler::zero, is_char ? TRUE_LABEL : COMPARE_BYTE);
   load_unsigned_short(chr, Address(ary1, 0));
   load_unsigned_short(limit, Address(ary2, 0));
   cmpl(chr, limit);
   jccb(Assembler::notEqual, FALSE_LABEL);
 
+  if (!is_char) {
+    // Byte counts can be odd; step over the compared char and check the
+    // trailing byte, if any
+    lea(ary1, Address(ary1, 2));
+    lea(ary2, Address(ary2, 2));
+
+    bind(COMPARE_BYTE);
+    testl(result, 0x1);   // tail  byte
+    jccb(Assembler::zero, TRUE_LABEL);
+    load_unsigned_byte(chr, Address(ary1, 0));
+    load_unsigned_byte(limit, Address(ary2, 0));
+    cmpl(chr, limit);
+    jccb(Assembler::notEqual, FALSE_LABEL);
+  }
+
   bind(TRUE_LABEL);
   movl(result, 1);   // return true
   jmpb(DONE);
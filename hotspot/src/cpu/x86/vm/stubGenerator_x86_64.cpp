@@ -1476,6 +1476,64 @@ class StubGenerator: public StubCodeGenerator {
     setup_arg_regs(); // from => rdi, to => rsi, count => rdx
                       // r9 and r10 may be used to save non-volatile registers
 
+    {
+      // Copies of at most 32 bytes are common (short strings, serialization
+      // records); handle them with a pair of possibly overlapping loads and
+      // stores instead of setting up the qword loop.  All loads precede all
+      // stores, so this is safe even for overlapping arrays; bytes covered
+      // twice are stored with the same value, preserving byte atomicity.
+      Label L_long_copy, L_below_16, L_below_8, L_below_4, L_below_2, L_small_exit;
+      __ cmpptr(count, 32);
+      __ jcc(Assembler::above, L_long_copy);
+      __ cmpptr(count, 16);
+      __ jccb(Assembler::below, L_below_16);
+      // 16..32 bytes: copy the first and last 16 bytes
+      __ movdqu(xmm0, Address(from, 0));
+      __ movdqu(xmm1, Address(from, count, Address::times_1, -16));
+      __ movdqu(Address(to, 0), xmm0);
+      __ movdqu(Address(to, count, Address::times_1, -16), xmm1);
+      __ jmp(L_small_exit);
+    __ BIND(L_below_16);
+      __ cmpptr(count, 8);
+      __ jccb(Assembler::below, L_below_8);
+      // 8..15 bytes: copy the first and last qword
+      __ movq(rax, Address(from, 0));
+      __ movq(rcx, Address(from, count, Address::times_1, -8));
+      __ movq(Address(to, 0), rax);
+      __ movq(Address(to, count, Address::times_1, -8), rcx);
+      __ jmp(L_small_exit);
+    __ BIND(L_below_8);
+      __ cmpptr(count, 4);
+      __ jccb(Assembler::below, L_below_4);
+      // 4..7 bytes: copy the first and last dword
+      __ movl(rax, Address(from, 0));
+      __ movl(rcx, Address(from, count, Address::times_1, -4));
+      __ movl(Address(to, 0), rax);
+      __ movl(Address(to, count, Address::times_1, -4), rcx);
+      __ jmpb(L_small_exit);
+    __ BIND(L_below_4);
+      __ cmpptr(count, 2);
+      __ jccb(Assembler::below, L_below_2);
+      // 2..3 bytes: copy the first and last word
+      __ movw(rax, Address(from, 0));
+      __ movw(rcx, Address(from, count, Address::times_1, -2));
+      __ movw(Address(to, 0), rax);
+      __ movw(Address(to, count, Address::times_1, -2), rcx);
+      __ jmpb(L_small_exit);
+    __ BIND(L_below_2);
+      __ testptr(count, count);
+      __ jccb(Assembler::zero, L_small_exit);
+      __ movb(rax, Address(from, 0));
+      __ movb(Address(to, 0), rax);
+    __ BIND(L_small_exit);
+      restore_arg_regs();
+      inc_counter_np(SharedRuntime::_jbyte_short_copy_ctr); // Update counter after rscratch1 is free
+      __ xorptr(rax, rax); // return 0
+      __ leave(); // required for proper stackwalking of RuntimeStub frame
+      __ ret(0);
+    __ BIND(L_long_copy);
+    }
+
     // 'from', 'to' and 'count' are now valid
     __ movptr(byte_count, count);
     __ shrptr(count, 3); // count => qword_count
@@ -740,17 +740,16 @@ address InterpreterGenerator::generate_accessor_entry(void) {
     __ jmp(xreturn_path);
 
     __ bind(notChar);
-#ifdef ASSERT
+    // Long, float and double getters also get the accessor entry point;
+    // their results do not fit the single-register return here, so they
+    // take the slow path.
     Label okay;
     __ cmpl(rdx, atos);
     __ jcc(Assembler::equal, okay);
     __ cmpl(rdx, itos);
-    __ jcc(Assembler::equal, okay);
-    __ stop("what type is this?");
+    __ jcc(Assembler::notEqual, slow_path);
     __ bind(okay);
-#endif // ASSERT
-    // All the rest are a 32 bit wordsize
-    // This is ok for now. Since fast accessors should be going away
+    // atos and itos are a 32 bit wordsize
     __ movptr(rax, field_address);
 
     __ bind(xreturn_path);
@@ -680,7 +680,7 @@ address InterpreterGenerator::generate_accessor_entry(void) {
                     ConstantPoolCache::base_offset() +
                     ConstantPoolCacheEntry::flags_offset()));
 
-    Label notObj, notInt, notByte, notShort;
+    Label notObj, notInt, notByte, notShort, notChar, notLong, notFloat;
     const Address field_address(rax, rcx, Address::times_1);
 
     // Need to differentiate between igetfield, agetfield, bgetfield etc.
@@ -718,15 +718,36 @@ address InterpreterGenerator::generate_accessor_entry(void) {
     __ jmp(xreturn_path);
 
     __ bind(notShort);
+    __ cmpl(rdx, ctos);
+    __ jcc(Assembler::notEqual, notChar);
+    // ctos
+    __ load_unsigned_short(rax, field_address);
+    __ jmp(xreturn_path);
+
+    __ bind(notChar);
+    __ cmpl(rdx, ltos);
+    __ jcc(Assembler::notEqual, notLong);
+    // ltos (a 64-bit load is atomic, so this also serves volatile longs)
+    __ movq(rax, field_address);
+    __ jmp(xreturn_path);
+
+    __ bind(notLong);
+    __ cmpl(rdx, ftos);
+    __ jcc(Assembler::notEqual, notFloat);
+    // ftos (floats and doubles are returned in xmm0, rax is ignored)
+    __ movflt(xmm0, field_address);
+    __ jmp(xreturn_path);
+
+    __ bind(notFloat);
 #ifdef ASSERT
     Label okay;
-    __ cmpl(rdx, ctos);
+    __ cmpl(rdx, dtos);
     __ jcc(Assembler::equal, okay);
     __ stop("what type is this?");
     __ bind(okay);
 #endif
-    // ctos
-    __ load_unsigned_short(rax, field_address);
+    // dtos
+    __ movdbl(xmm0, field_address);
 
     __ bind(xreturn_path);
 
@@ -2844,6 +2844,10 @@ void TemplateTable::fast_xaccess(TosState state) {
     __ verify_oop(rax);
   } else if (state == ftos) {
     __ fld_s(lo);
+  } else if (state == ltos) {
+    // getfield is never rewritten to _fast_lgetfield on 32 bit x86
+    // (potential volatile case), so _fast_laccess_0 cannot occur either
+    __ stop("should not be rewritten");
   } else {
     ShouldNotReachHere();
   }
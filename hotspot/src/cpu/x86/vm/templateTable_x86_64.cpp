@@ -761,6 +761,7 @@ void TemplateTable::aload_0() {
   // _aload_0, _fast_igetfield
   // _aload_0, _fast_agetfield
   // _aload_0, _fast_fgetfield
+  // _aload_0, _fast_lgetfield
   //
   // occur frequently. If RewriteFrequentPairs is set, the (slow)
   // _aload_0 bytecode checks if the next bytecode is either
@@ -816,6 +817,14 @@ void TemplateTable::aload_0() {
     __ movl(bc, Bytecodes::_fast_faccess_0);
     __ jccb(Assembler::equal, rewrite);
 
+    // if _lgetfield then reqrite to _fast_laccess_0
+    assert(Bytecodes::java_code(Bytecodes::_fast_laccess_0) ==
+           Bytecodes::_aload_0,
+           "fix bytecode definition");
+    __ cmpl(rbx, Bytecodes::_fast_lgetfield);
+    __ movl(bc, Bytecodes::_fast_laccess_0);
+    __ jccb(Assembler::equal, rewrite);
+
     // else rewrite to _fast_aload0
     assert(Bytecodes::java_code(Bytecodes::_fast_aload_0) ==
            Bytecodes::_aload_0,
@@ -2885,6 +2894,9 @@ void TemplateTable::fast_xaccess(TosState state) {
   case ftos:
     __ movflt(xmm0, Address(rax, rbx, Address::times_1));
     break;
+  case ltos:
+    __ movq(rax, Address(rax, rbx, Address::times_1));
+    break;
   default:
     ShouldNotReachHere();
   }
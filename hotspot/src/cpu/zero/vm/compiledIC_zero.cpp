@@ -62,7 +62,7 @@ bool CompiledIC::is_icholder_call_site(virtual_call_Relocation* call_site) {
 // High-level access to an inline cache. Guaranteed to be MT-safe.
 
 CompiledIC::CompiledIC(nmethod* nm, NativeCall* call)
-  : _ic_call(call)
+  : _nm(nm), _ic_call(call)
 {
   address ic_call = call->instruction_address();
 
@@ -218,13 +218,17 @@ int CppInterpreter::native_entry(Method* method, intptr_t UNUSED, TRAPS) {
       if (HAS_PENDING_EXCEPTION)
         goto unwind_and_return;
     }
-    InvocationCounter *counter = mcs->invocation_counter();
-    counter->increment();
-    if (counter->reached_InvocationLimit()) {
-      CALL_VM_NOCHECK(
-        InterpreterRuntime::frequency_counter_overflow(thread, NULL));
-      if (HAS_PENDING_EXCEPTION)
-        goto unwind_and_return;
+    // mcs is NULL when allocation is still deferred or failed; skip
+    // counting this invocation, like the compiled interpreters do.
+    if (mcs != NULL) {
+      InvocationCounter *counter = mcs->invocation_counter();
+      counter->increment();
+      if (counter->reached_InvocationLimit()) {
+        CALL_VM_NOCHECK(
+          InterpreterRuntime::frequency_counter_overflow(thread, NULL));
+        if (HAS_PENDING_EXCEPTION)
+          goto unwind_and_return;
+      }
     }
   }
 
@@ -501,7 +505,10 @@ int CppInterpreter::accessor_entry(Method* method, intptr_t UNUSED, TRAPS) {
   assert(code[0] == Bytecodes::_aload_0 &&
          code[1] == Bytecodes::_getfield &&
          (code[4] == Bytecodes::_ireturn ||
-          code[4] == Bytecodes::_areturn), "should do");
+          code[4] == Bytecodes::_areturn ||
+          code[4] == Bytecodes::_lreturn ||
+          code[4] == Bytecodes::_freturn ||
+          code[4] == Bytecodes::_dreturn), "should do");
   u2 index = Bytes::get_native_u2(&code[2]);
 
   // Get the entry from the constant pool cache, and drop into
@@ -43,6 +43,15 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, UseRdtscNanoTime, false,                                \
+          "Derive os::javaTimeNanos() from the TSC on x86 processors " \
+          "that report an invariant TSC; may drift slowly against "     \
+          "the monotonic clock")                                        \
+                                                                        \
+  product(bool, UseThreadStackCache, false,                             \
+          "Cache and reuse Java thread stacks to reduce thread start "  \
+          "latency in workloads that create threads at a high rate")    \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
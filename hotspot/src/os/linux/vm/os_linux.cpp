@@ -66,6 +66,12 @@
 #include "utilities/elfFile.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/vmError.hpp"
+#ifdef TARGET_ARCH_x86
+# include "vm_version_x86.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_x86
+# include "os_linux_x86.inline.hpp"
+#endif
 
 // put OS-includes here
 # include <sys/types.h>
@@ -83,6 +89,7 @@
 # include <sys/stat.h>
 # include <sys/time.h>
 # include <sys/times.h>
+# include <time.h>
 # include <sys/utsname.h>
 # include <sys/socket.h>
 # include <sys/wait.h>
@@ -802,6 +809,114 @@ static bool _thread_safety_check(Thread* thread) {
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// thread stack cache
+//
+// With -XX:+UseThreadStackCache the stacks of exited Java threads are kept
+// on a free list and handed to subsequent pthread_create() calls via
+// pthread_attr_setstack(), avoiding the mmap/munmap round trip glibc does
+// for every thread when stacks fall out of its own (small) cache. Java
+// threads get no glibc guard page (see default_guard_size), so a plain
+// anonymous mapping is an exact replacement; the HotSpot guard pages are
+// created inside the stack by the new thread as usual.
+//
+// Threads running on a cached stack are created joinable instead of
+// detached. The exiting thread pushes its stack entry onto the retired
+// list as the very last thing it does in java_start(); the stack remains
+// in use until the thread has fully terminated, so the next thread to
+// pick the entry up joins the previous owner before reusing the memory.
+// All unmapping also happens in creator context, because a thread can
+// never unmap the stack it is still running on.
+
+struct CachedThreadStack {
+  CachedThreadStack* _next;
+  pthread_t          _tid;   // owner; joined before the stack is reused
+  char*              _base;  // low address of the mapping
+  size_t             _size;
+};
+
+static pthread_mutex_t _stack_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static CachedThreadStack* _live_stacks    = NULL;  // owner still running
+static CachedThreadStack* _retired_stacks = NULL;  // owner exited or exiting
+static int _retired_stack_count = 0;
+static const int retired_stack_limit = 64;
+
+// Take a retired stack of exactly the requested size off the cache, or
+// return NULL. Joins the previous owner, so on return the memory is idle.
+static char* stack_cache_acquire(size_t stack_size) {
+  CachedThreadStack* found = NULL;
+  pthread_mutex_lock(&_stack_cache_lock);
+  for (CachedThreadStack** p = &_retired_stacks; *p != NULL; p = &(*p)->_next) {
+    if ((*p)->_size == stack_size) {
+      found = *p;
+      *p = found->_next;
+      _retired_stack_count--;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&_stack_cache_lock);
+  if (found == NULL) {
+    return NULL;
+  }
+  pthread_join(found->_tid, NULL);
+  char* base = found->_base;
+  os::free(found, mtThread);
+  return base;
+}
+
+// Record a newly created thread on the live list. Must complete before the
+// thread can exit; the start handshake in os::create_thread guarantees
+// this, since the child blocks until os::start_thread() is called.
+static void stack_cache_note_live(CachedThreadStack* entry, char* base,
+                                  size_t size, pthread_t tid) {
+  entry->_tid  = tid;
+  entry->_base = base;
+  entry->_size = size;
+  pthread_mutex_lock(&_stack_cache_lock);
+  entry->_next = _live_stacks;
+  _live_stacks = entry;
+  pthread_mutex_unlock(&_stack_cache_lock);
+}
+
+// Move the current thread's stack entry, if it has one, from the live list
+// to the retired list. Called on thread exit; the entry is not reused
+// until the next creator has joined this thread.
+static void stack_cache_retire(pthread_t self) {
+  pthread_mutex_lock(&_stack_cache_lock);
+  for (CachedThreadStack** p = &_live_stacks; *p != NULL; p = &(*p)->_next) {
+    if (pthread_equal((*p)->_tid, self)) {
+      CachedThreadStack* entry = *p;
+      *p = entry->_next;
+      entry->_next = _retired_stacks;
+      _retired_stacks = entry;
+      _retired_stack_count++;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&_stack_cache_lock);
+}
+
+// Bound the cache: reap and unmap retired stacks beyond the limit. Runs in
+// creator context.
+static void stack_cache_trim() {
+  while (true) {
+    CachedThreadStack* victim = NULL;
+    pthread_mutex_lock(&_stack_cache_lock);
+    if (_retired_stack_count > retired_stack_limit) {
+      victim = _retired_stacks;
+      _retired_stacks = victim->_next;
+      _retired_stack_count--;
+    }
+    pthread_mutex_unlock(&_stack_cache_lock);
+    if (victim == NULL) {
+      return;
+    }
+    pthread_join(victim->_tid, NULL);
+    ::munmap(victim->_base, victim->_size);
+    os::free(victim, mtThread);
+  }
+}
+
 // Thread start routine for all newly created threads
 static void *java_start(Thread *thread) {
   // Try to randomize the cache line index of hot stack frames.
@@ -859,6 +974,12 @@ static void *java_start(Thread *thread) {
   // call one more level start routine
   thread->run();
 
+  // Retire a cached stack as the very last action; it stays in use until
+  // this thread has terminated, which the next user waits for.
+  if (UseThreadStackCache) {
+    stack_cache_retire(pthread_self());
+  }
+
   return 0;
 }
 
@@ -884,6 +1005,10 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
   pthread_attr_init(&attr);
   pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
 
+  // set when the thread runs on a stack from the stack cache
+  char* cached_stack = NULL;
+  CachedThreadStack* stack_entry = NULL;
+
   // stack size
   if (os::Linux::supports_variable_stack_size()) {
     // calculate stack size if it's not specified by caller
@@ -913,7 +1038,37 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
     }
 
     stack_size = MAX2(stack_size, os::Linux::min_stack_allowed);
-    pthread_attr_setstacksize(&attr, stack_size);
+
+    if (UseThreadStackCache && thr_type == java_thread && os::Linux::is_NPTL()) {
+      // pthread_attr_setstack requires a page aligned mapping
+      stack_size = align_size_up(stack_size, os::Linux::page_size());
+      stack_entry = (CachedThreadStack*)
+                       os::malloc(sizeof(CachedThreadStack), mtThread);
+      if (stack_entry != NULL) {
+        cached_stack = stack_cache_acquire(stack_size);
+        if (cached_stack == NULL) {
+          char* res = (char*) ::mmap(NULL, stack_size, PROT_READ|PROT_WRITE,
+                                     MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+          if (res != MAP_FAILED) {
+            cached_stack = res;
+          }
+        }
+        if (cached_stack == NULL) {
+          // fall back to a glibc allocated stack
+          os::free(stack_entry, mtThread);
+          stack_entry = NULL;
+        }
+      }
+      stack_cache_trim();
+    }
+
+    if (cached_stack != NULL) {
+      pthread_attr_setstack(&attr, cached_stack, stack_size);
+      // joinable, so the next user of this stack can wait for our exit
+      pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+    } else {
+      pthread_attr_setstacksize(&attr, stack_size);
+    }
   } else {
     // let pthread_create() pick the default value.
   }
@@ -940,6 +1095,10 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
         perror("pthread_create()");
       }
       // Need to clean up stuff we've allocated so far
+      if (cached_stack != NULL) {
+        ::munmap(cached_stack, stack_size);
+        os::free(stack_entry, mtThread);
+      }
       thread->set_osthread(NULL);
       delete osthread;
       if (lock) os::Linux::createThread_lock()->unlock();
@@ -949,6 +1108,10 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
     // Store pthread info into the OSThread
     osthread->set_pthread_id(tid);
 
+    if (stack_entry != NULL) {
+      stack_cache_note_live(stack_entry, cached_stack, stack_size, tid);
+    }
+
     // Wait until child thread is either initialized or aborted
     {
       Monitor* sync_with_child = osthread->startThread_lock();
@@ -1450,7 +1613,97 @@ void os::Linux::fast_thread_clock_init() {
   }
 }
 
+#if defined(IA32) || defined(AMD64)
+
+// TSC-based time for javaTimeNanos(). On processors which advertise an
+// invariant TSC the counter runs at a constant rate across power states
+// and is kept synchronized across cores by the hardware, so reading it
+// costs a single rdtsc instruction instead of a trip through the vDSO.
+// The rate is calibrated once against CLOCK_MONOTONIC and the result is
+// anchored to the monotonic reading taken during calibration, which
+// makes the switch-over continuous for earlier callers.
+
+static volatile bool _use_tsc_nano_time  = false;
+static jlong         _tsc_anchor_ticks   = 0;
+static jlong         _tsc_anchor_nanos   = 0;
+static double        _tsc_nanos_per_tick = 0.0;
+
+static inline jlong nanos_from_timespec(const struct timespec& tp) {
+  return jlong(tp.tv_sec) * (1000 * 1000 * 1000) + jlong(tp.tv_nsec);
+}
+
+void os::Linux::tsc_clock_init() {
+  if (!UseRdtscNanoTime) {
+    return;
+  }
+  if (!VM_Version::supports_tscinv() || !supports_monotonic_clock()) {
+    warning("UseRdtscNanoTime requires an invariant TSC and a monotonic "
+            "clock - falling back to clock_gettime");
+    UseRdtscNanoTime = false;
+    return;
+  }
+
+  // Measure the TSC rate against CLOCK_MONOTONIC over a couple of
+  // milliseconds. Each clock reading is bracketed by two rdtsc reads
+  // and the midpoints are used, which bounds the error introduced by
+  // the cost of the clock call itself.
+  struct timespec tp;
+  jlong t0a = os::rdtsc();
+  int status = Linux::clock_gettime(CLOCK_MONOTONIC, &tp);
+  assert(status == 0, "gettime error");
+  jlong t0b = os::rdtsc();
+  jlong nanos0 = nanos_from_timespec(tp);
+
+  jlong t1a, t1b, nanos1;
+  do {
+    struct timespec req;
+    req.tv_sec  = 0;
+    req.tv_nsec = NANOSECS_PER_MILLISEC;
+    ::nanosleep(&req, NULL);
+    t1a = os::rdtsc();
+    status = Linux::clock_gettime(CLOCK_MONOTONIC, &tp);
+    assert(status == 0, "gettime error");
+    t1b = os::rdtsc();
+    nanos1 = nanos_from_timespec(tp);
+  } while (nanos1 - nanos0 < 20 * NANOSECS_PER_MILLISEC);
+
+  jlong ticks = ((t1a + t1b) - (t0a + t0b)) / 2;
+  jlong nanos = nanos1 - nanos0;
+  if (ticks <= 0) {
+    warning("TSC did not advance during calibration - falling back to "
+            "clock_gettime");
+    UseRdtscNanoTime = false;
+    return;
+  }
+
+  _tsc_nanos_per_tick = (double) nanos / (double) ticks;
+  _tsc_anchor_ticks   = t1b;
+  _tsc_anchor_nanos   = nanos1;
+
+  // Publish the calibration before enabling the TSC path; other threads
+  // may already be calling javaTimeNanos().
+  OrderAccess::fence();
+  _use_tsc_nano_time = true;
+}
+
+#else
+
+void os::Linux::tsc_clock_init() {
+  if (UseRdtscNanoTime) {
+    warning("UseRdtscNanoTime is only supported on x86");
+    UseRdtscNanoTime = false;
+  }
+}
+
+#endif // defined(IA32) || defined(AMD64)
+
 jlong os::javaTimeNanos() {
+#if defined(IA32) || defined(AMD64)
+  if (_use_tsc_nano_time) {
+    jlong ticks = os::rdtsc() - _tsc_anchor_ticks;
+    return _tsc_anchor_nanos + (jlong)(ticks * _tsc_nanos_per_tick);
+  }
+#endif
   if (Linux::supports_monotonic_clock()) {
     struct timespec tp;
     int status = Linux::clock_gettime(CLOCK_MONOTONIC, &tp);
@@ -4942,6 +5195,10 @@ jint os::init_2(void)
 // this is called at the end of vm_initialization
 void os::init_3(void)
 {
+  // VM_Version is initialized by now, so we know whether the processor
+  // has an invariant TSC
+  Linux::tsc_clock_init();
+
 #ifdef JAVASE_EMBEDDED
   // Start the MemNotifyThread
   if (LowMemoryProtection) {
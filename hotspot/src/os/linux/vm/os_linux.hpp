@@ -200,6 +200,10 @@ class Linux {
   // Real-time clock functions
   static void clock_init(void);
 
+  // TSC-based time for javaTimeNanos(); requires VM_Version to be
+  // initialized, so it runs later than clock_init()
+  static void tsc_clock_init(void);
+
   // fast POSIX clocks support
   static void fast_thread_clock_init(void);
 
@@ -82,9 +82,11 @@ public:
       _resultStr(resultStr), _lchild(lchild), _rchild(rchild) { }
 
   MatchList  *get_next(void)  { return _next; }
+  void        set_next(MatchList *next) { _next = next; }
   char       *get_pred(void)  { return (_pred?_pred->_pred:NULL); }
   Predicate  *get_pred_obj(void)  { return _pred; }
   const char *get_cost(void) { return _cost == NULL ? "0" :_cost; }
+  void        set_cost(const char *cost) { _cost = cost; }
   bool        search(const char *opc, const char *res, const char *lch,
                     const char *rch, Predicate *pr);
 
@@ -233,6 +235,7 @@ public:
   void inspectInstructions();        // Build MatchLists for all operands
   void buildDFA(FILE *fp);           // Driver for constructing the DFA
   void gen_dfa_state_body(FILE *fp, Dict &minmize, ProductionState &status, Dict &chained, int i);    // Driver for constructing the DFA state bodies
+  void compact_dfa_state_body(FILE *fp, Dict &minmize, ProductionState &status, Dict &chained, int i); // Rewrites production runs as result tables
 
   // Helper utilities to generate reduction maps for internal operands
   const char *reduceLeft (char *internalName);
@@ -34,8 +34,10 @@ static const char *sLeft   = "_kids[0]";
 static const char *sRight  = "_kids[1]";
 
 //---------------------------DFA productions-----------------------------------
-static const char *dfa_production           = "DFA_PRODUCTION";
-static const char *dfa_production_set_valid = "DFA_PRODUCTION__SET_VALID";
+static const char *dfa_production                = "DFA_PRODUCTION";
+static const char *dfa_production_set_valid      = "DFA_PRODUCTION__SET_VALID";
+static const char *dfa_production_list           = "DFA_PRODUCTION_LIST";
+static const char *dfa_production_set_valid_list = "DFA_PRODUCTION__SET_VALID_LIST";
 
 //---------------------------Production State----------------------------------
 static const char *knownInvalid = "knownInvalid";    // The result does NOT have a rule defined
@@ -355,11 +357,67 @@ void ArchDesc::chain_rule(FILE *fp, const char *indent, const char *operand,
   }
 }
 
+//---------------------------matchlist_key-------------------------------------
+// Build a hash key from the inputs that determine whether two match list
+// entries compete for the same production: the result type, the child
+// types and the predicate. The rule and the cost are deliberately left
+// out; entries that agree on the key differ only in which rule wins the
+// cost check.
+static const char *matchlist_key(MatchList &mlist) {
+  const char *res  = mlist._resultStr ? mlist._resultStr : "";
+  const char *lch  = mlist._lchild    ? mlist._lchild    : "";
+  const char *rch  = mlist._rchild    ? mlist._rchild    : "";
+  const char *pred = mlist.get_pred() ? mlist.get_pred() : "";
+  char *key = new char[strlen(res) + strlen(lch) + strlen(rch) + strlen(pred) + 4];
+  sprintf(key, "%s|%s|%s|%s", res, lch, rch, pred);
+  return key;
+}
+
 //---------------------------prune_matchlist-----------------------------------
 // Check for duplicate entries in a matchlist, and prune out the higher cost
-// entry.
+// entry. Called with the head of the list for one ideal opcode; two entries
+// are duplicates when they produce the same result from the same child
+// types under the same predicate, in which case only the cheaper one can
+// ever win the cost check at run time and the other is dead code in the
+// generated DFA. Entries whose symbolic costs cannot be ordered statically
+// are both kept. The head entry is never unlinked; when a later duplicate
+// is cheaper its rule and cost move into the surviving entry.
 void ArchDesc::prune_matchlist(Dict &minimize, MatchList &mlist) {
-
+  minimize.Clear();
+  minimize.Insert(matchlist_key(mlist), &mlist);
+
+  MatchList *prev = &mlist;
+  MatchList *cur  = mlist.get_next();
+  while (cur != NULL) {
+    const char *key = matchlist_key(*cur);
+    MatchList *first = (MatchList*)minimize[key];
+    if (first == NULL) {
+      minimize.Insert(key, cur);
+      prev = cur;
+      cur  = cur->get_next();
+      continue;
+    }
+    delete[] key;
+
+    Expr *first_cost = new Expr(first->get_cost());
+    Expr *cur_cost   = new Expr(cur->get_cost());
+    if (strcmp(first->get_cost(), cur->get_cost()) == 0 ||
+        first_cost->less_than_or_equal(cur_cost)) {
+      // The surviving entry is no more expensive; 'cur' is dead code.
+    } else if (cur_cost->less_than_or_equal(first_cost)) {
+      // 'cur' is cheaper and would overwrite the earlier production at
+      // run time; keep its rule and cost in the surviving entry.
+      first->_opcode = cur->_opcode;
+      first->set_cost(cur->get_cost());
+    } else {
+      // The costs cannot be ordered statically; keep both entries.
+      prev = cur;
+      cur  = cur->get_next();
+      continue;
+    }
+    prev->set_next(cur->get_next());
+    cur = prev->get_next();
+  }
 }
 
 //---------------------------buildDFA------------------------------------------
@@ -408,6 +466,16 @@ void ArchDesc::buildDFA(FILE* fp) {
   fprintf(fp, "  %s( (result), (rule), (cost) ); STATE__SET_VALID( (result) );\n", dfa_production);
   fprintf(fp, "\n");
 
+  // Table-driven variants: apply one rule at one cost to a list of results.
+  // Emitted by compact_dfa_state_body for long production runs.
+  fprintf(fp, "#define %s(results, count, rule, cost)\\\n", dfa_production_list);
+  fprintf(fp, "  for (int _i = 0; _i < (count); _i++) { %s( (results)[_i], (rule), (cost) ); }\n", dfa_production);
+  fprintf(fp, "\n");
+
+  fprintf(fp, "#define %s(results, count, rule, cost)\\\n", dfa_production_set_valid_list);
+  fprintf(fp, "  for (int _i = 0; _i < (count); _i++) { %s( (results)[_i], (rule), (cost) ); }\n", dfa_production_set_valid);
+  fprintf(fp, "\n");
+
   fprintf(fp, "//------------------------- DFA --------------------------------------------\n");
 
   fprintf(fp,
@@ -429,7 +497,7 @@ void ArchDesc::buildDFA(FILE* fp) {
       // Generate the routine header statement for this opcode
       fprintf(fp, "void  State::_sub_Op_%s(const Node *n){\n", NodeClassNames[i]);
       // Generate body. Shared for both inline and out-of-line version
-      gen_dfa_state_body(fp, minimize, status, operands_chained_from, i);
+      compact_dfa_state_body(fp, minimize, status, operands_chained_from, i);
       // End of routine
       fprintf(fp, "}\n");
     }
@@ -447,7 +515,7 @@ void ArchDesc::buildDFA(FILE* fp) {
     } else {
       fprintf(fp, "  case Op_%s: {\n", NodeClassNames[i]);
       // Walk the list, compacting it
-      gen_dfa_state_body(fp, minimize, status, operands_chained_from, i);
+      compact_dfa_state_body(fp, minimize, status, operands_chained_from, i);
     }
     // Print the "break"
     fprintf(fp, "    break;\n");
@@ -594,23 +662,18 @@ void ArchDesc::gen_dfa_state_body(FILE* fp, Dict &minimize, ProductionState &sta
   // Start the body of each Op_XXX sub-dfa with a clean state.
   status.initialize();
 
-  // Walk the list, compacting it
-  MatchList* mList = _mlistab[i];
-  do {
-    // Hash each entry using inputs as key and pointer as data.
-    // If there is already an entry, keep the one with lower cost, and
-    // remove the other one from the list.
-    prune_matchlist(minimize, *mList);
-    // Iterate
-    mList = mList->get_next();
-  } while(mList != NULL);
+  // Walk the list, compacting it.
+  // Hash each entry using inputs as key and pointer as data.
+  // If there is already an entry, keep the one with lower cost, and
+  // remove the other one from the list.
+  prune_matchlist(minimize, *_mlistab[i]);
 
   // Hoist previously specified common sub-expressions out of predicates
   dfa_shared_preds::reset_found();
   dfa_shared_preds::cse_matchlist(_mlistab[i]);
   dfa_shared_preds::generate_cse(fp);
 
-  mList = _mlistab[i];
+  MatchList* mList = _mlistab[i];
 
   // Walk the list again, generating code
   do {
@@ -630,6 +693,138 @@ void ArchDesc::gen_dfa_state_body(FILE* fp, Dict &minimize, ProductionState &sta
 
 
 
+//---------------------------compact_dfa_state_body----------------------------
+// Post-process the code generated for one ideal opcode. Operand class
+// expansion and chain rules produce long straight-line runs of productions
+// that apply the same rule at the same cost to different results — e.g. one
+// line per register class an instruction result belongs to. Such runs are
+// rewritten into a small table of result indices walked by a loop
+// (DFA_PRODUCTION_LIST), which shrinks the matcher's text size without
+// changing the order or the effect of the productions. Lines that do not
+// parse as a bare production — guarded productions, cost computations,
+// braces — flush the current run and pass through unchanged.
+
+enum {
+  production_run_capacity  = 64,
+  production_run_threshold = 4,  // below this a table is not smaller
+  production_line_limit    = 256
+};
+
+struct ProductionRun {
+  char lines  [production_run_capacity][production_line_limit]; // original text
+  char results[production_run_capacity][production_line_limit];
+  char rule[production_line_limit];
+  char cost[production_line_limit];
+  bool set_valid;
+  int  length;
+};
+
+// Recognize "  DFA_PRODUCTION[__SET_VALID](result, rule, cost)" with nothing
+// but whitespace after the closing parenthesis.
+static bool parse_production(const char *line, char *result, char *rule,
+                             char *cost, bool *set_valid) {
+  const char *p = line;
+  while (*p == ' ') p++;
+  size_t sv_len = strlen(dfa_production_set_valid);
+  size_t pl_len = strlen(dfa_production);
+  if (strncmp(p, dfa_production_set_valid, sv_len) == 0 && p[sv_len] == '(') {
+    *set_valid = true;
+    p += sv_len + 1;
+  } else if (strncmp(p, dfa_production, pl_len) == 0 && p[pl_len] == '(') {
+    *set_valid = false;
+    p += pl_len + 1;
+  } else {
+    return false;
+  }
+  // The cost expression may not contain parentheses or commas; this keeps
+  // the parse unambiguous and is true for everything cost_check emits.
+  const char *comma1 = strchr(p, ',');
+  if (comma1 == NULL) return false;
+  const char *comma2 = strchr(comma1 + 1, ',');
+  if (comma2 == NULL) return false;
+  const char *close  = strchr(comma2 + 1, ')');
+  if (close == NULL || strchr(comma2 + 1, '(') != NULL) return false;
+  for (const char *t = close + 1; *t != '\0'; t++) {
+    if (*t != ' ' && *t != '\n' && *t != '\r') return false;
+  }
+  if ((comma1 - p) >= production_line_limit ||
+      (comma2 - comma1) >= production_line_limit ||
+      (close - comma2) >= production_line_limit) {
+    return false;
+  }
+  strncpy(result, p, comma1 - p);                 result[comma1 - p] = '\0';
+  const char *r = comma1 + 1; while (*r == ' ') r++;
+  strncpy(rule, r, comma2 - r);                   rule[comma2 - r] = '\0';
+  const char *c = comma2 + 1; while (*c == ' ') c++;
+  strncpy(cost, c, close - c);                    cost[close - c] = '\0';
+  return true;
+}
+
+static void flush_production_run(FILE *fp, ProductionRun *run) {
+  if (run->length == 0) return;
+  if (run->length < production_run_threshold) {
+    for (int i = 0; i < run->length; i++) {
+      fputs(run->lines[i], fp);
+    }
+  } else {
+    fprintf(fp, "      { static const int _results[] = { %s", run->results[0]);
+    for (int i = 1; i < run->length; i++) {
+      fprintf(fp, ", %s", run->results[i]);
+    }
+    fprintf(fp, " };\n");
+    fprintf(fp, "        %s(_results, %d, %s, %s) }\n",
+            run->set_valid ? dfa_production_set_valid_list : dfa_production_list,
+            run->length, run->rule, run->cost);
+  }
+  run->length = 0;
+}
+
+void ArchDesc::compact_dfa_state_body(FILE *fp, Dict &minimize,
+                                      ProductionState &status,
+                                      Dict &operands_chained_from, int i) {
+  FILE *tmp = tmpfile();
+  if (tmp == NULL) {
+    // No scratch file available; emit the uncompacted form.
+    gen_dfa_state_body(fp, minimize, status, operands_chained_from, i);
+    return;
+  }
+  gen_dfa_state_body(tmp, minimize, status, operands_chained_from, i);
+  rewind(tmp);
+
+  ProductionRun run;
+  run.length = 0;
+  char line[production_line_limit];
+  while (fgets(line, sizeof(line), tmp) != NULL) {
+    char result[production_line_limit];
+    char rule  [production_line_limit];
+    char cost  [production_line_limit];
+    bool set_valid;
+    if (parse_production(line, result, rule, cost, &set_valid)) {
+      if (run.length > 0 &&
+          (run.set_valid != set_valid ||
+           strcmp(run.rule, rule) != 0 ||
+           strcmp(run.cost, cost) != 0 ||
+           run.length == production_run_capacity)) {
+        flush_production_run(fp, &run);
+      }
+      if (run.length == 0) {
+        strcpy(run.rule, rule);
+        strcpy(run.cost, cost);
+        run.set_valid = set_valid;
+      }
+      strcpy(run.lines[run.length], line);
+      strcpy(run.results[run.length], result);
+      run.length++;
+    } else {
+      flush_production_run(fp, &run);
+      fputs(line, fp);
+    }
+  }
+  flush_production_run(fp, &run);
+  fclose(tmp);
+}
+
+
 //------------------------------Expr------------------------------------------
 Expr *Expr::_unknown_expr = NULL;
 char  Expr::string_buffer[STRING_BUFFER_LENGTH];
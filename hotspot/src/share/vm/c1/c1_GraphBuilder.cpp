@@ -983,7 +983,7 @@ void GraphBuilder::store_indexed(BasicType type) {
     // Note that we'd collect profile data in this method if we wanted it.
     compilation()->set_would_profile(true);
 
-    if (profile_checkcasts()) {
+    if (profile_checkcasts() && profile_scope()) {
       result->set_profiled_method(method());
       result->set_profiled_bci(bci());
       result->set_should_profile(true);
@@ -1170,7 +1170,7 @@ void GraphBuilder::_goto(int from_bci, int to_bci) {
   if (is_profiling()) {
     compilation()->set_would_profile(true);
     x->set_profiled_bci(bci());
-    if (profile_branches()) {
+    if (profile_branches() && profile_scope()) {
       x->set_profiled_method(method());
       x->set_should_profile(true);
     }
@@ -1199,7 +1199,7 @@ void GraphBuilder::if_node(Value x, If::Condition cond, Value y, ValueStack* sta
       compilation()->set_would_profile(true);
       // At level 2 we need the proper bci to count backedges
       if_node->set_profiled_bci(bci());
-      if (profile_branches()) {
+      if (profile_branches() && profile_scope()) {
         // Successors can be rotated by the canonicalizer, check for this case.
         if_node->set_profiled_method(method());
         if_node->set_should_profile(true);
@@ -1215,7 +1215,7 @@ void GraphBuilder::if_node(Value x, If::Condition cond, Value y, ValueStack* sta
     if (goto_node != NULL) {
       compilation()->set_would_profile(true);
       goto_node->set_profiled_bci(bci());
-      if (profile_branches()) {
+      if (profile_branches() && profile_scope()) {
         goto_node->set_profiled_method(method());
         goto_node->set_should_profile(true);
         // Find out which successor is used.
@@ -1472,9 +1472,10 @@ void GraphBuilder::method_return(Value x) {
       state()->push(x->type(), x);
       if (profile_return() && x->type()->is_object_kind()) {
         ciMethod* caller = state()->scope()->method();
+        // The caller may be a cold inlinee without a MethodData.
         ciMethodData* md = caller->method_data_or_null();
-        ciProfileData* data = md->bci_to_data(invoke_bci);
-        if (data->is_CallTypeData() || data->is_VirtualCallTypeData()) {
+        ciProfileData* data = (md == NULL) ? NULL : md->bci_to_data(invoke_bci);
+        if (data != NULL && (data->is_CallTypeData() || data->is_VirtualCallTypeData())) {
           bool has_return = data->is_CallTypeData() ? ((ciCallTypeData*)data)->has_return() : ((ciVirtualCallTypeData*)data)->has_return();
           // May not be true in case of an inlined call through a method handle intrinsic.
           if (has_return) {
@@ -2000,13 +2001,13 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
   }
 
   if (is_profiling()) {
-    if (recv != NULL && profile_calls()) {
+    if (recv != NULL && profile_calls() && profile_scope()) {
       null_check(recv);
     }
     // Note that we'd collect profile data in this method if we wanted it.
     compilation()->set_would_profile(true);
 
-    if (profile_calls()) {
+    if (profile_calls() && profile_scope()) {
       assert(cha_monomorphic_target == NULL || exact_target == NULL, "both can not be set");
       ciKlass* target_klass = NULL;
       if (cha_monomorphic_target != NULL) {
@@ -2090,7 +2091,7 @@ void GraphBuilder::check_cast(int klass_index) {
     // Note that we'd collect profile data in this method if we wanted it.
     compilation()->set_would_profile(true);
 
-    if (profile_checkcasts()) {
+    if (profile_checkcasts() && profile_scope()) {
       c->set_profiled_method(method());
       c->set_profiled_bci(bci());
       c->set_should_profile(true);
@@ -2111,7 +2112,7 @@ void GraphBuilder::instance_of(int klass_index) {
     // Note that we'd collect profile data in this method if we wanted it.
     compilation()->set_would_profile(true);
 
-    if (profile_checkcasts()) {
+    if (profile_checkcasts() && profile_scope()) {
       i->set_profiled_method(method());
       i->set_profiled_bci(bci());
       i->set_should_profile(true);
@@ -3563,7 +3564,7 @@ bool GraphBuilder::try_inline_intrinsics(ciMethod* callee) {
     if (callee != method()) {
       // Note that we'd collect profile data in this method if we wanted it.
       compilation()->set_would_profile(true);
-      if (profile_calls()) {
+      if (profile_calls() && profile_scope()) {
         Value recv = NULL;
         if (has_receiver) {
           recv = args->at(0);
@@ -3762,8 +3763,17 @@ bool GraphBuilder::try_inline_full(ciMethod* callee, bool holder_known, Bytecode
     INLINE_BAILOUT("caller and callee have different strict fp requirements");
   }
 
-  if (is_profiling() && !callee->ensure_method_data()) {
-    INLINE_BAILOUT("mdo allocation failed");
+  if (is_profiling()) {
+    if (C1InlineeProfileThreshold == 0 ||
+        callee->interpreter_invocation_count() >= C1InlineeProfileThreshold ||
+        callee->method_data_or_null() != NULL) {
+      if (!callee->ensure_method_data()) {
+        INLINE_BAILOUT("mdo allocation failed");
+      }
+    }
+    // else: the callee is too cold to pay for a MethodData; it is still
+    // inlined, but its scope emits no profiling (see profile_scope()) and
+    // its invocation counts keep accruing in its MethodCounters.
   }
 
   // now perform tests that are based on flag settings
@@ -3827,7 +3837,7 @@ bool GraphBuilder::try_inline_full(ciMethod* callee, bool holder_known, Bytecode
     // this may be redundant here...
     compilation()->set_would_profile(true);
 
-    if (profile_calls()) {
+    if (profile_calls() && profile_scope()) {
       int start = 0;
       Values* obj_args = args_list_for_profiling(callee, start, has_receiver);
       if (obj_args != NULL) {
@@ -4354,7 +4364,11 @@ void GraphBuilder::profile_return_type(Value ret, ciMethod* callee, ciMethod* m,
   if (invoke_bci < 0) {
     invoke_bci = bci();
   }
+  // The scope may belong to a cold inlinee without a MethodData.
   ciMethodData* md = m->method_data_or_null();
+  if (md == NULL) {
+    return;
+  }
   ciProfileData* data = md->bci_to_data(invoke_bci);
   if (data->is_CallTypeData() || data->is_VirtualCallTypeData()) {
     append(new ProfileReturnType(m , invoke_bci, callee, ret));
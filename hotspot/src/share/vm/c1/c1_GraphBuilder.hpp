@@ -389,6 +389,10 @@ class GraphBuilder VALUE_OBJ_CLASS_SPEC {
   bool profile_parameters()    { return _compilation->profile_parameters();    }
   bool profile_arguments()     { return _compilation->profile_arguments();     }
   bool profile_return()        { return _compilation->profile_return();        }
+  // Whether profiled instructions may be emitted in the current scope.
+  // Inlined scopes whose methods were too cold to be given a MethodData
+  // do not profile (see try_inline_full).
+  bool profile_scope()         { return method()->method_data_or_null() != NULL; }
 
   Values* args_list_for_profiling(ciMethod* target, int& start, bool may_have_receiver);
   Values* collect_args_for_profiling(Values* args, ciMethod* target, bool may_have_receiver);
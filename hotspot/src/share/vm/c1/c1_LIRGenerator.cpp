@@ -3329,9 +3329,19 @@ void LIRGenerator::increment_event_counter_impl(CodeEmitInfo* info,
   int level = _compilation->env()->comp_level();
   assert(level > CompLevel_simple, "Shouldn't be here");
 
+  // Cold inlinees are not given a MethodData by a profiled compilation
+  // (see GraphBuilder::try_inline_full); count them in their
+  // MethodCounters instead, like a limited-profile compilation would,
+  // so they can still trip the thresholds and be noticed.
+  ciMethodData* md = NULL;
+  if (level == CompLevel_full_profile) {
+    md = method->method_data_or_null();
+  }
+
   int offset = -1;
   LIR_Opr counter_holder;
-  if (level == CompLevel_limited_profile) {
+  if (level == CompLevel_limited_profile ||
+      (level == CompLevel_full_profile && md == NULL)) {
     MethodCounters* counters_adr = method->ensure_method_counters();
     if (counters_adr == NULL) {
       bailout("method counters allocation failed");
@@ -3345,8 +3355,6 @@ void LIRGenerator::increment_event_counter_impl(CodeEmitInfo* info,
     counter_holder = new_register(T_METADATA);
     offset = in_bytes(backedge ? MethodData::backedge_counter_offset() :
                                  MethodData::invocation_counter_offset());
-    ciMethodData* md = method->method_data_or_null();
-    assert(md != NULL, "Sanity");
     __ metadata2reg(md->constant_encoding(), counter_holder);
   } else {
     ShouldNotReachHere();
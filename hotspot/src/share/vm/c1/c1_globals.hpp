@@ -323,6 +323,10 @@
   product(bool, C1ProfileInlinedCalls, true,                                \
           "Profile inlined calls when generating code for updating MDOs")   \
                                                                             \
+  product(intx, C1InlineeProfileThreshold, 128,                             \
+          "Inlinees with fewer interpreter invocations than this are not "  \
+          "given a MethodData by a profiled compilation (0 = always)")      \
+                                                                            \
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
@@ -1066,6 +1066,37 @@ bool ciMethod::should_not_inline() {
   return CompilerOracle::should_not_inline(mh);
 }
 
+// ------------------------------------------------------------------
+// ciMethod::is_pure
+//
+// Is this method known to be free of side effects, with a result that
+// depends only on its arguments and the memory it reads?  Seeded with
+// well-known JDK accessors and extensible with the CompilerOracle
+// "pure" command.
+bool ciMethod::is_pure() {
+  check_is_loaded();
+  switch (intrinsic_id()) {
+  case vmIntrinsics::_booleanValue:
+  case vmIntrinsics::_byteValue:
+  case vmIntrinsics::_charValue:
+  case vmIntrinsics::_shortValue:
+  case vmIntrinsics::_intValue:
+  case vmIntrinsics::_longValue:
+  case vmIntrinsics::_floatValue:
+  case vmIntrinsics::_doubleValue:
+  case vmIntrinsics::_floatToRawIntBits:
+  case vmIntrinsics::_intBitsToFloat:
+  case vmIntrinsics::_doubleToRawLongBits:
+  case vmIntrinsics::_longBitsToDouble:
+    return true;
+  default:
+    break;
+  }
+  VM_ENTRY_MARK;
+  methodHandle mh(THREAD, get_Method());
+  return CompilerOracle::should_be_pure(mh);
+}
+
 // ------------------------------------------------------------------
 // ciMethod::should_print_assembly
 //
@@ -260,6 +260,7 @@ class ciMethod : public ciMetadata {
   bool should_exclude();
   bool should_inline();
   bool should_not_inline();
+  bool is_pure();
   bool should_print_assembly();
   bool break_at_execute();
   bool has_option(const char *option);
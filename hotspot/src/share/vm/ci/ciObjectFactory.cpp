@@ -40,12 +40,14 @@
 #include "ci/ciTypeArray.hpp"
 #include "ci/ciTypeArrayKlass.hpp"
 #include "ci/ciUtilities.hpp"
+#include "classfile/classLoaderData.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "gc_interface/collectedHeap.inline.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/oop.inline2.hpp"
 #include "runtime/fieldType.hpp"
+#include "runtime/mutexLocker.hpp"
 
 // ciObjectFactory
 //
@@ -118,6 +120,18 @@ void ciObjectFactory::initialize() {
 
 }
 
+// Support for CIPreMirrorBootClasses: the dictionary walk collects the
+// bootstrap classes first, so that SystemDictionary_lock is not held
+// while the mirrors are created.
+static GrowableArray<Klass*>* _premirror_klasses = NULL;
+
+static void collect_boot_klass(Klass* k, ClassLoaderData* cld) {
+  if (cld->is_the_null_class_loader_data() &&
+      k->oop_is_instance() && InstanceKlass::cast(k)->is_loaded()) {
+    _premirror_klasses->append(k);
+  }
+}
+
 void ciObjectFactory::init_shared_objects() {
 
   _next_ident = 1;  // start numbering CI objects at 1
@@ -162,6 +176,24 @@ void ciObjectFactory::init_shared_objects() {
   WK_KLASSES_DO(WK_KLASS_DEFN)
 #undef WK_KLASS_DEFN
 
+  if (CIPreMirrorBootClasses) {
+    // Extend the shared set beyond the well-known classes: mirror every
+    // bootstrap class loaded so far, so steady-state compilations stop
+    // re-creating identical ciInstanceKlasses for the core library.
+    // Bootstrap classes are never unloaded, and mutable state of shared
+    // mirrors is re-read from the VM on access, so the mirrors stay
+    // valid across compilations and class redefinition.
+    _premirror_klasses = new GrowableArray<Klass*>(256);
+    {
+      MutexLocker ml(SystemDictionary_lock);
+      SystemDictionary::classes_do(collect_boot_klass);
+    }
+    for (int i = 0; i < _premirror_klasses->length(); i++) {
+      get_metadata(_premirror_klasses->at(i));
+    }
+    _premirror_klasses = NULL;
+  }
+
   for (int len = -1; len != _ci_metadata->length(); ) {
     len = _ci_metadata->length();
     for (int i2 = 0; i2 < len; i2++) {
@@ -31,6 +31,9 @@
 #include "memory/resourceArea.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/macros.hpp"
+#ifdef COMPILER2
+#include "opto/phase.hpp"
+#endif
 
 #ifndef PRODUCT
 
@@ -429,8 +432,30 @@ class CompileReplay : public StackObj {
       nm->make_not_entrant();
     }
     replay_state = this;
+#ifdef COMPILER2
+    Phase::TimerSnapshot phases_before;
+#endif
+    elapsedTimer timer;
+    timer.start();
     CompileBroker::compile_method(method, entry_bci, comp_level,
                                   methodHandle(), 0, "replay", THREAD);
+    timer.stop();
+    if (ReplayTiming) {
+      // One greppable line per compilation so successive replay runs of
+      // the same corpus can be diffed for compile-time regressions.
+      // Run with -Xbatch so the elapsed time covers the compilation.
+      ResourceMark rm;
+      tty->print("replay_compile %s level %d elapsed %1.4f",
+                 method->name_and_sig_as_C_string(), comp_level, timer.seconds());
+#ifdef COMPILER2
+      if (comp_level == CompLevel_full_optimization) {
+        Phase::TimerSnapshot phases_after;
+        tty->print(" ");
+        phases_after.print_delta_on(tty, phases_before);
+      }
+#endif
+      tty->cr();
+    }
     replay_state = NULL;
     reset();
   }
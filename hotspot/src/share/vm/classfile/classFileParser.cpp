@@ -60,6 +60,7 @@
 #include "services/threadService.hpp"
 #include "utilities/array.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/stringUtils.hpp"
 
 // We generally try to create the oops directly when parsing, rather than
 // allocating temporary data structures and copying the bytes twice. A
@@ -3315,6 +3316,98 @@ void ClassFileParser::layout_fields(Handle class_loader,
   int nonstatic_short_space_offset;
   int nonstatic_byte_space_offset;
 
+  int nonstatic_supergap_word_space_count  = 0;
+  int nonstatic_supergap_short_space_count = 0;
+  int nonstatic_supergap_byte_space_count  = 0;
+  int nonstatic_supergap_word_space_offset;
+  int nonstatic_supergap_short_space_offset;
+  int nonstatic_supergap_byte_space_offset;
+
+  // Try to squeeze small fields into the alignment gap left after the
+  // last superclass field.  The superclass instance size is rounded up
+  // to a whole heap word, so up to (heapOopSize - 1) bytes may be free
+  // before nonstatic_fields_start; packing subclass fields there keeps
+  // instances on fewer cache lines.  Only non-oop fields are placed in
+  // the gap so the oop maps are not affected.  The gap is computed from
+  // the field information of the super chain alone, so the resulting
+  // layout stays deterministic and CDS-archivable.
+  if (compact_fields && !is_contended_class && super_has_nonstatic_fields) {
+    int super_end = instanceOopDesc::base_offset_in_bytes();
+    bool super_is_contended = false;
+    for (InstanceKlass* ik = _super_klass(); ik != NULL; ik = ik->superklass()) {
+      if (ik->is_contended()) {
+        super_is_contended = true;
+        break;
+      }
+      for (AllFieldStream fs(ik); !fs.done(); fs.next()) {
+        if (fs.access_flags().is_static()) continue;
+        if (fs.is_contended()) {
+          super_is_contended = true;
+          break;
+        }
+        BasicType bt = FieldType::basic_type(fs.signature());
+        int field_size = (bt == T_OBJECT || bt == T_ARRAY) ? heapOopSize
+                                                           : type2aelembytes(bt);
+        int field_end = fs.offset() + field_size;
+        if (field_end > super_end) super_end = field_end;
+      }
+      if (super_is_contended) break;
+    }
+    // Never pack into padding that @Contended asked for.
+    if (!super_is_contended && super_end < nonstatic_fields_start) {
+      int offset = super_end;
+      int length = nonstatic_fields_start - super_end;
+      // A leading byte and/or short brings us to int alignment.
+      nonstatic_supergap_byte_space_offset = offset;
+      if ((offset & (BytesPerShort - 1)) != 0 && nonstatic_byte_count > 0) {
+        nonstatic_byte_count                -= 1;
+        nonstatic_supergap_byte_space_count += 1;
+        offset += 1;
+        length -= 1;
+      }
+      nonstatic_supergap_short_space_offset = offset;
+      if ((offset & (BytesPerShort - 1)) == 0 &&
+          (offset & (BytesPerInt - 1)) != 0 &&
+          length >= BytesPerShort && nonstatic_short_count > 0) {
+        nonstatic_short_count                -= 1;
+        nonstatic_supergap_short_space_count += 1;
+        offset += BytesPerShort;
+        length -= BytesPerShort;
+      }
+      if ((offset & (BytesPerInt - 1)) == 0) {
+        nonstatic_supergap_word_space_offset = offset;
+        while (length >= BytesPerInt && nonstatic_word_count > 0) {
+          nonstatic_word_count                -= 1;
+          nonstatic_supergap_word_space_count += 1;
+          offset += BytesPerInt;
+          length -= BytesPerInt;
+        }
+      }
+      // The tail of the gap can still take shorts or bytes, but only if
+      // the corresponding run did not already start earlier in the gap -
+      // each size class gets a single contiguous run.
+      if (nonstatic_supergap_short_space_count == 0 &&
+          (offset & (BytesPerShort - 1)) == 0) {
+        nonstatic_supergap_short_space_offset = offset;
+        while (length >= BytesPerShort && nonstatic_short_count > 0) {
+          nonstatic_short_count                -= 1;
+          nonstatic_supergap_short_space_count += 1;
+          offset += BytesPerShort;
+          length -= BytesPerShort;
+        }
+      }
+      if (nonstatic_supergap_byte_space_count == 0) {
+        nonstatic_supergap_byte_space_offset = offset;
+        while (length > 0 && nonstatic_byte_count > 0) {
+          nonstatic_byte_count                -= 1;
+          nonstatic_supergap_byte_space_count += 1;
+          offset += 1;
+          length -= 1;
+        }
+      }
+    }
+  }
+
   // Try to squeeze some of the fields into the gaps due to
   // long/double alignment.
   if( nonstatic_double_count > 0 ) {
@@ -3440,7 +3533,11 @@ void ClassFileParser::layout_fields(Handle class_loader,
         }
         break;
       case NONSTATIC_BYTE:
-        if( nonstatic_byte_space_count > 0 ) {
+        if( nonstatic_supergap_byte_space_count > 0 ) {
+          real_offset = nonstatic_supergap_byte_space_offset;
+          nonstatic_supergap_byte_space_offset += 1;
+          nonstatic_supergap_byte_space_count  -= 1;
+        } else if( nonstatic_byte_space_count > 0 ) {
           real_offset = nonstatic_byte_space_offset;
           nonstatic_byte_space_offset += 1;
           nonstatic_byte_space_count  -= 1;
@@ -3450,7 +3547,11 @@ void ClassFileParser::layout_fields(Handle class_loader,
         }
         break;
       case NONSTATIC_SHORT:
-        if( nonstatic_short_space_count > 0 ) {
+        if( nonstatic_supergap_short_space_count > 0 ) {
+          real_offset = nonstatic_supergap_short_space_offset;
+          nonstatic_supergap_short_space_offset += BytesPerShort;
+          nonstatic_supergap_short_space_count  -= 1;
+        } else if( nonstatic_short_space_count > 0 ) {
           real_offset = nonstatic_short_space_offset;
           nonstatic_short_space_offset += BytesPerShort;
           nonstatic_short_space_count  -= 1;
@@ -3460,7 +3561,11 @@ void ClassFileParser::layout_fields(Handle class_loader,
         }
         break;
       case NONSTATIC_WORD:
-        if( nonstatic_word_space_count > 0 ) {
+        if( nonstatic_supergap_word_space_count > 0 ) {
+          real_offset = nonstatic_supergap_word_space_offset;
+          nonstatic_supergap_word_space_offset += BytesPerInt;
+          nonstatic_supergap_word_space_count  -= 1;
+        } else if( nonstatic_word_space_count > 0 ) {
           real_offset = nonstatic_word_space_offset;
           nonstatic_word_space_offset += BytesPerInt;
           nonstatic_word_space_count  -= 1;
@@ -4967,27 +5072,25 @@ int ClassFileParser::verify_legal_method_signature(Symbol* name, Symbol* signatu
 // calling this method in verify_legal_method_name.
 bool ClassFileParser::verify_unqualified_name(
     char* name, unsigned int length, int type) {
-  jchar ch;
-
-  for (char* p = name; p != name + length; ) {
-    ch = *p;
-    if (ch < 128) {
-      p++;
-      if (ch == '.' || ch == ';' || ch == '[' ) {
-        return false;   // do not permit '.', ';', or '['
-      }
-      if (type != LegalClass && ch == '/') {
-        return false;   // do not permit '/' unless it's class name
-      }
-      if (type == LegalMethod && (ch == '<' || ch == '>')) {
-        return false;   // do not permit '<' or '>' in method names
-      }
-    } else {
-      char* tmp_p = UTF8::next(p, &ch);
-      p = tmp_p;
-    }
+  // All forbidden characters are ASCII, and none of their byte values
+  // can occur inside a multi-byte UTF8 sequence (every byte of such a
+  // sequence has its high bit set), so scanning the raw bytes is
+  // equivalent to decoding the string first.  '.', ';' and '[' are
+  // never permitted; '/' only in class names; '<' and '>' are rejected
+  // in method names only.
+  const char* stops;
+  int nstops;
+  if (type == LegalClass) {
+    stops = ".;[";
+    nstops = 3;
+  } else if (type == LegalMethod) {
+    stops = ".;[/<>";
+    nstops = 6;
+  } else {
+    stops = ".;[/";
+    nstops = 4;
   }
-  return true;
+  return StringUtils::find_first_of(name, length, stops, nstops) == NULL;
 }
 
 
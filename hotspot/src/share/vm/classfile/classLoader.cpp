@@ -59,6 +59,7 @@
 #include "utilities/events.hpp"
 #include "utilities/hashtable.hpp"
 #include "utilities/hashtable.inline.hpp"
+#include "utilities/stringUtils.hpp"
 #ifdef TARGET_OS_FAMILY_linux
 # include "os_linux.inline.hpp"
 #endif
@@ -227,10 +228,42 @@ ClassFileStream* ClassPathDirEntry::open_stream(const char* name, TRAPS) {
 }
 
 
+ZipPackageIndex::~ZipPackageIndex() {
+  for (int i = 0; i < _num_packages; i++) {
+    FREE_C_HEAP_ARRAY(char, _packages[i], mtClass);
+  }
+  FREE_C_HEAP_ARRAY(char*, _packages, mtClass);
+}
+
+bool ZipPackageIndex::may_contain(const char* name) {
+  const char* slash = strrchr(name, '/');
+  int len = (slash == NULL) ? 0 : (int)(slash - name + 1);
+  int lo = 0;
+  int hi = _num_packages - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    const char* pkg = _packages[mid];
+    int cmp = strncmp(pkg, name, len);
+    if (cmp == 0) {
+      // pkg is either the prefix itself or extends past it
+      cmp = (pkg[len] == '\0') ? 0 : 1;
+    }
+    if (cmp == 0) {
+      return true;
+    } else if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return false;
+}
+
 ClassPathZipEntry::ClassPathZipEntry(jzfile* zip, const char* zip_name) : ClassPathEntry() {
   _zip = zip;
   _zip_name = NEW_C_HEAP_ARRAY(char, strlen(zip_name)+1, mtClass);
   strcpy(_zip_name, zip_name);
+  _package_index = NULL;
 }
 
 ClassPathZipEntry::~ClassPathZipEntry() {
@@ -238,9 +271,85 @@ ClassPathZipEntry::~ClassPathZipEntry() {
     (*ZipClose)(_zip);
   }
   FREE_C_HEAP_ARRAY(char, _zip_name, mtClass);
+  if (_package_index != NULL) {
+    delete (ZipPackageIndex*)_package_index;
+  }
+}
+
+static int package_name_compare(char** a, char** b) {
+  return strcmp(*a, *b);
+}
+
+// Collect the distinct directory prefixes from the central directory and
+// publish them as a ZipPackageIndex. The zip library keeps the central
+// directory in memory, so this is one cheap pass per archive. Racing
+// builders are resolved like LazyClassPathEntry::resolve_entry: first
+// publication under ThreadCritical wins, the loser is deleted.
+void ClassPathZipEntry::build_package_index() {
+  JavaThread* thread = JavaThread::current();
+  ResourceMark rm(thread);
+  GrowableArray<char*>* prefixes = new GrowableArray<char*>(128);
+  {
+    ThreadToNativeFromVM ttn(thread);
+    for (int n = 0; ; n++) {
+      jzentry* ze = ((*GetNextEntry)(_zip, n));
+      if (ze == NULL) break;
+      const char* slash = strrchr(ze->name, '/');
+      int len = (slash == NULL) ? 0 : (int)(slash - ze->name + 1);
+      // Entries of one directory are usually adjacent, so comparing
+      // against the last prefix removes most duplicates before sorting.
+      if (prefixes->length() > 0) {
+        char* last = prefixes->at(prefixes->length() - 1);
+        if (strncmp(last, ze->name, len) == 0 && last[len] == '\0') {
+          continue;
+        }
+      }
+      char* pkg = NEW_RESOURCE_ARRAY(char, len + 1);
+      memcpy(pkg, ze->name, len);
+      pkg[len] = '\0';
+      prefixes->append(pkg);
+    }
+  }
+  prefixes->sort(package_name_compare);
+
+  int num_packages = 0;
+  char** packages = NEW_C_HEAP_ARRAY(char*, MAX2(prefixes->length(), 1), mtClass);
+  for (int i = 0; i < prefixes->length(); i++) {
+    char* pkg = prefixes->at(i);
+    if (i > 0 && strcmp(pkg, prefixes->at(i - 1)) == 0) {
+      continue;  // duplicate
+    }
+    char* copy = NEW_C_HEAP_ARRAY(char, strlen(pkg) + 1, mtClass);
+    strcpy(copy, pkg);
+    packages[num_packages++] = copy;
+  }
+  ZipPackageIndex* index = new ZipPackageIndex(num_packages, packages);
+  {
+    ThreadCritical tc;
+    if (_package_index == NULL) {
+      _package_index = index;
+      return;
+    }
+  }
+  delete index;
+}
+
+bool ClassPathZipEntry::may_contain(const char* name) {
+  if (!UseClassPathIndex) {
+    return true;
+  }
+  if (_package_index == NULL) {
+    build_package_index();
+  }
+  return ((ZipPackageIndex*)_package_index)->may_contain(name);
 }
 
 ClassFileStream* ClassPathZipEntry::open_stream(const char* name, TRAPS) {
+  // Reject lookups that cannot succeed before transitioning to native
+  // and calling into the zip library.
+  if (!may_contain(name)) {
+    return NULL;
+  }
   // enable call to C land
   JavaThread* thread = JavaThread::current();
   ThreadToNativeFromVM ttn(thread);
@@ -1252,7 +1361,7 @@ bool ClassPathZipEntry::is_rt_jar13() {
   // Check whether zip name ends in "rt.jar"
   // This will match other archives named rt.jar as well, but this is
   // only used for debugging.
-  return (len >= 6) && (strcasecmp(zip->name + len - 6, "rt.jar") == 0);
+  return (len >= 6) && StringUtils::equals_ignore_case_ascii(zip->name + len - 6, "rt.jar", 6);
 }
 
 // JDK 1.2 version
@@ -1262,7 +1371,7 @@ bool ClassPathZipEntry::is_rt_jar12() {
   // Check whether zip name ends in "rt.jar"
   // This will match other archives named rt.jar as well, but this is
   // only used for debugging.
-  return (len >= 6) && (strcasecmp(zip->name + len - 6, "rt.jar") == 0);
+  return (len >= 6) && StringUtils::equals_ignore_case_ascii(zip->name + len - 6, "rt.jar", 6);
 }
 
 void LazyClassPathEntry::compile_the_world(Handle loader, TRAPS) {
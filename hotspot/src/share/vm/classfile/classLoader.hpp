@@ -98,10 +98,28 @@ typedef struct {
 } jzentry;
 
 
+// Sorted list of the directory prefixes present in a zip archive, so a
+// lookup that cannot succeed is rejected with a binary search instead of
+// a call into the zip library. Built once from the central directory and
+// immutable afterwards.
+class ZipPackageIndex: public CHeapObj<mtClass> {
+ private:
+  int    _num_packages;
+  char** _packages;     // sorted C-heap copies, e.g. "java/lang/"
+ public:
+  ZipPackageIndex(int num_packages, char** packages)
+    : _num_packages(num_packages), _packages(packages) {}
+  ~ZipPackageIndex();
+  bool may_contain(const char* name);
+};
+
 class ClassPathZipEntry: public ClassPathEntry {
  private:
   jzfile* _zip;        // The zip archive
   char*   _zip_name;   // Name of zip archive
+  volatile ZipPackageIndex* _package_index;  // built on first lookup
+  void build_package_index();
+  bool may_contain(const char* name);
  public:
   bool is_jar_file()  { return true;  }
   const char* name()  { return _zip_name; }
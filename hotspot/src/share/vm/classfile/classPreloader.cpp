@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classPreloader.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "memory/resourceArea.hpp"
+#include "prims/jvm.h"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+
+GrowableArray<const char*>* ClassPreloader::_class_names = NULL;
+volatile jint               ClassPreloader::_next_class  = 0;
+
+void ClassPreloader::preload_thread_entry(JavaThread* thread, TRAPS) {
+  HandleMark hm(THREAD);
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  for (;;) {
+    jint i = Atomic::add(1, &_next_class) - 1;
+    if (i >= _class_names->length()) {
+      break;
+    }
+    const char* name = _class_names->at(i);
+    TempNewSymbol class_name = SymbolTable::new_symbol(name, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    // resolve_or_null loads and parses the class but does not link it;
+    // linking still happens on the application thread at first use.
+    Klass* k = SystemDictionary::resolve_or_null(class_name, loader, Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    if (TraceClassLoading && Verbose && k == NULL) {
+      ResourceMark rm(THREAD);
+      tty->print_cr("[Preload failed: %s]", name);
+    }
+  }
+}
+
+void ClassPreloader::start_preload_thread(int id, TRAPS) {
+  Klass* k = SystemDictionary::resolve_or_fail(vmSymbols::java_lang_Thread(), true, CHECK);
+  instanceKlassHandle klass(THREAD, k);
+  instanceHandle thread_oop = klass->allocate_instance_handle(CHECK);
+
+  char thread_name[32];
+  jio_snprintf(thread_name, sizeof(thread_name), "Class Preloader #%d", id);
+  Handle string = java_lang_String::create_from_str(thread_name, CHECK);
+
+  // Initialize thread_oop to put it into the system threadGroup
+  Handle thread_group(THREAD, Universe::system_thread_group());
+  JavaValue result(T_VOID);
+  JavaCalls::call_special(&result, thread_oop,
+                          klass,
+                          vmSymbols::object_initializer_name(),
+                          vmSymbols::threadgroup_string_void_signature(),
+                          thread_group,
+                          string,
+                          CHECK);
+
+  KlassHandle group(THREAD, SystemDictionary::ThreadGroup_klass());
+  JavaCalls::call_special(&result,
+                          thread_group,
+                          group,
+                          vmSymbols::add_method_name(),
+                          vmSymbols::thread_void_signature(),
+                          thread_oop,             // ARG 1
+                          CHECK);
+
+  { MutexLocker mu(Threads_lock);
+    JavaThread* preload_thread = new JavaThread(&preload_thread_entry);
+
+    // Check that thread and osthread were created
+    if (preload_thread == NULL || preload_thread->osthread() == NULL) {
+      vm_exit_during_initialization("java.lang.OutOfMemoryError",
+                                    "unable to create new native thread");
+    }
+
+    java_lang_Thread::set_thread(thread_oop(), preload_thread);
+    java_lang_Thread::set_daemon(thread_oop());
+
+    preload_thread->set_threadObj(thread_oop());
+    Threads::add(preload_thread);
+    Thread::start(preload_thread);
+  }
+}
+
+void ClassPreloader::start(TRAPS) {
+  assert(ClassPreloadFile != NULL, "should not be called otherwise");
+  FILE* file = fopen(ClassPreloadFile, "r");
+  if (file == NULL) {
+    warning("Could not open ClassPreloadFile %s", ClassPreloadFile);
+    return;
+  }
+
+  _class_names = new (ResourceObj::C_HEAP, mtClass) GrowableArray<const char*>(1024, true, mtClass);
+  char line[1024];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (line[0] == '#') {
+      continue;
+    }
+    // Strip the trailing newline and convert dotted names to slashed form
+    size_t len = strlen(line);
+    while (len > 0 && (line[len-1] == '\n' || line[len-1] == '\r' || line[len-1] == ' ')) {
+      line[--len] = '\0';
+    }
+    if (len == 0) {
+      continue;
+    }
+    char* name = NEW_C_HEAP_ARRAY(char, len + 1, mtClass);
+    for (size_t i = 0; i <= len; i++) {
+      name[i] = (line[i] == '.') ? '/' : line[i];
+    }
+    _class_names->append(name);
+  }
+  fclose(file);
+
+  if (_class_names->length() == 0) {
+    return;
+  }
+
+  int nthreads = MIN2((int)ClassPreloadThreads, _class_names->length());
+  for (int i = 0; i < MAX2(nthreads, 1); i++) {
+    start_preload_thread(i, CHECK);
+  }
+}
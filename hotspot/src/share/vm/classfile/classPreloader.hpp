@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
+#define SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/growableArray.hpp"
+
+// Background class preloading (-XX:ClassPreloadFile=<file>).
+//
+// The file names one class per line (slashed or dotted form, '#' starts
+// a comment). After the VM is up, ClassPreloadThreads daemon threads
+// claim names from the list and resolve them through the system
+// dictionary with the system class loader, so class file reading and
+// parsing happen ahead of the application's first use. Linking
+// (verification, rewriting) still happens on demand. The system
+// dictionary placeholder protocol already serializes concurrent loads
+// of the same class and permits concurrent loads of distinct classes,
+// so the workers need no coordination beyond the claim index.
+
+class ClassPreloader : AllStatic {
+ private:
+  static GrowableArray<const char*>* _class_names;  // C-heap copies of the list entries
+  static volatile jint               _next_class;   // next list index to claim
+
+  static void preload_thread_entry(JavaThread* thread, TRAPS);
+  static void start_preload_thread(int id, TRAPS);
+
+ public:
+  // Read ClassPreloadFile and start the preload threads.
+  static void start(TRAPS);
+};
+
+#endif // SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
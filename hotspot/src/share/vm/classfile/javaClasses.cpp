@@ -1582,7 +1582,10 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, methodHandle met
           method = nm->method();
           bci = 0;
         } else {
-          PcDesc* pd = nm->pc_desc_at(pc);
+          // Repeated throws from the same compiled site (common in
+          // exception-heavy frameworks) hit the thread-local memo and skip
+          // the search through the nmethod's shared PcDesc cache.
+          PcDesc* pd = thread->pc_desc_at_with_memo(nm, pc);
           decode_offset = pd->scope_decode_offset();
           // if decode_offset is not equal to 0, it will execute the
           // "compiled java method case" at the beginning of the loop.
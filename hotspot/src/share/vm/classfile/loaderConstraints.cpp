@@ -431,7 +431,7 @@ void LoaderConstraintTable::merge_loader_constraints(
 void LoaderConstraintTable::verify(Dictionary* dictionary,
                                    PlaceholderTable* placeholders) {
   Thread *thread = Thread::current();
-  for (int cindex = 0; cindex < _loader_constraint_size; cindex++) {
+  for (int cindex = 0; cindex < table_size(); cindex++) {
     for (LoaderConstraintEntry* probe = bucket(cindex);
                                 probe != NULL;
                                 probe = probe->next()) {
@@ -475,8 +475,8 @@ void LoaderConstraintTable::print() {
   ResourceMark rm;
 
   assert_locked_or_safepoint(SystemDictionary_lock);
-  tty->print_cr("Java loader constraints (entries=%d)", _loader_constraint_size);
-  for (int cindex = 0; cindex < _loader_constraint_size; cindex++) {
+  tty->print_cr("Java loader constraints (entries=%d)", table_size());
+  for (int cindex = 0; cindex < table_size(); cindex++) {
     for (LoaderConstraintEntry* probe = bucket(cindex);
                                 probe != NULL;
                                 probe = probe->next()) {
@@ -48,7 +48,10 @@ MetadataOnStackMark::MetadataOnStackMark() {
     _marked_objects = new (ResourceObj::C_HEAP, mtClass) GrowableArray<Metadata*>(1000, true);
   }
   Threads::metadata_do(Metadata::mark_on_stack);
-  CodeCache::alive_nmethods_do(nmethod::mark_on_stack);
+  // Use the incrementally maintained nmethod list rather than walking the
+  // code cache blob by blob; with large code caches the heap walk dominates
+  // the redefinition pause.
+  CodeCache::registered_nmethods_do(nmethod::mark_on_stack);
   CompileBroker::mark_on_stack();
   JvmtiCurrentBreakpoints::metadata_do(Metadata::mark_on_stack);
   ThreadService::metadata_do(Metadata::mark_on_stack);
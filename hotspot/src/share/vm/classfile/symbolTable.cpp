@@ -42,6 +42,7 @@ SymbolTable* SymbolTable::_the_table = NULL;
 // Static arena for symbols that are not deallocated
 Arena* SymbolTable::_arena = NULL;
 bool SymbolTable::_needs_rehashing = false;
+bool SymbolTable::_needs_resizing = false;
 
 Symbol* SymbolTable::allocate_symbol(const u1* name, int len, bool c_heap, TRAPS) {
   assert (len <= Symbol::max_length(), "should be checked by caller");
@@ -150,6 +151,28 @@ void SymbolTable::rehash_table() {
   _the_table = new_table;
 }
 
+// Create a table with roughly twice as many buckets and move the entries
+// over, keeping their existing hash values. Lookups run lock-free, so the
+// table can only be replaced at a safepoint; the old bucket array is freed
+// but the entries themselves are reused.
+void SymbolTable::grow_table() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // This should never happen with -Xshare:dump but it might in testing mode.
+  if (DumpSharedSpaces) return;
+
+  // Keep the bucket count odd, the default sizes are primes and an even
+  // modulus would throw away a hash bit.
+  SymbolTableSize = the_table()->table_size() * 2 + 1;
+  SymbolTable* new_table = new SymbolTable();
+
+  the_table()->resize_to(new_table);
+
+  // Delete the table and buckets (entries are reused in new table).
+  delete _the_table;
+  _needs_resizing = false;
+  _the_table = new_table;
+}
+
 // Lookup a symbol in a bucket.
 
 Symbol* SymbolTable::lookup(int index, const char* name,
@@ -339,6 +362,22 @@ Symbol* SymbolTable::new_permanent_symbol(const char* name, TRAPS) {
   return table->basic_add(index, (u1*)name, (int)strlen(name), hash, false, THREAD);
 }
 
+void SymbolTable::new_permanent_symbols(const char* bodies, int count,
+                                        Symbol** out, TRAPS) {
+  // Grab SymbolTable_lock once for the whole batch.
+  MutexLocker ml(SymbolTable_lock, THREAD);
+
+  SymbolTable* table = the_table();
+  const char* string = bodies;
+  for (int i = 0; i < count; i++) {
+    int len = (int)strlen(string);
+    unsigned int hash = hash_symbol(string, len);
+    int index = table->hash_to_index(hash);
+    out[i] = table->basic_add(index, (u1*)string, len, hash, false, CHECK);
+    string += len + 1;
+  }
+}
+
 Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
                                unsigned int hashValue_arg, bool c_heap, TRAPS) {
   assert(!Universe::heap()->is_in_reserved(name),
@@ -380,6 +419,9 @@ Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
 
   HashtableEntry<Symbol*, mtSymbol>* entry = new_entry(hashValue, sym);
   add_entry(index, entry);
+  if (!_needs_resizing) {
+    _needs_resizing = check_resize_table();
+  }
   return sym;
 }
 
@@ -431,6 +473,9 @@ bool SymbolTable::basic_add(ClassLoaderData* loader_data, constantPoolHandle cp,
       cp->symbol_at_put(cp_indices[i], sym);
     }
   }
+  if (!_needs_resizing) {
+    _needs_resizing = check_resize_table();
+  }
   return true;
 }
 
@@ -598,6 +643,8 @@ StringTable* StringTable::_the_table = NULL;
 
 bool StringTable::_needs_rehashing = false;
 
+bool StringTable::_needs_resizing = false;
+
 volatile int StringTable::_parallel_claimed_idx = 0;
 
 // Pick hashing algorithm
@@ -656,6 +703,9 @@ oop StringTable::basic_add(int index_arg, Handle string, jchar* name,
 
   HashtableEntry<oop, mtSymbol>* entry = new_entry(hashValue, string());
   add_entry(index, entry);
+  if (!_needs_resizing) {
+    _needs_resizing = check_resize_table();
+  }
   return string();
 }
 
@@ -1002,3 +1052,21 @@ void StringTable::rehash_table() {
   _needs_rehashing = false;
   _the_table = new_table;
 }
+
+// Create a table with roughly twice as many buckets and move the entries
+// over, keeping their existing hash values. See SymbolTable::grow_table().
+void StringTable::grow_table() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // This should never happen with -Xshare:dump but it might in testing mode.
+  if (DumpSharedSpaces) return;
+
+  StringTableSize = the_table()->table_size() * 2 + 1;
+  StringTable* new_table = new StringTable();
+
+  the_table()->resize_to(new_table);
+
+  // Delete the table and buckets (entries are reused in new table).
+  delete _the_table;
+  _needs_resizing = false;
+  _the_table = new_table;
+}
@@ -85,6 +85,9 @@ private:
   // Set if one bucket is out of balance due to hash algorithm deficiency
   static bool _needs_rehashing;
 
+  // Set if the average bucket length has passed the growth trigger
+  static bool _needs_resizing;
+
   // For statistics
   static int symbols_removed;
   static int symbols_counted;
@@ -198,6 +201,12 @@ public:
   // Create a symbol in the arena for symbols that are not deleted
   static Symbol* new_permanent_symbol(const char* name, TRAPS);
 
+  // Create a batch of permanent symbols from a packed list of count
+  // null-terminated strings, taking the lock once for the whole batch.
+  // Used to pre-populate the table with the VM symbols at startup.
+  static void new_permanent_symbols(const char* bodies, int count,
+                                    Symbol** out, TRAPS);
+
   // Symbol lookup
   static Symbol* lookup(int index, const char* name, int len, TRAPS);
 
@@ -235,6 +244,10 @@ public:
   // Rehash the symbol table if it gets out of balance
   static void rehash_table();
   static bool needs_rehashing()         { return _needs_rehashing; }
+
+  // Grow the symbol table if its load factor gets too high
+  static void grow_table();
+  static bool needs_resizing()          { return _needs_resizing; }
 };
 
 class StringTable : public Hashtable<oop, mtSymbol> {
@@ -247,6 +260,9 @@ private:
   // Set if one bucket is out of balance due to hash algorithm deficiency
   static bool _needs_rehashing;
 
+  // Set if the average bucket length has passed the growth trigger
+  static bool _needs_resizing;
+
   // Claimed high water mark for parallel chunked scanning
   static volatile int _parallel_claimed_idx;
 
@@ -347,6 +363,10 @@ public:
   static void rehash_table();
   static bool needs_rehashing() { return _needs_rehashing; }
 
+  // Grow the string table if its load factor gets too high
+  static void grow_table();
+  static bool needs_resizing() { return _needs_resizing; }
+
   // Parallel chunked scanning
   static void clear_parallel_claimed_index() { _parallel_claimed_idx = 0; }
 };
@@ -645,6 +645,7 @@ Klass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
   bool class_has_been_loaded   = false;
   bool super_load_in_progress  = false;
   bool havesupername = false;
+  bool load_instance_added = false;
   instanceKlassHandle k;
   PlaceholderEntry* placeholder;
   Symbol* superclassname = NULL;
@@ -664,6 +665,16 @@ Klass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
            superclassname = placeholder->supername();
            havesupername = true;
          }
+      } else if (!class_loader.is_null() && is_parallelCapable(class_loader)) {
+        // Parallel-capable loaders never run the LOAD_INSTANCE wait
+        // protocol below and we just checked the dictionary, so claim
+        // the LOAD_INSTANCE token in this same critical section rather
+        // than dropping and retaking SystemDictionary_lock. Under a
+        // parallel classloading storm the second acquisition of this
+        // global lock per load is a measurable serialization point.
+        placeholders()->find_and_add(p_index, p_hash, name, loader_data,
+                                     PlaceholderTable::LOAD_INSTANCE, NULL, THREAD);
+        load_instance_added = true;
       }
     }
   }
@@ -682,7 +693,6 @@ Klass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
 
   bool throw_circularity_error = false;
   if (!class_has_been_loaded) {
-    bool load_instance_added = false;
 
     // add placeholder entry to record loading instance class
     // Five cases:
@@ -708,8 +718,9 @@ Klass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
     //    No performance benefit and no deadlock issues.
     // case 5. parallelCapable user level classloaders - without objectLocker
     //    Allow parallel classloading of a class/classloader pair
+    //    (these claimed LOAD_INSTANCE in the critical section above)
 
-    {
+    if (!load_instance_added) {
       MutexLocker mu(SystemDictionary_lock, THREAD);
       if (class_loader.is_null() || !is_parallelCapable(class_loader)) {
         PlaceholderEntry* oldprobe = placeholders()->get_entry(p_index, p_hash, name, loader_data);
@@ -1830,7 +1841,11 @@ void SystemDictionary::initialize(TRAPS) {
   _dictionary          = new Dictionary(calculate_systemdictionary_size(PredictedLoadedClassCount));
   _placeholders        = new PlaceholderTable(_nof_buckets);
   _number_of_modifications = 0;
-  _loader_constraints  = new LoaderConstraintTable(_loader_constraint_size);
+  // The number of constraints scales with cross-loader resolution, so size
+  // the constraint table with the dictionary instead of a fixed 107
+  // buckets; PredictedLoadedClassCount then also scales constraint chains.
+  _loader_constraints  = new LoaderConstraintTable(
+      MAX2((int)_loader_constraint_size, (_dictionary->table_size() / 4) | 1));
   _resolution_errors   = new ResolutionErrorTable(_resolution_error_size);
   _invoke_method_table = new SymbolPropertyTable(_invoke_method_size);
 
@@ -2103,6 +2118,13 @@ Klass* SystemDictionary::find_constrained_instance_or_array_klass(
   // Now look to see if it has been loaded elsewhere, and is subject to
   // a loader constraint that would require this loader to return the
   // klass that is already loaded.
+  //
+  // The constraint table is empty unless classes have crossed between
+  // delegating loaders, so check the entry count before taking the
+  // lock. The unlocked read races with concurrent constraint updates,
+  // but missing an in-flight constraint here is indistinguishable from
+  // having probed the table just before it was added; callers already
+  // treat NULL as "not resolvable without loading".
   if (FieldType::is_array(class_name)) {
     // For array classes, their Klass*s are not kept in the
     // constraint table. The element Klass*s are.
@@ -2110,7 +2132,7 @@ Klass* SystemDictionary::find_constrained_instance_or_array_klass(
     BasicType t = FieldType::get_array_info(class_name, fd, CHECK_(NULL));
     if (t != T_OBJECT) {
       klass = Universe::typeArrayKlassObj(t);
-    } else {
+    } else if (constraints()->number_of_entries() > 0) {
       MutexLocker mu(SystemDictionary_lock, THREAD);
       klass = constraints()->find_constrained_klass(fd.object_key(), class_loader);
     }
@@ -2118,7 +2140,7 @@ Klass* SystemDictionary::find_constrained_instance_or_array_klass(
     if (klass != NULL) {
       klass = klass->array_klass_or_null(fd.dimension());
     }
-  } else {
+  } else if (constraints()->number_of_entries() > 0) {
     MutexLocker mu(SystemDictionary_lock, THREAD);
     // Non-array classes are easy: simply check the constraint table.
     klass = constraints()->find_constrained_klass(class_name, class_loader);
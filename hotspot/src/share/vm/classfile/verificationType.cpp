@@ -43,7 +43,6 @@ VerificationType VerificationType::from_tag(u1 tag) {
 
 bool VerificationType::is_reference_assignable_from(
     const VerificationType& from, ClassVerifier* context, TRAPS) const {
-  instanceKlassHandle klass = context->current_class();
   if (from.is_null()) {
     // null is assignable to any reference
     return true;
@@ -57,9 +56,7 @@ bool VerificationType::is_reference_assignable_from(
       // any object or array is assignable to java.lang.Object
       return true;
     }
-    Klass* obj = SystemDictionary::resolve_or_fail(
-        name(), Handle(THREAD, klass->class_loader()),
-        Handle(THREAD, klass->protection_domain()), true, CHECK_false);
+    Klass* obj = context->load_class(name(), CHECK_false);
     KlassHandle this_class(THREAD, obj);
 
     if (this_class->is_interface()) {
@@ -67,9 +64,7 @@ bool VerificationType::is_reference_assignable_from(
       // java.lang.Cloneable and java.io.Serializable
       return true;
     } else if (from.is_object()) {
-      Klass* from_class = SystemDictionary::resolve_or_fail(
-          from.name(), Handle(THREAD, klass->class_loader()),
-          Handle(THREAD, klass->protection_domain()), true, CHECK_false);
+      Klass* from_class = context->load_class(from.name(), CHECK_false);
       return InstanceKlass::cast(from_class)->is_subclass_of(this_class());
     }
   } else if (is_array() && from.is_array()) {
@@ -522,6 +522,9 @@ ClassVerifier::ClassVerifier(
   _this_type = VerificationType::reference_type(klass->name());
   // Create list to hold symbols in reference area.
   _symbols = new GrowableArray<Symbol*>(100, 0, NULL);
+  // Create the resolved class cache used by load_class().
+  _resolved_names = new GrowableArray<Symbol*>(8, 0, NULL);
+  _resolved_classes = new GrowableArray<Klass*>(8, 0, NULL);
 }
 
 ClassVerifier::~ClassVerifier() {
@@ -1919,13 +1922,26 @@ void ClassVerifier::class_format_error(const char* msg, ...) {
 }
 
 Klass* ClassVerifier::load_class(Symbol* name, TRAPS) {
+  // The loader and protection domain don't change while this class is
+  // being verified, so a name already resolved here resolves to the same
+  // class again; the few distinct names per class make a linear scan fine.
+  int cached = _resolved_names->find(name);
+  if (cached >= 0) {
+    return _resolved_classes->at(cached);
+  }
+
   // Get current loader and protection domain first.
   oop loader = current_class()->class_loader();
   oop protection_domain = current_class()->protection_domain();
 
-  return SystemDictionary::resolve_or_fail(
+  Klass* klass = SystemDictionary::resolve_or_fail(
     name, Handle(THREAD, loader), Handle(THREAD, protection_domain),
     true, CHECK_NULL);
+
+  // Only successful resolutions are cached; failures throw above.
+  _resolved_names->append(name);
+  _resolved_classes->append(klass);
+  return klass;
 }
 
 bool ClassVerifier::is_protected_access(instanceKlassHandle this_class,
@@ -253,6 +253,14 @@ class ClassVerifier : public StackObj {
   Thread* _thread;
   GrowableArray<Symbol*>* _symbols;  // keep a list of symbols created
 
+  // Cache of classes resolved by load_class() while verifying this class.
+  // The methods of one class keep checking assignability against the same
+  // few named types, and each check used to go back to the system
+  // dictionary. The arrays are parallel and resource-allocated, so they
+  // live exactly as long as the verifier.
+  GrowableArray<Symbol*>* _resolved_names;
+  GrowableArray<Klass*>*  _resolved_classes;
+
   Symbol* _exception_type;
   char* _message;
 
@@ -77,13 +77,11 @@ void vmSymbols::initialize(TRAPS) {
   assert(vmIntrinsics::FLAG_LIMIT <= (1 << vmIntrinsics::log2_FLAG_LIMIT), "must fit in this bitfield");
 
   if (!UseSharedSpaces) {
-    const char* string = &vm_symbol_bodies[0];
-    for (int index = (int)FIRST_SID; index < (int)SID_LIMIT; index++) {
-      Symbol* sym = SymbolTable::new_permanent_symbol(string, CHECK);
-      _symbols[index] = sym;
-      string += strlen(string); // skip string body
-      string += 1;              // skip trailing null
-    }
+    // Add all the symbols in one locked batch rather than taking the
+    // SymbolTable_lock once per symbol.
+    SymbolTable::new_permanent_symbols(&vm_symbol_bodies[0],
+                                       (int)SID_LIMIT - (int)FIRST_SID,
+                                       &_symbols[(int)FIRST_SID], CHECK);
 
     _type_signatures[T_BYTE]    = byte_signature();
     _type_signatures[T_CHAR]    = char_signature();
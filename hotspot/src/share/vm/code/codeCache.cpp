@@ -118,24 +118,50 @@ class CodeBlob_sizes {
 // CodeCache implementation
 
 CodeHeap * CodeCache::_heap = new CodeHeap();
+CodeHeap * CodeCache::_heaps[CodeBlobType::NumTypes] = { _heap, _heap, _heap, NULL };
+int CodeCache::_n_heaps = 1;
+address CodeCache::_low_bound = NULL;
+address CodeCache::_high_bound = NULL;
 int CodeCache::_number_of_blobs = 0;
 int CodeCache::_number_of_adapters = 0;
 int CodeCache::_number_of_nmethods = 0;
 int CodeCache::_number_of_nmethods_with_dependencies = 0;
 bool CodeCache::_needs_cache_clean = false;
 nmethod* CodeCache::_scavenge_root_nmethods = NULL;
+nmethod* CodeCache::_registered_nmethods = NULL;
 
 int CodeCache::_codemem_full_count = 0;
 
+CodeHeap* CodeCache::get_code_heap_containing(const void* p) {
+  for (int i = 0; i < _n_heaps; i++) {
+    if (_heaps[i]->contains(p)) {
+      return _heaps[i];
+    }
+  }
+  return NULL;
+}
+
 CodeBlob* CodeCache::first() {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (CodeBlob*)_heap->first();
+  for (int i = 0; i < _n_heaps; i++) {
+    CodeBlob* cb = (CodeBlob*)_heaps[i]->first();
+    if (cb != NULL) return cb;
+  }
+  return NULL;
 }
 
 
 CodeBlob* CodeCache::next(CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (CodeBlob*)_heap->next(cb);
+  int i = 0;
+  while (i < _n_heaps && !_heaps[i]->contains(cb)) i++;
+  assert(i < _n_heaps, "CodeBlob is not in any code heap");
+  CodeBlob* next = (CodeBlob*)_heaps[i]->next(cb);
+  // Advance to the next non-empty heap once the current one is exhausted
+  while (next == NULL && ++i < _n_heaps) {
+    next = (CodeBlob*)_heaps[i]->first();
+  }
+  return next;
 }
 
 
@@ -172,7 +198,7 @@ nmethod* CodeCache::next_nmethod (CodeBlob* cb) {
 
 static size_t maxCodeCacheUsed = 0;
 
-CodeBlob* CodeCache::allocate(int size, bool is_critical) {
+CodeBlob* CodeCache::allocate(int size, int code_blob_type, bool is_critical) {
   // Do not seize the CodeCache lock here--if the caller has not
   // already done so, we are going to lose bigtime, since the code
   // cache will contain a garbage CodeBlob until the caller can
@@ -180,35 +206,80 @@ CodeBlob* CodeCache::allocate(int size, bool is_critical) {
   // instantiating.
   guarantee(size >= 0, "allocation request must be reasonable");
   assert_locked_or_safepoint(CodeCache_lock);
+  CodeHeap* heap = get_code_heap(code_blob_type);
   CodeBlob* cb = NULL;
   _number_of_blobs++;
+  bool tried_fallback = false;
   while (true) {
-    cb = (CodeBlob*)_heap->allocate(size, is_critical);
+    cb = (CodeBlob*)heap->allocate(size, is_critical);
     if (cb != NULL) break;
-    if (!_heap->expand_by(CodeCacheExpansionSize)) {
+    if (!heap->expand_by(CodeCacheExpansionSize)) {
+      // The requested heap is full; with a segmented code cache try to
+      // borrow space from the other method heap before giving up. Blobs
+      // allocated by the fallback still iterate, flush and unregister
+      // correctly since all lookups go through the heap containing them.
+      if (SegmentedCodeCache && !tried_fallback) {
+        CodeHeap* fallback = (code_blob_type == CodeBlobType::MethodNonProfiled)
+                               ? get_code_heap(CodeBlobType::MethodProfiled)
+                               : get_code_heap(CodeBlobType::MethodNonProfiled);
+        if (fallback != heap) {
+          if (PrintCodeCacheExtension) {
+            tty->print_cr("Extension of code heap failed, trying fallback heap");
+          }
+          heap = fallback;
+          tried_fallback = true;
+          continue;
+        }
+      }
       // Expansion failed
       return NULL;
     }
     if (PrintCodeCacheExtension) {
       ResourceMark rm;
       tty->print_cr("code cache extended to [" INTPTR_FORMAT ", " INTPTR_FORMAT "] (%d bytes)",
-                    (intptr_t)_heap->low_boundary(), (intptr_t)_heap->high(),
-                    (address)_heap->high() - (address)_heap->low_boundary());
+                    (intptr_t)heap->low_boundary(), (intptr_t)heap->high(),
+                    (address)heap->high() - (address)heap->low_boundary());
     }
   }
-  maxCodeCacheUsed = MAX2(maxCodeCacheUsed, ((address)_heap->high_boundary() -
-                          (address)_heap->low_boundary()) - unallocated_capacity());
+  maxCodeCacheUsed = MAX2(maxCodeCacheUsed, max_capacity() - unallocated_capacity());
   verify_if_often();
   print_trace("allocation", cb, size);
   return cb;
 }
 
+void CodeCache::register_nmethod_link(nmethod* nm) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  nm->set_registered_prev(NULL);
+  nm->set_registered_link(_registered_nmethods);
+  if (_registered_nmethods != NULL) {
+    _registered_nmethods->set_registered_prev(nm);
+  }
+  _registered_nmethods = nm;
+}
+
+void CodeCache::unregister_nmethod_link(nmethod* nm) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  nmethod* prev = nm->registered_prev();
+  nmethod* next = nm->registered_link();
+  if (prev != NULL) {
+    prev->set_registered_link(next);
+  } else if (_registered_nmethods == nm) {
+    _registered_nmethods = next;
+  }
+  if (next != NULL) {
+    next->set_registered_prev(prev);
+  }
+  nm->set_registered_link(NULL);
+  nm->set_registered_prev(NULL);
+}
+
 void CodeCache::free(CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
   verify_if_often();
 
   print_trace("free", cb);
   if (cb->is_nmethod()) {
+    unregister_nmethod_link((nmethod*)cb);
     _number_of_nmethods--;
     if (((nmethod *)cb)->has_dependencies()) {
       _number_of_nmethods_with_dependencies--;
@@ -219,7 +290,9 @@ void CodeCache::free(CodeBlob* cb) {
   }
   _number_of_blobs--;
 
-  _heap->deallocate(cb);
+  CodeHeap* heap = get_code_heap_containing(cb);
+  assert(heap != NULL, "CodeBlob is not in any code heap");
+  heap->deallocate(cb);
 
   verify_if_often();
   assert(_number_of_blobs >= 0, "sanity check");
@@ -230,6 +303,7 @@ void CodeCache::commit(CodeBlob* cb) {
   // this is called by nmethod::nmethod, which must already own CodeCache_lock
   assert_locked_or_safepoint(CodeCache_lock);
   if (cb->is_nmethod()) {
+    register_nmethod_link((nmethod*)cb);
     _number_of_nmethods++;
     if (((nmethod *)cb)->has_dependencies()) {
       _number_of_nmethods_with_dependencies++;
@@ -259,7 +333,10 @@ void CodeCache::flush() {
 
 bool CodeCache::contains(void *p) {
   // It should be ok to call contains without holding a lock
-  return _heap->contains(p);
+  for (int i = 0; i < _n_heaps; i++) {
+    if (_heaps[i]->contains(p)) return true;
+  }
+  return false;
 }
 
 
@@ -303,6 +380,19 @@ void CodeCache::alive_nmethods_do(void f(nmethod* nm)) {
   }
 }
 
+void CodeCache::registered_nmethods_do(void f(nmethod* nm)) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  for (nmethod* nm = _registered_nmethods; nm != NULL; nm = nm->registered_link()) {
+    // Zombie and unloaded nmethods stay on the list until they are freed;
+    // skip them here so this behaves like alive_nmethods_do.  In particular
+    // the metadata of unloaded nmethods may already be dead and must not be
+    // touched.
+    if (nm->is_alive()) {
+      f(nm);
+    }
+  }
+}
+
 int CodeCache::alignment_unit() {
   return (int)_heap->alignment_unit();
 }
@@ -528,13 +618,46 @@ void CodeCache::verify_oops() {
 
 address CodeCache::first_address() {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (address)_heap->low_boundary();
+  return low_bound();
 }
 
 
 address CodeCache::last_address() {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (address)_heap->high();
+  return high();
+}
+
+address CodeCache::high() {
+  address result = NULL;
+  for (int i = 0; i < _n_heaps; i++) {
+    address heap_high = (address)_heaps[i]->high();
+    if (heap_high > result) result = heap_high;
+  }
+  return result;
+}
+
+size_t CodeCache::capacity() {
+  size_t result = 0;
+  for (int i = 0; i < _n_heaps; i++) {
+    result += _heaps[i]->capacity();
+  }
+  return result;
+}
+
+size_t CodeCache::max_capacity() {
+  size_t result = 0;
+  for (int i = 0; i < _n_heaps; i++) {
+    result += _heaps[i]->max_capacity();
+  }
+  return result;
+}
+
+size_t CodeCache::unallocated_capacity() {
+  size_t result = 0;
+  for (int i = 0; i < _n_heaps; i++) {
+    result += _heaps[i]->unallocated_capacity();
+  }
+  return result;
 }
 
 /**
@@ -547,8 +670,100 @@ double CodeCache::reverse_free_ratio() {
   return max_capacity / unallocated_capacity;
 }
 
+/**
+ * Returns the reverse free ratio of the heap holding blobs of the given
+ * type. The sweeper uses this to put more pressure on a code heap that
+ * is running full while the others still have room.
+ */
+double CodeCache::reverse_free_ratio(int code_blob_type) {
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  double unallocated_capacity = MAX2((double)heap->unallocated_capacity(), 1.0);
+  double max_capacity = (double)heap->max_capacity();
+  return max_capacity / unallocated_capacity;
+}
+
 void icache_init();
 
+ReservedCodeSpace CodeCache::reserve_heap_memory(size_t size) {
+  const size_t page_size = os::can_execute_large_page_memory() ?
+          os::page_size_for_region(InitialCodeCacheSize, size, 8) :
+          os::vm_page_size();
+  const size_t granularity = os::vm_allocation_granularity();
+  const size_t r_align = MAX2(page_size, granularity);
+  const size_t r_size = align_size_up(size, r_align);
+  const size_t rs_align = page_size == (size_t) os::vm_page_size() ? 0 :
+    MAX2(page_size, granularity);
+
+  ReservedCodeSpace rs(r_size, rs_align, rs_align > 0);
+  os::trace_page_sizes("code heap", InitialCodeCacheSize, size, page_size,
+                       rs.base(), rs.size());
+  if (!rs.is_reserved()) {
+    vm_exit_during_initialization("Could not reserve enough space for code cache");
+  }
+  return rs;
+}
+
+void CodeCache::initialize_heaps() {
+  size_t cache_size        = ReservedCodeCacheSize;
+  size_t non_nmethod_size  = NonNMethodCodeHeapSize;
+  size_t profiled_size     = ProfiledCodeHeapSize;
+  size_t non_profiled_size = NonProfiledCodeHeapSize;
+
+  // Method heap sizes not set on the command line default to an even split
+  // of the space remaining after the non-nmethod heap.
+  if (profiled_size == 0) {
+    profiled_size = non_profiled_size == 0 ? (cache_size - non_nmethod_size) / 2
+                                           : cache_size - non_nmethod_size - non_profiled_size;
+  }
+  if (non_profiled_size == 0) {
+    non_profiled_size = cache_size - non_nmethod_size - profiled_size;
+  }
+  if (non_nmethod_size >= cache_size || profiled_size >= cache_size ||
+      non_profiled_size >= cache_size ||
+      non_nmethod_size + profiled_size + non_profiled_size > cache_size) {
+    vm_exit_during_initialization(
+        err_msg("Invalid code heap sizes: NonNMethodCodeHeapSize + ProfiledCodeHeapSize "
+                "+ NonProfiledCodeHeapSize must not exceed ReservedCodeCacheSize (" SIZE_FORMAT "K)",
+                cache_size/K));
+  }
+
+  // Reserve one contiguous address range and carve the heaps out of it, so
+  // that pc-relative calls and branches still reach across heaps.
+  ReservedCodeSpace rs = reserve_heap_memory(cache_size);
+  const size_t h_align = rs.alignment();
+  non_nmethod_size = align_size_up(non_nmethod_size, h_align);
+  profiled_size    = align_size_up(profiled_size, h_align);
+  if (non_nmethod_size + profiled_size >= rs.size()) {
+    vm_exit_during_initialization("Invalid code heap sizes");
+  }
+  non_profiled_size = rs.size() - non_nmethod_size - profiled_size;
+
+  // Put the non-nmethod heap in the middle so that both method heaps are
+  // as close as possible to the stubs and adapters they call.
+  ReservedSpace profiled_space     = rs.first_part(profiled_size);
+  ReservedSpace rest               = rs.last_part(profiled_size);
+  ReservedSpace non_nmethod_space  = rest.first_part(non_nmethod_size);
+  ReservedSpace non_profiled_space = rest.last_part(non_nmethod_size);
+
+  // The statically allocated heap becomes the non-profiled method heap;
+  // this is also the heap the SA continues to see as CodeCache::_heap.
+  _heaps[CodeBlobType::MethodNonProfiled] = _heap;
+  _heaps[CodeBlobType::MethodProfiled]    = new CodeHeap();
+  _heaps[CodeBlobType::NonNMethod]        = new CodeHeap();
+  _n_heaps = 3;
+
+  const size_t initial = align_size_up(InitialCodeCacheSize / _n_heaps, os::vm_page_size());
+  if (!_heaps[CodeBlobType::MethodProfiled]->reserve(profiled_space, MIN2(initial, profiled_size), CodeCacheSegmentSize) ||
+      !_heaps[CodeBlobType::NonNMethod]->reserve(non_nmethod_space, MIN2(initial, non_nmethod_size), CodeCacheSegmentSize) ||
+      !_heaps[CodeBlobType::MethodNonProfiled]->reserve(non_profiled_space, MIN2(initial, non_profiled_size), CodeCacheSegmentSize)) {
+    vm_exit_during_initialization("Could not reserve enough space for code cache");
+  }
+
+  MemoryService::add_code_heap_memory_pool(_heaps[CodeBlobType::NonNMethod],        "CodeHeap 'non-nmethods'");
+  MemoryService::add_code_heap_memory_pool(_heaps[CodeBlobType::MethodProfiled],    "CodeHeap 'profiled nmethods'");
+  MemoryService::add_code_heap_memory_pool(_heaps[CodeBlobType::MethodNonProfiled], "CodeHeap 'non-profiled nmethods'");
+}
+
 void CodeCache::initialize() {
   assert(CodeCacheSegmentSize >= (uintx)CodeEntryAlignment, "CodeCacheSegmentSize must be large enough to align entry points");
 #ifdef COMPILER2
@@ -561,11 +776,24 @@ void CodeCache::initialize() {
   CodeCacheExpansionSize = round_to(CodeCacheExpansionSize, os::vm_page_size());
   InitialCodeCacheSize = round_to(InitialCodeCacheSize, os::vm_page_size());
   ReservedCodeCacheSize = round_to(ReservedCodeCacheSize, os::vm_page_size());
-  if (!_heap->reserve(ReservedCodeCacheSize, InitialCodeCacheSize, CodeCacheSegmentSize)) {
-    vm_exit_during_initialization("Could not reserve enough space for code cache");
+  if (SegmentedCodeCache) {
+    initialize_heaps();
+  } else {
+    ReservedCodeSpace rs = reserve_heap_memory(ReservedCodeCacheSize);
+    if (!_heap->reserve(rs, InitialCodeCacheSize, CodeCacheSegmentSize)) {
+      vm_exit_during_initialization("Could not reserve enough space for code cache");
+    }
+    MemoryService::add_code_heap_memory_pool(_heap, "Code Cache");
   }
 
-  MemoryService::add_code_heap_memory_pool(_heap);
+  // The heaps are carved out of one contiguous reservation, so the bounds
+  // of the code cache are the bounds of that reservation.
+  _low_bound  = (address)_heaps[0]->low_boundary();
+  _high_bound = (address)_heaps[0]->high_boundary();
+  for (int i = 1; i < _n_heaps; i++) {
+    _low_bound  = MIN2(_low_bound,  (address)_heaps[i]->low_boundary());
+    _high_bound = MAX2(_high_bound, (address)_heaps[i]->high_boundary());
+  }
 
   // Initialize ICache flush mechanism
   // This service is needed for os::register_code_area
@@ -574,7 +802,7 @@ void CodeCache::initialize() {
   // Give OS a chance to register generated code area.
   // This is used on Windows 64 bit platforms to register
   // Structured Exception Handlers for our generated code.
-  os::register_code_area(_heap->low_boundary(), _heap->high_boundary());
+  os::register_code_area((char*)_low_bound, (char*)_high_bound);
 }
 
 
@@ -680,6 +908,46 @@ int CodeCache::mark_for_evol_deoptimization(instanceKlassHandle dependee) {
 
   return number_of_marked_CodeBlobs;
 }
+
+// The targeted variant of the above: only methods that were actually
+// changed (not EMCP) or deleted by the current RedefineClasses()
+// operation are considered. Compiled code rooted in or depending only
+// on methods that remained EMCP stays valid; the old method versions
+// are kept alive by the previous version list and by the on-stack
+// metadata marking done by the nmethods themselves.
+int CodeCache::mark_for_evol_deoptimization(instanceKlassHandle dependee,
+                                            GrowableArray<Method*>* changed_methods) {
+  MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  int number_of_marked_CodeBlobs = 0;
+
+  // Deoptimize the compiled versions of the changed methods themselves
+  for (int i = 0; i < changed_methods->length(); i++) {
+    ResourceMark rm;
+    Method* old_method = changed_methods->at(i);
+    assert(old_method->method_holder() == dependee(),
+           "changed method must belong to the evolving class");
+    nmethod *nm = old_method->code();
+    if (nm != NULL) {
+      nm->mark_for_deoptimization();
+      number_of_marked_CodeBlobs++;
+    }
+  }
+
+  FOR_ALL_ALIVE_NMETHODS(nm) {
+    if (nm->is_marked_for_deoptimization()) {
+      // ...Already marked in the previous pass; don't count it again.
+    } else if (nm->is_evol_dependent_on(changed_methods)) {
+      ResourceMark rm;
+      nm->mark_for_deoptimization();
+      number_of_marked_CodeBlobs++;
+    } else  {
+      // flush caches in case they refer to a redefined Method*
+      nm->clear_inline_caches();
+    }
+  }
+
+  return number_of_marked_CodeBlobs;
+}
 #endif // HOTSWAP
 
 
@@ -738,10 +1006,25 @@ void CodeCache::make_marked_nmethods_not_entrant() {
 }
 
 void CodeCache::verify() {
-  _heap->verify();
+  for (int i = 0; i < _n_heaps; i++) {
+    _heaps[i]->verify();
+  }
   FOR_ALL_ALIVE_BLOBS(p) {
     p->verify();
   }
+  // The registered-nmethod list must cover exactly the nmethods in the
+  // code heaps (alive or not; entries are only removed on free()).
+  int heap_count = 0;
+  FOR_ALL_BLOBS(p) {
+    if (p->is_nmethod()) {
+      heap_count++;
+    }
+  }
+  int list_count = 0;
+  for (nmethod* nm = _registered_nmethods; nm != NULL; nm = nm->registered_link()) {
+    list_count++;
+  }
+  guarantee(heap_count == list_count, "registered-nmethod list out of sync with code heaps");
 }
 
 void CodeCache::report_codemem_full() {
@@ -767,7 +1050,9 @@ void CodeCache::report_codemem_full() {
 
 void CodeCache::verify_if_often() {
   if (VerifyCodeCacheOften) {
-    _heap->verify();
+    for (int i = 0; i < _n_heaps; i++) {
+      _heaps[i]->verify();
+    }
   }
 }
 
@@ -938,18 +1223,37 @@ void CodeCache::print() {
 #endif // !PRODUCT
 }
 
+static const char* code_heap_names[CodeBlobType::NumTypes] = {
+  "CodeHeap 'non-profiled nmethods'",
+  "CodeHeap 'profiled nmethods'",
+  "CodeHeap 'non-nmethods'",
+  NULL
+};
+
 void CodeCache::print_summary(outputStream* st, bool detailed) {
-  size_t total = (_heap->high_boundary() - _heap->low_boundary());
+  size_t total = max_capacity();
   st->print_cr("CodeCache: size=" SIZE_FORMAT "Kb used=" SIZE_FORMAT
                "Kb max_used=" SIZE_FORMAT "Kb free=" SIZE_FORMAT "Kb",
                total/K, (total - unallocated_capacity())/K,
                maxCodeCacheUsed/K, unallocated_capacity()/K);
 
+  if (SegmentedCodeCache) {
+    for (int i = 0; i < _n_heaps; i++) {
+      CodeHeap* heap = _heaps[i];
+      size_t heap_total = heap->max_capacity();
+      st->print_cr("%s: size=" SIZE_FORMAT "Kb used=" SIZE_FORMAT
+                   "Kb free=" SIZE_FORMAT "Kb",
+                   code_heap_names[i], heap_total/K,
+                   (heap_total - heap->unallocated_capacity())/K,
+                   heap->unallocated_capacity()/K);
+    }
+  }
+
   if (detailed) {
     st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]",
-                 _heap->low_boundary(),
-                 _heap->high(),
-                 _heap->high_boundary());
+                 low_bound(),
+                 high(),
+                 high_bound());
     st->print_cr(" total_blobs=" UINT32_FORMAT " nmethods=" UINT32_FORMAT
                  " adapters=" UINT32_FORMAT,
                  nof_blobs(), nof_nmethods(), nof_adapters());
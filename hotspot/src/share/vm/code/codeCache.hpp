@@ -39,6 +39,11 @@
 //   - Each CodeBlob occupies one chunk of memory.
 //   - Like the offset table in oldspace the zone has at table for
 //     locating a method given a addess of an instruction.
+//   - With -XX:+SegmentedCodeCache the cache is split into separate heaps
+//     for non-nmethod code (buffers, adapters and runtime stubs), profiled
+//     nmethods (tier 2 and 3) and non-profiled nmethods (tier 1 and 4).
+//     All heaps are carved out of one contiguous address range so that
+//     pc-relative calls and branches still span the whole code cache.
 
 class OopClosure;
 class DepChange;
@@ -46,17 +51,28 @@ class DepChange;
 class CodeCache : AllStatic {
   friend class VMStructs;
  private:
-  // CodeHeap is malloc()'ed at startup and never deleted during shutdown,
+  // CodeHeaps are malloc()'ed at startup and never deleted during shutdown,
   // so that the generated assembly code is always there when it's needed.
   // This may cause memory leak, but is necessary, for now. See 4423824,
   // 4422213 or 4436291 for details.
+  // Without code cache segmentation _heap is the only heap and all entries
+  // of _heaps alias it; with segmentation _heap is the heap holding the
+  // non-profiled nmethods (this is also the heap the SA continues to read).
   static CodeHeap * _heap;
+  static CodeHeap * _heaps[CodeBlobType::NumTypes];
+  static int _n_heaps;                      // Number of distinct heaps (1 or 3)
+  static address _low_bound;                // Lower bound of the reserved code space
+  static address _high_bound;               // Upper bound of the reserved code space
   static int _number_of_blobs;
   static int _number_of_adapters;
   static int _number_of_nmethods;
   static int _number_of_nmethods_with_dependencies;
   static bool _needs_cache_clean;
   static nmethod* _scavenge_root_nmethods;  // linked via nm->scavenge_root_link()
+  static nmethod* _registered_nmethods;     // all nmethods, linked via nm->registered_link()
+
+  static void register_nmethod_link(nmethod* nm);   // called from commit()
+  static void unregister_nmethod_link(nmethod* nm); // called from free()
 
   static void verify_if_often() PRODUCT_RETURN;
 
@@ -65,6 +81,18 @@ class CodeCache : AllStatic {
 
   static int _codemem_full_count;
 
+  // Creates the code heaps and carves them out of the reserved code space
+  static void initialize_heaps();
+  static ReservedCodeSpace reserve_heap_memory(size_t size);
+
+  // Returns the heap holding blobs of the given type
+  static CodeHeap* get_code_heap(int code_blob_type) {
+    assert(code_blob_type >= 0 && code_blob_type < CodeBlobType::NumTypes, "invalid code blob type");
+    return _heaps[code_blob_type];
+  }
+  // Returns the heap containing the given address or NULL
+  static CodeHeap* get_code_heap_containing(const void* p);
+
  public:
 
   // Initialization
@@ -72,8 +100,18 @@ class CodeCache : AllStatic {
 
   static void report_codemem_full();
 
+  // Returns the code heap type an nmethod compiled at the given
+  // compilation level should be allocated in
+  static int get_code_blob_type(int comp_level) {
+    if (comp_level == CompLevel_full_profile ||
+        comp_level == CompLevel_limited_profile) {
+      return CodeBlobType::MethodProfiled;
+    }
+    return CodeBlobType::MethodNonProfiled;
+  }
+
   // Allocation/administration
-  static CodeBlob* allocate(int size, bool is_critical = false); // allocates a new CodeBlob
+  static CodeBlob* allocate(int size, int code_blob_type, bool is_critical = false); // allocates a new CodeBlob
   static void commit(CodeBlob* cb);                 // called when the allocated CodeBlob has been filled
   static int alignment_unit();                      // guaranteed alignment of all CodeBlobs
   static int alignment_offset();                    // guaranteed offset of first CodeBlob byte within alignment unit (i.e., allocation header)
@@ -85,6 +123,14 @@ class CodeCache : AllStatic {
   static void nmethods_do(void f(nmethod* nm));     // iterates over all nmethods
   static void alive_nmethods_do(void f(nmethod* nm)); // iterates over all alive nmethods
 
+  // Iterates over the alive nmethods on the registered-nmethod list.  The
+  // list is maintained incrementally at commit/free time, so walking it is
+  // proportional to the number of nmethods rather than to the size of the
+  // code cache (no blob-by-blob heap walk past adapters, stubs and free
+  // space).  Preferred for safepoint work such as metadata-on-stack
+  // marking on large code caches.
+  static void registered_nmethods_do(void f(nmethod* nm));
+
   // Lookup
   static CodeBlob* find_blob(void* start);
   static nmethod*  find_nmethod(void* start);
@@ -95,7 +141,10 @@ class CodeCache : AllStatic {
     // NMT can walk the stack before code cache is created
     if (_heap == NULL) return NULL;
 
-    CodeBlob* result = (CodeBlob*)_heap->find_start(start);
+    CodeHeap* heap = get_code_heap_containing(start);
+    if (heap == NULL) return NULL;
+
+    CodeBlob* result = (CodeBlob*)heap->find_start(start);
     // this assert is too strong because the heap code will return the
     // heapblock containing start. That block can often be larger than
     // the codeBlob itself. If you look up an address that is within
@@ -156,17 +205,18 @@ class CodeCache : AllStatic {
   static void log_state(outputStream* st);
 
   // The full limits of the codeCache
-  static address  low_bound()                    { return (address) _heap->low_boundary(); }
-  static address  high_bound()                   { return (address) _heap->high_boundary(); }
-  static address  high()                         { return (address) _heap->high(); }
+  static address  low_bound()                    { return _low_bound; }
+  static address  high_bound()                   { return _high_bound; }
+  static address  high();                        // highest committed address of any heap
 
   // Profiling
   static address first_address();                // first address used for CodeBlobs
   static address last_address();                 // last  address used for CodeBlobs
-  static size_t  capacity()                      { return _heap->capacity(); }
-  static size_t  max_capacity()                  { return _heap->max_capacity(); }
-  static size_t  unallocated_capacity()          { return _heap->unallocated_capacity(); }
+  static size_t  capacity();
+  static size_t  max_capacity();
+  static size_t  unallocated_capacity();
   static double  reverse_free_ratio();
+  static double  reverse_free_ratio(int code_blob_type);
 
   static bool needs_cache_clean()                { return _needs_cache_clean; }
   static void set_needs_cache_clean(bool v)      { _needs_cache_clean = v;    }
@@ -176,6 +226,8 @@ class CodeCache : AllStatic {
   static int  mark_for_deoptimization(DepChange& changes);
 #ifdef HOTSWAP
   static int  mark_for_evol_deoptimization(instanceKlassHandle dependee);
+  static int  mark_for_evol_deoptimization(instanceKlassHandle dependee,
+                                           GrowableArray<Method*>* changed_methods);
 #endif // HOTSWAP
 
   static void mark_all_nmethods_for_deoptimization();
@@ -37,20 +37,42 @@
 #include "oops/oop.inline.hpp"
 #include "oops/symbol.hpp"
 #include "runtime/icache.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "utilities/events.hpp"
 
 
 // Every time a compiled IC is changed or its type is being accessed,
-// either the CompiledIC_lock must be set or we must be at a safe point.
+// either the IC lock of the enclosing nmethod (see ic_lock()) must be
+// held or we must be at a safe point.
+
+// Returns the lock guarding IC and static call patching in the nmethod
+// containing the call site. Using a striped array instead of one global
+// lock lets transitions in unrelated nmethods proceed concurrently; a
+// monomorphic-to-megamorphic transition in one hot call site no longer
+// blocks IC patching everywhere else.
+Mutex* CompiledIC::ic_lock(const nmethod* nm) {
+  assert(nm != NULL, "call site must be in an nmethod");
+  // nmethods are at least CodeCacheSegmentSize (>= 64 bytes) apart, so
+  // drop the low bits before folding the address into a stripe index.
+  int index = (int)((((uintptr_t)nm) >> 6) & (CompiledICLock_stripes - 1));
+  return CompiledIC_locks[index];
+}
+
+Mutex* CompiledIC::ic_lock_for(address instruction) {
+  // Use the unsafe variant, since the site might be in a zombie method.
+  CodeBlob* cb = CodeCache::find_blob_unsafe(instruction);
+  assert(cb != NULL && cb->is_nmethod(), "not a compiled call site");
+  return ic_lock((nmethod*)cb);
+}
 
 //-----------------------------------------------------------------------------
 // Low-level access to an inline cache. Private, since they might not be
 // MT-safe to use.
 
 void* CompiledIC::cached_value() const {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   assert (!is_optimized(), "an optimized virtual call does not have a cached metadata");
 
   if (!is_in_transition_state()) {
@@ -67,7 +89,7 @@ void* CompiledIC::cached_value() const {
 
 void CompiledIC::internal_set_ic_destination(address entry_point, bool is_icstub, void* cache, bool is_icholder) {
   assert(entry_point != NULL, "must set legal entry point");
-  assert(CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert(ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   assert (!is_optimized() || cache == NULL, "an optimized virtual call does not have a cached metadata");
   assert (cache == NULL || cache != (Metadata*)badOopVal, "invalid metadata");
 
@@ -128,7 +150,7 @@ void CompiledIC::set_ic_destination(ICStub* stub) {
 
 
 address CompiledIC::ic_destination() const {
- assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+ assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
  if (!is_in_transition_state()) {
    return _ic_call->destination();
  } else {
@@ -138,13 +160,13 @@ address CompiledIC::ic_destination() const {
 
 
 bool CompiledIC::is_in_transition_state() const {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   return InlineCacheBuffer::contains(_ic_call->destination());
 }
 
 
 bool CompiledIC::is_icholder_call() const {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   return !_is_optimized && is_icholder_entry(ic_destination());
 }
 
@@ -161,7 +183,7 @@ address CompiledIC::stub_address() const {
 
 
 bool CompiledIC::set_to_megamorphic(CallInfo* call_info, Bytecodes::Code bytecode, TRAPS) {
-  assert(CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert(ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   assert(!is_optimized(), "cannot set an optimized virtual call to megamorphic");
   assert(is_call_to_compiled() || is_call_to_interpreted(), "going directly to megamorphic?");
 
@@ -211,7 +233,7 @@ bool CompiledIC::set_to_megamorphic(CallInfo* call_info, Bytecodes::Code bytecod
 
 // true if destination is megamorphic stub
 bool CompiledIC::is_megamorphic() const {
-  assert(CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert(ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   assert(!is_optimized(), "an optimized call cannot be megamorphic");
 
   // Cannot rely on cached_value. It is either an interface or a method.
@@ -219,7 +241,7 @@ bool CompiledIC::is_megamorphic() const {
 }
 
 bool CompiledIC::is_call_to_compiled() const {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
 
   // Use unsafe, since an inline cache might point to a zombie method. However, the zombie
   // method is guaranteed to still exist, since we only remove methods after all inline caches
@@ -242,7 +264,7 @@ bool CompiledIC::is_call_to_compiled() const {
 
 
 bool CompiledIC::is_call_to_interpreted() const {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   // Call to interpreter if destination is either calling to a stub (if it
   // is optimized), or calling to an I2C blob
   bool is_call_to_interpreted = false;
@@ -270,7 +292,7 @@ bool CompiledIC::is_call_to_interpreted() const {
 
 
 void CompiledIC::set_to_clean() {
-  assert(SafepointSynchronize::is_at_safepoint() || CompiledIC_lock->is_locked() , "MT-unsafe call");
+  assert(SafepointSynchronize::is_at_safepoint() || ic_lock(_nm)->is_locked() , "MT-unsafe call");
   if (TraceInlineCacheClearing || TraceICs) {
     tty->print_cr("IC@" INTPTR_FORMAT ": set to clean", instruction_address());
     print();
@@ -313,7 +335,7 @@ void CompiledIC::set_to_clean() {
 
 
 bool CompiledIC::is_clean() const {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   bool is_clean = false;
   address dest = ic_destination();
   is_clean = dest == SharedRuntime::get_resolve_opt_virtual_call_stub() ||
@@ -324,7 +346,7 @@ bool CompiledIC::is_clean() const {
 
 
 void CompiledIC::set_to_monomorphic(CompiledICInfo& info) {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
+  assert (ic_lock(_nm)->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   // Updating a cache to the wrong entry can cause bugs that are very hard
   // to track down - if cache entry gets invalid - we just clean it. In
   // this way it is always the same code path that is responsible for
@@ -483,7 +505,7 @@ bool CompiledIC::is_icholder_entry(address entry) {
 // ----------------------------------------------------------------------------
 
 void CompiledStaticCall::set_to_clean() {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "mt unsafe call");
+  assert (CompiledIC::ic_lock_for(instruction_address())->is_locked() || SafepointSynchronize::is_at_safepoint(), "mt unsafe call");
   // Reset call site
   MutexLockerEx pl(Patching_lock, Mutex::_no_safepoint_check_flag);
 #ifdef ASSERT
@@ -515,7 +537,7 @@ bool CompiledStaticCall::is_call_to_interpreted() const {
 }
 
 void CompiledStaticCall::set(const StaticCallInfo& info) {
-  assert (CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "mt unsafe call");
+  assert (CompiledIC::ic_lock_for(instruction_address())->is_locked() || SafepointSynchronize::is_at_safepoint(), "mt unsafe call");
   MutexLockerEx pl(Patching_lock, Mutex::_no_safepoint_check_flag);
   // Updating a cache to the wrong entry can cause bugs that are very hard
   // to track down - if cache entry gets invalid - we just clean it. In
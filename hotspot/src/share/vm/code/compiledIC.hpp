@@ -74,6 +74,7 @@
 //
 class CompiledIC;
 class ICStub;
+class Mutex;
 
 class CompiledICInfo : public StackObj {
  private:
@@ -145,6 +146,7 @@ class CompiledIC: public ResourceObj {
 
 
  private:
+  nmethod*      _nm;            // the nmethod containing the call site
   NativeCall*   _ic_call;       // the call instruction
   NativeMovConstReg* _value;    // patchable value cell for this IC
   bool          _is_optimized;  // an optimized virtual call (i.e., no compiled IC)
@@ -179,6 +181,16 @@ class CompiledIC: public ResourceObj {
   bool is_in_transition_state() const;  // Use InlineCacheBuffer
 
  public:
+  // Inline cache patching is serialized per nmethod rather than through one
+  // global lock: the guarding lock is picked from a small striped array by
+  // hashing the nmethod, so transitions in unrelated nmethods can proceed
+  // concurrently, while all call sites of one nmethod share a lock and can
+  // be cleaned under a single acquisition.
+  static Mutex* ic_lock(const nmethod* nm);
+  // Variant for code that only has an instruction address at hand (e.g.
+  // static call sites); looks up the containing nmethod.
+  static Mutex* ic_lock_for(address instruction);
+
   // conversion (machine PC to CompiledIC*)
   friend CompiledIC* CompiledIC_before(nmethod* nm, address return_addr);
   friend CompiledIC* CompiledIC_at(nmethod* nm, address call_site);
@@ -216,8 +228,9 @@ class CompiledIC: public ResourceObj {
 
   address end_of_call() { return  _ic_call->return_address(); }
 
-  // MT-safe patching of inline caches. Note: Only safe to call is_xxx when holding the CompiledIC_ock
-  // so you are guaranteed that no patching takes place. The same goes for verify.
+  // MT-safe patching of inline caches. Note: Only safe to call is_xxx when holding the IC lock
+  // of the enclosing nmethod (see ic_lock()) so you are guaranteed that no patching takes place.
+  // The same goes for verify.
   //
   // Note: We do not provide any direct access to the stub code, to prevent parts of the code
   // to manipulate the inline cache in MT-unsafe ways.
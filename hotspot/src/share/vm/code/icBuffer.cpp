@@ -112,7 +112,7 @@ void InlineCacheBuffer::init_next_stub() {
 
 void InlineCacheBuffer::initialize() {
   if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  _buffer = new StubQueue(new ICStubInterface, InlineCacheBufferSize, InlineCacheBuffer_lock, "InlineCacheBuffer");
   assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
   init_next_stub();
 }
@@ -126,6 +126,11 @@ ICStub* InlineCacheBuffer::new_ic_stub() {
     }
     // we ran out of inline cache buffer space; must enter safepoint.
     // We do this by forcing a safepoint
+    if (TraceICBuffer) {
+      tty->print_cr("[InlineCacheBuffer exhausted (%d stubs live), forcing safepoint;"
+                    " consider a larger -XX:InlineCacheBufferSize]",
+                    buffer()->number_of_stubs());
+    }
     EXCEPTION_MARK;
 
     VM_ForceSafepoint vfs;
@@ -172,7 +177,7 @@ void InlineCacheBuffer_init() {
 
 void InlineCacheBuffer::create_transition_stub(CompiledIC *ic, void* cached_value, address entry) {
   assert(!SafepointSynchronize::is_at_safepoint(), "should not be called during a safepoint");
-  assert (CompiledIC_lock->is_locked(), "");
+  assert (CompiledIC::ic_lock_for(ic->instruction_address())->is_locked(), "");
   if (TraceICBuffer) {
     tty->print_cr("  create transition stub for " INTPTR_FORMAT " destination " INTPTR_FORMAT " cached value " INTPTR_FORMAT,
                   ic->instruction_address(), entry, cached_value);
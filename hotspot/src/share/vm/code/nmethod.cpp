@@ -191,21 +191,20 @@ struct nmethod_stats_struct {
   int pc_desc_resets;   // number of resets (= number of caches)
   int pc_desc_queries;  // queries to nmethod::find_pc_desc
   int pc_desc_approx;   // number of those which have approximate true
-  int pc_desc_repeats;  // number of _pc_descs[0] hits
-  int pc_desc_hits;     // number of LRU cache hits
+  int pc_desc_hits;     // number of direct-mapped cache hits
   int pc_desc_tests;    // total number of PcDesc examinations
   int pc_desc_searches; // total number of quasi-binary search steps
-  int pc_desc_adds;     // number of LUR cache insertions
+  int pc_desc_adds;     // number of cache insertions
 
   void print_pc_stats() {
     tty->print_cr("PcDesc Statistics:  %d queries, %.2f comparisons per query",
                   pc_desc_queries,
                   (double)(pc_desc_tests + pc_desc_searches)
                   / pc_desc_queries);
-    tty->print_cr("  caches=%d queries=%d/%d, hits=%d+%d, tests=%d+%d, adds=%d",
+    tty->print_cr("  caches=%d queries=%d/%d, hits=%d, tests=%d+%d, adds=%d",
                   pc_desc_resets,
                   pc_desc_queries, pc_desc_approx,
-                  pc_desc_repeats, pc_desc_hits,
+                  pc_desc_hits,
                   pc_desc_tests, pc_desc_searches, pc_desc_adds);
   }
 } nmethod_stats;
@@ -299,7 +298,9 @@ static inline bool match_desc(PcDesc* pc, int pc_offset, bool approximate) {
 
 void PcDescCache::reset_to(PcDesc* initial_pc_desc) {
   if (initial_pc_desc == NULL) {
-    _pc_descs[0] = NULL; // native method; no PcDescs at all
+    // native method; no PcDescs at all
+    for (int i = 0; i < cache_size; i++)
+      _pc_descs[i] = NULL;
     return;
   }
   NOT_PRODUCT(++nmethod_stats.pc_desc_resets);
@@ -317,42 +318,28 @@ PcDesc* PcDescCache::find_pc_desc(int pc_offset, bool approximate) {
   // read value separately would be a win, but one would be
   // wrong.  When many threads are updating it, the cache
   // line it's in would bounce between caches, negating
-  // any benefit.
+  // any benefit.  (Threads that really do repeat the same
+  // lookup keep a private memo instead; see
+  // JavaThread::pc_desc_at_with_memo.)
 
   // In order to prevent race conditions do not load cache elements
   // repeatedly, but use a local copy:
-  PcDesc* res;
-
-  // Step one:  Check the most recently added value.
-  res = _pc_descs[0];
+  PcDesc* res = _pc_descs[cache_index(pc_offset)];
   if (res == NULL) return NULL;  // native method; no PcDescs at all
   if (match_desc(res, pc_offset, approximate)) {
-    NOT_PRODUCT(++nmethod_stats.pc_desc_repeats);
+    NOT_PRODUCT(++nmethod_stats.pc_desc_hits);
     return res;
   }
 
-  // Step two:  Check the rest of the LRU cache.
-  for (int i = 1; i < cache_size; ++i) {
-    res = _pc_descs[i];
-    if (res->pc_offset() < 0) break;  // optimization: skip empty cache
-    if (match_desc(res, pc_offset, approximate)) {
-      NOT_PRODUCT(++nmethod_stats.pc_desc_hits);
-      return res;
-    }
-  }
-
   // Report failure.
   return NULL;
 }
 
-void PcDescCache::add_pc_desc(PcDesc* pc_desc) {
+void PcDescCache::add_pc_desc(int pc_offset, PcDesc* pc_desc) {
   NOT_PRODUCT(++nmethod_stats.pc_desc_adds);
-  // Update the LRU cache by shifting pc_desc forward.
-  for (int i = 0; i < cache_size; i++)  {
-    PcDesc* next = _pc_descs[i];
-    _pc_descs[i] = pc_desc;
-    pc_desc = next;
-  }
+  // Record under the offset that was queried, not the PcDesc's own
+  // offset, so that a repeated approximate query hits as well.
+  _pc_descs[cache_index(pc_offset)] = pc_desc;
 }
 
 // adjust pcs_size so that it is a multiple of both oopSize and
@@ -479,8 +466,11 @@ void nmethod::init_defaults() {
   _jmethod_id              = NULL;
   _osr_link                = NULL;
   _scavenge_root_link      = NULL;
+  _registered_link         = NULL;
+  _registered_prev         = NULL;
   _scavenge_root_state     = 0;
   _compiler                = NULL;
+  _compile_time_ms         = 0;
 
 #ifdef HAVE_DTRACE_H
   _trap_offset             = 0;
@@ -505,7 +495,7 @@ nmethod* nmethod::new_native_nmethod(methodHandle method,
     CodeOffsets offsets;
     offsets.set_value(CodeOffsets::Verified_Entry, vep_offset);
     offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
-    nm = new (native_nmethod_size) nmethod(method(), native_nmethod_size,
+    nm = new (native_nmethod_size, CompLevel_none) nmethod(method(), native_nmethod_size,
                                             compile_id, &offsets,
                                             code_buffer, frame_size,
                                             basic_lock_owner_sp_offset,
@@ -543,7 +533,7 @@ nmethod* nmethod::new_dtrace_nmethod(methodHandle method,
     offsets.set_value(CodeOffsets::Dtrace_trap, trap_offset);
     offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
 
-    nm = new (nmethod_size) nmethod(method(), nmethod_size,
+    nm = new (nmethod_size, CompLevel_none) nmethod(method(), nmethod_size,
                                     &offsets, code_buffer, frame_size);
 
     NOT_PRODUCT(if (nm != NULL)  nmethod_stats.note_nmethod(nm));
@@ -591,7 +581,7 @@ nmethod* nmethod::new_nmethod(methodHandle method,
       + round_to(nul_chk_table->size_in_bytes(), oopSize)
       + round_to(debug_info->data_size()       , oopSize);
 
-    nm = new (nmethod_size)
+    nm = new (nmethod_size, comp_level)
     nmethod(method(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -800,9 +790,9 @@ nmethod::nmethod(
 }
 #endif // def HAVE_DTRACE_H
 
-void* nmethod::operator new(size_t size, int nmethod_size) throw() {
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw() {
   // Not critical, may return null if there is too little continuous memory
-  return CodeCache::allocate(nmethod_size);
+  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level));
 }
 
 nmethod::nmethod(
@@ -1126,7 +1116,7 @@ void nmethod::clear_inline_caches() {
 
 void nmethod::cleanup_inline_caches() {
 
-  assert_locked_or_safepoint(CompiledIC_lock);
+  assert_locked_or_safepoint(CompiledIC::ic_lock(this));
 
   // If the method is not entrant or zombie then a JMP is plastered over the
   // first few bytes.  If an oop in the old code was there, that oop
@@ -2110,8 +2100,10 @@ PcDesc* nmethod::find_pc_desc_internal(address pc, bool approximate) {
   assert(upper->pc_offset() >= pc_offset, "sanity")
   assert_LU_OK;
 
-  // Use the last successful return as a split point.
-  PcDesc* mid = _pc_desc_cache.last_pc_desc();
+  // Use the cached entry for this offset's slot as a split point.
+  // After a reset it is the leading sentinel, which leaves the
+  // search bounds unchanged.
+  PcDesc* mid = _pc_desc_cache.cached_pc_desc(pc_offset);
   NOT_PRODUCT(++nmethod_stats.pc_desc_searches);
   if (mid->pc_offset() < pc_offset) {
     lower = mid;
@@ -2152,7 +2144,7 @@ PcDesc* nmethod::find_pc_desc_internal(address pc, bool approximate) {
 
   if (match_desc(upper, pc_offset, approximate)) {
     assert(upper == linear_search(this, pc_offset, approximate), "search ok");
-    _pc_desc_cache.add_pc_desc(upper);
+    _pc_desc_cache.add_pc_desc(pc_offset, upper);
     return upper;
   } else {
     assert(NULL == linear_search(this, pc_offset, approximate), "search ok");
@@ -2215,6 +2207,31 @@ bool nmethod::is_evol_dependent_on(Klass* dependee) {
   return false;
 }
 
+bool nmethod::is_evol_dependent_on(GrowableArray<Method*>* changed_methods) {
+  for (Dependencies::DepStream deps(this); deps.next(); ) {
+    if (deps.type() == Dependencies::evol_method) {
+      Method* method = deps.method_argument(0);
+      for (int j = 0; j < changed_methods->length(); j++) {
+        if (changed_methods->at(j) == method) {
+          // RC_TRACE macro has an embedded ResourceMark
+          RC_TRACE(0x01000000,
+            ("Found evol dependency of nmethod %s.%s(%s) compile_id=%d on changed method %s.%s(%s)",
+            _method->method_holder()->external_name(),
+            _method->name()->as_C_string(),
+            _method->signature()->as_C_string(), compile_id(),
+            method->method_holder()->external_name(),
+            method->name()->as_C_string(),
+            method->signature()->as_C_string()));
+          if (TraceDependencies || LogCompilation)
+            deps.log_dependency(method->method_holder());
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
 // Called from mark_for_deoptimization, when dependee is invalidated.
 bool nmethod::is_dependent_on_method(Method* dependee) {
   for (Dependencies::DepStream deps(this); deps.next(); ) {
@@ -2397,13 +2414,13 @@ void nmethod::verify_interrupt_point(address call_site) {
                       || !this->is_in_use();     // nmethod is installed, but not in 'alive' state
   if (is_installed) {
     Thread *cur = Thread::current();
-    if (CompiledIC_lock->owner() == cur ||
+    if (CompiledIC::ic_lock(this)->owner() == cur ||
         ((cur->is_VM_thread() || cur->is_ConcurrentGC_thread()) &&
          SafepointSynchronize::is_at_safepoint())) {
       CompiledIC_at(this, call_site);
       CHECK_UNHANDLED_OOPS_ONLY(Thread::current()->clear_unhandled_oops());
     } else {
-      MutexLocker ml_verify (CompiledIC_lock);
+      MutexLocker ml_verify (CompiledIC::ic_lock(this));
       CompiledIC_at(this, call_site);
     }
   }
@@ -2916,7 +2933,7 @@ void nmethod::print_calls(outputStream* st) {
     switch (iter.type()) {
     case relocInfo::virtual_call_type:
     case relocInfo::opt_virtual_call_type: {
-      VerifyMutexLocker mc(CompiledIC_lock);
+      VerifyMutexLocker mc(CompiledIC::ic_lock(this));
       CompiledIC_at(iter.reloc())->print();
       break;
     }
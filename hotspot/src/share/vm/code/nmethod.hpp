@@ -68,14 +68,24 @@ class ExceptionCache : public CHeapObj<mtCode> {
 class PcDescCache VALUE_OBJ_CLASS_SPEC {
   friend class VMStructs;
  private:
-  enum { cache_size = 4 };
-  PcDesc* _pc_descs[cache_size]; // last cache_size pc_descs found
+  enum { cache_size = 16 };
+  // The cache is direct-mapped on the queried pc offset.  A successful
+  // search writes exactly one slot, so concurrent readers of other slots
+  // are not invalidated the way they were by the old shifting LRU, and
+  // distinct call sites within the same nmethod no longer evict each other
+  // as long as they hash to different slots.
+  PcDesc* _pc_descs[cache_size];
+  static int cache_index(int pc_offset) {
+    return ((unsigned int) pc_offset >> 2) & (cache_size - 1);
+  }
  public:
   PcDescCache() { debug_only(_pc_descs[0] = NULL); }
   void    reset_to(PcDesc* initial_pc_desc);
   PcDesc* find_pc_desc(int pc_offset, bool approximate);
-  void    add_pc_desc(PcDesc* pc_desc);
-  PcDesc* last_pc_desc() { return _pc_descs[0]; }
+  void    add_pc_desc(int pc_offset, PcDesc* pc_desc);
+  // Raw slot contents for the given offset: a PcDesc of this nmethod,
+  // the leading sentinel, or NULL for a native method.
+  PcDesc* cached_pc_desc(int pc_offset) { return _pc_descs[cache_index(pc_offset)]; }
 };
 
 
@@ -119,6 +129,8 @@ class nmethod : public CodeBlob {
   // To support simple linked-list chaining of nmethods:
   nmethod*  _osr_link;         // from InstanceKlass::osr_nmethods_head
   nmethod*  _scavenge_root_link; // from CodeCache::scavenge_root_nmethods
+  nmethod*  _registered_link;  // from CodeCache::registered_nmethods
+  nmethod*  _registered_prev;  // back link for O(1) removal on free
 
   static nmethod* volatile _oops_do_mark_nmethods;
   nmethod*        volatile _oops_do_mark_link;
@@ -161,6 +173,7 @@ class nmethod : public CodeBlob {
 
   int _compile_id;                           // which compilation made this nmethod
   int _comp_level;                           // compilation level
+  jint _compile_time_ms;                     // wall time spent compiling this nmethod (for diagnostics)
 
   // protected by CodeCache_lock
   bool _has_flushed_dependencies;            // Used for maintenance of dependencies (CodeCache_lock)
@@ -270,7 +283,7 @@ class nmethod : public CodeBlob {
           int comp_level);
 
   // helper methods
-  void* operator new(size_t size, int nmethod_size) throw();
+  void* operator new(size_t size, int nmethod_size, int comp_level) throw();
 
   const char* reloc_string_for(u_char* begin, u_char* end);
   // Returns true if this thread changed the state of the nmethod or
@@ -505,6 +518,11 @@ public:
   nmethod* scavenge_root_link() const                  { return _scavenge_root_link; }
   void     set_scavenge_root_link(nmethod *n)          { _scavenge_root_link = n; }
 
+  nmethod* registered_link() const                     { return _registered_link; }
+  void     set_registered_link(nmethod *n)             { _registered_link = n; }
+  nmethod* registered_prev() const                     { return _registered_prev; }
+  void     set_registered_prev(nmethod *n)             { _registered_prev = n; }
+
  public:
 
   // Sweeper support
@@ -590,7 +608,7 @@ public:
   PcDesc* find_pc_desc_internal(address pc, bool approximate);
 
   PcDesc* find_pc_desc(address pc, bool approximate) {
-    PcDesc* desc = _pc_desc_cache.last_pc_desc();
+    PcDesc* desc = _pc_desc_cache.cached_pc_desc((int)(pc - code_begin()));
     if (desc != NULL && desc->pc_offset() == pc - code_begin()) {
       return desc;
     }
@@ -671,6 +689,11 @@ public:
   int  compile_id() const                         { return _compile_id; }
   const char* compile_kind() const;
 
+  // Wall time spent compiling this nmethod, recorded by the broker when
+  // the compile finishes. Used by the Compiler.method_stats diagnostic command.
+  jint compile_time_ms() const                    { return _compile_time_ms; }
+  void set_compile_time_ms(jint t)                { _compile_time_ms = t; }
+
   // For debugging
   // CompiledIC*    IC_at(char* p) const;
   // PrimitiveIC*   primitiveIC_at(char* p) const;
@@ -689,6 +712,13 @@ public:
   // this compiled method will have to be deoptimized.
   bool is_evol_dependent_on(Klass* dependee);
 
+  // As above, but only considers the given subset of dependee's methods
+  // (the methods that were actually changed or deleted by the current
+  // RedefineClasses() operation). Compiled code whose evolution
+  // dependencies all refer to methods that remained EMCP does not have
+  // to be deoptimized.
+  bool is_evol_dependent_on(GrowableArray<Method*>* changed_methods);
+
   // Fast breakpoint support. Tells if this compiled method is
   // dependent on the given method. Returns true if this nmethod
   // corresponds to the given method as well.
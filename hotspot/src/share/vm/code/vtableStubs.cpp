@@ -34,7 +34,38 @@
 #include "prims/jvmtiExport.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/sharedRuntime.hpp"
+#ifdef TARGET_OS_ARCH_linux_x86
+# include "orderAccess_linux_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_sparc
+# include "orderAccess_linux_sparc.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_zero
+# include "orderAccess_linux_zero.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_solaris_x86
+# include "orderAccess_solaris_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_solaris_sparc
+# include "orderAccess_solaris_sparc.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_windows_x86
+# include "orderAccess_windows_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_arm
+# include "orderAccess_linux_arm.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_ppc
+# include "orderAccess_linux_ppc.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_bsd_x86
+# include "orderAccess_bsd_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_bsd_zero
+# include "orderAccess_bsd_zero.inline.hpp"
+#endif
 #ifdef COMPILER2
 #include "opto/matcher.hpp"
 #endif
@@ -124,7 +155,18 @@ address VtableStubs::find_stub(bool is_vtable_stub, int vtable_index) {
       return NULL;
     }
 
-    enter(is_vtable_stub, vtable_index, s);
+    {
+      MutexLocker ml(VtableStubs_lock);
+      // Since the lookup above is done without the lock, another thread
+      // may have created and entered an equivalent stub in the meantime.
+      // If so use that one and orphan ours (stub chunks are never freed).
+      VtableStub* s2 = ShareVtableStubs ? lookup(is_vtable_stub, vtable_index) : NULL;
+      if (s2 != NULL) {
+        s = s2;
+      } else {
+        enter(is_vtable_stub, vtable_index, s);
+      }
+    }
     if (PrintAdapterHandlers) {
       tty->print_cr("Decoding VtableStub %s[%d]@%d",
                     is_vtable_stub? "vtbl": "itbl", vtable_index, VtableStub::receiver_location());
@@ -142,22 +184,26 @@ inline uint VtableStubs::hash(bool is_vtable_stub, int vtable_index){
 }
 
 
+// The lookup is lock-free: stubs are only ever prepended to the bucket
+// lists (and never removed or modified afterwards), and enter() publishes
+// new list heads with a release store that pairs with the acquire load
+// below. The only writers are serialized by VtableStubs_lock.
 VtableStub* VtableStubs::lookup(bool is_vtable_stub, int vtable_index) {
-  MutexLocker ml(VtableStubs_lock);
   unsigned hash = VtableStubs::hash(is_vtable_stub, vtable_index);
-  VtableStub* s = _table[hash];
+  VtableStub* s = (VtableStub*)OrderAccess::load_ptr_acquire((volatile intptr_t*)&_table[hash]);
   while( s && !s->matches(is_vtable_stub, vtable_index)) s = s->next();
   return s;
 }
 
 
 void VtableStubs::enter(bool is_vtable_stub, int vtable_index, VtableStub* s) {
-  MutexLocker ml(VtableStubs_lock);
+  assert_lock_strong(VtableStubs_lock);
   assert(s->matches(is_vtable_stub, vtable_index), "bad vtable stub");
   unsigned int h = VtableStubs::hash(is_vtable_stub, vtable_index);
-  // enter s at the beginning of the corresponding list
+  // enter s at the beginning of the corresponding list; the release store
+  // makes the fully initialized stub visible to the unlocked lookup()
   s->set_next(_table[h]);
-  _table[h] = s;
+  OrderAccess::release_store_ptr((volatile intptr_t*)&_table[h], (intptr_t)s);
   _number_of_vtable_stubs++;
 }
 
@@ -191,10 +237,29 @@ VtableStub* VtableStubs::stub_containing(address pc) {
   return NULL;
 }
 
+// Eagerly create the stubs for the low vtable indices, which are shared
+// by virtually all classes, so that a startup storm of distinct receiver
+// classes does not pay the creation cost on first dispatch. This must run
+// after stubRoutines_init2() because the generated code jumps to exception
+// throwing entry points that only exist after the second init phase.
+void VtableStubs::pre_generate() {
+  for (intx i = 0; i < PreGenerateVtableStubs; i++) {
+    find_vtable_stub((int)i);
+    find_itable_stub((int)i);
+  }
+}
+
+
 void vtableStubs_init() {
   VtableStubs::initialize();
 }
 
+void vtableStubs_pre_generate() {
+  if (PreGenerateVtableStubs > 0) {
+    VtableStubs::pre_generate();
+  }
+}
+
 
 //-----------------------------------------------------------------------------------------------------
 // Non-product code
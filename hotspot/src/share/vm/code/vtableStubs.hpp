@@ -108,7 +108,7 @@ class VtableStub {
 class VtableStubs : AllStatic {
  public:                                         // N must be public (some compilers need this for _table)
   enum {
-    N    = 256,                                  // size of stub table; must be power of two
+    N    = 1024,                                 // size of stub table; must be power of two
     mask = N - 1
   };
 
@@ -131,6 +131,7 @@ class VtableStubs : AllStatic {
   static VtableStub* stub_containing(address pc);                    // stub containing pc or NULL
   static int         number_of_vtable_stubs() { return _number_of_vtable_stubs; }
   static void        initialize();
+  static void        pre_generate();                                 // eagerly create common stubs (PreGenerateVtableStubs)
 };
 
 #endif // SHARE_VM_CODE_VTABLESTUBS_HPP
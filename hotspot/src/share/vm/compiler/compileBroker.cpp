@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
@@ -156,6 +157,13 @@ PerfCounter* CompileBroker::_perf_sum_osr_bytes_compiled = NULL;
 PerfCounter* CompileBroker::_perf_sum_standard_bytes_compiled = NULL;
 PerfCounter* CompileBroker::_perf_sum_nmethod_size = NULL;
 PerfCounter* CompileBroker::_perf_sum_nmethod_code_size = NULL;
+PerfLongHistogram* CompileBroker::_perf_compile_time_histogram = NULL;
+
+PerfCounter* CompileBroker::_perf_total_queued_count = NULL;
+PerfCounter* CompileBroker::_perf_sum_queue_wait_time = NULL;
+PerfVariable* CompileBroker::_perf_queue_size = NULL;
+PerfVariable* CompileBroker::_perf_peak_queue_size = NULL;
+PerfVariable* CompileBroker::_perf_max_queue_wait_time = NULL;
 
 PerfStringVariable* CompileBroker::_perf_last_method = NULL;
 PerfStringVariable* CompileBroker::_perf_last_failed_method = NULL;
@@ -186,6 +194,7 @@ long CompileBroker::_peak_compilation_time       = 0;
 CompileQueue* CompileBroker::_c2_method_queue    = NULL;
 CompileQueue* CompileBroker::_c1_method_queue    = NULL;
 CompileTask*  CompileBroker::_task_free_list     = NULL;
+MPMCBoundedQueue<CompileTask*, mtCompiler>* CompileBroker::_task_ring = NULL;
 
 GrowableArray<CompilerThread*>* CompileBroker::_compiler_threads = NULL;
 
@@ -285,11 +294,10 @@ void CompileTask::initialize(int compile_id,
   _hot_method = NULL;
   _hot_method_holder = NULL;
   _hot_count = hot_count;
-  _time_queued = 0;  // tidy
+  _time_queued = os::elapsed_counter();
   _comment = comment;
 
   if (LogCompilation) {
-    _time_queued = os::elapsed_counter();
     if (hot_method.not_null()) {
       if (hot_method == method) {
         _hot_method = _method;
@@ -609,6 +617,16 @@ void CompileQueue::add(CompileTask* task) {
   }
   ++_size;
 
+  if (UsePerfData) {
+    CompileBroker::_perf_total_queued_count->inc();
+    CompileBroker::_perf_queue_size->inc();
+    // Both queues share one lock, so the aggregate peak is stable here.
+    jlong queued = CompileBroker::_perf_queue_size->get_value();
+    if (queued > CompileBroker::_perf_peak_queue_size->get_value()) {
+      CompileBroker::_perf_peak_queue_size->set_value(queued);
+    }
+  }
+
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
 
@@ -639,49 +657,27 @@ void CompileQueue::delete_all() {
 //
 // Get the next CompileTask from a CompileQueue
 CompileTask* CompileQueue::get() {
-  NMethodSweeper::possibly_sweep();
-
   MutexLocker locker(lock());
   // If _first is NULL we have no more compile jobs. There are two reasons for
   // having no compile jobs: First, we compiled everything we wanted. Second,
   // we ran out of code cache so compilation has been disabled. In the latter
-  // case we perform code cache sweeps to free memory such that we can re-enable
-  // compilation.
+  // case the dedicated sweeper thread frees memory so that compilation can
+  // eventually be re-enabled.
   while (_first == NULL) {
     // Exit loop if compilation is disabled forever
     if (CompileBroker::is_compilation_disabled_forever()) {
       return NULL;
     }
 
-    if (UseCodeCacheFlushing && !CompileBroker::should_compile_new_jobs()) {
-      // Wait a certain amount of time to possibly do another sweep.
-      // We must wait until stack scanning has happened so that we can
-      // transition a method's state from 'not_entrant' to 'zombie'.
-      long wait_time = NmethodSweepCheckInterval * 1000;
-      if (FLAG_IS_DEFAULT(NmethodSweepCheckInterval)) {
-        // Only one thread at a time can do sweeping. Scale the
-        // wait time according to the number of compiler threads.
-        // As a result, the next sweep is likely to happen every 100ms
-        // with an arbitrary number of threads that do sweeping.
-        wait_time = 100 * CICompilerCount;
-      }
-      bool timeout = lock()->wait(!Mutex::_no_safepoint_check_flag, wait_time);
-      if (timeout) {
-        MutexUnlocker ul(lock());
-        NMethodSweeper::possibly_sweep();
-      }
-    } else {
-      // If there are no compilation tasks and we can compile new jobs
-      // (i.e., there is enough free space in the code cache) there is
-      // no need to invoke the sweeper. As a result, the hotness of methods
-      // remains unchanged. This behavior is desired, since we want to keep
-      // the stable state, i.e., we do not want to evict methods from the
-      // code cache if it is unnecessary.
-      // We need a timed wait here, since compiler threads can exit if compilation
-      // is disabled forever. We use 5 seconds wait time; the exiting of compiler threads
-      // is not critical and we do not want idle compiler threads to wake up too often.
-      lock()->wait(!Mutex::_no_safepoint_check_flag, 5*1000);
-    }
+    // If there are no compilation tasks there is nothing to do here; the
+    // sweeper runs on its own thread, so the hotness of methods remains
+    // unchanged while compiler threads are idle. This behavior is desired,
+    // since we want to keep the stable state, i.e., we do not want to evict
+    // methods from the code cache if it is unnecessary.
+    // We need a timed wait here, since compiler threads can exit if compilation
+    // is disabled forever. We use 5 seconds wait time; the exiting of compiler threads
+    // is not critical and we do not want idle compiler threads to wake up too often.
+    lock()->wait(!Mutex::_no_safepoint_check_flag, 5*1000);
   }
 
   if (CompileBroker::is_compilation_disabled_forever()) {
@@ -690,6 +686,13 @@ CompileTask* CompileQueue::get() {
 
   CompileTask* task = CompilationPolicy::policy()->select_task(this);
   remove(task);
+  if (UsePerfData) {
+    jlong wait_time = os::elapsed_counter() - task->time_queued();
+    CompileBroker::_perf_sum_queue_wait_time->inc(wait_time);
+    if (wait_time > CompileBroker::_perf_max_queue_wait_time->get_value()) {
+      CompileBroker::_perf_max_queue_wait_time->set_value(wait_time);
+    }
+  }
   return task;
 }
 
@@ -712,6 +715,9 @@ void CompileQueue::remove(CompileTask* task)
     _last = task->prev();
   }
   --_size;
+  if (UsePerfData) {
+    CompileBroker::_perf_queue_size->inc((jlong)-1);
+  }
 }
 
 // methods in the compile queue need to be marked as used on the stack
@@ -724,6 +730,66 @@ void CompileQueue::mark_on_stack() {
   }
 }
 
+// ------------------------------------------------------------------
+// CompileRequestBuffer::append
+void CompileRequestBuffer::append(methodHandle method, int comp_level, int hot_count) {
+  assert(!is_full(), "caller must flush first");
+  assert(!_flushing, "no appends while flushing");
+  Request* r = &_requests[_length++];
+  r->_method        = method();
+  r->_method_holder = JNIHandles::make_global(method->method_holder()->klass_holder());
+  r->_comp_level    = comp_level;
+  r->_hot_count     = hot_count;
+}
+
+// ------------------------------------------------------------------
+// CompileRequestBuffer::flush
+//
+// Hand the buffered requests to the broker.  compile_method re-checks
+// each method (it may have been compiled, made not compilable or replaced
+// by RedefineClasses while it sat here) and sees _flushing, so the batch
+// goes down the synchronous path instead of being buffered again.
+void CompileRequestBuffer::flush(Thread* thread) {
+  assert(!_flushing, "no recursive flushes");
+  _flushing = true;
+  for (int i = 0; i < _length; i++) {
+    Request* r = &_requests[i];
+    methodHandle mh(thread, r->_method);
+    CompileBroker::compile_method(mh, InvocationEntryBci, r->_comp_level,
+                                  mh, r->_hot_count, "batched counter overflow",
+                                  thread);
+    // The method holder must stay reachable until the request is in the
+    // queue, where the CompileTask has its own handle.
+    JNIHandles::destroy_global(r->_method_holder);
+  }
+  _length   = 0;
+  _flushing = false;
+}
+
+// ------------------------------------------------------------------
+// CompileRequestBuffer::discard
+//
+// Drop the buffered requests without queueing them, used when the owning
+// thread exits.  The methods stay interpreted until their counters
+// overflow again on some other thread.
+void CompileRequestBuffer::discard() {
+  for (int i = 0; i < _length; i++) {
+    JNIHandles::destroy_global(_requests[i]._method_holder);
+  }
+  _length = 0;
+}
+
+// ------------------------------------------------------------------
+// CompileRequestBuffer::mark_on_stack
+//
+// Buffered methods need to be marked as used on the stack so that they
+// don't get reclaimed by Redefine Classes, like queued CompileTasks.
+void CompileRequestBuffer::mark_on_stack() {
+  for (int i = 0; i < _length; i++) {
+    _requests[i]._method->set_on_stack(true);
+  }
+}
+
 // ------------------------------------------------------------------
 // CompileQueue::print
 void CompileQueue::print() {
@@ -810,6 +876,7 @@ void CompileBroker::compilation_init() {
 
   // Initialize the CompileTask free list
   _task_free_list = NULL;
+  _task_ring = new MPMCBoundedQueue<CompileTask*, mtCompiler>(128);
 
   // Start the CompilerThreads
   init_compiler_threads(c1_count, c2_count);
@@ -871,6 +938,36 @@ void CompileBroker::compilation_init() {
                  PerfDataManager::create_counter(SUN_CI, "nmethodCodeSize",
                                                  PerfData::U_Bytes, CHECK);
 
+    // Distribution of successful compilation times in microseconds,
+    // log-linear bucketed. 96 buckets cover up to ~30 seconds.
+    _perf_compile_time_histogram =
+                 PerfDataManager::create_long_histogram(SUN_CI,
+                                                 "compileTimeMicrosDistribution",
+                                                 PerfData::U_Events, 96, CHECK);
+
+    _perf_total_queued_count =
+                 PerfDataManager::create_counter(SUN_CI, "queuedCompiles",
+                                                 PerfData::U_Events, CHECK);
+
+    _perf_sum_queue_wait_time =
+                 PerfDataManager::create_counter(SUN_CI, "queueWaitTime",
+                                                 PerfData::U_Ticks, CHECK);
+
+    _perf_queue_size =
+             PerfDataManager::create_variable(SUN_CI, "queueSize",
+                                              PerfData::U_None,
+                                              (jlong)0, CHECK);
+
+    _perf_peak_queue_size =
+             PerfDataManager::create_variable(SUN_CI, "peakQueueSize",
+                                              PerfData::U_None,
+                                              (jlong)0, CHECK);
+
+    _perf_max_queue_wait_time =
+             PerfDataManager::create_variable(SUN_CI, "maxQueueWaitTime",
+                                              PerfData::U_Ticks,
+                                              (jlong)0, CHECK);
+
     _perf_last_method =
                  PerfDataManager::create_string_variable(SUN_CI, "lastMethod",
                                        CompilerCounters::cmname_buffer_length,
@@ -1041,6 +1138,23 @@ void CompileBroker::init_compiler_threads(int c1_compiler_count, int c2_compiler
 }
 
 
+// Returns true if any compiler thread is currently processing a task.
+// The task fields are read without a lock so the answer is only a
+// snapshot; it is exact once the queues are empty and no more requests
+// are being submitted, which is how the WhiteBox API uses it.
+bool CompileBroker::is_compiling() {
+  if (_compiler_threads == NULL) {
+    return false;
+  }
+  for (int i = 0; i < _compiler_threads->length(); i++) {
+    if (_compiler_threads->at(i)->task() != NULL) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
 // Set the methods on the stack as on_stack so that redefine classes doesn't
 // reclaim them
 void CompileBroker::mark_on_stack() {
@@ -1050,6 +1164,18 @@ void CompileBroker::mark_on_stack() {
   if (_c1_method_queue != NULL) {
     _c1_method_queue->mark_on_stack();
   }
+  if (BatchCompileRequests) {
+    // Requests still sitting in per-thread buffers must survive
+    // RedefineClasses as well.  We are at a safepoint, so walking the
+    // thread list is safe.
+    assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+    for (JavaThread* thread = Threads::first(); thread != NULL; thread = thread->next()) {
+      CompileRequestBuffer* buffer = thread->compile_request_buffer();
+      if (buffer != NULL) {
+        buffer->mark_on_stack();
+      }
+    }
+  }
 }
 
 // ------------------------------------------------------------------
@@ -1263,6 +1389,31 @@ nmethod* CompileBroker::compile_method(methodHandle method, int osr_bci,
     if (method->is_not_osr_compilable(comp_level)) return NULL;
   }
 
+  // Batch standard background requests from Java threads: append the
+  // request to the thread's buffer and return, handing the whole batch to
+  // the queue once the buffer is full.  OSR requests stay synchronous (a
+  // loop is waiting for the result), as do native methods (their lookup
+  // below must run on the requesting thread) and everything when
+  // compilation is foreground and the caller would block anyway.
+  if (BatchCompileRequests && BackgroundCompilation &&
+      osr_bci == InvocationEntryBci &&
+      !method->is_native() && THREAD->is_Java_thread()) {
+    JavaThread* jt = (JavaThread*) THREAD;
+    CompileRequestBuffer* buffer = jt->compile_request_buffer();
+    if (buffer == NULL) {
+      buffer = new CompileRequestBuffer();
+      jt->set_compile_request_buffer(buffer);
+    }
+    if (!buffer->is_flushing()) {
+      if (buffer->is_full()) {
+        buffer->flush(THREAD);
+      }
+      buffer->append(method, comp_level, hot_count);
+      return NULL;
+    }
+    // Re-entered from flush(); fall through to the synchronous path.
+  }
+
   assert(!HAS_PENDING_EXCEPTION, "No exception should be present");
   // some prerequisites that are compiler specific
   if (comp->is_c2() || comp->is_shark()) {
@@ -1497,8 +1648,13 @@ CompileTask* CompileBroker::create_compile_task(CompileQueue* queue,
 //
 // Allocate a CompileTask, from the free list if possible.
 CompileTask* CompileBroker::allocate_task() {
-  MutexLocker locker(CompileTaskAlloc_lock);
   CompileTask* task = NULL;
+  // Fast path: take a recycled task from the lock-free ring.
+  if (_task_ring != NULL && _task_ring->pop(&task)) {
+    task->set_next(NULL);
+    return task;
+  }
+  MutexLocker locker(CompileTaskAlloc_lock);
   if (_task_free_list != NULL) {
     task = _task_free_list;
     _task_free_list = task->next();
@@ -1516,8 +1672,14 @@ CompileTask* CompileBroker::allocate_task() {
 //
 // Add a task to the free list.
 void CompileBroker::free_task(CompileTask* task) {
-  MutexLocker locker(CompileTaskAlloc_lock);
   task->free();
+  task->set_next(NULL);
+  // Fast path: hand the task to the lock-free ring; fall back to the
+  // linked list under the lock when the ring is full.
+  if (_task_ring != NULL && _task_ring->push(task)) {
+    return;
+  }
+  MutexLocker locker(CompileTaskAlloc_lock);
   task->set_next(_task_free_list);
   _task_free_list = task;
 }
@@ -1832,14 +1994,14 @@ void CompileBroker::maybe_block() {
 static void codecache_print(bool detailed)
 {
   ResourceMark rm;
-  stringStream s;
+  segmentedStream s;
   // Dump code cache  into a buffer before locking the tty,
   {
     MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
     CodeCache::print_summary(&s, detailed);
   }
   ttyLocker ttyl;
-  tty->print(s.as_string());
+  s.copy_to(tty);
 }
 
 // ------------------------------------------------------------------
@@ -1886,6 +2048,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     DTRACE_METHOD_COMPILE_BEGIN_PROBE(method, compiler_name(task_level));
   }
 
+  Events::log_vm_event(thread, VMTraceEvent::COMPILE_BEGIN,
+                       (intptr_t) compile_id, (intptr_t) task_level);
+
   // Allocate a new set of JNI handles.
   push_jni_handle_block();
   Method* target_handle = task->method();
@@ -1978,6 +2143,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   DTRACE_METHOD_COMPILE_END_PROBE(method, compiler_name(task_level), task->is_success());
 
+  Events::log_vm_event(thread, VMTraceEvent::COMPILE_END,
+                       (intptr_t) compile_id, (intptr_t) task_level);
+
   collect_statistics(thread, time, task);
 
   if (PrintCompilation && PrintCompilation2) {
@@ -2037,14 +2205,14 @@ void CompileBroker::handle_full_code_cache() {
   if (UseCompiler || AlwaysCompileLoopMethods ) {
     if (xtty != NULL) {
       ResourceMark rm;
-      stringStream s;
+      segmentedStream s;
       // Dump code cache state into a buffer before locking the tty,
       // because log_state() will use locks causing lock conflicts.
       CodeCache::log_state(&s);
       // Lock to prevent tearing
       ttyLocker ttyl;
       xtty->begin_elem("code_cache_full");
-      xtty->print(s.as_string());
+      s.copy_to(xtty);
       xtty->stamp();
       xtty->end_elem();
     }
@@ -2064,10 +2232,10 @@ void CompileBroker::handle_full_code_cache() {
       if (CompileBroker::set_should_compile_new_jobs(CompileBroker::stop_compilation)) {
         NMethodSweeper::log_sweep("disable_compiler");
       }
-      // Switch to 'vm_state'. This ensures that possibly_sweep() can be called
-      // without having to consider the state in which the current thread is.
+      // Wake up the sweeper thread so that it starts freeing memory as
+      // soon as stack scanning permits.
       ThreadInVMfromUnknown in_vm;
-      NMethodSweeper::possibly_sweep();
+      NMethodSweeper::notify();
     } else {
       disable_compilation_forever();
     }
@@ -2223,6 +2391,10 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
     _t_total_compilation.add(time);
     _peak_compilation_time = time.milliseconds() > _peak_compilation_time ? time.milliseconds() : _peak_compilation_time;
 
+    // Record the compile time in the nmethod for the per-method
+    // accounting surface (Compiler.method_stats).
+    code->set_compile_time_ms((jint)time.milliseconds());
+
     if (CITime) {
       if (is_osr) {
         _t_osr_compilation.add(time);
@@ -2246,6 +2418,7 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
         _perf_standard_compilation->inc(time.ticks());
         _perf_sum_standard_bytes_compiled->inc(method->code_size() + task->num_inlined_bytecodes());
       }
+      _perf_compile_time_histogram->record((jlong)(time.seconds() * 1000000.0));
     }
 
     if (CITimeEach) {
@@ -2286,6 +2459,239 @@ const char* CompileBroker::compiler_name(int comp_level) {
   }
 }
 
+// ------------------------------------------------------------------
+// CompileBroker::record_compilations
+//
+// Write one line per alive nmethod (class name, method name, signature
+// and compilation level) to CompilationRecordFile. A future run started
+// with -XX:CompilationWarmUpFile pointing at this file requests
+// compilation of the same methods during startup, so peak code is
+// available long before the counters would have triggered it. We record
+// method identities rather than code bytes: an nmethod embeds raw
+// Metadata* and oop pointers, inline cache states and class-dependent
+// optimizations that cannot be validated cheaply in another process.
+void CompileBroker::record_compilations() {
+  assert(CompilationRecordFile != NULL, "sanity");
+  FILE* file = fopen(CompilationRecordFile, "w");
+  if (file == NULL) {
+    warning("Could not open CompilationRecordFile [%s]", CompilationRecordFile);
+    return;
+  }
+  {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    for (nmethod* nm = CodeCache::alive_nmethod(CodeCache::first());
+         nm != NULL;
+         nm = CodeCache::alive_nmethod(CodeCache::next(nm))) {
+      Method* m = nm->method();
+      if (m == NULL || m->is_native() || nm->is_osr_method()) {
+        continue;
+      }
+      // Anonymous classes have no stable name to resolve in the next run.
+      if (m->method_holder()->is_anonymous()) {
+        continue;
+      }
+      ResourceMark rm;
+      fprintf(file, "%s %s %s %d\n",
+              m->method_holder()->name()->as_C_string(),
+              m->name()->as_C_string(),
+              m->signature()->as_C_string(),
+              nm->comp_level());
+    }
+  }
+  fclose(file);
+}
+
+// ------------------------------------------------------------------
+// CompileBroker::warm_up_compilations
+//
+// Read a file written by record_compilations() and request compilation
+// of each listed method. Classes are resolved through the system class
+// loader and initialized eagerly (compilation requires an initialized
+// holder), which is the documented cost of opting into the warmup file.
+// Entries that no longer resolve, e.g. after a code change, are skipped.
+void CompileBroker::warm_up_compilations(TRAPS) {
+  assert(CompilationWarmUpFile != NULL, "sanity");
+  FILE* file = fopen(CompilationWarmUpFile, "r");
+  if (file == NULL) {
+    warning("Could not open CompilationWarmUpFile [%s]", CompilationWarmUpFile);
+    return;
+  }
+  HandleMark hm(THREAD);
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  char line[4096];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    char klass_name[1024];
+    char method_name[1024];
+    char signature[2048];
+    int comp_level;
+    if (sscanf(line, "%1023s %1023s %2047s %d",
+               klass_name, method_name, signature, &comp_level) != 4) {
+      continue;
+    }
+    ResourceMark rm(THREAD);
+    TempNewSymbol klass_sym = SymbolTable::new_symbol(klass_name, CHECK);
+    Klass* k = SystemDictionary::resolve_or_null(klass_sym, loader, Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    if (k == NULL || !k->oop_is_instance()) {
+      continue;
+    }
+    instanceKlassHandle ik(THREAD, k);
+    ik->initialize(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    TempNewSymbol name_sym = SymbolTable::new_symbol(method_name, CHECK);
+    TempNewSymbol sig_sym  = SymbolTable::new_symbol(signature, CHECK);
+    Method* m = ik->find_method(name_sym, sig_sym);
+    if (m == NULL) {
+      continue;
+    }
+    methodHandle mh(THREAD, m);
+    if (TieredCompilation) {
+      comp_level = MIN2(comp_level, (int)TieredStopAtLevel);
+    } else {
+      comp_level = CompLevel_highest_tier;
+    }
+    if (comp_level < CompLevel_simple ||
+        !CompilationPolicy::can_be_compiled(mh, comp_level)) {
+      continue;
+    }
+    compile_method(mh, InvocationEntryBci, comp_level,
+                   methodHandle(), 0, "warmup", THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+    }
+  }
+  fclose(file);
+}
+
+// Target file for record_one_profile() while record_profiles() runs.
+static FILE* _profile_record_file = NULL;
+
+static void record_one_profile(Method* m) {
+  if (m->is_native() || m->method_holder()->is_anonymous()) {
+    return;
+  }
+  int invocations = m->invocation_count();
+  int backedges   = m->backedge_count();
+  // Keep the file compact: methods this cold gain nothing from seeding,
+  // they would not have reached any policy threshold soon anyway.
+  if (invocations + backedges < 128) {
+    return;
+  }
+  ResourceMark rm;
+  fprintf(_profile_record_file, "%s %s %s %d %d\n",
+          m->method_holder()->name()->as_C_string(),
+          m->name()->as_C_string(),
+          m->signature()->as_C_string(),
+          invocations, backedges);
+}
+
+// ------------------------------------------------------------------
+// CompileBroker::record_profiles
+//
+// Write one line per warm method (class name, method name, signature,
+// invocation count and backedge count) to ProfileRecordFile. Unlike
+// record_compilations() this covers interpreted methods too, so a
+// future run started with -XX:ProfileSeedFile can pre-charge their
+// counters and let the tiered policy promote them organically instead
+// of re-climbing the thresholds from zero.
+void CompileBroker::record_profiles() {
+  assert(ProfileRecordFile != NULL, "sanity");
+  FILE* file = fopen(ProfileRecordFile, "w");
+  if (file == NULL) {
+    warning("Could not open ProfileRecordFile [%s]", ProfileRecordFile);
+    return;
+  }
+  _profile_record_file = file;
+  {
+    MutexLocker mu(SystemDictionary_lock);
+    SystemDictionary::methods_do(record_one_profile);
+  }
+  _profile_record_file = NULL;
+  fclose(file);
+}
+
+// ------------------------------------------------------------------
+// CompileBroker::seed_profiles
+//
+// Read a file written by record_profiles() and pre-charge the
+// invocation and backedge counters of each listed method, allocating
+// its MethodData up front when the interpreter profiles. The counters
+// feed the normal overflow notifications, so the compilation policy
+// sees a known-hot method on its first few invocations and promotes it
+// through the usual path - no compilation is forced here and classes
+// are only loaded, not initialized. Entries that no longer resolve are
+// skipped, as in warm_up_compilations().
+void CompileBroker::seed_profiles(TRAPS) {
+  assert(ProfileSeedFile != NULL, "sanity");
+  FILE* file = fopen(ProfileSeedFile, "r");
+  if (file == NULL) {
+    warning("Could not open ProfileSeedFile [%s]", ProfileSeedFile);
+    return;
+  }
+  HandleMark hm(THREAD);
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  char line[4096];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    char klass_name[1024];
+    char method_name[1024];
+    char signature[2048];
+    int invocations;
+    int backedges;
+    if (sscanf(line, "%1023s %1023s %2047s %d %d",
+               klass_name, method_name, signature,
+               &invocations, &backedges) != 5) {
+      continue;
+    }
+    ResourceMark rm(THREAD);
+    TempNewSymbol klass_sym = SymbolTable::new_symbol(klass_name, CHECK);
+    Klass* k = SystemDictionary::resolve_or_null(klass_sym, loader, Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    if (k == NULL || !k->oop_is_instance()) {
+      continue;
+    }
+    instanceKlassHandle ik(THREAD, k);
+    TempNewSymbol name_sym = SymbolTable::new_symbol(method_name, CHECK);
+    TempNewSymbol sig_sym  = SymbolTable::new_symbol(signature, CHECK);
+    Method* m = ik->find_method(name_sym, sig_sym);
+    if (m == NULL || m->is_native()) {
+      continue;
+    }
+    methodHandle mh(THREAD, m);
+    MethodCounters* mcs = mh->get_method_counters(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    if (mcs == NULL) {
+      continue;
+    }
+    // Stay below the sticky-carry limit; negative or oversized values
+    // mean a corrupt line and are clamped rather than trusted.
+    invocations = MAX2(0, MIN2(invocations, (int)InvocationCounter::count_limit - 1));
+    backedges   = MAX2(0, MIN2(backedges,   (int)InvocationCounter::count_limit - 1));
+    InvocationCounter* ic = mcs->invocation_counter();
+    ic->set(ic->state(), invocations);
+    InvocationCounter* bc = mcs->backedge_counter();
+    bc->set(bc->state(), backedges);
+    if (ProfileInterpreter && mh->method_data() == NULL) {
+      Method::build_interpreter_method_data(mh, THREAD);
+      if (HAS_PENDING_EXCEPTION) {
+        CLEAR_PENDING_EXCEPTION;
+      }
+    }
+  }
+  fclose(file);
+}
+
 void CompileBroker::print_times() {
   tty->cr();
   tty->print_cr("Accumulated compiler times (for compiled methods only)");
@@ -28,6 +28,7 @@
 #include "ci/compilerInterface.hpp"
 #include "compiler/abstractCompiler.hpp"
 #include "runtime/perfData.hpp"
+#include "utilities/mpmcBoundedQueue.hpp"
 
 class nmethod;
 class nmethodLocker;
@@ -53,8 +54,9 @@ class CompileTask : public CHeapObj<mtCompiler> {
   nmethodLocker* _code_handle;  // holder of eventual result
   CompileTask* _next, *_prev;
 
+  jlong        _time_queued;  // in units of os::elapsed_counter(), used for
+                              // starvation aging and queue wait time counters
   // Fields used for logging why the compilation was initiated:
-  jlong        _time_queued;  // in units of os::elapsed_counter()
   Method*      _hot_method;   // which method actually triggered this task
   jobject      _hot_method_holder;
   int          _hot_count;    // information about its invocation counter
@@ -91,6 +93,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int          comp_level()                      { return _comp_level;}
   void         set_comp_level(int comp_level)    { _comp_level = comp_level;}
 
+  jlong        time_queued() const               { return _time_queued; }
+
   int          num_inlined_bytecodes() const     { return _num_inlined_bytecodes; }
   void         set_num_inlined_bytecodes(int n)  { _num_inlined_bytecodes = n; }
 
@@ -221,6 +225,45 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   }
 };
 
+// CompileRequestBuffer
+//
+// A small per-thread buffer of deferred compilation requests, used when
+// BatchCompileRequests is on.  Standard background requests append here
+// instead of going to the broker synchronously; once the buffer fills up
+// the whole batch is handed over, so a thread executing many warm methods
+// does not make one broker call per counter overflow.  Like CompileTask,
+// each entry keeps a global handle to the method holder's class loader so
+// the method cannot be unloaded while it sits in the buffer.
+class CompileRequestBuffer : public CHeapObj<mtCompiler> {
+ private:
+  enum { buffer_size = 8 };
+
+  struct Request {
+    Method* _method;
+    jobject _method_holder;    // keeps the method alive while buffered
+    int     _comp_level;
+    int     _hot_count;
+  };
+
+  Request _requests[buffer_size];
+  int     _length;
+  bool    _flushing;           // true while flush() drains the buffer
+
+ public:
+  CompileRequestBuffer() : _length(0), _flushing(false) { }
+  ~CompileRequestBuffer() { discard(); }
+
+  bool is_full() const                           { return _length == buffer_size; }
+  bool is_flushing() const                       { return _flushing; }
+
+  void append(methodHandle method, int comp_level, int hot_count);
+  void flush(Thread* thread);  // hand buffered requests to the broker
+  void discard();              // drop buffered requests (thread exit)
+
+  // Redefine Classes support
+  void mark_on_stack();
+};
+
 // CompileTaskWrapper
 //
 // Assign this task to the current thread.  Deallocate the task
@@ -238,6 +281,7 @@ public:
 class CompileBroker: AllStatic {
  friend class Threads;
   friend class CompileTaskWrapper;
+  friend class CompileQueue; // For queue depth and wait time counters
 
  public:
   enum {
@@ -269,6 +313,9 @@ class CompileBroker: AllStatic {
   static CompileQueue* _c2_method_queue;
   static CompileQueue* _c1_method_queue;
   static CompileTask* _task_free_list;
+  // Lock-free front end of the free list; the linked list above is the
+  // overflow when the ring is full or empty.
+  static MPMCBoundedQueue<CompileTask*, mtCompiler>* _task_ring;
 
   static GrowableArray<CompilerThread*>* _compiler_threads;
 
@@ -289,6 +336,13 @@ class CompileBroker: AllStatic {
   static PerfCounter* _perf_sum_standard_bytes_compiled;
   static PerfCounter* _perf_sum_nmethod_size;
   static PerfCounter* _perf_sum_nmethod_code_size;
+  static PerfLongHistogram* _perf_compile_time_histogram;
+
+  static PerfCounter* _perf_total_queued_count;
+  static PerfCounter* _perf_sum_queue_wait_time;
+  static PerfVariable* _perf_queue_size;
+  static PerfVariable* _perf_peak_queue_size;
+  static PerfVariable* _perf_max_queue_wait_time;
 
   static PerfStringVariable* _perf_last_method;
   static PerfStringVariable* _perf_last_failed_method;
@@ -377,6 +431,7 @@ class CompileBroker: AllStatic {
     CompileQueue *q = compile_queue(comp_level);
     return q != NULL ? q->size() : 0;
   }
+  static bool is_compiling();
   static void compilation_init();
   static void init_compiler_thread_log();
   static nmethod* compile_method(methodHandle method,
@@ -389,6 +444,18 @@ class CompileBroker: AllStatic {
   static void compiler_thread_loop();
   static uint get_compilation_id() { return _compilation_id; }
 
+  // Support for CompilationRecordFile/CompilationWarmUpFile: record the
+  // names and levels of compiled methods at VM exit so that the next run
+  // can request their compilation again during startup.
+  static void record_compilations();
+  static void warm_up_compilations(TRAPS);
+
+  // Support for ProfileRecordFile/ProfileSeedFile: record per-method
+  // invocation and backedge counts at VM exit so that the next run can
+  // pre-charge the counters and promote known-hot methods immediately.
+  static void record_profiles();
+  static void seed_profiles(TRAPS);
+
   // Set _should_block.
   // Call this from the VM, with Threads_lock held and a safepoint requested.
   static void set_should_block();
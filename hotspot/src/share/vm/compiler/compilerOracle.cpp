@@ -215,6 +215,7 @@ enum OracleCommand {
   ExcludeCommand,
   InlineCommand,
   DontInlineCommand,
+  PureCommand,
   CompileOnlyCommand,
   LogCommand,
   OptionCommand,
@@ -230,6 +231,7 @@ static const char * command_names[] = {
   "exclude",
   "inline",
   "dontinline",
+  "pure",
   "compileonly",
   "log",
   "option",
@@ -303,6 +305,11 @@ bool CompilerOracle::should_not_inline(methodHandle method) {
 }
 
 
+bool CompilerOracle::should_be_pure(methodHandle method) {
+  return (check_predicate(PureCommand, method));
+}
+
+
 bool CompilerOracle::should_print(methodHandle method) {
   return (check_predicate(PrintCommand, method));
 }
@@ -52,6 +52,11 @@ class CompilerOracle : AllStatic {
   // Tells whether we want to disallow inlining of this method
   static bool should_not_inline(methodHandle method);
 
+  // Tells whether the compiler may treat this method as free of side
+  // effects with a result depending only on its arguments and the
+  // memory it reads
+  static bool should_be_pure(methodHandle method);
+
   // Tells whether we should print the assembly for this method
   static bool should_print(methodHandle method);
 
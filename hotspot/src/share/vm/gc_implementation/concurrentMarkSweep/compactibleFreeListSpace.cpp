@@ -2750,6 +2750,14 @@ void CompactibleFreeListSpace:: par_get_chunk_of_blocks(size_t word_sz, size_t n
          (cur_sz < CompactibleFreeListSpace::IndexSetSize) &&
          (CMSSplitIndexedFreeListBlocks || k <= 1);
          k++, cur_sz = k * word_sz) {
+      // Racy read of the count, used only as a hint so that we do not
+      // take (and bounce between workers) the per-size lock for lists
+      // that are empty, which is the common case once the indexed lists
+      // have been picked clean and refills feed off the dictionary.
+      // The count is re-read under the lock before any chunks are taken.
+      if (_indexedFreeList[cur_sz].count() == 0) {
+        continue;
+      }
       AdaptiveFreeList<FreeChunk> fl_for_cur_sz;  // Empty.
       fl_for_cur_sz.set_size(cur_sz);
       {
@@ -2782,28 +2790,33 @@ void CompactibleFreeListSpace:: par_get_chunk_of_blocks(size_t word_sz, size_t n
           // Divide each block on fl_for_cur_sz up k ways.
           FreeChunk* fc;
           while ((fc = fl_for_cur_sz.get_chunk_at_head()) != NULL) {
-            // Must do this in reverse order, so that anybody attempting to
-            // access the main chunk sees it as a single free block until we
-            // change it.
-            size_t fc_size = fc->size();
-            assert(fc->is_free(), "Error");
-            for (int i = k-1; i >= 0; i--) {
+            assert(fc->is_free() && fc->size() == k*word_sz, "Error");
+            // Carve the headers from the right, so that anybody
+            // attempting to access the main chunk sees it as a single
+            // free block until the first (leftmost) piece is resized
+            // below.
+            for (int i = k-1; i > 0; i--) {
               FreeChunk* ffc = (FreeChunk*)((HeapWord*)fc + i * word_sz);
-              assert((i != 0) ||
-                        ((fc == ffc) && ffc->is_free() &&
-                         (ffc->size() == k*word_sz) && (fc_size == word_sz)),
-                        "Counting error");
               ffc->set_size(word_sz);
               ffc->link_prev(NULL); // Mark as a free block for other (parallel) GC threads.
               ffc->link_next(NULL);
-              // Above must occur before BOT is updated below.
-              OrderAccess::storestore();
-              // splitting from the right, fc_size == i * word_sz
-              _bt.mark_block((HeapWord*)ffc, word_sz, true /* reducing */);
-              fc_size -= word_sz;
-              assert(fc_size == i*word_sz, "Error");
+            }
+            // The piece headers must be visible before the first
+            // piece's header stops covering the whole chunk...
+            OrderAccess::storestore();
+            fc->set_size(word_sz);
+            fc->link_prev(NULL);
+            fc->link_next(NULL);
+            // ... and all of the headers before the BOT entries that
+            // reference them.  Updating the BOT in one bulk pass here
+            // needs only the two fences above, where marking each
+            // piece separately would need one per piece.
+            OrderAccess::storestore();
+            _bt.mark_uniform_blocks((HeapWord*)fc, (size_t)k, word_sz,
+                                    true /* reducing */);
+            for (int i = k-1; i >= 0; i--) {
+              FreeChunk* ffc = (FreeChunk*)((HeapWord*)fc + i * word_sz);
               _bt.verify_not_unallocated((HeapWord*)ffc, word_sz);
-              _bt.verify_single_block((HeapWord*)fc, fc_size);
               _bt.verify_single_block((HeapWord*)ffc, word_sz);
               // Push this on "fl".
               fl->return_chunk_at_head(ffc);
@@ -2902,36 +2915,36 @@ void CompactibleFreeListSpace:: par_get_chunk_of_blocks(size_t word_sz, size_t n
   }
   assert((ssize_t)n > 0 && fc != NULL, "Consistency");
   // Now do the splitting up.
-  // Must do this in reverse order, so that anybody attempting to
-  // access the main chunk sees it as a single free block until we
-  // change it.
-  size_t fc_size = n * word_sz;
+  // Carve the headers from the right, so that anybody attempting to
+  // access the main chunk sees it as a single free block until the
+  // first (leftmost) piece is resized below.
   // All but first chunk in this loop
   for (ssize_t i = n-1; i > 0; i--) {
     FreeChunk* ffc = (FreeChunk*)((HeapWord*)fc + i * word_sz);
     ffc->set_size(word_sz);
     ffc->link_prev(NULL); // Mark as a free block for other (parallel) GC threads.
     ffc->link_next(NULL);
-    // Above must occur before BOT is updated below.
-    OrderAccess::storestore();
-    // splitting from the right, fc_size == (n - i + 1) * wordsize
-    _bt.mark_block((HeapWord*)ffc, word_sz, true /* reducing */);
-    fc_size -= word_sz;
-    _bt.verify_not_unallocated((HeapWord*)ffc, ffc->size());
-    _bt.verify_single_block((HeapWord*)ffc, ffc->size());
-    _bt.verify_single_block((HeapWord*)fc, fc_size);
-    // Push this on "fl".
-    fl->return_chunk_at_head(ffc);
   }
-  // First chunk
+  // First chunk.  The piece headers above must be visible before the
+  // first piece's header stops covering the whole prefix...
+  OrderAccess::storestore();
   assert(fc->is_free() && fc->size() == n*word_sz, "Error: should still be a free block");
-  // The blocks above should show their new sizes before the first block below
   fc->set_size(word_sz);
   fc->link_prev(NULL);    // idempotent wrt free-ness, see assert above
   fc->link_next(NULL);
-  _bt.verify_not_unallocated((HeapWord*)fc, fc->size());
-  _bt.verify_single_block((HeapWord*)fc, fc->size());
-  fl->return_chunk_at_head(fc);
+  // ... and all of the headers before the BOT entries that reference
+  // them.  Updating the BOT in one bulk pass here needs only the two
+  // fences above, where marking each piece separately would need one
+  // per piece.
+  OrderAccess::storestore();
+  _bt.mark_uniform_blocks((HeapWord*)fc, n, word_sz, true /* reducing */);
+  for (ssize_t i = n-1; i >= 0; i--) {
+    FreeChunk* ffc = (FreeChunk*)((HeapWord*)fc + i * word_sz);
+    _bt.verify_not_unallocated((HeapWord*)ffc, word_sz);
+    _bt.verify_single_block((HeapWord*)ffc, word_sz);
+    // Push this on "fl".
+    fl->return_chunk_at_head(ffc);
+  }
 
   assert((ssize_t)n > 0 && (ssize_t)n == fl->count(), "Incorrect number of blocks");
   {
@@ -28,6 +28,7 @@
 #include "gc_implementation/g1/g1CollectorPolicy.hpp"
 #include "gc_implementation/g1/g1ErgoVerbose.hpp"
 #include "memory/space.inline.hpp"
+#include "utilities/parallelSort.hpp"
 
 // Even though we don't use the GC efficiency in our heuristics as
 // much as we used to, we still order according to GC efficiency. This
@@ -129,7 +130,18 @@ void CollectionSetChooser::sort_regions() {
            "Or we didn't reserved enough length");
     regions_trunc_to(_first_par_unreserved_idx);
   }
-  _regions.sort(order_regions);
+  // This runs in the Cleanup pause; with many candidate regions the sort
+  // is worth spreading over the GC worker gang.  ParallelSort falls back
+  // to the serial quicksort below its length threshold.
+  FlexibleWorkGang* workers = G1CollectedHeap::heap()->workers();
+  if (G1CollectedHeap::use_parallel_gc_threads() &&
+      workers != NULL && regions_length() > 0) {
+    ParallelSort::sort(workers, _regions.adr_at(0), (size_t)regions_length(),
+                       static_cast<int (*)(HeapRegion*, HeapRegion*)>(order_regions),
+                       false);
+  } else {
+    _regions.sort(order_regions);
+  }
   assert(_length <= regions_length(), "Requirement");
 #ifdef ASSERT
   for (uint i = 0; i < _length; i++) {
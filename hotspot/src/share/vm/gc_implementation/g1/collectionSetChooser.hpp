@@ -110,6 +110,7 @@ public:
     assert(hr->is_marked(), "pre-condition");
     assert(!hr->is_young(), "should never consider young regions");
     return !hr->isHumongous() &&
+           !hr->is_pinned() &&
             hr->live_bytes() < _region_live_threshold_bytes;
   }
 
@@ -25,11 +25,15 @@
 #include "precompiled.hpp"
 #include "gc_implementation/g1/concurrentG1Refine.hpp"
 #include "gc_implementation/g1/concurrentG1RefineThread.hpp"
+#include "gc_implementation/g1/dirtyCardQueue.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/g1HotCardCache.hpp"
 
 ConcurrentG1Refine::ConcurrentG1Refine(G1CollectedHeap* g1h) :
   _threads(NULL), _n_threads(0),
+  _last_rate_sample_time(0.0),
+  _last_enqueued_buffers(0),
+  _last_processed_buffers(0),
   _hot_card_cache(g1h)
 {
   // Ergomonically select initial concurrent refinement parameters
@@ -80,6 +84,58 @@ void ConcurrentG1Refine::init() {
   _hot_card_cache.initialize();
 }
 
+void ConcurrentG1Refine::update_zones_from_rates() {
+  if (!G1UseAdaptiveConcRefinement || !G1RateBasedConcRefinementZones) {
+    return;
+  }
+
+  DirtyCardQueueSet& dcqs = JavaThread::dirty_card_queue_set();
+  double now = os::elapsedTime();
+  jint enqueued = dcqs.total_enqueued_buffers();
+  jint processed = dcqs.processed_buffers_rs_thread();
+
+  double interval = now - _last_rate_sample_time;
+  if (_last_rate_sample_time == 0.0 || interval < 0.05) {
+    // First sample, or not enough time has passed for a useful rate.
+    _last_rate_sample_time = now;
+    _last_enqueued_buffers = enqueued;
+    _last_processed_buffers = processed;
+    return;
+  }
+
+  double production_rate  = (enqueued - _last_enqueued_buffers) / interval;
+  double consumption_rate = (processed - _last_processed_buffers) / interval;
+
+  _last_rate_sample_time = now;
+  _last_enqueued_buffers = enqueued;
+  _last_processed_buffers = processed;
+
+  int queue_length = dcqs.completed_buffers_num();
+  if (production_rate > consumption_rate && queue_length > green_zone()) {
+    // The refinement threads are not keeping up. Pull the yellow zone in
+    // so that more threads activate earlier, and keep the red zone well
+    // above it so mutators only process buffers as a last resort.
+    int new_yellow = MAX2(green_zone() + worker_thread_num(),
+                          (int)(yellow_zone() * 9 / 10));
+    set_yellow_zone(new_yellow);
+    set_red_zone(MAX2(new_yellow * 2, red_zone()));
+  } else if (production_rate < consumption_rate * 0.5 &&
+             queue_length < green_zone()) {
+    // Plenty of headroom; relax the yellow zone back towards its
+    // configured value so buffers can sit and absorb re-dirtying.
+    int new_yellow = MIN2((int)G1ConcRefinementYellowZone,
+                          yellow_zone() + MAX2(worker_thread_num(), 1));
+    set_yellow_zone(MAX2(new_yellow, green_zone()));
+    set_red_zone(MAX2(yellow_zone() * 2, yellow_zone()));
+  } else {
+    return;
+  }
+
+  reset_threshold_step();
+  reinitialize_threads();
+  dcqs.set_max_completed_queue(red_zone());
+}
+
 void ConcurrentG1Refine::stop() {
   if (_threads != NULL) {
     for (int i = 0; i < _n_threads; i++) {
@@ -64,6 +64,12 @@ class ConcurrentG1Refine: public CHeapObj<mtGC> {
 
   int _thread_threshold_step;
 
+  // State for the rate-based zone controller: when the last sample was
+  // taken and the counter values seen then.
+  double _last_rate_sample_time;
+  jint   _last_enqueued_buffers;
+  jint   _last_processed_buffers;
+
   // We delay the refinement of 'hot' cards using the hot card cache.
   G1HotCardCache _hot_card_cache;
 
@@ -79,6 +85,11 @@ class ConcurrentG1Refine: public CHeapObj<mtGC> {
 
   void reinitialize_threads();
 
+  // Recompute the zone boundaries from the measured dirty-card
+  // production rate versus the refinement threads' consumption rate.
+  // Called periodically by the sampling thread.
+  void update_zones_from_rates();
+
   // Iterate over all concurrent refinement threads
   void threads_do(ThreadClosure *tc);
 
@@ -103,6 +103,10 @@ void ConcurrentG1RefineThread::run_young_rs_sampling() {
     sample_young_list_rs_lengths();
     _sts.leave();
 
+    // Piggyback the rate-based refinement zone update on the sampling
+    // thread's service interval.
+    cg1r()->update_zones_from_rates();
+
     if (os::supports_vtime()) {
       _vtime_accum = (os::elapsedVTime() - _vtime_start);
     } else {
@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
 #include "gc_implementation/g1/concurrentMark.inline.hpp"
 #include "gc_implementation/g1/concurrentMarkThread.inline.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
@@ -32,6 +34,7 @@
 #include "gc_implementation/g1/g1Log.hpp"
 #include "gc_implementation/g1/g1OopClosures.inline.hpp"
 #include "gc_implementation/g1/g1RemSet.hpp"
+#include "gc_implementation/g1/g1StringDedup.hpp"
 #include "gc_implementation/g1/heapRegion.inline.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
 #include "gc_implementation/g1/heapRegionSeq.inline.hpp"
@@ -511,6 +514,7 @@ ConcurrentMark::ConcurrentMark(G1CollectedHeap* g1h, ReservedSpace heap_rs) :
   _concurrent(false),
   _has_aborted(false),
   _restart_for_overflow(false),
+  _cld_purge_pending(false),
   _concurrent_marking_in_progress(false),
 
   // _verbose_level set below
@@ -2530,6 +2534,30 @@ void ConcurrentMark::weakRefsWork(bool clear_all_soft_refs) {
   StringTable::unlink(&g1_is_alive);
   // Clean up unreferenced symbols in symbol table.
   SymbolTable::unlink();
+  // Unlink dead entries from the string deduplication queue and table.
+  G1StringDedup::unlink(&g1_is_alive);
+
+  if (G1ClassUnloadingWithConcurrentMark) {
+    // Unload classes whose loaders died during this marking cycle.
+    // This mirrors the unloading sequence performed during a full GC
+    // (see G1MarkSweep) but uses the previous marking information as
+    // the liveness oracle. The dead class loader data is only moved
+    // to the unloading list here; the list (and the metaspace it
+    // holds on to) is purged by the concurrent mark thread during the
+    // concurrent cleanup phase, so the remark pause does not pay for
+    // the deallocation work.
+    bool purged_class = SystemDictionary::do_unloading(&g1_is_alive);
+
+    // Follow SystemDictionary roots and unload classes and nmethods
+    // with unreachable classes.
+    CodeCache::do_unloading(&g1_is_alive, purged_class);
+
+    // Clean up subklass/sibling/implementor links of the unloaded
+    // classes.
+    Klass::clean_weak_klass_links(&g1_is_alive);
+
+    set_cld_purge_pending();
+  }
 }
 
 void ConcurrentMark::swapMarkBitMaps() {
@@ -3753,26 +3781,69 @@ void CMTask::drain_local_queue(bool partially) {
                              _worker_id, target_size);
     }
 
-    oop obj;
-    bool ret = _task_queue->pop_local(obj);
-    while (ret) {
-      statsOnly( ++_local_pops );
-
-      if (_cm->verbose_high()) {
-        gclog_or_tty->print_cr("[%u] popped "PTR_FORMAT, _worker_id,
-                               (void*) obj);
+    // We pop entries into a small window, issuing a software prefetch
+    // for each referent as it enters the window and scanning it only
+    // when it leaves.  By the time an object is scanned, its header
+    // and first fields have then usually arrived in cache, which
+    // matters because the marking graph walk is typically bound by
+    // the cache misses on the referents rather than by the scanning
+    // work itself.
+    oop window[max_mark_prefetch_window];
+    uint window_len = (uint) MAX2((uintx) 1,
+                      MIN2(G1MarkPrefetchQueueSize,
+                           (uintx) max_mark_prefetch_window));
+    uint head = 0;
+    uint tail = 0;
+    bool more = true;
+
+    while (more || head != tail) {
+      // Fill the window from the task queue.
+      oop obj;
+      while (more && tail - head < window_len) {
+        if (_task_queue->pop_local(obj)) {
+          statsOnly( ++_local_pops );
+
+          if (_cm->verbose_high()) {
+            gclog_or_tty->print_cr("[%u] popped "PTR_FORMAT, _worker_id,
+                                   (void*) obj);
+          }
+
+          assert(_g1h->is_in_g1_reserved((HeapWord*) obj), "invariant" );
+          assert(!_g1h->is_on_master_free_list(
+                      _g1h->heap_region_containing((HeapWord*) obj)), "invariant");
+
+          if (window_len > 1) {
+            Prefetch::read((void*) obj, 0);
+          }
+          window[tail % max_mark_prefetch_window] = obj;
+          tail += 1;
+        } else {
+          more = false;
+        }
+      }
+      if (head == tail) {
+        break;
       }
 
-      assert(_g1h->is_in_g1_reserved((HeapWord*) obj), "invariant" );
-      assert(!_g1h->is_on_master_free_list(
-                  _g1h->heap_region_containing((HeapWord*) obj)), "invariant");
-
+      // Scan the oldest entry in the window.
+      obj = window[head % max_mark_prefetch_window];
+      head += 1;
       scan_object(obj);
 
-      if (_task_queue->size() <= target_size || has_aborted()) {
-        ret = false;
-      } else {
-        ret = _task_queue->pop_local(obj);
+      if (_task_queue->size() <= target_size) {
+        more = false;
+      }
+      if (has_aborted()) {
+        // Put the prefetched but not yet scanned entries back.  We
+        // popped them from this queue ourselves and we are the only
+        // pusher, so there is room for them.
+        while (head != tail) {
+          bool pushed =
+            _task_queue->push(window[head % max_mark_prefetch_window]);
+          assert(pushed, "the window entries came from this queue");
+          head += 1;
+        }
+        break;
       }
     }
 
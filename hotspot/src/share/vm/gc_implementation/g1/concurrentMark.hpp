@@ -449,6 +449,12 @@ protected:
   // another concurrent marking phase should start
   volatile bool           _restart_for_overflow;
 
+  // set during remark when class unloading moved dead class loader
+  // data onto the unloading list; tells the concurrent mark thread
+  // to purge it (and the associated metaspace) during the concurrent
+  // cleanup phase rather than in the pause
+  volatile bool           _cld_purge_pending;
+
   // This is true from the very start of concurrent marking until the
   // point when all the tasks complete their work. It is really used
   // to determine the points between the end of concurrent marking and
@@ -504,6 +510,10 @@ protected:
     return _cleanup_list.is_empty();
   }
 
+  bool cld_purge_pending()           { return _cld_purge_pending; }
+  void set_cld_purge_pending()       { _cld_purge_pending = true; }
+  void clear_cld_purge_pending()     { _cld_purge_pending = false; }
+
   // accessor methods
   uint parallel_marking_threads() const     { return _parallel_marking_threads; }
   uint max_parallel_marking_threads() const { return _max_parallel_marking_threads;}
@@ -981,7 +991,11 @@ private:
     init_hash_seed                = 17,
     // how many entries will be transferred between global stack and
     // local queues
-    global_stack_transfer_size    = 16
+    global_stack_transfer_size    = 16,
+    // upper bound on the number of popped task queue entries that are
+    // kept in flight and prefetched ahead of scanning (see
+    // drain_local_queue()); G1MarkPrefetchQueueSize is clamped to this
+    max_mark_prefetch_window      = 16
   };
 
   uint                        _worker_id;
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
 #include "gc_implementation/g1/concurrentMarkThread.inline.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/g1CollectorPolicy.hpp"
@@ -238,6 +239,35 @@ void ConcurrentMarkThread::run() {
       guarantee(cm()->cleanup_list_is_empty(),
                 "at this point there should be no regions on the cleanup list");
 
+      if (_cm->cld_purge_pending()) {
+        // Remark moved the class loader data of unloaded classes to
+        // the unloading list. Delete it now, concurrently, so that the
+        // pause does not have to pay for freeing the metaspace. We do
+        // the purge while joined to the STS: a Full GC also purges the
+        // unloading list and must not run in the middle of ours.
+        double purge_start_sec = os::elapsedTime();
+        if (G1Log::fine()) {
+          gclog_or_tty->date_stamp(PrintGCDateStamps);
+          gclog_or_tty->stamp(PrintGCTimeStamps);
+          gclog_or_tty->print_cr("[GC concurrent-class-purge-start]");
+        }
+
+        _sts.join();
+        if (!cm()->has_aborted()) {
+          ClassLoaderDataGraph::purge();
+        }
+        _cm->clear_cld_purge_pending();
+        _sts.leave();
+
+        double purge_end_sec = os::elapsedTime();
+        if (G1Log::fine()) {
+          gclog_or_tty->date_stamp(PrintGCDateStamps);
+          gclog_or_tty->stamp(PrintGCTimeStamps);
+          gclog_or_tty->print_cr("[GC concurrent-class-purge-end, %1.7lf secs]",
+                                 purge_end_sec - purge_start_sec);
+        }
+      }
+
       // There is a tricky race before recording that the concurrent
       // cleanup has completed and a potential Full GC starting around
       // the same time. We want to make sure that the Full GC calls
@@ -123,6 +123,13 @@ bool DirtyCardQueueSet::mut_process_buffer(void** buf) {
   // We grab the current JavaThread.
   JavaThread* thread = JavaThread::current();
 
+  // Bound the amount of in-line refinement work the mutator does: only
+  // process the buffer if the thread has refinement credit left,
+  // otherwise let it be enqueued for the refinement threads.
+  if (!thread->dirty_card_queue().try_spend_refinement_credit()) {
+    return false;
+  }
+
   // We get the the number of any par_id that this thread
   // might have already claimed.
   int worker_i = thread->get_claimed_par_id();
@@ -25,6 +25,7 @@
 #ifndef SHARE_VM_GC_IMPLEMENTATION_G1_DIRTYCARDQUEUE_HPP
 #define SHARE_VM_GC_IMPLEMENTATION_G1_DIRTYCARDQUEUE_HPP
 
+#include "gc_implementation/g1/g1_globals.hpp"
 #include "gc_implementation/g1/ptrQueue.hpp"
 #include "memory/allocation.hpp"
 
@@ -41,11 +42,31 @@ public:
 
 // A ptrQueue whose elements are "oops", pointers to object heads.
 class DirtyCardQueue: public PtrQueue {
+  // Credit bounding the amount of refinement work this mutator thread
+  // does in-line: one credit is spent per buffer processed when the
+  // completed queue is over the red zone, one is earned (up to the
+  // G1MutatorRefinementCredit cap) per buffer handed off unprocessed.
+  int _refinement_credit;
+
 public:
   DirtyCardQueue(PtrQueueSet* qset_, bool perm = false) :
     // Dirty card queues are always active, so we create them with their
     // active field set to true.
-    PtrQueue(qset_, perm, true /* active */) { }
+    PtrQueue(qset_, perm, true /* active */),
+    _refinement_credit((int) G1MutatorRefinementCredit) { }
+
+  // Returns true and spends a credit if one is available, otherwise
+  // earns a credit (up to the cap) and returns false.
+  bool try_spend_refinement_credit() {
+    if (_refinement_credit > 0) {
+      _refinement_credit--;
+      return true;
+    }
+    if (_refinement_credit < (int) G1MutatorRefinementCredit) {
+      _refinement_credit++;
+    }
+    return false;
+  }
 
   // Apply the closure to all elements, and reset the index to make the
   // buffer empty.  If a closure application returns "false", return
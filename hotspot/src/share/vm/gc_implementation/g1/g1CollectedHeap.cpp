@@ -39,6 +39,7 @@
 #include "gc_implementation/g1/g1MarkSweep.hpp"
 #include "gc_implementation/g1/g1OopClosures.inline.hpp"
 #include "gc_implementation/g1/g1RemSet.inline.hpp"
+#include "gc_implementation/g1/g1StringDedup.hpp"
 #include "gc_implementation/g1/g1YCTypes.hpp"
 #include "gc_implementation/g1/heapRegion.inline.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
@@ -438,6 +439,7 @@ HeapRegion* G1CollectedHeap::pop_dirty_cards_region()
 void G1CollectedHeap::stop_conc_gc_threads() {
   _cg1r->stop();
   _cmThread->stop();
+  G1StringDedup::stop();
 }
 
 #ifdef ASSERT
@@ -562,7 +564,27 @@ G1CollectedHeap::new_region_try_secondary_free_list() {
   return NULL;
 }
 
-HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool do_expand) {
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(supports_object_pinning(), "Region pinning not enabled");
+  heap_region_containing(obj)->increment_pin_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(supports_object_pinning(), "Region pinning not enabled");
+  heap_region_containing(obj)->decrement_pin_count();
+}
+
+void G1CollectedHeap::bind_region_to_node(HeapRegion* hr, uint node_index) {
+  assert(UseNUMA, "Only used when NUMA support is enabled");
+  if (hr->node_index() == HeapRegion::InvalidNodeIndex) {
+    os::numa_make_local((char*) hr->bottom(), hr->capacity(), (int) node_index);
+    hr->set_node_index(node_index);
+  }
+}
+
+HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool do_expand,
+                                        uint preferred_node) {
   assert(!isHumongous(word_size) || word_size <= HeapRegion::GrainWords,
          "the only time we use this to allocate a humongous region is "
          "when we are allocating a single humongous region");
@@ -580,7 +602,14 @@ HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool do_expand) {
       }
     }
   }
-  res = _free_list.remove_head_or_null();
+  res = NULL;
+  if (UseNUMA && preferred_node != HeapRegion::InvalidNodeIndex) {
+    res = _free_list.remove_region_on_node(preferred_node,
+                                           G1NUMAFreeRegionScanLength);
+  }
+  if (res == NULL) {
+    res = _free_list.remove_head_or_null();
+  }
   if (res == NULL) {
     if (G1ConcRegionFreeingVerbose) {
       gclog_or_tty->print_cr("G1ConcRegionFreeing [region alloc] : "
@@ -1226,17 +1255,19 @@ public:
 };
 
 class ParRebuildRSTask: public AbstractGangTask {
-  G1CollectedHeap* _g1;
+  G1CollectedHeap*    _g1;
+  ClaimedRegionCursor _cursor;
 public:
   ParRebuildRSTask(G1CollectedHeap* g1)
     : AbstractGangTask("ParRebuildRSTask"),
       _g1(g1)
-  { }
+  {
+    _cursor.reset(g1->n_regions(), g1->workers()->active_workers());
+  }
 
   void work(uint worker_id) {
     RebuildRSOutOfRegionClosure rebuild_rs(_g1, worker_id);
-    _g1->heap_region_par_iterate_chunked(&rebuild_rs, worker_id,
-                                          _g1->workers()->active_workers(),
+    _g1->heap_region_par_iterate_batched(&rebuild_rs, &_cursor,
                                          HeapRegion::RebuildRSClaimValue);
   }
 };
@@ -1772,6 +1803,39 @@ void G1CollectedHeap::update_committed_space(HeapWord* old_end,
   _cg1r->hot_card_cache()->resize_card_counts(capacity());
 }
 
+// Pre-touches a range of newly committed heap memory with the worker
+// gang, so that a large -XX:+AlwaysPreTouch expansion (in particular the
+// initial commit of a big heap) is not bottlenecked on a single thread.
+// Workers claim fixed-size chunks from an atomic counter, so the OS-side
+// cost of faulting in the pages balances across the gang.
+class G1PretouchTask : public AbstractGangTask {
+private:
+  char*         _start;
+  char*         _end;
+  volatile jint _claim;
+
+  enum {
+    ChunkSizeInBytes = 4*M
+  };
+
+public:
+  G1PretouchTask(char* start, char* end) :
+    AbstractGangTask("G1 Pre-Touch"),
+    _start(start), _end(end), _claim(0) { }
+
+  virtual void work(uint worker_id) {
+    while (true) {
+      size_t chunk = (size_t) (Atomic::add(1, &_claim) - 1);
+      char* chunk_start = _start + chunk * (size_t) ChunkSizeInBytes;
+      if (chunk_start >= _end) {
+        return;
+      }
+      char* chunk_end = MIN2(chunk_start + (size_t) ChunkSizeInBytes, _end);
+      os::pretouch_memory(chunk_start, chunk_end);
+    }
+  }
+};
+
 bool G1CollectedHeap::expand(size_t expand_bytes) {
   size_t aligned_expand_bytes = ReservedSpace::page_align_size_up(expand_bytes);
   aligned_expand_bytes = align_size_up(aligned_expand_bytes,
@@ -1797,6 +1861,18 @@ bool G1CollectedHeap::expand(size_t expand_bytes) {
     HeapWord* new_end = (HeapWord*) _g1_storage.high();
     update_committed_space(old_end, new_end);
 
+    if (AlwaysPreTouch) {
+      // The storage space leaves pre-touching to us (see initialize())
+      // so that we can spread it over the worker gang instead of
+      // touching every page from this thread.
+      if (G1CollectedHeap::use_parallel_gc_threads() && workers() != NULL) {
+        G1PretouchTask task((char*) old_end, (char*) new_end);
+        workers()->run_task(&task);
+      } else {
+        os::pretouch_memory((char*) old_end, (char*) new_end);
+      }
+    }
+
     FreeRegionList expansion_list("Local Expansion List");
     MemRegion mr = _hrs.expand_by(old_end, new_end, &expansion_list);
     assert(mr.start() == old_end, "post-condition");
@@ -1971,12 +2047,16 @@ G1CollectedHeap::G1CollectedHeap(G1CollectorPolicy* policy_) :
   _worker_cset_start_region = NEW_C_HEAP_ARRAY(HeapRegion*, n_queues, mtGC);
   _worker_cset_start_region_time_stamp = NEW_C_HEAP_ARRAY(unsigned int, n_queues, mtGC);
   _evacuation_failed_info_array = NEW_C_HEAP_ARRAY(EvacuationFailedInfo, n_queues, mtGC);
+  _objs_with_preserved_marks = NEW_C_HEAP_ARRAY(Stack<oop, mtGC>, n_queues, mtGC);
+  _preserved_marks_of_objs = NEW_C_HEAP_ARRAY(Stack<markOop, mtGC>, n_queues, mtGC);
 
   for (int i = 0; i < n_queues; i++) {
     RefToScanQueue* q = new RefToScanQueue();
     q->initialize();
     _task_queues->register_queue(i, q);
     ::new (&_evacuation_failed_info_array[i]) EvacuationFailedInfo();
+    ::new (&_objs_with_preserved_marks[i]) Stack<oop, mtGC>();
+    ::new (&_preserved_marks_of_objs[i]) Stack<markOop, mtGC>();
   }
   clear_cset_start_regions();
 
@@ -2061,6 +2141,9 @@ jint G1CollectedHeap::initialize() {
                            g1_rs.size()/HeapWordSize);
 
   _g1_storage.initialize(g1_rs, 0);
+  // Pre-touching of newly committed memory is done in expand() with the
+  // worker gang rather than in VirtualSpace::expand_by().
+  _g1_storage.set_pretouch_by_caller(true);
   _g1_committed = MemRegion((HeapWord*)_g1_storage.low(), (size_t) 0);
   _hrs.initialize((HeapWord*) _g1_reserved.start(),
                   (HeapWord*) _g1_reserved.end());
@@ -2124,6 +2207,8 @@ jint G1CollectedHeap::initialize() {
   // Perform any initialization actions delegated to the policy.
   g1_policy()->init();
 
+  G1StringDedup::initialize();
+
   _refine_cte_cl =
     new RefineCardTableEntryClosure(ConcurrentG1RefineThread::sts(),
                                     g1_rem_set(),
@@ -2400,6 +2485,7 @@ bool G1CollectedHeap::should_do_concurrent_full_gc(GCCause::Cause cause) {
     case GCCause::_gc_locker:               return GCLockerInvokesConcurrent;
     case GCCause::_java_lang_system_gc:     return ExplicitGCInvokesConcurrent;
     case GCCause::_g1_humongous_allocation: return true;
+    case GCCause::_wb_conc_mark:            return true;
     default:                                return false;
   }
 }
@@ -2693,63 +2779,87 @@ G1CollectedHeap::heap_region_par_iterate_chunked(HeapRegionClosure* cl,
   for (uint count = 0; count < regions; ++count) {
     const uint index = (start_index + count) % regions;
     assert(0 <= index && index < regions, "sanity");
-    HeapRegion* r = region_at(index);
-    // we'll ignore "continues humongous" regions (we'll process them
-    // when we come across their corresponding "start humongous"
-    // region) and regions already claimed
-    if (r->claim_value() == claim_value || r->continuesHumongous()) {
-      continue;
-    }
-    // OK, try to claim it
-    if (r->claimHeapRegion(claim_value)) {
-      // success!
-      assert(!r->continuesHumongous(), "sanity");
-      if (r->startsHumongous()) {
-        // If the region is "starts humongous" we'll iterate over its
-        // "continues humongous" first; in fact we'll do them
-        // first. The order is important. In on case, calling the
-        // closure on the "starts humongous" region might de-allocate
-        // and clear all its "continues humongous" regions and, as a
-        // result, we might end up processing them twice. So, we'll do
-        // them first (notice: most closures will ignore them anyway) and
-        // then we'll do the "starts humongous" region.
-        for (uint ch_index = index + 1; ch_index < regions; ++ch_index) {
-          HeapRegion* chr = region_at(ch_index);
-
-          // if the region has already been claimed or it's not
-          // "continues humongous" we're done
-          if (chr->claim_value() == claim_value ||
-              !chr->continuesHumongous()) {
-            break;
-          }
+    par_claim_and_apply(cl, index, claim_value);
+  }
+}
 
-          // No one should have claimed it directly. We can given
-          // that we claimed its "starts humongous" region.
-          assert(chr->claim_value() != claim_value, "sanity");
-          assert(chr->humongous_start_region() == r, "sanity");
+// Claims the region at the given index (and, for a "starts humongous"
+// region, its "continues humongous" tail) and applies the closure to the
+// regions it claimed.  Shared by the chunked and the batched parallel
+// iterators; safe to call concurrently for the same index.
+void G1CollectedHeap::par_claim_and_apply(HeapRegionClosure* cl,
+                                          uint index,
+                                          jint claim_value) {
+  const uint regions = n_regions();
+  HeapRegion* r = region_at(index);
+  // we'll ignore "continues humongous" regions (we'll process them
+  // when we come across their corresponding "start humongous"
+  // region) and regions already claimed
+  if (r->claim_value() == claim_value || r->continuesHumongous()) {
+    return;
+  }
+  // OK, try to claim it
+  if (r->claimHeapRegion(claim_value)) {
+    // success!
+    assert(!r->continuesHumongous(), "sanity");
+    if (r->startsHumongous()) {
+      // If the region is "starts humongous" we'll iterate over its
+      // "continues humongous" first; in fact we'll do them
+      // first. The order is important. In on case, calling the
+      // closure on the "starts humongous" region might de-allocate
+      // and clear all its "continues humongous" regions and, as a
+      // result, we might end up processing them twice. So, we'll do
+      // them first (notice: most closures will ignore them anyway) and
+      // then we'll do the "starts humongous" region.
+      for (uint ch_index = index + 1; ch_index < regions; ++ch_index) {
+        HeapRegion* chr = region_at(ch_index);
+
+        // if the region has already been claimed or it's not
+        // "continues humongous" we're done
+        if (chr->claim_value() == claim_value ||
+            !chr->continuesHumongous()) {
+          break;
+        }
 
-          if (chr->claimHeapRegion(claim_value)) {
-            // we should always be able to claim it; no one else should
-            // be trying to claim this region
+        // No one should have claimed it directly. We can given
+        // that we claimed its "starts humongous" region.
+        assert(chr->claim_value() != claim_value, "sanity");
+        assert(chr->humongous_start_region() == r, "sanity");
 
-            bool res2 = cl->doHeapRegion(chr);
-            assert(!res2, "Should not abort");
+        if (chr->claimHeapRegion(claim_value)) {
+          // we should always be able to claim it; no one else should
+          // be trying to claim this region
 
-            // Right now, this holds (i.e., no closure that actually
-            // does something with "continues humongous" regions
-            // clears them). We might have to weaken it in the future,
-            // but let's leave these two asserts here for extra safety.
-            assert(chr->continuesHumongous(), "should still be the case");
-            assert(chr->humongous_start_region() == r, "sanity");
-          } else {
-            guarantee(false, "we should not reach here");
-          }
+          bool res2 = cl->doHeapRegion(chr);
+          assert(!res2, "Should not abort");
+
+          // Right now, this holds (i.e., no closure that actually
+          // does something with "continues humongous" regions
+          // clears them). We might have to weaken it in the future,
+          // but let's leave these two asserts here for extra safety.
+          assert(chr->continuesHumongous(), "should still be the case");
+          assert(chr->humongous_start_region() == r, "sanity");
+        } else {
+          guarantee(false, "we should not reach here");
         }
       }
+    }
 
-      assert(!r->continuesHumongous(), "sanity");
-      bool res = cl->doHeapRegion(r);
-      assert(!res, "Should not abort");
+    assert(!r->continuesHumongous(), "sanity");
+    bool res = cl->doHeapRegion(r);
+    assert(!res, "Should not abort");
+  }
+}
+
+void
+G1CollectedHeap::heap_region_par_iterate_batched(HeapRegionClosure* cl,
+                                                 ClaimedRegionCursor* cursor,
+                                                 jint claim_value) {
+  uint start;
+  uint end;
+  while (cursor->claim_batch(&start, &end)) {
+    for (uint index = start; index < end; ++index) {
+      par_claim_and_apply(cl, index, claim_value);
     }
   }
 }
@@ -3884,7 +3994,10 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
   assert_at_safepoint(true /* should_be_vm_thread */);
   guarantee(!is_gc_active(), "collection is not reentrant");
 
-  if (GC_locker::check_active_before_gc()) {
+  // With region pinning, evacuation pauses can proceed while JNI
+  // critical sections are active: pinned regions are simply not
+  // evacuated. Full collections still defer to the GC locker.
+  if (!G1UseRegionPinning && GC_locker::check_active_before_gc()) {
     return false;
   }
 
@@ -4241,8 +4354,15 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
       gc_epilogue(false);
     }
 
+    double pause_time_sec = os::elapsedTime() - pause_start_sec;
+
     // Print the remainder of the GC log output.
-    log_gc_footer(os::elapsedTime() - pause_start_sec);
+    log_gc_footer(pause_time_sec);
+
+    // Publish the phase breakdown of this pause to the jstat counters
+    // so that monitoring tools can sample it from the PerfData memory
+    // region without parsing the log output.
+    g1mm()->update_pause_times(g1_policy()->phase_times(), pause_time_sec);
 
     // It is not yet to safe to tell the concurrent mark to
     // start as we have some optional output below. We don't want the
@@ -4414,16 +4534,30 @@ void G1CollectedHeap::remove_self_forwarding_pointers() {
 
   assert(check_cset_heap_region_claim_values(HeapRegion::InitialClaimValue), "sanity");
 
-  // Now restore saved marks, if any.
-  assert(_objs_with_preserved_marks.size() ==
-            _preserved_marks_of_objs.size(), "Both or none.");
-  while (!_objs_with_preserved_marks.is_empty()) {
-    oop obj = _objs_with_preserved_marks.pop();
-    markOop m = _preserved_marks_of_objs.pop();
+  // Now restore saved marks, if any. Each worker restores the stacks
+  // filled by one or more of the evacuating workers.
+  G1RestorePreservedMarksTask restore_task(this);
+
+  if (G1CollectedHeap::use_parallel_gc_threads()) {
+    set_par_threads();
+    workers()->run_task(&restore_task);
+    set_par_threads(0);
+  } else {
+    restore_task.work(0);
+  }
+}
+
+void G1CollectedHeap::restore_preserved_marks(int queue_num) {
+  Stack<oop, mtGC>* objs = &_objs_with_preserved_marks[queue_num];
+  Stack<markOop, mtGC>* marks = &_preserved_marks_of_objs[queue_num];
+  assert(objs->size() == marks->size(), "Both or none.");
+  while (!objs->is_empty()) {
+    oop obj = objs->pop();
+    markOop m = marks->pop();
     obj->set_mark(m);
   }
-  _objs_with_preserved_marks.clear(true);
-  _preserved_marks_of_objs.clear(true);
+  objs->clear(true);
+  marks->clear(true);
 }
 
 void G1CollectedHeap::push_on_evac_failure_scan_stack(oop obj) {
@@ -4464,13 +4598,13 @@ G1CollectedHeap::handle_evacuation_failure_par(G1ParScanThreadState* _par_scan_s
       assert(_evac_failure_closure == NULL, "Or locking has failed.");
       set_evac_failure_closure(cl);
       // Now do the common part.
-      handle_evacuation_failure_common(old, m);
+      handle_evacuation_failure_common(old, m, queue_num);
       // Reset to NULL.
       set_evac_failure_closure(NULL);
     } else {
       // The lock is already held, and this is recursive.
       assert(_drain_in_progress, "This should only be the recursive case.");
-      handle_evacuation_failure_common(old, m);
+      handle_evacuation_failure_common(old, m, queue_num);
     }
     return old;
   } else {
@@ -4485,8 +4619,9 @@ G1CollectedHeap::handle_evacuation_failure_par(G1ParScanThreadState* _par_scan_s
   }
 }
 
-void G1CollectedHeap::handle_evacuation_failure_common(oop old, markOop m) {
-  preserve_mark_if_necessary(old, m);
+void G1CollectedHeap::handle_evacuation_failure_common(oop old, markOop m,
+                                                       uint queue_num) {
+  preserve_mark_if_necessary(old, m, queue_num);
 
   HeapRegion* r = heap_region_containing(old);
   if (!r->evacuation_failed()) {
@@ -4504,13 +4639,14 @@ void G1CollectedHeap::handle_evacuation_failure_common(oop old, markOop m) {
   }
 }
 
-void G1CollectedHeap::preserve_mark_if_necessary(oop obj, markOop m) {
+void G1CollectedHeap::preserve_mark_if_necessary(oop obj, markOop m,
+                                                 uint queue_num) {
   assert(evacuation_failed(), "Oversaving!");
   // We want to call the "for_promotion_failure" version only in the
   // case of a promotion failure.
   if (m->must_be_preserved_for_promotion_failure(obj)) {
-    _objs_with_preserved_marks.push(obj);
-    _preserved_marks_of_objs.push(m);
+    _objs_with_preserved_marks[queue_num].push(obj);
+    _preserved_marks_of_objs[queue_num].push(m);
   }
 }
 
@@ -4553,6 +4689,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h, uint queue_num)
     _g1_rem(g1h->g1_rem_set()),
     _hash_seed(17), _queue_num(queue_num),
     _term_attempts(0),
+    _steal_failures(0),
     _surviving_alloc_buffer(g1h->desired_plab_sz(GCAllocForSurvived)),
     _tenured_alloc_buffer(g1h->desired_plab_sz(GCAllocForTenured)),
     _age_table(false),
@@ -4711,6 +4848,14 @@ oop G1ParCopyClosure<do_gen_barrier, barrier, do_mark_object>
   ::copy_to_survivor_space(oop old) {
   size_t word_sz = old->size();
   HeapRegion* from_region = _g1->heap_region_containing_raw(old);
+
+  if (G1UseRegionPinning && from_region->is_pinned()) {
+    // The region is pinned by a JNI critical section; leave the object
+    // in place via the evacuation failure machinery (forward-to-self,
+    // region retained).
+    return _g1->handle_evacuation_failure_par(_par_scan_state, old);
+  }
+
   // +1 to make the -1 indexes valid...
   int       young_index = from_region->young_index_in_cset()+1;
   assert( (from_region->is_young() && young_index >  0) ||
@@ -4773,6 +4918,17 @@ oop G1ParCopyClosure<do_gen_barrier, barrier, do_mark_object>
       obj->set_mark(m);
     }
 
+    if (G1StringDedup::is_enabled()) {
+      // Tenured objects never reach this point again, so this is the last
+      // opportunity to enqueue them; survivors are enqueued exactly once,
+      // when they first reach the age threshold.
+      bool obj_is_tenured = !g1p->track_object_age(alloc_purpose);
+      uint obj_age = obj_is_tenured ? (uint) age : (uint) obj->age();
+      if (G1StringDedup::is_candidate_from_evacuation(obj, obj_is_tenured, obj_age)) {
+        G1StringDedup::enqueue_from_evacuation(obj);
+      }
+    }
+
     size_t* surv_young_words = _par_scan_state->surviving_young_words();
     surv_young_words[young_index] += word_sz;
 
@@ -4957,6 +5113,9 @@ void G1ParEvacuateFollowersClosure::do_void() {
       // we drain the queues as necessary.
       pss->trim_queue();
     }
+    // The steal sweep over all queues came up empty; this is where
+    // stealing degenerates into termination attempts.
+    pss->note_steal_failure();
   } while (!offer_termination());
 
   pss->retire_alloc_buffers();
@@ -5098,6 +5257,10 @@ public:
         double term_ms = pss.term_time()*1000.0;
         _g1h->g1_policy()->phase_times()->add_obj_copy_time(worker_id, elapsed_ms-term_ms);
         _g1h->g1_policy()->phase_times()->record_termination(worker_id, term_ms, pss.term_attempts());
+        _g1h->g1_policy()->phase_times()->record_task_queue_stats(worker_id,
+                                                                  pss.refs()->overflow_pushes(),
+                                                                  pss.steal_failures());
+        pss.refs()->reset_overflow_pushes();
       }
       _g1h->g1_policy()->record_thread_age_table(pss.age_table());
       _g1h->update_surviving_young_words(pss.surviving_young_words()+1);
@@ -5823,6 +5986,10 @@ void G1CollectedHeap::evacuate_collection_set(EvacuationInfo& evacuation_info) {
     G1STWIsAliveClosure is_alive(this);
     G1KeepAliveClosure keep_alive(this);
     JNIHandles::weak_oops_do(&is_alive, &keep_alive);
+    // Unlink dead entries from the string deduplication queue and table,
+    // and update the remaining (weak) entries to point to the to-space
+    // copies of their objects.
+    G1StringDedup::unlink_or_oops_do(&is_alive, &keep_alive);
   }
 
   release_gc_alloc_regions(n_workers, evacuation_info);
@@ -6432,9 +6599,19 @@ HeapRegion* G1CollectedHeap::new_mutator_alloc_region(size_t word_size,
          "if force is true we should be able to expand the young list");
   bool young_list_full = g1_policy()->is_young_list_full();
   if (force || !young_list_full) {
+    uint preferred_node = HeapRegion::InvalidNodeIndex;
+    if (UseNUMA) {
+      preferred_node = (uint) os::numa_get_group_id();
+    }
     HeapRegion* new_alloc_region = new_region(word_size,
-                                              false /* do_expand */);
+                                              false /* do_expand */,
+                                              preferred_node);
     if (new_alloc_region != NULL) {
+      if (UseNUMA) {
+        // Bind the region to the allocating thread's node by first touch,
+        // so subsequent allocations from this eden region stay node-local.
+        bind_region_to_node(new_alloc_region, preferred_node);
+      }
       set_region_short_lived_locked(new_alloc_region);
       _hr_printer.alloc(new_alloc_region, G1HRPrinter::Eden, young_list_full);
       return new_alloc_region;
@@ -6491,8 +6668,14 @@ HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size,
   assert(FreeList_lock->owned_by_self(), "pre-condition");
 
   if (count < g1_policy()->max_regions(ap)) {
+    uint preferred_node = HeapRegion::InvalidNodeIndex;
+    if (UseNUMA) {
+      // Prefer to evacuate into a region on the GC worker's own node.
+      preferred_node = (uint) os::numa_get_group_id();
+    }
     HeapRegion* new_alloc_region = new_region(word_size,
-                                              true /* do_expand */);
+                                              true /* do_expand */,
+                                              preferred_node);
     if (new_alloc_region != NULL) {
       // We really only need to do this for old regions given that we
       // should never scan survivors. But it doesn't hurt to do it
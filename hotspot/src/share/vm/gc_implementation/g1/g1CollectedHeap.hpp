@@ -33,6 +33,7 @@
 #include "gc_implementation/g1/g1RemSet.hpp"
 #include "gc_implementation/g1/g1SATBCardTableModRefBS.hpp"
 #include "gc_implementation/g1/g1YCTypes.hpp"
+#include "gc_implementation/g1/g1_globals.hpp"
 #include "gc_implementation/g1/heapRegionSeq.hpp"
 #include "gc_implementation/g1/heapRegionSets.hpp"
 #include "gc_implementation/shared/hSpaceCounters.hpp"
@@ -225,6 +226,7 @@ class G1CollectedHeap : public SharedHeap {
   friend class CountRCClosure;
   friend class EvacPopObjClosure;
   friend class G1ParCleanupCTTask;
+  friend class G1RestorePreservedMarksTask;
 
   // Other related classes.
   friend class G1MarkSweep;
@@ -503,7 +505,14 @@ protected:
   // an allocation of the given word_size. If do_expand is true,
   // attempt to expand the heap if necessary to satisfy the allocation
   // request.
-  HeapRegion* new_region(size_t word_size, bool do_expand);
+  // Try to allocate a new region, preferring one whose memory is bound
+  // to preferred_node when UseNUMA is enabled and a preference is given.
+  HeapRegion* new_region(size_t word_size, bool do_expand,
+                         uint preferred_node = HeapRegion::InvalidNodeIndex);
+
+  // Bind the given region's memory to the given NUMA node by first
+  // touch, if it has not been bound already.
+  void bind_region_to_node(HeapRegion* hr, uint node_index);
 
   // Attempt to satisfy a humongous allocation request of the given
   // size by finding a contiguous set of free regions of num_regions
@@ -887,13 +896,17 @@ protected:
   // forwarding pointers to themselves.  Reset them.
   void remove_self_forwarding_pointers();
 
-  // Together, these store an object with a preserved mark, and its mark value.
-  Stack<oop, mtGC>     _objs_with_preserved_marks;
-  Stack<markOop, mtGC> _preserved_marks_of_objs;
+  // Together, these store an object with a preserved mark, and its
+  // mark value. There is one pair of stacks per worker queue so that
+  // the marks can be preserved and restored without a global lock;
+  // the stacks are indexed by the queue num of the worker that
+  // failed to evacuate the object.
+  Stack<oop, mtGC>*     _objs_with_preserved_marks;
+  Stack<markOop, mtGC>* _preserved_marks_of_objs;
 
   // Preserve the mark of "obj", if necessary, in preparation for its mark
   // word being overwritten with a self-forwarding-pointer.
-  void preserve_mark_if_necessary(oop obj, markOop m);
+  void preserve_mark_if_necessary(oop obj, markOop m, uint queue_num);
 
   // The stack of evac-failure objects left to be scanned.
   GrowableArray<oop>*    _evac_failure_scan_stack;
@@ -924,7 +937,11 @@ protected:
 
   // An attempt to evacuate "obj" has failed; take necessary steps.
   oop handle_evacuation_failure_par(G1ParScanThreadState* _par_scan_state, oop obj);
-  void handle_evacuation_failure_common(oop obj, markOop m);
+  void handle_evacuation_failure_common(oop obj, markOop m, uint queue_num);
+
+  // Restores the marks preserved by the worker with the given queue
+  // num; called in parallel by G1RestorePreservedMarksTask.
+  void restore_preserved_marks(int queue_num);
 
 #ifndef PRODUCT
   // Support for forcing evacuation failures. Analogous to
@@ -1397,6 +1414,24 @@ public:
                                        uint no_of_par_workers,
                                        jint claim_value);
 
+  // Variant of the above driven by a shared ClaimedRegionCursor instead of
+  // each worker scanning all regions.  Workers claim contiguous batches of
+  // region indices from the cursor (one atomic add per batch) and only touch
+  // the per-region claim values of the regions in their batches, so with
+  // many regions the claiming traffic drops from one CAS attempt per region
+  // per worker to one per region overall.  The cursor must have been reset
+  // by the caller before the workers were started; the claim_value contract
+  // is the same as for heap_region_par_iterate_chunked.
+  void heap_region_par_iterate_batched(HeapRegionClosure* blk,
+                                       ClaimedRegionCursor* cursor,
+                                       jint claim_value);
+
+ private:
+  // Common per-region claiming logic of the two parallel iterators above.
+  void par_claim_and_apply(HeapRegionClosure* blk, uint index, jint claim_value);
+
+ public:
+
   // It resets all the region claim values to the default.
   void reset_heap_region_claim_values();
 
@@ -1476,6 +1511,13 @@ public:
   // Does this heap support heap inspection? (+PrintClassHistogram)
   virtual bool supports_heap_inspection() const { return true; }
 
+  // Object pinning support: a pinned object's region is excluded from
+  // collection sets and evacuation, so evacuation pauses can proceed
+  // while JNI critical sections are active.
+  virtual bool supports_object_pinning() const { return G1UseRegionPinning; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // Section on thread-local allocation buffers (TLABs)
   // See CollectedHeap for semantics.
 
@@ -1897,6 +1939,7 @@ protected:
   uint _queue_num;
 
   size_t _term_attempts;
+  size_t _steal_failures;
 
   double _start;
   double _start_strong_roots;
@@ -2031,6 +2074,9 @@ public:
   size_t term_attempts() const  { return _term_attempts; }
   void note_term_attempt() { _term_attempts++; }
 
+  size_t steal_failures() const { return _steal_failures; }
+  void note_steal_failure() { _steal_failures++; }
+
   void start_strong_roots() {
     _start_strong_roots = os::elapsedTime();
   }
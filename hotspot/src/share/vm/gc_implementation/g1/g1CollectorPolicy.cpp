@@ -105,6 +105,7 @@ G1CollectorPolicy::G1CollectorPolicy() :
 
   _pending_cards_seq(new TruncatedSeq(TruncatedSeqLength)),
   _rs_lengths_seq(new TruncatedSeq(TruncatedSeqLength)),
+  _copied_regions_seq(new TruncatedSeq(TruncatedSeqLength)),
 
   _pause_time_target_ms((double) MaxGCPauseMillis),
 
@@ -309,9 +310,11 @@ G1CollectorPolicy::G1CollectorPolicy() :
             "it's been updated to %u", reserve_perc);
   }
   _reserve_factor = (double) reserve_perc / 100.0;
-  // This will be set when the heap is expanded
+  // These will be set when the heap is expanded
   // for the first time during initialization.
   _reserve_regions = 0;
+  _base_reserve_regions = 0;
+  _max_reserve_regions = 0;
 
   _collectionSetChooser = new CollectionSetChooser();
 }
@@ -500,11 +503,29 @@ void G1CollectorPolicy::record_new_heap_size(uint new_number_of_regions) {
   double reserve_regions_d = (double) new_number_of_regions * _reserve_factor;
   // We use ceiling so that if reserve_regions_d is > 0.0 (but
   // smaller than 1.0) we'll get 1.
-  _reserve_regions = (uint) ceil(reserve_regions_d);
+  _base_reserve_regions = (uint) ceil(reserve_regions_d);
+  // Never let the adaptive reserve claim more than a quarter of the
+  // heap, however large the observed promotion spikes are.
+  _max_reserve_regions = MAX2(_base_reserve_regions, new_number_of_regions / 4);
+  update_reserve_regions();
 
   _young_gen_sizer->heap_size_changed(new_number_of_regions);
 }
 
+void G1CollectorPolicy::update_reserve_regions() {
+  uint reserve_regions = _base_reserve_regions;
+  if (G1AdaptiveHeapReserve && _copied_regions_seq->num() > 0) {
+    // Predict the to-space demand of the next pause from the recent
+    // pauses and make sure the reserve can absorb a spike of that
+    // size. The prediction decays as quieter pauses are recorded, so
+    // the reserve shrinks back to the static one after a spike.
+    uint predicted_regions =
+      (uint) ceil(get_new_prediction(_copied_regions_seq));
+    reserve_regions = MAX2(reserve_regions, predicted_regions);
+  }
+  _reserve_regions = MIN2(reserve_regions, _max_reserve_regions);
+}
+
 uint G1CollectorPolicy::calculate_young_list_desired_min_length(
                                                        uint base_min_length) {
   uint desired_min_length = 0;
@@ -987,6 +1008,19 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
   evacuation_info.set_collectionset_used_before(_collection_set_bytes_used_before);
   evacuation_info.set_bytes_copied(_bytes_copied_during_gc);
 
+  // Update the adaptive heap reserve with the to-space demand of this
+  // pause. We do this whether or not the evacuation succeeded: after a
+  // failure the bytes copied understate the demand, so we record at
+  // least one region more than the current reserve, which grows the
+  // reserve until the failures stop.
+  size_t copied_regions =
+    (_bytes_copied_during_gc + HeapRegion::GrainBytes - 1) / HeapRegion::GrainBytes;
+  if (_g1->evacuation_failed()) {
+    copied_regions = MAX2(copied_regions, (size_t) _reserve_regions + 1);
+  }
+  _copied_regions_seq->add((double) copied_regions);
+  update_reserve_regions();
+
   if (update_stats) {
     _trace_gen0_time_data.record_end_collection(pause_time_ms, phase_times());
     // this is where we update the allocation rate of the application
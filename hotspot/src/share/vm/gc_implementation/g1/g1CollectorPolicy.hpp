@@ -217,6 +217,18 @@ private:
   double _reserve_factor;
   uint _reserve_regions;
 
+  // The reserve derived from G1ReservePercent alone. _reserve_regions
+  // is at least this, and is grown above it when the recent to-space
+  // demand (regions' worth of bytes copied during evacuation, or an
+  // evacuation failure) suggests that the static reserve is too small.
+  uint _base_reserve_regions;
+  // Upper bound on _reserve_regions, recalculated on heap resize.
+  uint _max_reserve_regions;
+
+  // Recalculates _reserve_regions from _base_reserve_regions and the
+  // recent to-space demand recorded in _copied_regions_seq.
+  void update_reserve_regions();
+
   bool during_marking() {
     return _during_marking;
   }
@@ -242,6 +254,10 @@ private:
   TruncatedSeq* _pending_cards_seq;
   TruncatedSeq* _rs_lengths_seq;
 
+  // Regions' worth of bytes copied to to-space per evacuation pause;
+  // feeds the adaptive heap reserve.
+  TruncatedSeq* _copied_regions_seq;
+
   TruncatedSeq* _cost_per_byte_ms_during_cm_seq;
 
   G1YoungGenSizer* _young_gen_sizer;
@@ -32,6 +32,7 @@
 #include "gc_implementation/g1/g1OopClosures.inline.hpp"
 #include "gc_implementation/g1/heapRegion.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/workgroup.hpp"
 
 // Closures and tasks associated with any self-forwarding pointers
@@ -240,4 +241,27 @@ public:
   }
 };
 
+class G1RestorePreservedMarksTask: public AbstractGangTask {
+protected:
+  G1CollectedHeap* _g1h;
+  volatile jint    _next_queue;
+
+public:
+  G1RestorePreservedMarksTask(G1CollectedHeap* g1h) :
+    AbstractGangTask("G1 Restore Preserved Marks"),
+    _g1h(g1h), _next_queue(0) { }
+
+  void work(uint worker_id) {
+    // The number of active workers may be smaller than the number of
+    // mark stacks, so the workers claim stacks until all have been
+    // drained rather than each draining only its own.
+    jint n_queues = (jint) MAX2((int) ParallelGCThreads, 1);
+    for (jint i = Atomic::add(1, &_next_queue) - 1;
+         i < n_queues;
+         i = Atomic::add(1, &_next_queue) - 1) {
+      _g1h->restore_preserved_marks(i);
+    }
+  }
+};
+
 #endif // SHARE_VM_GC_IMPLEMENTATION_G1_G1EVACFAILURE_HPP
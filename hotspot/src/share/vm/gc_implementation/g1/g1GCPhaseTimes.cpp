@@ -166,6 +166,8 @@ G1GCPhaseTimes::G1GCPhaseTimes(uint max_gc_threads) :
   _last_obj_copy_times_ms(_max_gc_threads, "%.1lf"),
   _last_termination_times_ms(_max_gc_threads, "%.1lf"),
   _last_termination_attempts(_max_gc_threads, SIZE_FORMAT),
+  _last_overflow_pushes(_max_gc_threads, SIZE_FORMAT),
+  _last_steal_failures(_max_gc_threads, SIZE_FORMAT),
   _last_gc_worker_end_times_ms(_max_gc_threads, "%.1lf", false),
   _last_gc_worker_times_ms(_max_gc_threads, "%.1lf"),
   _last_gc_worker_other_times_ms(_max_gc_threads, "%.1lf")
@@ -189,6 +191,8 @@ void G1GCPhaseTimes::note_gc_start(uint active_gc_threads) {
   _last_obj_copy_times_ms.reset();
   _last_termination_times_ms.reset();
   _last_termination_attempts.reset();
+  _last_overflow_pushes.reset();
+  _last_steal_failures.reset();
   _last_gc_worker_end_times_ms.reset();
   _last_gc_worker_times_ms.reset();
   _last_gc_worker_other_times_ms.reset();
@@ -206,6 +210,8 @@ void G1GCPhaseTimes::note_gc_end() {
   _last_obj_copy_times_ms.verify();
   _last_termination_times_ms.verify();
   _last_termination_attempts.verify();
+  _last_overflow_pushes.verify();
+  _last_steal_failures.verify();
   _last_gc_worker_end_times_ms.verify();
 
   for (uint i = 0; i < _active_gc_threads; i++) {
@@ -279,6 +285,8 @@ void G1GCPhaseTimes::print(double pause_time_sec) {
     _last_termination_times_ms.print(2, "Termination (ms)");
     if (G1Log::finest()) {
       _last_termination_attempts.print(3, "Termination Attempts");
+      _last_overflow_pushes.print(3, "Queue Overflow Pushes");
+      _last_steal_failures.print(3, "Failed Steal Sweeps");
     }
     _last_gc_worker_other_times_ms.print(2, "GC Worker Other (ms)");
     _last_gc_worker_times_ms.print(2, "GC Worker Total (ms)");
@@ -124,6 +124,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   WorkerDataArray<double> _last_obj_copy_times_ms;
   WorkerDataArray<double> _last_termination_times_ms;
   WorkerDataArray<size_t> _last_termination_attempts;
+  WorkerDataArray<size_t> _last_overflow_pushes;
+  WorkerDataArray<size_t> _last_steal_failures;
   WorkerDataArray<double> _last_gc_worker_end_times_ms;
   WorkerDataArray<double> _last_gc_worker_times_ms;
   WorkerDataArray<double> _last_gc_worker_other_times_ms;
@@ -203,6 +205,11 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _last_termination_attempts.set(worker_i, attempts);
   }
 
+  void record_task_queue_stats(uint worker_i, size_t overflow_pushes, size_t steal_failures) {
+    _last_overflow_pushes.set(worker_i, overflow_pushes);
+    _last_steal_failures.set(worker_i, steal_failures);
+  }
+
   void record_gc_worker_end_time(uint worker_i, double ms) {
     _last_gc_worker_end_times_ms.set(worker_i, ms);
   }
@@ -265,6 +272,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   double accounted_time_ms();
 
+  uint active_gc_threads() {
+    return _active_gc_threads;
+  }
+
   double cur_collection_start_sec() {
     return _cur_collection_start_sec;
   }
@@ -277,6 +288,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     return _cur_clear_ct_time_ms;
   }
 
+  double cur_ref_proc_time_ms() {
+    return _cur_ref_proc_time_ms;
+  }
+
   double root_region_scan_wait_time_ms() {
     return _root_region_scan_wait_time_ms;
   }
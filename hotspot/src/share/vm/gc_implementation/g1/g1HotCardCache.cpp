@@ -23,15 +23,18 @@
  */
 
 #include "precompiled.hpp"
+#include "gc_implementation/g1/concurrentG1Refine.hpp"
 #include "gc_implementation/g1/dirtyCardQueue.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/g1HotCardCache.hpp"
 #include "gc_implementation/g1/g1RemSet.hpp"
 #include "gc_implementation/g1/heapRegion.hpp"
+#include "memory/padded.inline.hpp"
 #include "runtime/atomic.hpp"
 
 G1HotCardCache::G1HotCardCache(G1CollectedHeap *g1h):
-  _g1h(g1h), _hot_cache(NULL), _use_cache(false), _card_counts(g1h) {}
+  _g1h(g1h), _hot_cache(NULL), _stripes(NULL),
+  _use_cache(false), _card_counts(g1h) {}
 
 void G1HotCardCache::initialize() {
   if (default_use_cache()) {
@@ -39,9 +42,25 @@ void G1HotCardCache::initialize() {
 
     _hot_cache_size = (1 << G1ConcRSLogCacheSize);
     _hot_cache = NEW_C_HEAP_ARRAY(jbyte*, _hot_cache_size, mtGC);
+    for (int i = 0; i < _hot_cache_size; i++) {
+      _hot_cache[i] = NULL;
+    }
+
+    // Aim for one stripe per refinement thread so that, in the steady
+    // state, each thread has its allocation index to itself. Mutator
+    // threads that insert directly hash across the same stripes.
+    int n_refine_threads = MAX2(1, (int) ConcurrentG1Refine::thread_num());
+    _n_stripes = 1;
+    while (_n_stripes < n_refine_threads && (_n_stripes * 2) <= _hot_cache_size) {
+      _n_stripes *= 2;
+    }
+    assert(is_power_of_2(_hot_cache_size), "size is 1 << G1ConcRSLogCacheSize");
+    _stripe_size = _hot_cache_size / _n_stripes;
 
-    _n_hot = 0;
-    _hot_cache_idx = 0;
+    _stripes = PaddedArray<HotCacheStripe, mtGC>::create_unfreeable(_n_stripes);
+    for (int i = 0; i < _n_stripes; i++) {
+      _stripes[i]._idx = 0;
+    }
 
     // For refining the cards in the hot cache in parallel
     int n_workers = (ParallelGCThreads > 0 ?
@@ -68,25 +87,24 @@ jbyte* G1HotCardCache::insert(jbyte* card_ptr) {
     return card_ptr;
   }
 
-  // Otherwise, the card is hot.
-  jbyte* res = NULL;
-  MutexLockerEx x(HotCardCache_lock, Mutex::_no_safepoint_check_flag);
-  if (_n_hot == _hot_cache_size) {
-    res = _hot_cache[_hot_cache_idx];
-    _n_hot--;
-  }
-
-  // Now _n_hot < _hot_cache_size, and we can insert at _hot_cache_idx.
-  _hot_cache[_hot_cache_idx] = card_ptr;
-  _hot_cache_idx++;
-
-  if (_hot_cache_idx == _hot_cache_size) {
-    // Wrap around
-    _hot_cache_idx = 0;
-  }
-  _n_hot++;
-
-  return res;
+  // Otherwise, the card is hot. Claim the next slot in the inserting
+  // thread's stripe and swap the card into it. The allocation index is
+  // only shared by the threads that hash to the same stripe, and the
+  // swap is a single atomic on the slot itself, so there is no lock
+  // or globally shared counter on this path.
+  int stripe = stripe_for_thread(Thread::current());
+  int masked_idx =
+    (int) (((uint) Atomic::add(1, &_stripes[stripe]._idx) - 1u) &
+           (uint) (_stripe_size - 1));
+  int slot = stripe * _stripe_size + masked_idx;
+
+  jbyte* previous_ptr =
+    (jbyte*) Atomic::xchg_ptr(card_ptr, (volatile void*) &_hot_cache[slot]);
+
+  // The slot is NULL until the stripe wraps around for the first
+  // time, in which case there is nothing to refine yet; otherwise
+  // the evicted card is returned for immediate refinement.
+  return previous_ptr;
 }
 
 void G1HotCardCache::drain(int worker_i,
@@ -101,13 +119,13 @@ void G1HotCardCache::drain(int worker_i,
   assert(!use_cache(), "cache should be disabled");
   int start_idx;
 
-  while ((start_idx = _hot_cache_par_claimed_idx) < _n_hot) { // read once
+  while ((start_idx = _hot_cache_par_claimed_idx) < _hot_cache_size) { // read once
     int end_idx = start_idx + _hot_cache_par_chunk_size;
 
     if (start_idx ==
         Atomic::cmpxchg(end_idx, &_hot_cache_par_claimed_idx, start_idx)) {
       // The current worker has successfully claimed the chunk [start_idx..end_idx)
-      end_idx = MIN2(end_idx, _n_hot);
+      end_idx = MIN2(end_idx, _hot_cache_size);
       for (int i = start_idx; i < end_idx; i++) {
         jbyte* card_ptr = _hot_cache[i];
         if (card_ptr != NULL) {
@@ -135,6 +153,19 @@ void G1HotCardCache::drain(int worker_i,
   // above, are discarded prior to re-enabling the cache near the end of the GC.
 }
 
+void G1HotCardCache::reset_hot_cache() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at a safepoint");
+  assert(Thread::current()->is_VM_thread(), "Current thread should be the VMthread");
+  if (default_use_cache()) {
+    for (int i = 0; i < _hot_cache_size; i++) {
+      _hot_cache[i] = NULL;
+    }
+    for (int i = 0; i < _n_stripes; i++) {
+      _stripes[i]._idx = 0;
+    }
+  }
+}
+
 void G1HotCardCache::resize_card_counts(size_t heap_capacity) {
   _card_counts.resize(heap_capacity);
 }
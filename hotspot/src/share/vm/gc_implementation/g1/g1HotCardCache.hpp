@@ -28,6 +28,7 @@
 #include "gc_implementation/g1/g1_globals.hpp"
 #include "gc_implementation/g1/g1CardCounts.hpp"
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -54,14 +55,29 @@ class HeapRegion;
 // code, increasing throughput.
 
 class G1HotCardCache: public CHeapObj<mtGC> {
+
+  // The allocation index of one stripe of the cache. It is padded so
+  // that the stripes do not share cache lines; without the padding
+  // the indices would ping-pong between the inserting threads just
+  // like a single global index does.
+  class HotCacheStripe VALUE_OBJ_CLASS_SPEC {
+   public:
+    volatile int _idx;
+  };
+
   G1CollectedHeap*   _g1h;
 
-  // The card cache table
+  // The card cache table. It is divided into _n_stripes contiguous
+  // segments of _stripe_size entries each; an inserting thread only
+  // ever allocates slots from the stripe it hashes to, so the only
+  // shared atomic on the insertion path is the index of that stripe.
   jbyte**      _hot_cache;
 
   int          _hot_cache_size;
-  int          _n_hot;
-  int          _hot_cache_idx;
+  int          _n_stripes;    // power of two
+  int          _stripe_size;  // power of two
+
+  PaddedEnd<HotCacheStripe>* _stripes;
 
   int          _hot_cache_par_chunk_size;
   volatile int _hot_cache_par_claimed_idx;
@@ -74,6 +90,13 @@ class G1HotCardCache: public CHeapObj<mtGC> {
     return (G1ConcRSLogCacheSize > 0);
   }
 
+  // Returns the stripe the given thread inserts into. The low-order
+  // bits of a Thread* are identical for all threads because of
+  // alignment, so they are shifted out before selecting a stripe.
+  int stripe_for_thread(Thread* t) const {
+    return (int) ((((uintptr_t) t) >> 8) & (uintptr_t) (_n_stripes - 1));
+  }
+
  public:
   G1HotCardCache(G1CollectedHeap* g1h);
   ~G1HotCardCache();
@@ -90,10 +113,10 @@ class G1HotCardCache: public CHeapObj<mtGC> {
   //
   // Increments the count for given the card. if the card is not 'hot',
   // it is returned for immediate refining. Otherwise the card is
-  // added to the hot card cache.
-  // If there is enough room in the hot card cache for the card we're
-  // adding, NULL is returned and no further action in needed.
-  // If we evict a card from the cache to make room for the new card,
+  // added to the inserting thread's stripe of the hot card cache.
+  // If the claimed slot in the stripe is empty, NULL is returned and
+  // no further action is needed.
+  // If we evict a card from the slot to make room for the new card,
   // the evicted card is then returned for refinement.
   jbyte* insert(jbyte* card_ptr);
 
@@ -107,13 +130,7 @@ class G1HotCardCache: public CHeapObj<mtGC> {
   }
 
   // Resets the hot card cache and discards the entries.
-  void reset_hot_cache() {
-    assert(SafepointSynchronize::is_at_safepoint(), "Should be at a safepoint");
-    assert(Thread::current()->is_VM_thread(), "Current thread should be the VMthread");
-    _hot_cache_idx = 0; _n_hot = 0;
-  }
-
-  bool hot_cache_is_empty() { return _n_hot == 0; }
+  void reset_hot_cache();
 
   // Resizes the card counts table to match the given capacity
   void resize_card_counts(size_t heap_capacity);
@@ -31,6 +31,7 @@
 #include "code/icBuffer.hpp"
 #include "gc_implementation/g1/g1Log.hpp"
 #include "gc_implementation/g1/g1MarkSweep.hpp"
+#include "gc_implementation/g1/g1StringDedup.hpp"
 #include "gc_implementation/shared/gcHeapSummary.hpp"
 #include "gc_implementation/shared/gcTimer.hpp"
 #include "gc_implementation/shared/gcTrace.hpp"
@@ -169,6 +170,9 @@ void G1MarkSweep::mark_sweep_phase1(bool& marked_for_unloading,
   // Clean up unreferenced symbols in symbol table.
   SymbolTable::unlink();
 
+  // Unlink dead entries from the string deduplication queue and table.
+  G1StringDedup::unlink(&GenMarkSweep::is_alive);
+
   if (VerifyDuringGC) {
     HandleMark hm;  // handle scope
     COMPILER2_PRESENT(DerivedPointerTableDeactivate dpt_deact);
@@ -200,6 +204,7 @@ class G1PrepareCompactClosure: public HeapRegionClosure {
   ModRefBarrierSet* _mrbs;
   CompactPoint _cp;
   HumongousRegionSet _humongous_proxy_set;
+  bool _par;
 
   void free_humongous_region(HeapRegion* hr) {
     HeapWord* end = hr->end();
@@ -209,7 +214,7 @@ class G1PrepareCompactClosure: public HeapRegionClosure {
     assert(hr->startsHumongous(),
            "Only the start of a humongous region should be freed.");
     _g1h->free_humongous_region(hr, &dummy_pre_used, &dummy_free_list,
-                                &_humongous_proxy_set, false /* par */);
+                                &_humongous_proxy_set, _par);
     hr->prepare_for_compaction(&_cp);
     // Also clear the part of the card table that will be unused after
     // compaction.
@@ -218,11 +223,12 @@ class G1PrepareCompactClosure: public HeapRegionClosure {
   }
 
 public:
-  G1PrepareCompactClosure(CompactibleSpace* cs)
+  G1PrepareCompactClosure(CompactibleSpace* cs, bool par = false)
   : _g1h(G1CollectedHeap::heap()),
     _mrbs(_g1h->g1_barrier_set()),
     _cp(NULL, cs, cs->initialize_threshold()),
-    _humongous_proxy_set("G1MarkSweep Humongous Proxy Set") { }
+    _humongous_proxy_set("G1MarkSweep Humongous Proxy Set"),
+    _par(par) { }
 
   void update_sets() {
     // We'll recalculate total used bytes and recreate the free list
@@ -231,7 +237,7 @@ public:
                                             NULL, /* free_list */
                                             NULL, /* old_proxy_set */
                                             &_humongous_proxy_set,
-                                            false /* par */);
+                                            _par);
   }
 
   bool doHeapRegion(HeapRegion* hr) {
@@ -256,6 +262,84 @@ public:
   }
 };
 
+// The parallel full GC partitions the region sequence into one contiguous
+// chunk of regions per worker. Each worker prepares, and later compacts,
+// its own partition with a private CompactPoint, so objects never move
+// across a partition boundary and the compact phase needs no further
+// synchronization. The resulting heap is compact within each partition
+// rather than globally, which is an acceptable trade for making the
+// pause scale with ParallelGCThreads.
+
+uint* G1MarkSweep::_partition_starts = NULL;
+uint  G1MarkSweep::_num_partitions = 0;
+
+bool G1MarkSweep::use_parallel_full_gc() {
+  return G1ParallelFullGC &&
+         G1CollectedHeap::use_parallel_gc_threads() &&
+         G1CollectedHeap::heap()->workers() != NULL;
+}
+
+void G1MarkSweep::compute_compaction_partitions(uint n_workers) {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  uint n_regions = g1h->n_regions();
+
+  assert(_partition_starts == NULL, "Should have been freed after last full GC");
+  _partition_starts = NEW_C_HEAP_ARRAY(uint, n_workers + 1, mtGC);
+  _num_partitions = 0;
+
+  uint chunk = MAX2((n_regions + n_workers - 1) / n_workers, (uint)1);
+  uint idx = 0;
+  while (idx < n_regions) {
+    _partition_starts[_num_partitions++] = idx;
+    idx = MIN2(idx + chunk, n_regions);
+    // Never split a humongous object sequence across partitions.
+    while (idx < n_regions && g1h->region_at(idx)->continuesHumongous()) {
+      idx++;
+    }
+  }
+  _partition_starts[_num_partitions] = n_regions;
+}
+
+void G1MarkSweep::release_compaction_partitions() {
+  if (_partition_starts != NULL) {
+    FREE_C_HEAP_ARRAY(uint, _partition_starts, mtGC);
+    _partition_starts = NULL;
+    _num_partitions = 0;
+  }
+}
+
+// Returns the starting compaction space for the partition beginning at
+// region index 'start', mirroring what the serial path does for region 0.
+static CompactibleSpace* partition_compaction_space(G1CollectedHeap* g1h, uint start) {
+  HeapRegion* r = g1h->region_at(start);
+  CompactibleSpace* sp = r;
+  if (r->isHumongous() && oop(r->bottom())->is_gc_marked()) {
+    sp = r->next_compaction_space();
+  }
+  return sp;
+}
+
+class G1ParPrepareCompactTask : public AbstractGangTask {
+public:
+  G1ParPrepareCompactTask() : AbstractGangTask("G1 prepare compact task") { }
+
+  void work(uint worker_id) {
+    if (worker_id >= G1MarkSweep::num_partitions()) {
+      return;
+    }
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    uint start = G1MarkSweep::partition_start(worker_id);
+    uint limit = G1MarkSweep::partition_start(worker_id + 1);
+
+    G1PrepareCompactClosure blk(partition_compaction_space(g1h, start),
+                                true /* par */);
+    for (uint i = start; i < limit; i++) {
+      blk.doHeapRegion(g1h->region_at(i));
+    }
+    blk.update_sets();
+  }
+};
+
 void G1MarkSweep::mark_sweep_phase2() {
   // Now all live objects are marked, compute the new object addresses.
 
@@ -268,6 +352,13 @@ void G1MarkSweep::mark_sweep_phase2() {
   GCTraceTime tm("phase 2", G1Log::fine() && Verbose, true, gc_timer());
   GenMarkSweep::trace("2");
 
+  if (use_parallel_full_gc()) {
+    compute_compaction_partitions(g1h->workers()->active_workers());
+    G1ParPrepareCompactTask task;
+    g1h->workers()->run_task(&task);
+    return;
+  }
+
   // find the first region
   HeapRegion* r = g1h->region_at(0);
   CompactibleSpace* sp = r;
@@ -298,6 +389,19 @@ class G1AdjustPointersClosure: public HeapRegionClosure {
   }
 };
 
+class G1ParAdjustPointersTask : public AbstractGangTask {
+public:
+  G1ParAdjustPointersTask() : AbstractGangTask("G1 adjust pointers task") { }
+
+  void work(uint worker_id) {
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    G1AdjustPointersClosure blk;
+    g1h->heap_region_par_iterate_chunked(&blk, worker_id,
+                                         g1h->workers()->active_workers(),
+                                         HeapRegion::ParFullGCClaimValue);
+  }
+};
+
 void G1MarkSweep::mark_sweep_phase3() {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
@@ -323,11 +427,18 @@ void G1MarkSweep::mark_sweep_phase3() {
   // Now adjust pointers in remaining weak roots.  (All of which should
   // have been cleared if they pointed to non-surviving objects.)
   g1h->g1_process_weak_roots(&GenMarkSweep::adjust_pointer_closure);
+  G1StringDedup::oops_do(&GenMarkSweep::adjust_pointer_closure);
 
   GenMarkSweep::adjust_marks();
 
-  G1AdjustPointersClosure blk;
-  g1h->heap_region_iterate(&blk);
+  if (use_parallel_full_gc()) {
+    G1ParAdjustPointersTask task;
+    g1h->workers()->run_task(&task);
+    g1h->reset_heap_region_claim_values();
+  } else {
+    G1AdjustPointersClosure blk;
+    g1h->heap_region_iterate(&blk);
+  }
 }
 
 class G1SpaceCompactClosure: public HeapRegionClosure {
@@ -352,6 +463,25 @@ public:
   }
 };
 
+class G1ParCompactTask : public AbstractGangTask {
+public:
+  G1ParCompactTask() : AbstractGangTask("G1 compact task") { }
+
+  void work(uint worker_id) {
+    if (worker_id >= G1MarkSweep::num_partitions()) {
+      return;
+    }
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    uint start = G1MarkSweep::partition_start(worker_id);
+    uint limit = G1MarkSweep::partition_start(worker_id + 1);
+
+    G1SpaceCompactClosure blk;
+    for (uint i = start; i < limit; i++) {
+      blk.doHeapRegion(g1h->region_at(i));
+    }
+  }
+};
+
 void G1MarkSweep::mark_sweep_phase4() {
   // All pointers are now adjusted, move objects accordingly
 
@@ -364,6 +494,13 @@ void G1MarkSweep::mark_sweep_phase4() {
   GCTraceTime tm("phase 4", G1Log::fine() && Verbose, true, gc_timer());
   GenMarkSweep::trace("4");
 
+  if (use_parallel_full_gc()) {
+    G1ParCompactTask task;
+    g1h->workers()->run_task(&task);
+    release_compaction_partitions();
+    return;
+  }
+
   G1SpaceCompactClosure blk;
   g1h->heap_region_iterate(&blk);
 
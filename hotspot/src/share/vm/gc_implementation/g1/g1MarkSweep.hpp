@@ -57,7 +57,23 @@ class G1MarkSweep : AllStatic {
   static STWGCTimer* gc_timer() { return GenMarkSweep::_gc_timer; }
   static SerialOldTracer* gc_tracer() { return GenMarkSweep::_gc_tracer; }
 
+  // Partitioning of the region sequence used by the parallel full GC.
+  // One contiguous chunk of regions per worker; set up in phase 2 and
+  // reused by the compact phase.
+  static uint num_partitions()          { return _num_partitions; }
+  static uint partition_start(uint i)   {
+    assert(i <= _num_partitions, "partition index out of range");
+    return _partition_starts[i];
+  }
+
  private:
+  static uint* _partition_starts;
+  static uint  _num_partitions;
+
+  static bool use_parallel_full_gc();
+  static void compute_compaction_partitions(uint n_workers);
+  static void release_compaction_partitions();
+
 
   // Mark live objects
   static void mark_sweep_phase1(bool& marked_for_deopt,
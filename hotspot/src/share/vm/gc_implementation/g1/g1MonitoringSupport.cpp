@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc_implementation/g1/g1GCPhaseTimes.hpp"
 #include "gc_implementation/g1/g1MonitoringSupport.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/g1CollectorPolicy.hpp"
@@ -83,6 +84,20 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
   _from_counters(NULL),
   _to_counters(NULL),
 
+  _last_pause_seq(NULL),
+  _last_pause_time(NULL),
+  _last_pause_parallel_time(NULL),
+  _last_pause_gc_workers(NULL),
+  _last_pause_ext_root_scan_time(NULL),
+  _last_pause_satb_filtering_time(NULL),
+  _last_pause_update_rs_time(NULL),
+  _last_pause_update_rs_processed_buffers(NULL),
+  _last_pause_scan_rs_time(NULL),
+  _last_pause_obj_copy_time(NULL),
+  _last_pause_termination_time(NULL),
+  _last_pause_clear_ct_time(NULL),
+  _last_pause_ref_proc_time(NULL),
+
   _overall_reserved(0),
   _overall_committed(0),    _overall_used(0),
   _young_region_num(0),
@@ -167,6 +182,69 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
     // worry about updating it again later.
     _from_counters->update_used(0);
   }
+
+  // Counters for the phase breakdown of the last evacuation pause,
+  //  name "g1.lastPause". See update_pause_times() for how they are
+  // kept consistent while being sampled by external tools.
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+
+    const char* cns = PerfDataManager::name_space("g1", "lastPause");
+
+    char* cname = PerfDataManager::counter_name(cns, "seq");
+    _last_pause_seq = PerfDataManager::create_variable(SUN_GC, cname,
+                                            PerfData::U_Events, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "time");
+    _last_pause_time = PerfDataManager::create_variable(SUN_GC, cname,
+                                            PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "parallelTime");
+    _last_pause_parallel_time = PerfDataManager::create_variable(SUN_GC, cname,
+                                            PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "gcWorkers");
+    _last_pause_gc_workers = PerfDataManager::create_variable(SUN_GC, cname,
+                                            PerfData::U_None, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "extRootScanTime");
+    _last_pause_ext_root_scan_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "satbFilteringTime");
+    _last_pause_satb_filtering_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "updateRSTime");
+    _last_pause_update_rs_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "updateRSProcessedBuffers");
+    _last_pause_update_rs_processed_buffers =
+      PerfDataManager::create_variable(SUN_GC, cname,
+                                            PerfData::U_None, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "scanRSTime");
+    _last_pause_scan_rs_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "objCopyTime");
+    _last_pause_obj_copy_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "terminationTime");
+    _last_pause_termination_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "clearCTTime");
+    _last_pause_clear_ct_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+
+    cname = PerfDataManager::counter_name(cns, "refProcTime");
+    _last_pause_ref_proc_time = PerfDataManager::create_variable(SUN_GC,
+                                            cname, PerfData::U_Ticks, CHECK);
+  }
 }
 
 void G1MonitoringSupport::recalculate_sizes() {
@@ -272,3 +350,39 @@ void G1MonitoringSupport::update_eden_size() {
     eden_counters()->update_used(eden_space_used());
   }
 }
+
+void G1MonitoringSupport::update_pause_times(G1GCPhaseTimes* phase_times,
+                                             double pause_time_sec) {
+  if (!UsePerfData) {
+    return;
+  }
+
+  // Make the seq counter odd while the update is in progress so that
+  // samplers can detect (and retry on) a torn read of the record.
+  _last_pause_seq->inc();
+
+  _last_pause_time->set_value(ms_to_us(pause_time_sec * MILLIUNITS));
+  _last_pause_parallel_time->set_value(
+    ms_to_us(phase_times->cur_collection_par_time_ms()));
+  _last_pause_gc_workers->set_value((jlong) phase_times->active_gc_threads());
+  _last_pause_ext_root_scan_time->set_value(
+    ms_to_us(phase_times->average_last_ext_root_scan_time()));
+  _last_pause_satb_filtering_time->set_value(
+    ms_to_us(phase_times->average_last_satb_filtering_times_ms()));
+  _last_pause_update_rs_time->set_value(
+    ms_to_us(phase_times->average_last_update_rs_time()));
+  _last_pause_update_rs_processed_buffers->set_value(
+    (jlong) phase_times->sum_last_update_rs_processed_buffers());
+  _last_pause_scan_rs_time->set_value(
+    ms_to_us(phase_times->average_last_scan_rs_time()));
+  _last_pause_obj_copy_time->set_value(
+    ms_to_us(phase_times->average_last_obj_copy_time()));
+  _last_pause_termination_time->set_value(
+    ms_to_us(phase_times->average_last_termination_time()));
+  _last_pause_clear_ct_time->set_value(
+    ms_to_us(phase_times->cur_clear_ct_time_ms()));
+  _last_pause_ref_proc_time->set_value(
+    ms_to_us(phase_times->cur_ref_proc_time_ms()));
+
+  _last_pause_seq->inc();
+}
@@ -28,6 +28,7 @@
 #include "gc_implementation/shared/hSpaceCounters.hpp"
 
 class G1CollectedHeap;
+class G1GCPhaseTimes;
 
 // Class for monitoring logical spaces in G1. It provides data for
 // both G1's jstat counters as well as G1's memory pools.
@@ -138,6 +139,36 @@ class G1MonitoringSupport : public CHeapObj<mtGC> {
   HSpaceCounters*      _from_counters;
   HSpaceCounters*      _to_counters;
 
+  // Per-pause phase timing counters, name "sun.gc.g1.lastPause.*".
+  // They export the phase breakdown of the most recent evacuation
+  // pause in a machine-readable form so that monitoring tools can
+  // sample it from the PerfData memory region instead of parsing the
+  // -XX:+PrintGCDetails output. All times are in microseconds so that
+  // sub-millisecond phases survive the conversion to jlong. The seq
+  // counter is incremented before and after each update (i.e., it is
+  // odd while an update is in progress); a sampler that reads the same
+  // even value before and after reading the other counters is
+  // guaranteed a consistent per-pause record.
+  PerfVariable* _last_pause_seq;
+  PerfVariable* _last_pause_time;
+  PerfVariable* _last_pause_parallel_time;
+  PerfVariable* _last_pause_gc_workers;
+  PerfVariable* _last_pause_ext_root_scan_time;
+  PerfVariable* _last_pause_satb_filtering_time;
+  PerfVariable* _last_pause_update_rs_time;
+  PerfVariable* _last_pause_update_rs_processed_buffers;
+  PerfVariable* _last_pause_scan_rs_time;
+  PerfVariable* _last_pause_obj_copy_time;
+  PerfVariable* _last_pause_termination_time;
+  PerfVariable* _last_pause_clear_ct_time;
+  PerfVariable* _last_pause_ref_proc_time;
+
+  // It converts a phase time in milliseconds, as accumulated by
+  // G1GCPhaseTimes, to the microsecond value stored in the counters.
+  static jlong ms_to_us(double ms) {
+    return (jlong) (ms * 1000.0);
+  }
+
   // When it's appropriate to recalculate the various sizes (at the
   // end of a GC, when a new eden region is allocated, etc.) we store
   // them here so that we can easily report them when needed and not
@@ -204,6 +235,10 @@ class G1MonitoringSupport : public CHeapObj<mtGC> {
   // allocated and update any jstat counters that need to be updated.
   void update_eden_size();
 
+  // Publish the phase breakdown of the evacuation pause that just
+  // finished to the "sun.gc.g1.lastPause" jstat counters.
+  void update_pause_times(G1GCPhaseTimes* phase_times, double pause_time_sec);
+
   CollectorCounters* incremental_collection_counters() {
     return _incremental_collection_counters;
   }
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "gc_implementation/g1/g1StringDedup.hpp"
+#include "gc_implementation/g1/g1_globals.hpp"
+#include "memory/iterator.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
+
+//
+// G1StringDedupQueue
+//
+
+G1StringDedupQueue::G1StringDedupQueue(size_t size) :
+  _size(size),
+  _top(0),
+  _dropped(0) {
+  _lock = new Monitor(Mutex::leaf, "G1StringDedupQueue lock", true);
+  _buffer = NEW_C_HEAP_ARRAY(oop, size, mtGC);
+}
+
+void G1StringDedupQueue::push(oop java_string) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  if (_top < _size) {
+    _buffer[_top++] = java_string;
+  } else {
+    _dropped++;
+  }
+}
+
+oop G1StringDedupQueue::pop() {
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  if (_top == 0) {
+    return NULL;
+  }
+  return _buffer[--_top];
+}
+
+void G1StringDedupQueue::wait_for_work(long timeout_ms) {
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  if (_top == 0) {
+    _lock->wait(Mutex::_no_safepoint_check_flag, timeout_ms);
+  }
+}
+
+void G1StringDedupQueue::notify_work() {
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  _lock->notify();
+}
+
+void G1StringDedupQueue::oops_do(OopClosure* cl) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  for (size_t i = 0; i < _top; i++) {
+    cl->do_oop(&_buffer[i]);
+  }
+}
+
+void G1StringDedupQueue::unlink(BoolObjectClosure* is_alive) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  size_t live = 0;
+  for (size_t i = 0; i < _top; i++) {
+    if (is_alive->do_object_b(_buffer[i])) {
+      _buffer[live++] = _buffer[i];
+    }
+  }
+  _top = live;
+}
+
+//
+// G1StringDedupTable
+//
+
+G1StringDedupTable::G1StringDedupTable(size_t n_buckets) :
+  _n_buckets(n_buckets),
+  _entries(0) {
+  _lock = new Mutex(Mutex::leaf, "G1StringDedupTable lock", true);
+  _buckets = NEW_C_HEAP_ARRAY(G1StringDedupEntry*, n_buckets, mtGC);
+  memset(_buckets, 0, n_buckets * sizeof(G1StringDedupEntry*));
+}
+
+unsigned int G1StringDedupTable::hash_array(typeArrayOop value) {
+  int length = value->length();
+  const jchar* data = (const jchar*)value->base(T_CHAR);
+  unsigned int h = 0;
+  for (int i = 0; i < length; i++) {
+    h = 31 * h + (unsigned int)data[i];
+  }
+  return h;
+}
+
+typeArrayOop G1StringDedupTable::lookup_or_add(typeArrayOop value, unsigned int hash) {
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  size_t index = hash % _n_buckets;
+  for (G1StringDedupEntry* e = _buckets[index]; e != NULL; e = e->_next) {
+    if (e->_hash == hash &&
+        e->_array->length() == value->length() &&
+        memcmp(e->_array->base(T_CHAR), value->base(T_CHAR),
+               value->length() * sizeof(jchar)) == 0) {
+      return e->_array;
+    }
+  }
+  G1StringDedupEntry* e = new G1StringDedupEntry();
+  e->_array = value;
+  e->_hash = hash;
+  e->_next = _buckets[index];
+  _buckets[index] = e;
+  _entries++;
+  return value;
+}
+
+void G1StringDedupTable::deduplicate(oop java_string) {
+  typeArrayOop value = java_lang_String::value(java_string);
+  if (value == NULL) {
+    // String has no value array (not yet initialized).
+    return;
+  }
+  unsigned int hash = hash_array(value);
+  typeArrayOop canonical = lookup_or_add(value, hash);
+  if (canonical != value) {
+    java_lang_String::set_value(java_string, canonical);
+  }
+}
+
+void G1StringDedupTable::oops_do(OopClosure* cl) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  for (size_t i = 0; i < _n_buckets; i++) {
+    for (G1StringDedupEntry* e = _buckets[i]; e != NULL; e = e->_next) {
+      cl->do_oop((oop*)&e->_array);
+    }
+  }
+}
+
+void G1StringDedupTable::unlink(BoolObjectClosure* is_alive) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  for (size_t i = 0; i < _n_buckets; i++) {
+    G1StringDedupEntry** p = &_buckets[i];
+    while (*p != NULL) {
+      G1StringDedupEntry* e = *p;
+      if (is_alive->do_object_b(e->_array)) {
+        p = &e->_next;
+      } else {
+        *p = e->_next;
+        delete e;
+        _entries--;
+      }
+    }
+  }
+}
+
+//
+// G1StringDedupThread
+//
+
+G1StringDedupThread::G1StringDedupThread(G1StringDedupQueue* queue,
+                                         G1StringDedupTable* table) :
+  ConcurrentGCThread(),
+  _queue(queue),
+  _table(table) {
+  set_name("G1 StrDedup");
+  create_and_start();
+}
+
+void G1StringDedupThread::run() {
+  initialize_in_thread();
+  wait_for_universe_init();
+
+  while (!_should_terminate) {
+    _queue->wait_for_work(100 /* ms */);
+
+    for (;;) {
+      // Join the suspendible thread set while holding heap oops, so that
+      // a safepoint can update or unlink the queue and table entries we
+      // are working on.
+      _sts.join();
+      oop java_string = _queue->pop();
+      if (java_string != NULL) {
+        _table->deduplicate(java_string);
+      }
+      _sts.leave();
+      if (java_string == NULL) {
+        break;
+      }
+    }
+  }
+
+  terminate();
+}
+
+void G1StringDedupThread::stop() {
+  {
+    MutexLockerEx ml(Terminator_lock);
+    _should_terminate = true;
+  }
+  _queue->notify_work();
+  {
+    MutexLockerEx ml(Terminator_lock);
+    while (!_has_terminated) {
+      Terminator_lock->wait();
+    }
+  }
+}
+
+//
+// G1StringDedup
+//
+
+G1StringDedupQueue*  G1StringDedup::_queue = NULL;
+G1StringDedupTable*  G1StringDedup::_table = NULL;
+G1StringDedupThread* G1StringDedup::_thread = NULL;
+
+void G1StringDedup::initialize() {
+  if (is_enabled()) {
+    _queue = new G1StringDedupQueue(G1StringDeduplicationQueueSize);
+    _table = new G1StringDedupTable(G1StringDeduplicationTableSize);
+    _thread = new G1StringDedupThread(_queue, _table);
+  }
+}
+
+void G1StringDedup::stop() {
+  if (is_enabled()) {
+    _thread->stop();
+  }
+}
+
+bool G1StringDedup::is_candidate_from_evacuation(oop obj, bool obj_is_tenured, uint age) {
+  if (obj->klass() != SystemDictionary::String_klass()) {
+    return false;
+  }
+  if (obj_is_tenured) {
+    // Promoted before reaching the threshold; last chance to catch it.
+    return age < G1StringDeduplicationAgeThreshold;
+  }
+  // Enqueue exactly once, when the threshold is first reached.
+  return age == G1StringDeduplicationAgeThreshold;
+}
+
+void G1StringDedup::enqueue_from_evacuation(oop java_string) {
+  assert(is_enabled(), "String deduplication not enabled");
+  _queue->push(java_string);
+}
+
+void G1StringDedup::unlink(BoolObjectClosure* is_alive) {
+  if (is_enabled()) {
+    _queue->unlink(is_alive);
+    _table->unlink(is_alive);
+  }
+}
+
+void G1StringDedup::oops_do(OopClosure* cl) {
+  if (is_enabled()) {
+    _queue->oops_do(cl);
+    _table->oops_do(cl);
+  }
+}
+
+void G1StringDedup::unlink_or_oops_do(BoolObjectClosure* is_alive, OopClosure* cl) {
+  if (is_enabled()) {
+    unlink(is_alive);
+    oops_do(cl);
+    _queue->notify_work();
+  }
+}
+
+void G1StringDedup::print_statistics(outputStream* st) {
+  if (is_enabled()) {
+    st->print_cr("String deduplication: " SIZE_FORMAT " canonical arrays, "
+                 SIZE_FORMAT " candidates dropped",
+                 _table->entries(), _queue->dropped());
+  }
+}
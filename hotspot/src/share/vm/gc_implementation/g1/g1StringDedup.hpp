@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_IMPLEMENTATION_G1_G1STRINGDEDUP_HPP
+#define SHARE_VM_GC_IMPLEMENTATION_G1_G1STRINGDEDUP_HPP
+
+#include "gc_implementation/g1/g1_globals.hpp"
+#include "gc_implementation/shared/concurrentGCThread.hpp"
+#include "memory/allocation.hpp"
+#include "oops/oop.hpp"
+#include "oops/typeArrayOop.hpp"
+
+class BoolObjectClosure;
+class OopClosure;
+
+//
+// String deduplication lets equal java.lang.String instances share a single
+// backing char[] array. Candidate Strings are discovered by the GC as they
+// are evacuated and have reached a given age (or are promoted to old), and
+// are placed on a queue. A concurrent worker thread drains the queue and
+// canonicalizes each String's value array through a hashtable of previously
+// seen arrays. The table and the queue hold weak references to the heap;
+// they are unlinked/updated as part of normal GC root processing.
+//
+
+// A bounded queue of candidate String oops, filled by GC worker threads
+// during evacuation and drained by the deduplication thread. The queue
+// drops candidates when full; dropped candidates will usually reappear
+// during a later evacuation if they stay live.
+class G1StringDedupQueue : public CHeapObj<mtGC> {
+private:
+  Monitor*        _lock;
+  oop*            _buffer;
+  size_t          _size;
+  volatile size_t _top;
+  volatile size_t _dropped;
+
+public:
+  G1StringDedupQueue(size_t size);
+
+  // Push a candidate. Only called by GC workers at a safepoint.
+  void push(oop java_string);
+
+  // Pop a candidate, or NULL if the queue is empty. Only called by
+  // the deduplication thread.
+  oop pop();
+
+  // Block until the queue is non-empty or the given timeout expires.
+  void wait_for_work(long timeout_ms);
+  void notify_work();
+
+  void oops_do(OopClosure* cl);
+  void unlink(BoolObjectClosure* is_alive);
+
+  size_t dropped() const { return _dropped; }
+};
+
+// A chained hashtable of previously seen char[] value arrays, keyed by a
+// hash over the array contents. Entries reference the heap weakly and are
+// unlinked when their array dies.
+class G1StringDedupTable : public CHeapObj<mtGC> {
+private:
+  class G1StringDedupEntry : public CHeapObj<mtGC> {
+  public:
+    typeArrayOop        _array;
+    unsigned int        _hash;
+    G1StringDedupEntry* _next;
+  };
+
+  G1StringDedupEntry** _buckets;
+  size_t               _n_buckets;
+  size_t               _entries;
+  Mutex*               _lock;
+
+  static unsigned int hash_array(typeArrayOop value);
+
+  // Returns the canonical array equal to value, inserting value if no
+  // equal array is present. Called by the deduplication thread only.
+  typeArrayOop lookup_or_add(typeArrayOop value, unsigned int hash);
+
+public:
+  G1StringDedupTable(size_t n_buckets);
+
+  // Replace java_string's value array with the canonical equal array,
+  // if one exists.
+  void deduplicate(oop java_string);
+
+  void oops_do(OopClosure* cl);
+  void unlink(BoolObjectClosure* is_alive);
+
+  size_t entries() const { return _entries; }
+};
+
+// The concurrent deduplication worker thread.
+class G1StringDedupThread : public ConcurrentGCThread {
+private:
+  G1StringDedupQueue* _queue;
+  G1StringDedupTable* _table;
+
+public:
+  G1StringDedupThread(G1StringDedupQueue* queue, G1StringDedupTable* table);
+
+  virtual void run();
+  void stop();
+};
+
+// Static interface used by the rest of G1.
+class G1StringDedup : public AllStatic {
+private:
+  static G1StringDedupQueue*  _queue;
+  static G1StringDedupTable*  _table;
+  static G1StringDedupThread* _thread;
+
+public:
+  static bool is_enabled() { return G1UseStringDeduplication; }
+
+  // Initialize the queue, table and worker thread. Called during
+  // G1CollectedHeap initialization.
+  static void initialize();
+  static void stop();
+
+  // Candidate check used in the evacuation copy path. An object is a
+  // candidate if it is a String that has just reached the deduplication
+  // age threshold, or is being promoted to old before reaching it.
+  static bool is_candidate_from_evacuation(oop obj, bool obj_is_tenured, uint age);
+
+  static void enqueue_from_evacuation(oop java_string);
+
+  // Weak root processing, called at safepoints alongside StringTable
+  // unlink/oops_do.
+  static void unlink(BoolObjectClosure* is_alive);
+  static void oops_do(OopClosure* cl);
+  static void unlink_or_oops_do(BoolObjectClosure* is_alive, OopClosure* cl);
+
+  static void print_statistics(outputStream* st);
+};
+
+#endif // SHARE_VM_GC_IMPLEMENTATION_G1_G1STRINGDEDUP_HPP
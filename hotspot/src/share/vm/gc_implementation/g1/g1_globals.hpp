@@ -75,6 +75,12 @@
           "Target duration of individual concurrent marking steps "         \
           "in milliseconds.")                                               \
                                                                             \
+  diagnostic(uintx, G1MarkPrefetchQueueSize, 8,                             \
+          "The number of entries popped from a marking task queue that "    \
+          "are kept in flight and prefetched ahead of being scanned "       \
+          "during concurrent marking. Values of 0 or 1 disable "            \
+          "prefetching.")                                                   \
+                                                                            \
   product(intx, G1RefProcDrainInterval, 10,                                 \
           "The number of discovered reference objects to process before "   \
           "draining concurrent marking work queues.")                       \
@@ -322,7 +328,56 @@
              "remembered set when verifying the heap during a full GC.")    \
                                                                             \
   diagnostic(bool, G1VerifyHeapRegionCodeRoots, false,                      \
-             "Verify the code root lists attached to each heap region.")
+             "Verify the code root lists attached to each heap region.")    \
+                                                                            \
+  product(bool, G1AdaptiveHeapReserve, true,                                \
+          "Grow the heap reserve beyond G1ReservePercent when recent "      \
+          "pauses copied more than it can absorb, to make to-space "        \
+          "exhaustion during evacuation rare")                              \
+                                                                            \
+  product(bool, G1ClassUnloadingWithConcurrentMark, true,                   \
+          "Unload classes at the remark pause of a concurrent marking "     \
+          "cycle and purge the dead class loader data concurrently, "      \
+          "instead of waiting for a full GC")                               \
+                                                                            \
+  product(bool, G1UseRegionPinning, true,                                   \
+          "Pin the region containing an object handed out through a JNI "   \
+          "critical section instead of blocking evacuation pauses with "    \
+          "the GC locker")                                                  \
+                                                                            \
+  product(bool, G1RateBasedConcRefinementZones, true,                       \
+          "Size the refinement zones from the measured dirty-card "         \
+          "production rate versus refinement thread throughput")            \
+                                                                            \
+  product(uintx, G1MutatorRefinementCredit, 2,                              \
+          "Maximum number of completed buffers a mutator thread will "      \
+          "refine in-line before handing buffers to the refinement "        \
+          "threads instead")                                                \
+                                                                            \
+  product(uintx, G1NUMAFreeRegionScanLength, 16,                            \
+          "Maximum number of free regions scanned when looking for a "      \
+          "region on the allocating thread's NUMA node")                    \
+                                                                            \
+  product(bool, G1RSetScrubDowngrade, true,                                 \
+          "During remembered set scrubbing, move fine-grain tables that "   \
+          "have shrunk below the sparse capacity back to the sparse table") \
+                                                                            \
+  product(bool, G1ParallelFullGC, true,                                     \
+          "Use the GC worker threads for the prepare, adjust and compact "  \
+          "phases of a G1 full collection")                                 \
+                                                                            \
+  experimental(bool, G1UseStringDeduplication, false,                       \
+          "Share the backing char[] arrays of equal String objects")        \
+                                                                            \
+  experimental(uintx, G1StringDeduplicationAgeThreshold, 3,                 \
+          "String age (in GCs survived) at which a String becomes a "       \
+          "deduplication candidate")                                        \
+                                                                            \
+  experimental(uintx, G1StringDeduplicationQueueSize, 16*K,                 \
+          "Maximum number of pending String deduplication candidates")      \
+                                                                            \
+  experimental(uintx, G1StringDeduplicationTableSize, 32*K,                 \
+          "Number of buckets in the String deduplication hashtable")
 
 G1_FLAGS(DECLARE_DEVELOPER_FLAG, DECLARE_PD_DEVELOPER_FLAG, DECLARE_PRODUCT_FLAG, DECLARE_PD_PRODUCT_FLAG, DECLARE_DIAGNOSTIC_FLAG, DECLARE_EXPERIMENTAL_FLAG, DECLARE_NOTPRODUCT_FLAG, DECLARE_MANAGEABLE_FLAG, DECLARE_PRODUCT_RW_FLAG)
 
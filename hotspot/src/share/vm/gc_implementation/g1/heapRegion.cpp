@@ -32,6 +32,7 @@
 #include "gc_implementation/g1/heapRegionSeq.inline.hpp"
 #include "memory/genOopClosures.inline.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
 #include "oops/oop.inline.hpp"
 
 int    HeapRegion::LogOfHRGrainBytes = 0;
@@ -346,6 +347,8 @@ HeapRegion::HeapRegion(uint hrs_index,
                        MemRegion mr) :
     G1OffsetTableContigSpace(sharedOffsetArray, mr),
     _hrs_index(hrs_index),
+    _node_index(InvalidNodeIndex),
+    _pin_count(0),
     _humongous_type(NotHumongous), _humongous_start_region(NULL),
     _in_collection_set(false),
     _next_in_special_set(NULL), _orig_end(NULL),
@@ -371,6 +374,15 @@ HeapRegion::HeapRegion(uint hrs_index,
   assert(HeapRegionRemSet::num_par_rem_sets() > 0, "Invariant.");
 }
 
+void HeapRegion::increment_pin_count() {
+  Atomic::inc(&_pin_count);
+}
+
+void HeapRegion::decrement_pin_count() {
+  jint result = Atomic::add(-1, &_pin_count);
+  assert(result >= 0, "pin count underflow");
+}
+
 CompactibleSpace* HeapRegion::next_compaction_space() const {
   // We're not using an iterator given that it will wrap around when
   // it reaches the last region and this is not what we want here.
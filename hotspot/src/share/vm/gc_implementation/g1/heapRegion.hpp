@@ -243,6 +243,13 @@ class HeapRegion: public G1OffsetTableContigSpace {
   // The index of this region in the heap region sequence.
   uint  _hrs_index;
 
+  // NUMA node the region memory is bound to, InvalidNodeIndex if unknown.
+  uint  _node_index;
+
+  // Number of objects in this region currently pinned by JNI critical
+  // sections.
+  volatile jint _pin_count;
+
   HumongousType _humongous_type;
   // For a humongous region, region in which it starts.
   HeapRegion* _humongous_start_region;
@@ -375,7 +382,9 @@ class HeapRegion: public G1OffsetTableContigSpace {
     ParEvacFailureClaimValue   = 6,
     AggregateCountClaimValue   = 7,
     VerifyCountClaimValue      = 8,
-    ParMarkRootClaimValue      = 9
+    ParMarkRootClaimValue      = 9,
+    ParFullGCClaimValue        = 10,
+    ParInspectClaimValue       = 11
   };
 
   inline HeapWord* par_allocate_no_bot_updates(size_t word_size) {
@@ -391,6 +400,19 @@ class HeapRegion: public G1OffsetTableContigSpace {
   // sequence, otherwise -1.
   uint hrs_index() const { return _hrs_index; }
 
+  // A region is pinned while it contains an object handed out through a
+  // JNI critical section. Pinned regions are not evacuated; objects in
+  // them stay put via the evacuation failure machinery.
+  bool is_pinned() const { return _pin_count > 0; }
+  void increment_pin_count();
+  void decrement_pin_count();
+
+  // The NUMA node that this region's memory was bound to by first touch,
+  // or InvalidNodeIndex if the region has not been bound yet.
+  static const uint InvalidNodeIndex = (uint) -1;
+  uint node_index() const           { return _node_index; }
+  void set_node_index(uint index)   { _node_index = index; }
+
   // The number of bytes marked live in the region in the last marking phase.
   size_t marked_bytes()    { return _prev_marked_bytes; }
   size_t live_bytes() {
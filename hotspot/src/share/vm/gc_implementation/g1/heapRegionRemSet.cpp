@@ -608,6 +608,22 @@ PerRegionTable* OtherRegionsTable::delete_region_table() {
 
 
 // At present, this must be called stop-world single-threaded.
+bool OtherRegionsTable::downgrade_to_sparse(PerRegionTable* prt) {
+  RegionIdx_t from_hrs_ind = (RegionIdx_t) prt->hr()->hrs_index();
+  BitMap* bm = prt->bm();
+  BitMap::idx_t cur = bm->get_next_one_offset(0);
+  while (cur < bm->size()) {
+    if (!_sparse_table.add_card(from_hrs_ind, (CardIdx_t) cur)) {
+      // No room in the sparse table after all; undo the partial transfer
+      // and keep the fine-grain table.
+      _sparse_table.delete_entry(from_hrs_ind);
+      return false;
+    }
+    cur = bm->get_next_one_offset(cur + 1);
+  }
+  return true;
+}
+
 void OtherRegionsTable::scrub(CardTableModRefBS* ctbs,
                               BitMap* region_bm, BitMap* card_bm) {
   // First eliminated garbage regions from the coarse map.
@@ -662,6 +678,19 @@ void OtherRegionsTable::scrub(CardTableModRefBS* ctbs,
           _n_fine_entries--;
           unlink_from_all(cur);
           PerRegionTable::free(cur);
+        } else if (G1RSetScrubDowngrade &&
+                   cur->occupied() <= (jint) SparsePRTEntry::cards_num() &&
+                   downgrade_to_sparse(cur)) {
+          // Scrubbing shrank the table below the sparse capacity, so the
+          // remaining cards now live in the sparse table again.
+          *prev = nxt;
+          cur->set_collision_list_next(NULL);
+          _n_fine_entries--;
+          unlink_from_all(cur);
+          PerRegionTable::free(cur);
+          if (G1RSScrubVerbose) {
+            gclog_or_tty->print_cr("          downgraded to sparse.");
+          }
         } else {
           prev = cur->collision_list_next_addr();
         }
@@ -118,6 +118,11 @@ class OtherRegionsTable VALUE_OBJ_CLASS_SPEC {
   // false.
   bool del_single_region_table(size_t ind, HeapRegion* hr);
 
+  // Move the cards of a fine-grain table that has shrunk below the sparse
+  // capacity back into the sparse table. Returns false (leaving the fine
+  // table in place) if the sparse table has no room.
+  bool downgrade_to_sparse(PerRegionTable* prt);
+
   // Indexed by thread X heap region, to minimize thread contention.
   static int** _from_card_cache;
   static size_t _from_card_cache_max_regions;
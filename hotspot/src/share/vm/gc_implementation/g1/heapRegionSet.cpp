@@ -333,6 +333,35 @@ void HeapRegionLinkedList::add_as_tail(HeapRegionLinkedList* from_list) {
   from_list->verify_optional();
 }
 
+HeapRegion* HeapRegionLinkedList::remove_region_on_node(uint node_index,
+                                                        uint max_scan) {
+  hrs_assert_mt_safety_ok(this);
+
+  HeapRegion* prev = NULL;
+  HeapRegion* curr = _head;
+  uint scanned = 0;
+  while (curr != NULL && scanned < max_scan) {
+    if (curr->node_index() == node_index) {
+      if (prev == NULL) {
+        return remove_head();
+      }
+      prev->set_next(curr->next());
+      if (curr == _tail) {
+        _tail = prev;
+      }
+      curr->set_next(NULL);
+
+      // remove_internal() will verify the region.
+      remove_internal(curr);
+      return curr;
+    }
+    prev = curr;
+    curr = curr->next();
+    scanned++;
+  }
+  return NULL;
+}
+
 void HeapRegionLinkedList::remove_all() {
   hrs_assert_mt_safety_ok(this);
   verify_optional();
@@ -320,6 +320,12 @@ public:
   // Convenience method.
   inline HeapRegion* remove_head_or_null();
 
+  // It scans up to max_scan regions from the head of the list for one
+  // whose memory is bound to the given NUMA node, removes and returns
+  // it, or returns NULL if no such region is found. The scan is bounded
+  // so that a NUMA miss stays cheap under the Heap_lock.
+  HeapRegion* remove_region_on_node(uint node_index, uint max_scan);
+
   // It moves the regions from from_list to this list and empties
   // from_list. The new regions will appear in the same order as they
   // were in from_list and be linked in the beginning of this list.
@@ -91,7 +91,8 @@ PtrQueueSet::PtrQueueSet(bool notify_when_complete) :
   _completed_buffers_tail(NULL),
   _n_completed_buffers(0),
   _process_completed_threshold(0), _process_completed(false),
-  _buf_free_list(NULL), _buf_free_list_sz(0)
+  _buf_free_list(NULL), _buf_free_list_sz(0),
+  _total_enqueued_buffers(0)
 {
   _fl_owner = this;
 }
@@ -223,6 +224,7 @@ void PtrQueueSet::enqueue_complete_buffer(void** buf, size_t index) {
     _completed_buffers_tail = cbn;
   }
   _n_completed_buffers++;
+  _total_enqueued_buffers++;
 
   if (!_process_completed && _process_completed_threshold >= 0 &&
       _n_completed_buffers >= _process_completed_threshold) {
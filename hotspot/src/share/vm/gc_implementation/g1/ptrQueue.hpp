@@ -230,6 +230,11 @@ protected:
   int _max_completed_queue;
   int _completed_queue_padding;
 
+  // Cumulative number of buffers ever enqueued on the completed list.
+  // Together with the processed counts this gives the production rate
+  // seen by concurrent refinement. Racy reads are fine.
+  jint _total_enqueued_buffers;
+
   int completed_buffers_list_length();
   void assert_completed_buffer_list_len_correct_locked();
   void assert_completed_buffer_list_len_correct();
@@ -300,6 +305,7 @@ public:
   void reduce_free_list();
 
   int completed_buffers_num() { return _n_completed_buffers; }
+  jint total_enqueued_buffers() { return _total_enqueued_buffers; }
 
   void merge_bufferlists(PtrQueueSet* src);
 
@@ -63,8 +63,15 @@ void CardTableModRefBS::non_clean_card_iterate_parallel_work(Space* sp, MemRegio
   pst->set_n_threads(n_threads);
   pst->set_n_tasks(n_strides);
 
-  uint stride = 0;
-  while (!pst->is_task_claimed(/* reference */ stride)) {
+  // When ordering strides by density, the task numbers handed out by
+  // the claim counter are positions in the precomputed order rather
+  // than stride numbers, so the strides with the most dirty cards are
+  // processed first and the cheap ones backfill the tail of the scan.
+  uint* stride_order = get_stride_order_for_space(sp, mr, n_strides);
+
+  uint claimed = 0;
+  while (!pst->is_task_claimed(/* reference */ claimed)) {
+    uint stride = stride_order != NULL ? stride_order[claimed] : claimed;
     process_stride(sp, mr, stride, n_strides, cl, ct,
                    lowest_non_clean,
                    lowest_non_clean_base_chunk_index,
@@ -83,6 +90,106 @@ void CardTableModRefBS::non_clean_card_iterate_parallel_work(Space* sp, MemRegio
   }
 }
 
+// Counts the non-clean cards of "mr" in each stride. The card table is
+// read a word at a time so that the all-clean common case costs one
+// comparison per sizeof(intptr_t) cards. The counts are only a
+// scheduling hint, so no attempt is made to distinguish the different
+// non-clean card values or to synchronize with concurrent LNC updates.
+void
+CardTableModRefBS::
+count_dirty_cards_per_stride(MemRegion mr, uint n_strides, size_t* counts) {
+  const intptr_t all_clean = ~(intptr_t)0;  // sizeof(intptr_t) clean cards
+  assert((jbyte)all_clean == clean_card_val(), "clean card is not all ones");
+
+  for (uint s = 0; s < n_strides; s++) {
+    counts[s] = 0;
+  }
+
+  jbyte* cur      = byte_for(mr.start());
+  jbyte* end_card = byte_after(mr.last());
+  while (cur < end_card) {
+    // The chunk containing "cur" ends at the next multiple of
+    // ParGCCardsPerStrideChunk in card index space.
+    uintptr_t chunk_index = (uintptr_t)cur / ParGCCardsPerStrideChunk;
+    jbyte* limit = (jbyte*)((chunk_index + 1) * ParGCCardsPerStrideChunk);
+    limit = MIN2(limit, end_card);
+    const uint stride = (uint)(chunk_index % n_strides);
+
+    size_t dirty = 0;
+    // Lead-in up to word alignment.
+    while (cur < limit && !is_ptr_aligned(cur, sizeof(intptr_t))) {
+      if (*cur != clean_card_val()) dirty++;
+      cur++;
+    }
+    // Word-at-a-time over the body of the chunk.
+    while (cur + sizeof(intptr_t) <= limit) {
+      intptr_t v = *(intptr_t*)cur;
+      if (v != all_clean) {
+        for (size_t b = 0; b < sizeof(intptr_t); b++) {
+          if (cur[b] != clean_card_val()) dirty++;
+        }
+      }
+      cur += sizeof(intptr_t);
+    }
+    // Tail of the chunk.
+    while (cur < limit) {
+      if (*cur != clean_card_val()) dirty++;
+      cur++;
+    }
+    counts[stride] += dirty;
+  }
+}
+
+// Returns the strides of "mr" ordered by decreasing dirty-card count,
+// or NULL when density ordering is disabled. The order is computed once
+// per collection per covered region by the first thread to get here;
+// later threads either see the published collection count or block
+// briefly on the lock while the pre-scan finishes. This mirrors the
+// once-per-collection resizing protocol of get_LNC_array_for_space().
+uint*
+CardTableModRefBS::
+get_stride_order_for_space(Space* sp, MemRegion mr, uint n_strides) {
+  if (!ParGCStrideDensityOrdering) {
+    return NULL;
+  }
+  int i = find_covering_region_containing(sp->bottom());
+  int cur_collection = Universe::heap()->total_collections();
+  if (_last_stride_order_collection[i] != cur_collection) {
+    MutexLocker x(ParGCRareEvent_lock);
+    if (_last_stride_order_collection[i] != cur_collection) {
+      if (_stride_order[i] == NULL || _stride_order_len[i] != n_strides) {
+        if (_stride_order[i] != NULL) {
+          FREE_C_HEAP_ARRAY(uint, _stride_order[i], mtGC);
+        }
+        _stride_order[i]     = NEW_C_HEAP_ARRAY(uint, n_strides, mtGC);
+        _stride_order_len[i] = n_strides;
+      }
+      size_t* counts = NEW_C_HEAP_ARRAY(size_t, n_strides, mtGC);
+      count_dirty_cards_per_stride(mr, n_strides, counts);
+
+      // Insertion sort by decreasing count; n_strides is small
+      // (ParallelGCThreads * ParGCStridesPerThread).
+      uint* order = _stride_order[i];
+      for (uint s = 0; s < n_strides; s++) {
+        order[s] = s;
+      }
+      for (uint s = 1; s < n_strides; s++) {
+        uint   stride = order[s];
+        size_t count  = counts[stride];
+        uint   t      = s;
+        while (t > 0 && counts[order[t - 1]] < count) {
+          order[t] = order[t - 1];
+          t--;
+        }
+        order[t] = stride;
+      }
+      FREE_C_HEAP_ARRAY(size_t, counts, mtGC);
+      _last_stride_order_collection[i] = cur_collection;
+    }
+  }
+  return _stride_order[i];
+}
+
 void
 CardTableModRefBS::
 process_stride(Space* sp,
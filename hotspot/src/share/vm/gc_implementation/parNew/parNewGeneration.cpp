@@ -120,6 +120,8 @@ void ParScanThreadState::scan_partial_array_and_push_remainder(oop old) {
   assert(Universe::heap()->is_in_reserved(old), "must be in heap.");
   assert(!old_gen()->is_in(old), "must be in young generation.");
 
+  TASKQUEUE_STATS_ONLY(note_array_chunk_processed());
+
   objArrayOop obj = objArrayOop(old->forwardee());
   // Process ParGCArrayScanChunk elements now
   // and push the remainder back onto queue
@@ -382,6 +384,8 @@ ParScanThreadState::reset_stats()
   _term_attempts = 0;
   _overflow_refills = 0;
   _overflow_refill_objs = 0;
+  _arrays_chunked = 0;
+  _array_chunks_processed = 0;
 }
 
 void ParScanThreadStateSet::reset_stats()
@@ -443,6 +447,11 @@ void ParScanThreadStateSet::print_taskqueue_stats(outputStream* const st)
                    SIZE_FORMAT_W(10) " overflow objects",
                    pss.overflow_refills(), pss.overflow_refill_objs());
     }
+    if (pss.arrays_chunked() > 0) {
+      st->print_cr("    " SIZE_FORMAT_W(10) " arrays chunked      "
+                   SIZE_FORMAT_W(10) " array chunks",
+                   pss.arrays_chunked(), pss.array_chunks_processed());
+    }
   }
   st->print("tot "); totals.print(st); st->cr();
 
@@ -1239,6 +1248,7 @@ oop ParNewGeneration::copy_to_survivor_space_avoiding_promotion_undo(
       obj_to_push = old;
       assert(obj_to_push->is_forwarded() && obj_to_push->forwardee() != obj_to_push,
              "push forwarded object");
+      TASKQUEUE_STATS_ONLY(par_scan_state->note_array_chunked());
     }
     // Push it on one of the queues of to-be-scanned objects.
     bool simulate_overflow = false;
@@ -1367,6 +1377,7 @@ oop ParNewGeneration::copy_to_survivor_space_with_undo(
       obj_to_push = old;
       assert(obj_to_push->is_forwarded() && obj_to_push->forwardee() != obj_to_push,
              "push forwarded object");
+      TASKQUEUE_STATS_ONLY(par_scan_state->note_array_chunked());
     }
     // Push it on one of the queues of to-be-scanned objects.
     bool simulate_overflow = false;
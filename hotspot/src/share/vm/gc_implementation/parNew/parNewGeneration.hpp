@@ -105,6 +105,8 @@ class ParScanThreadState {
   size_t _term_attempts;
   size_t _overflow_refills;
   size_t _overflow_refill_objs;
+  size_t _arrays_chunked;
+  size_t _array_chunks_processed;
 #endif // TASKQUEUE_STATS
 
   // Stats for promotion failure
@@ -201,10 +203,15 @@ class ParScanThreadState {
   size_t overflow_refills() const          { return _overflow_refills; }
   size_t overflow_refill_objs() const      { return _overflow_refill_objs; }
 
+  size_t arrays_chunked() const            { return _arrays_chunked; }
+  size_t array_chunks_processed() const    { return _array_chunks_processed; }
+
   void note_term_attempt()                 { ++_term_attempts; }
   void note_overflow_refill(size_t objs)   {
     ++_overflow_refills; _overflow_refill_objs += objs;
   }
+  void note_array_chunked()                { ++_arrays_chunked; }
+  void note_array_chunk_processed()        { ++_array_chunks_processed; }
 
   void reset_stats();
 #endif // TASKQUEUE_STATS
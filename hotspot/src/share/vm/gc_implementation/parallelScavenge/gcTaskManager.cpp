@@ -28,6 +28,7 @@
 #include "gc_implementation/shared/adaptiveSizePolicy.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
 
@@ -401,6 +402,21 @@ void GCTaskManager::initialize() {
   // The queue for the GCTaskManager must be a CHeapObj.
   GCTaskQueue* unsynchronized_queue = GCTaskQueue::create_on_c_heap();
   _queue = SynchronizedGCTaskQueue::create(unsynchronized_queue, lock());
+  if (UseGCTaskStealing) {
+    _worker_queues = new GCTaskWorkerQueueSet(workers());
+    _steal_seeds = NEW_C_HEAP_ARRAY(int, workers(), mtGC);
+    for (uint q = 0; q < workers(); q += 1) {
+      GCTaskWorkerQueue* worker_queue = new GCTaskWorkerQueue();
+      worker_queue->initialize();
+      _worker_queues->register_queue(q, worker_queue);
+      _steal_seeds[q] = 17 + (int) q;
+    }
+  } else {
+    _worker_queues = NULL;
+    _steal_seeds = NULL;
+  }
+  _distributed_tasks = 0;
+  _round_robin = 0;
   _noop_task = NoopGCTask::create_on_c_heap();
   _idle_inactive_task = WaitForBarrierGCTask::create_on_c_heap();
   _resource_flag = NEW_C_HEAP_ARRAY(bool, workers(), mtGC);
@@ -446,6 +462,16 @@ void GCTaskManager::initialize() {
 GCTaskManager::~GCTaskManager() {
   assert(busy_workers() == 0, "still have busy workers");
   assert(queue()->is_empty(), "still have queued work");
+  assert(!has_distributed_tasks(), "still have distributed work");
+  if (_worker_queues != NULL) {
+    for (uint q = 0; q < workers(); q += 1) {
+      delete _worker_queues->queue(q);
+    }
+    delete _worker_queues;
+    _worker_queues = NULL;
+    FREE_C_HEAP_ARRAY(int, _steal_seeds, mtGC);
+    _steal_seeds = NULL;
+  }
   NoopGCTask::destroy(_noop_task);
   _noop_task = NULL;
   WaitForBarrierGCTask::destroy(_idle_inactive_task);
@@ -612,6 +638,9 @@ void GCTaskManager::add_list(GCTaskQueue* list) {
   if (TraceGCTaskManager) {
     tty->print_cr("GCTaskManager::add_list(%u)", list->length());
   }
+  if (worker_queues() != NULL) {
+    distribute_list(list);
+  }
   queue()->enqueue(list);
   // Notify with the lock held to avoid missed notifies.
   if (TraceGCTaskManager) {
@@ -622,54 +651,130 @@ void GCTaskManager::add_list(GCTaskQueue* list) {
   // Release monitor().
 }
 
-// GC workers wait in get_task() for new work to be added
-// to the GCTaskManager's queue.  When new work is added,
-// a notify is sent to the waiting GC workers which then
-// compete to get tasks.  If a GC worker wakes up and there
-// is no work on the queue, it is given a noop_task to execute
-// and then loops to find more work.
+// Deal the leading ordinary tasks of "list" into the per-worker deques,
+// leaving everything from the first non-ordinary task onward on "list"
+// for the shared queue.  Stopping at the first barrier preserves the
+// ordering the barrier protocol relies on: get_task() refuses to hand
+// out a barrier while the deques still hold tasks that were enqueued
+// ahead of it.
+void GCTaskManager::distribute_list(GCTaskQueue* list) {
+  assert(monitor()->owned_by_self(), "don't own the lock");
+  uint n = active_workers() != 0 ? active_workers() : workers();
+  while (!list->is_empty() && list->peek()->is_ordinary_task()) {
+    GCTask* task = list->dequeue();
+    uint target;
+    if (UseGCTaskAffinity && task->affinity() < workers()) {
+      target = task->affinity();
+    } else {
+      target = _round_robin % n;
+      _round_robin += 1;
+    }
+    if (worker_queues()->queue(target)->push(task)) {
+      Atomic::inc(&_distributed_tasks);
+      if (TraceGCTaskManager) {
+        tty->print_cr("GCTaskManager::distribute_list: task " INTPTR_FORMAT
+                      " [%s] -> worker %u",
+                      task, GCTask::Kind::to_string(task->kind()), target);
+      }
+    } else {
+      // The deque is full.  Put the task back at the head of the shared
+      // queue; the rest of the list is enqueued behind it by the caller,
+      // so the original order is kept.
+      queue()->enqueue(task);
+      break;
+    }
+  }
+}
+
+// Claim a task from the worker deques without taking the monitor.
+// All dequeues here use the "steal" end of the deques: the VM thread
+// is the only pusher (in distribute_list(), under the monitor), so
+// every worker -- including a deque's nominal owner -- acts as a
+// thief.  Returns NULL if the deques are (or appear to be) empty, or
+// if dispatch is blocked by a barrier task.
+GCTask* GCTaskManager::poll_worker_queues(uint which) {
+  if (worker_queues() == NULL ||
+      !has_distributed_tasks() ||
+      is_blocked()) {
+    return NULL;
+  }
+  GCTask* task = NULL;
+  if (!worker_queues()->queue(which)->pop_global(task) &&
+      !worker_queues()->steal(which, &_steal_seeds[which], task)) {
+    return NULL;
+  }
+  Atomic::dec(&_distributed_tasks);
+  if (TraceGCTaskManager) {
+    tty->print_cr("GCTaskManager::poll_worker_queues(%u) => " INTPTR_FORMAT
+                  " [%s]",
+                  which, task, GCTask::Kind::to_string(task->kind()));
+  }
+  return task;
+}
+
+// GC workers first look for work in the per-worker deques filled by
+// add_list(), claiming it with lock-free pops and steals.  Only when
+// the deques are empty do they fall back to the GCTaskManager's
+// shared queue and its monitor, where they wait for new work to be
+// added.  When new work is added, a notify is sent to the waiting GC
+// workers which then compete to get tasks.  If a GC worker wakes up
+// and there is no work on the queue, it is given a noop_task to
+// execute and then loops to find more work.
 
 GCTask* GCTaskManager::get_task(uint which) {
-  GCTask* result = NULL;
-  // Grab the queue lock.
-  MutexLockerEx ml(monitor(), Mutex::_no_safepoint_check_flag);
-  // Wait while the queue is block or
-  // there is nothing to do, except maybe release resources.
-  while (is_blocked() ||
-         (queue()->is_empty() && !should_release_resources(which))) {
-    if (TraceGCTaskManager) {
-      tty->print_cr("GCTaskManager::get_task(%u)"
-                    "  blocked: %s"
-                    "  empty: %s"
-                    "  release: %s",
-                    which,
-                    is_blocked() ? "true" : "false",
-                    queue()->is_empty() ? "true" : "false",
-                    should_release_resources(which) ? "true" : "false");
-      tty->print_cr("    => (%s)->wait()",
-                    monitor()->name());
+  GCTask* result = poll_worker_queues(which);
+  if (result == NULL) {
+    // Grab the queue lock.
+    MutexLockerEx ml(monitor(), Mutex::_no_safepoint_check_flag);
+    // Wait while the queue is block or
+    // there is nothing to do, except maybe release resources.
+    while (is_blocked() ||
+           (queue()->is_empty() &&
+            !has_distributed_tasks() &&
+            !should_release_resources(which))) {
+      if (TraceGCTaskManager) {
+        tty->print_cr("GCTaskManager::get_task(%u)"
+                      "  blocked: %s"
+                      "  empty: %s"
+                      "  release: %s",
+                      which,
+                      is_blocked() ? "true" : "false",
+                      queue()->is_empty() ? "true" : "false",
+                      should_release_resources(which) ? "true" : "false");
+        tty->print_cr("    => (%s)->wait()",
+                      monitor()->name());
+      }
+      monitor()->wait(Mutex::_no_safepoint_check_flag, 0);
     }
-    monitor()->wait(Mutex::_no_safepoint_check_flag, 0);
-  }
-  // We've reacquired the queue lock here.
-  // Figure out which condition caused us to exit the loop above.
-  if (!queue()->is_empty()) {
-    if (UseGCTaskAffinity) {
-      result = queue()->dequeue(which);
-    } else {
-      result = queue()->dequeue();
+    // We've reacquired the queue lock here.
+    // Dispatch work may have been dealt into the deques while we slept.
+    result = poll_worker_queues(which);
+    if (result == NULL && !queue()->is_empty()) {
+      if (queue()->peek()->is_barrier_task() && has_distributed_tasks()) {
+        // The barrier must not be handed out while tasks that were
+        // enqueued ahead of it are still sitting in the deques.  Fall
+        // through to the noop below and come around again.
+      } else {
+        if (UseGCTaskAffinity) {
+          result = queue()->dequeue(which);
+        } else {
+          result = queue()->dequeue();
+        }
+        if (result->is_barrier_task()) {
+          assert(which != sentinel_worker(),
+                 "blocker shouldn't be bogus");
+          set_blocking_worker(which);
+        }
+      }
     }
-    if (result->is_barrier_task()) {
-      assert(which != sentinel_worker(),
-             "blocker shouldn't be bogus");
-      set_blocking_worker(which);
+    if (result == NULL) {
+      // The queue is empty, but we were woken up.
+      // Just hand back a Noop task,
+      // in case someone wanted us to release resources, or whatever.
+      result = noop_task();
+      increment_noop_tasks();
     }
-  } else {
-    // The queue is empty, but we were woken up.
-    // Just hand back a Noop task,
-    // in case someone wanted us to release resources, or whatever.
-    result = noop_task();
-    increment_noop_tasks();
+    // Release monitor().
   }
   assert(result != NULL, "shouldn't have null task");
   if (TraceGCTaskManager) {
@@ -682,7 +787,6 @@ GCTask* GCTaskManager::get_task(uint which) {
     increment_delivered_tasks();
   }
   return result;
-  // Release monitor().
 }
 
 void GCTaskManager::note_completion(uint which) {
@@ -699,7 +803,7 @@ void GCTaskManager::note_completion(uint which) {
   }
   increment_completed_tasks();
   uint active = decrement_busy_workers();
-  if ((active == 0) && (queue()->is_empty())) {
+  if ((active == 0) && (queue()->is_empty()) && !has_distributed_tasks()) {
     increment_emptied_queue();
     if (TraceGCTaskManager) {
       tty->print_cr("    GCTaskManager::note_completion(%u) done", which);
@@ -735,17 +839,18 @@ void GCTaskManager::note_completion(uint which) {
   // Release monitor().
 }
 
+// The busy worker count is updated atomically instead of under the
+// monitor, because workers on the stealing fast path become busy
+// without ever taking the monitor.
 uint GCTaskManager::increment_busy_workers() {
-  assert(queue()->own_lock(), "don't own the lock");
-  _busy_workers += 1;
-  return _busy_workers;
+  return (uint) Atomic::add(1, &_busy_workers);
 }
 
 uint GCTaskManager::decrement_busy_workers() {
   assert(queue()->own_lock(), "don't own the lock");
-  assert(_busy_workers > 0, "About to make a mistake");
-  _busy_workers -= 1;
-  return _busy_workers;
+  jint result = Atomic::add(-1, &_busy_workers);
+  assert(result >= 0, "About to make a mistake");
+  return (uint) result;
 }
 
 void GCTaskManager::release_all_resources() {
@@ -25,8 +25,10 @@
 #ifndef SHARE_VM_GC_IMPLEMENTATION_PARALLELSCAVENGE_GCTASKMANAGER_HPP
 #define SHARE_VM_GC_IMPLEMENTATION_PARALLELSCAVENGE_GCTASKMANAGER_HPP
 
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "utilities/growableArray.hpp"
+#include "utilities/taskqueue.hpp"
 
 //
 // The GCTaskManager is a queue of GCTasks, and accessors
@@ -55,6 +57,12 @@ class Mutex;
 class Monitor;
 class ThreadClosure;
 
+// Per-worker dispatch deques.  add_list() deals the leading ordinary
+// tasks of each batch into these so that workers can claim dispatch
+// work without serializing on the manager's monitor.
+typedef GenericTaskQueue<GCTask*, mtGC>              GCTaskWorkerQueue;
+typedef GenericTaskQueueSet<GCTaskWorkerQueue, mtGC> GCTaskWorkerQueueSet;
+
 // The abstract base GCTask.
 class GCTask : public ResourceObj {
 public:
@@ -164,6 +172,10 @@ public:
   uint length() const {
     return _length;
   }
+  //     Peek at the task that dequeue() would return, without removing it.
+  GCTask* peek() const {
+    return remove_end();
+  }
   // Methods.
   //     Enqueue one task.
   void enqueue(GCTask* task);
@@ -261,6 +273,10 @@ public:
     guarantee(own_lock(), "don't own the lock");
     return unsynchronized_queue()->dequeue(affinity);
   }
+  GCTask* peek() const {
+    guarantee(own_lock(), "don't own the lock");
+    return unsynchronized_queue()->peek();
+  }
   uint length() const {
     guarantee(own_lock(), "don't own the lock");
     return unsynchronized_queue()->length();
@@ -369,12 +385,16 @@ private:
   const uint                _workers;           // Number of workers.
   Monitor*                  _monitor;           // Notification of changes.
   SynchronizedGCTaskQueue*  _queue;             // Queue of tasks.
+  GCTaskWorkerQueueSet*     _worker_queues;     // Per-worker dispatch deques.
+  int*                      _steal_seeds;       // Per-worker steal random seeds.
+  volatile jint             _distributed_tasks; // Tasks dealt into the deques.
+  uint                      _round_robin;       // Next deque to deal a task to.
   GCTaskThread**            _thread;            // Array of worker threads.
   uint                      _active_workers;    // Number of active workers.
-  uint                      _busy_workers;      // Number of busy workers.
+  volatile jint             _busy_workers;      // Number of busy workers.
   uint                      _blocking_worker;   // The worker that's blocking.
   bool*                     _resource_flag;     // Array of flag per threads.
-  uint                      _delivered_tasks;   // Count of delivered tasks.
+  volatile jint             _delivered_tasks;   // Count of delivered tasks.
   uint                      _completed_tasks;   // Count of completed tasks.
   uint                      _barriers;          // Count of barrier tasks.
   uint                      _emptied_queue;     // Times we emptied the queue.
@@ -397,7 +417,7 @@ public:
   }
   // Accessors.
   uint busy_workers() const {
-    return _busy_workers;
+    return (uint) _busy_workers;
   }
   volatile uint idle_workers() const {
     return _idle_workers;
@@ -475,6 +495,20 @@ protected:
   SynchronizedGCTaskQueue* queue() const {
     return _queue;
   }
+  GCTaskWorkerQueueSet* worker_queues() const {
+    return _worker_queues;
+  }
+  //     Are any tasks currently sitting in the worker deques?
+  //     This is a racy read; callers re-check under the monitor
+  //     where it matters (barrier dispatch and queue-emptied
+  //     accounting).
+  bool has_distributed_tasks() const {
+    return _distributed_tasks != 0;
+  }
+  //     Deal the leading ordinary tasks of a list into the worker deques.
+  void distribute_list(GCTaskQueue* list);
+  //     Take a task from the worker deques, stealing if need be.
+  GCTask* poll_worker_queues(uint which);
   NoopGCTask* noop_task() const {
     return _noop_task;
   }
@@ -502,10 +536,12 @@ protected:
   uint decrement_busy_workers();
   //     Count of tasks delivered to workers.
   uint delivered_tasks() const {
-    return _delivered_tasks;
+    return (uint) _delivered_tasks;
   }
   void increment_delivered_tasks() {
-    _delivered_tasks += 1;
+    // Tasks are delivered outside the monitor on the stealing
+    // fast path, so count them atomically.
+    Atomic::inc(&_delivered_tasks);
   }
   void reset_delivered_tasks() {
     _delivered_tasks = 0;
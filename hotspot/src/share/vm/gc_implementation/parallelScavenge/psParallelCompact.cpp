@@ -374,6 +374,7 @@ ParallelCompactData::ParallelCompactData()
   _reserved_byte_size = 0;
   _region_data = 0;
   _region_count = 0;
+  _region_prev_live = 0;
 
   _block_vspace = 0;
   _block_data = 0;
@@ -431,11 +432,22 @@ bool ParallelCompactData::initialize_region_data(size_t region_size)
   if (_region_vspace != 0) {
     _region_data = (RegionData*)_region_vspace->reserved_low_addr();
     _region_count = count;
+    _region_prev_live = NEW_C_HEAP_ARRAY(size_t, count, mtGC);
+    memset(_region_prev_live, 0, count * sizeof(size_t));
     return true;
   }
   return false;
 }
 
+void ParallelCompactData::record_prev_live(HeapWord* beg, HeapWord* end)
+{
+  const size_t beg_region = addr_to_region_idx(beg);
+  const size_t end_region = addr_to_region_idx(region_align_up(end));
+  for (size_t cur = beg_region; cur < end_region; ++cur) {
+    _region_prev_live[cur] = region(cur)->data_size();
+  }
+}
+
 bool ParallelCompactData::initialize_block_data()
 {
   assert(_region_count != 0, "region data must be initialized first");
@@ -1461,7 +1473,38 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   }
 #endif  // #if 0
 
-  return sd.region_to_addr(best_cp);
+  HeapWord* dense_prefix = sd.region_to_addr(best_cp);
+  if (ParallelOldIncrementalDensePrefix) {
+    dense_prefix = extend_dense_prefix_over_stable_regions(id, dense_prefix);
+  }
+  return dense_prefix;
+}
+
+HeapWord*
+PSParallelCompact::extend_dense_prefix_over_stable_regions(const SpaceId id,
+                                                           HeapWord* dense_prefix)
+{
+  const ParallelCompactData& sd = summary_data();
+  HeapWord* const new_top = _space_info[id].new_top();
+  const size_t threshold_words =
+    ParallelCompactData::RegionSize * ParallelOldDenseRegionThreshold / 100;
+
+  size_t cur = sd.addr_to_region_idx(dense_prefix);
+  const size_t end = sd.addr_to_region_idx(sd.region_align_down(new_top));
+  while (cur < end) {
+    const size_t live = sd.region(cur)->data_size();
+    if (live < threshold_words || live != sd.prev_live_words(cur)) {
+      break;
+    }
+    ++cur;
+  }
+
+  if (TraceParallelOldGCDensePrefix &&
+      sd.region_to_addr(cur) != dense_prefix) {
+    tty->print_cr("incremental dense prefix: " PTR_FORMAT " -> " PTR_FORMAT,
+                  dense_prefix, sd.region_to_addr(cur));
+  }
+  return sd.region_to_addr(cur);
 }
 
 #ifndef PRODUCT
@@ -1894,6 +1937,15 @@ void PSParallelCompact::summary_phase(ParCompactionManager* cm,
   // Old generations.
   summarize_space(old_space_id, maximum_compaction);
 
+  // Remember the old space's per-region live counts so that the next full GC
+  // can tell which regions have not changed. Regions above the dense prefix
+  // will have their contents shifted by this compaction, so their recorded
+  // counts typically will not match next time; that only makes the stability
+  // test conservative.
+  if (ParallelOldIncrementalDensePrefix) {
+    _summary_data.record_prev_live(old_space->bottom(), old_space->top());
+  }
+
   // Summarize the remaining spaces in the young gen.  The initial target space
   // is the old gen.  If a space does not fit entirely into the target, then the
   // remainder is compacted into the space itself and that space becomes the new
@@ -404,6 +404,17 @@ public:
   // must be region-aligned; end need not be.
   void summarize_dense_prefix(HeapWord* beg, HeapWord* end);
 
+  // The live words each region contained at the end of the previous full GC's
+  // summary phase; used to recognize regions whose liveness has not changed
+  // between collections.
+  size_t prev_live_words(size_t region_idx) const {
+    return _region_prev_live[region_idx];
+  }
+
+  // Record the current per-region live counts for [beg, end) so they can be
+  // compared against during the next full GC.
+  void record_prev_live(HeapWord* beg, HeapWord* end);
+
   HeapWord* summarize_split_space(size_t src_region, SplitInfo& split_info,
                                   HeapWord* destination, HeapWord* target_end,
                                   HeapWord** target_next);
@@ -478,6 +489,7 @@ private:
   size_t          _reserved_byte_size;
   RegionData*     _region_data;
   size_t          _region_count;
+  size_t*         _region_prev_live; // live words per region, last full GC
 
   PSVirtualSpace* _block_vspace;
   BlockData*      _block_data;
@@ -1055,6 +1067,13 @@ class PSParallelCompact : AllStatic {
   static RegionData* first_dead_space_region(const RegionData* beg,
                                              const RegionData* end);
 
+  // Grow the dense prefix over any run of regions starting at dense_prefix
+  // whose occupancy is at least ParallelOldDenseRegionThreshold percent and
+  // whose liveness has not changed since the previous full GC.  Such regions
+  // would be copied almost in their entirety for very little reclaimed space.
+  static HeapWord* extend_dense_prefix_over_stable_regions(const SpaceId id,
+                                                           HeapWord* dense_prefix);
+
   // Return a value indicating the benefit or 'yield' if the compacted region
   // were to start (or equivalently if the dense prefix were to end) at the
   // candidate region.  Higher values are better.
@@ -87,6 +87,11 @@ class PSPromotionLAB : public CHeapObj<mtGC> {
   size_t capacity() const            { return byte_size(bottom(), end()); }
   size_t used() const                { return byte_size(bottom(), top()); }
   size_t free() const                { return byte_size(top(),    end()); }
+
+  // The space, in HeapWords, that would be wasted if the lab were
+  // abandoned now. Sampled by the owning promotion manager before a
+  // flush or refill when ResizePLAB is in effect.
+  size_t unused_words() const        { return pointer_delta(end(), top()); }
 };
 
 class PSYoungPromotionLAB : public PSPromotionLAB {
@@ -29,6 +29,7 @@
 #include "gc_implementation/parallelScavenge/psScavenge.inline.hpp"
 #include "gc_implementation/shared/gcTrace.hpp"
 #include "gc_implementation/shared/mutableSpace.hpp"
+#include "gc_interface/collectedHeap.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/padded.inline.hpp"
@@ -150,7 +151,10 @@ PSPromotionManager::reset_stats() {
 }
 #endif // TASKQUEUE_STATS
 
-PSPromotionManager::PSPromotionManager() {
+PSPromotionManager::PSPromotionManager() :
+  _young_plab_filter(PLABWeight, (float) YoungPLABSize),
+  _old_plab_filter(PLABWeight, (float) OldPLABSize)
+{
   ParallelScavengeHeap* heap = (ParallelScavengeHeap*)Universe::heap();
   assert(heap->kind() == CollectedHeap::ParallelScavengeHeap, "Sanity");
 
@@ -174,6 +178,9 @@ PSPromotionManager::PSPromotionManager() {
   // let's choose 1.5x the chunk size
   _min_array_size_for_chunking = 3 * _array_chunk_size / 2;
 
+  _young_plab_sz = YoungPLABSize;
+  _old_plab_sz = OldPLABSize;
+
   reset();
 }
 
@@ -196,6 +203,11 @@ void PSPromotionManager::reset() {
 
   _promotion_failed_info.reset();
 
+  _young_lab_allocated = 0;
+  _young_lab_unused = 0;
+  _old_lab_allocated = 0;
+  _old_lab_unused = 0;
+
   TASKQUEUE_STATS_ONLY(reset_stats());
 }
 
@@ -242,12 +254,20 @@ void PSPromotionManager::flush_labs() {
   // If either promotion lab fills up, we can flush the
   // lab but not refill it, so check first.
   assert(!_young_lab.is_flushed() || _young_gen_is_full, "Sanity");
-  if (!_young_lab.is_flushed())
+  if (!_young_lab.is_flushed()) {
+    _young_lab_unused += _young_lab.unused_words();
     _young_lab.flush();
+  }
 
   assert(!_old_lab.is_flushed() || _old_gen_is_full, "Sanity");
-  if (!_old_lab.is_flushed())
+  if (!_old_lab.is_flushed()) {
+    _old_lab_unused += _old_lab.unused_words();
     _old_lab.flush();
+  }
+
+  if (ResizePLAB) {
+    adjust_plab_sizes();
+  }
 
   // Let PSScavenge know if we overflowed
   if (_young_gen_is_full) {
@@ -255,6 +275,43 @@ void PSPromotionManager::flush_labs() {
   }
 }
 
+// The same heuristic as PLABStats::adjust_desired_plab_sz(), except that the
+// statistics cover a single worker and a single destination, so the result is
+// not divided among the workers and no atomics are involved in gathering it.
+void PSPromotionManager::adjust_plab_size(size_t* desired_sz,
+                                          AdaptiveWeightedAverage* filter,
+                                          size_t allocated, size_t unused,
+                                          size_t default_sz) {
+  assert(ResizePLAB, "Not set");
+  if (allocated == 0) {
+    assert(unused == 0, "Inconsistency in PLAB stats");
+    allocated = 1;
+  }
+  double wasted_frac    = (double) unused / (double) allocated;
+  size_t target_refills = (size_t) ((wasted_frac * TargetSurvivorRatio) /
+                                    TargetPLABWastePct);
+  if (target_refills == 0) {
+    target_refills = 1;
+  }
+  size_t used = allocated - unused;
+  size_t plab_sz = used / target_refills;
+  // Take historical weighted average
+  filter->sample((float) plab_sz);
+  // Clip from above and below, and align to object boundary
+  plab_sz = MAX2(default_sz / 8, (size_t) filter->average());
+  plab_sz = MIN2(default_sz * 8, plab_sz);
+  plab_sz = MAX2(align_object_size(CollectedHeap::min_fill_size()),
+                 align_object_size(plab_sz));
+  *desired_sz = plab_sz;
+}
+
+void PSPromotionManager::adjust_plab_sizes() {
+  adjust_plab_size(&_young_plab_sz, &_young_plab_filter,
+                   _young_lab_allocated, _young_lab_unused, YoungPLABSize);
+  adjust_plab_size(&_old_plab_sz, &_old_plab_filter,
+                   _old_lab_allocated, _old_lab_unused, OldPLABSize);
+}
+
 template <class T> void PSPromotionManager::process_array_chunk_work(
                                                  oop obj,
                                                  int start, int end) {
@@ -27,6 +27,7 @@
 
 #include "gc_implementation/parallelScavenge/psPromotionLAB.hpp"
 #include "gc_implementation/shared/gcTrace.hpp"
+#include "gc_implementation/shared/gcUtil.hpp"
 #include "gc_implementation/shared/copyFailedInfo.hpp"
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
@@ -91,6 +92,24 @@ class PSPromotionManager VALUE_OBJ_CLASS_SPEC {
 
   PromotionFailedInfo                 _promotion_failed_info;
 
+  // Per-destination adaptive lab sizing, gated by ResizePLAB. All of
+  // this state belongs to the owning worker, so accumulating the
+  // allocation and waste needs no synchronization at all, and each
+  // worker converges on lab sizes that match its own promotion
+  // behavior rather than sharing one global desired size.
+  size_t                              _young_plab_sz;
+  size_t                              _old_plab_sz;
+  size_t                              _young_lab_allocated;
+  size_t                              _young_lab_unused;
+  size_t                              _old_lab_allocated;
+  size_t                              _old_lab_unused;
+  AdaptiveWeightedAverage             _young_plab_filter;
+  AdaptiveWeightedAverage             _old_plab_filter;
+
+  void adjust_plab_size(size_t* desired_sz, AdaptiveWeightedAverage* filter,
+                        size_t allocated, size_t unused, size_t default_sz);
+  void adjust_plab_sizes();
+
   // Accessors
   static PSOldGen* old_gen()         { return _old_gen; }
   static MutableSpace* young_space() { return _young_space; }
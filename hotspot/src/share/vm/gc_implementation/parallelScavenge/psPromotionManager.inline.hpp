@@ -93,16 +93,18 @@ oop PSPromotionManager::copy_to_survivor_space(oop o) {
         new_obj = (oop) _young_lab.allocate(new_obj_size);
         if (new_obj == NULL && !_young_gen_is_full) {
           // Do we allocate directly, or flush and refill?
-          if (new_obj_size > (YoungPLABSize / 2)) {
+          if (new_obj_size > (_young_plab_sz / 2)) {
             // Allocate this object directly
             new_obj = (oop)young_space()->cas_allocate(new_obj_size);
           } else {
             // Flush and fill
+            _young_lab_unused += _young_lab.unused_words();
             _young_lab.flush();
 
-            HeapWord* lab_base = young_space()->cas_allocate(YoungPLABSize);
+            HeapWord* lab_base = young_space()->cas_allocate(_young_plab_sz);
             if (lab_base != NULL) {
-              _young_lab.initialize(MemRegion(lab_base, YoungPLABSize));
+              _young_lab.initialize(MemRegion(lab_base, _young_plab_sz));
+              _young_lab_allocated += _young_plab_sz;
               // Try the young lab allocation again.
               new_obj = (oop) _young_lab.allocate(new_obj_size);
             } else {
@@ -127,14 +129,15 @@ oop PSPromotionManager::copy_to_survivor_space(oop o) {
       if (new_obj == NULL) {
         if (!_old_gen_is_full) {
           // Do we allocate directly, or flush and refill?
-          if (new_obj_size > (OldPLABSize / 2)) {
+          if (new_obj_size > (_old_plab_sz / 2)) {
             // Allocate this object directly
             new_obj = (oop)old_gen()->cas_allocate(new_obj_size);
           } else {
             // Flush and fill
+            _old_lab_unused += _old_lab.unused_words();
             _old_lab.flush();
 
-            HeapWord* lab_base = old_gen()->cas_allocate(OldPLABSize);
+            HeapWord* lab_base = old_gen()->cas_allocate(_old_plab_sz);
             if(lab_base != NULL) {
 #ifdef ASSERT
               // Delay the initialization of the promotion lab (plab).
@@ -143,7 +146,8 @@ oop PSPromotionManager::copy_to_survivor_space(oop o) {
                 os::sleep(Thread::current(), GCWorkerDelayMillis, false);
               }
 #endif
-              _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+              _old_lab.initialize(MemRegion(lab_base, _old_plab_sz));
+              _old_lab_allocated += _old_plab_sz;
               // Try the old lab allocation again.
               new_obj = (oop) _old_lab.allocate(new_obj_size);
             }
@@ -30,6 +30,7 @@
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/timer.hpp"
+#include "utilities/events.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/ticks.inline.hpp"
 
@@ -38,6 +39,7 @@ GCTraceTime::GCTraceTime(const char* title, bool doit, bool print_cr, GCTimer* t
     _title(title), _doit(doit), _print_cr(print_cr), _timer(timer), _start_counter() {
   if (_doit || _timer != NULL) {
     _start_counter.stamp();
+    Events::log_vm_event(NULL, VMTraceEvent::GC_PHASE_BEGIN, (intptr_t) title);
   }
 
   if (_timer != NULL) {
@@ -62,6 +64,7 @@ GCTraceTime::~GCTraceTime() {
 
   if (_doit || _timer != NULL) {
     stop_counter.stamp();
+    Events::log_vm_event(NULL, VMTraceEvent::GC_PHASE_END, (intptr_t) _title);
   }
 
   if (_timer != NULL) {
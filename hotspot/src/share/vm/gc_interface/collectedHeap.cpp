@@ -35,6 +35,9 @@
 #include "memory/metaspace.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/instanceMirrorKlass.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/allocationSampler.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/thread.inline.hpp"
 #include "services/heapDumper.hpp"
@@ -46,6 +49,25 @@ int CollectedHeap::_fire_out_of_memory_count = 0;
 
 size_t CollectedHeap::_filler_array_max_size = 0;
 
+void ClaimedRegionCursor::reset(uint limit, uint n_workers) {
+  assert(n_workers > 0, "need at least one worker");
+  _cursor = 0;
+  _limit  = limit;
+  // Aim for roughly eight batches per worker: large enough to amortize the
+  // claim, small enough that a slow worker cannot strand much of the tail.
+  _batch = MAX2(limit / (n_workers * 8), (uint)1);
+}
+
+bool ClaimedRegionCursor::claim_batch(uint* start, uint* end) {
+  uint claimed = (uint)Atomic::add((jint)_batch, &_cursor) - _batch;
+  if (claimed >= _limit) {
+    return false;
+  }
+  *start = claimed;
+  *end   = MIN2(claimed + _batch, _limit);
+  return true;
+}
+
 template <>
 void EventLogBase<GCMessage>::print(outputStream* st, GCMessage& m) {
   st->print_cr("GC heap %s", m.is_before ? "before" : "after");
@@ -255,6 +277,15 @@ void CollectedHeap::check_for_valid_allocation_state() {
 
 HeapWord* CollectedHeap::allocate_from_tlab_slow(KlassHandle klass, Thread* thread, size_t size) {
 
+  if (JvmtiExport::should_post_sampled_allocation() && thread->is_Java_thread()) {
+    // Allocation sampling is hooked into the refill slow path so that
+    // its cost is bounded by the sample interval. The event is posted
+    // before the current tlab is discarded and before the new object's
+    // space is carved out, so the heap stays parsable if the agent
+    // callback allocates or triggers a GC.
+    JvmtiExport::post_sampled_allocation((JavaThread*)thread);
+  }
+
   // Retain tlab and allocate object in shared space if
   // the amount free in the tlab is too large to discard.
   if (thread->tlab().free() > thread->tlab().refill_waste_limit()) {
@@ -262,6 +293,14 @@ HeapWord* CollectedHeap::allocate_from_tlab_slow(KlassHandle klass, Thread* thre
     return NULL;
   }
 
+  if (AllocationSampleInterval > 0 && thread->is_Java_thread()) {
+    // Sample before the current tlab is discarded, while its fill level
+    // still tells us how much the thread has allocated since the last
+    // refill.
+    AllocationSampler::sample_if_due((JavaThread*)thread, klass(),
+                                     size * HeapWordSize);
+  }
+
   // Discard tlab and allocate a new one.
   // To minimize fragmentation, the last TLAB may be smaller than the rest.
   size_t new_tlab_size = thread->tlab().compute_size(size);
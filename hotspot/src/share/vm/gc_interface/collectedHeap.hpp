@@ -74,6 +74,31 @@ class GCHeapLog : public EventLogBase<GCMessage> {
   }
 };
 
+// Hands out disjoint index ranges to parallel GC workers iterating over a
+// region-structured space.  Workers repeatedly call claim_batch() until it
+// returns false; each batch is claimed with a single atomic add, so the
+// CAS-per-region cost of per-region claiming is paid once per batch instead.
+// Batches are contiguous, which also keeps each worker's regions local.
+// The cursor must be reset() before every parallel iteration that uses it.
+class ClaimedRegionCursor VALUE_OBJ_CLASS_SPEC {
+ private:
+  volatile jint _cursor;   // next unclaimed index
+  uint          _limit;    // one past the last valid index
+  uint          _batch;    // indices handed out per claim
+
+ public:
+  ClaimedRegionCursor() : _cursor(0), _limit(0), _batch(1) {}
+
+  // Prepare for an iteration over indices [0, limit) shared by n_workers.
+  // The batch size balances claim overhead against load imbalance at the
+  // tail of the iteration.
+  void reset(uint limit, uint n_workers);
+
+  // Claim the next batch; on success sets [*start, *end) and returns true.
+  // Returns false when all indices have been handed out.
+  bool claim_batch(uint* start, uint* end);
+};
+
 //
 // CollectedHeap
 //   SharedHeap
@@ -461,6 +486,18 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Does this heap support heap inspection (+PrintClassHistogram?)
   virtual bool supports_heap_inspection() const = 0;
 
+  // Object pinning support. A collector that can guarantee that an
+  // object will not move while it is pinned, without having to rely on
+  // the GC_locker to defer collections, should override these.
+  virtual bool supports_object_pinning() const { return false; }
+  virtual oop pin_object(JavaThread* thread, oop obj) {
+    ShouldNotReachHere();
+    return NULL;
+  }
+  virtual void unpin_object(JavaThread* thread, oop obj) {
+    ShouldNotReachHere();
+  }
+
   // Perform a collection of the heap; intended for use in implementing
   // "System.gc".  This probably implies as full a collection as the
   // "CollectedHeap" supports.
@@ -51,6 +51,9 @@ const char* GCCause::to_string(GCCause::Cause cause) {
     case _heap_dump:
       return "Heap Dump Initiated GC";
 
+    case _wb_conc_mark:
+      return "WhiteBox Initiated Concurrent Mark";
+
     case _no_gc:
       return "No GC";
 
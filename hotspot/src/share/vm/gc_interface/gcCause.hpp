@@ -46,6 +46,7 @@ class GCCause : public AllStatic {
     _gc_locker,
     _heap_inspection,
     _heap_dump,
+    _wb_conc_mark,
 
     /* implementation independent, but reserved for GC use */
     _no_gc,
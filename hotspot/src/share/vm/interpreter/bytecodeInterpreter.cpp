@@ -83,9 +83,24 @@
  * gives us the oportunity to have the instructions that calculate the
  * next opcode to jump to be intermixed with the rest of the instructions
  * that implement the opcode (see UPDATE_PC_AND_TOS_AND_CONTINUE macro).
+ * It also gives every bytecode handler its own dispatch branch, which
+ * predicts far better than a single shared switch branch.
+ *
+ * The build can force the decision: define CC_INTERP_USE_LABELS to get
+ * the threaded dispatch even in debug builds (platforms that ship the
+ * C++ interpreter as their only interpreter want the faster dispatch
+ * everywhere), or CC_INTERP_NO_LABELS to force the switch dispatch,
+ * e.g. for a GCC-compatible compiler that mishandles computed gotos.
  */
 #undef USELABELS
-#ifdef __GNUC__
+#if defined(CC_INTERP_USE_LABELS)
+#ifndef __GNUC__
+#error "CC_INTERP_USE_LABELS requires a compiler with computed gotos"
+#endif
+#define USELABELS
+#elif defined(CC_INTERP_NO_LABELS)
+// switch dispatch requested by the build
+#elif defined(__GNUC__)
 /*
    ASSERT signifies debugging. It is much easier to step thru bytecodes if we
    don't use the computed goto approach.
@@ -115,6 +130,20 @@
 #undef PREFETCH_OPCCODE
 #define PREFETCH_OPCCODE
 
+/*
+ * SUPERINSTRUCTION_OK - Peephole pairing of adjacent simple bytecodes.
+ *
+ * The dominant cost of both the switch and the threaded dispatch loop is
+ * the dispatch itself, so a few very common bytecode pairs are executed
+ * as one superinstruction, paying for a single dispatch.  Pairing is
+ * only legal when no per-bytecode JVMTI events have to be posted.
+ */
+#ifdef VM_JVMTI
+#define SUPERINSTRUCTION_OK() (!_jvmti_interp_events)
+#else
+#define SUPERINSTRUCTION_OK() true
+#endif
+
 /*
   Interpreter safepoint: it is expected that the interpreter will have no live
   handles of its own creation live at an interpreter safepoint. Therefore we
@@ -329,23 +358,26 @@
     if ((skip) <= 0) {                                                                              \
       MethodCounters* mcs;                                                                          \
       GET_METHOD_COUNTERS(mcs);                                                                     \
-      if (UseLoopCounter) {                                                                         \
-        bool do_OSR = UseOnStackReplacement;                                                        \
-        mcs->backedge_counter()->increment();                                                       \
-        if (do_OSR) do_OSR = mcs->backedge_counter()->reached_InvocationLimit();                    \
-        if (do_OSR) {                                                                               \
-          nmethod*  osr_nmethod;                                                                    \
-          OSR_REQUEST(osr_nmethod, branch_pc);                                                      \
-          if (osr_nmethod != NULL && osr_nmethod->osr_entry_bci() != InvalidOSREntryBci) {          \
-            intptr_t* buf = SharedRuntime::OSR_migration_begin(THREAD);                             \
-            istate->set_msg(do_osr);                                                                \
-            istate->set_osr_buf((address)buf);                                                      \
-            istate->set_osr_entry(osr_nmethod->osr_entry());                                        \
-            return;                                                                                 \
+      /* mcs is NULL while allocation is deferred or after an OOM - skip counting */                \
+      if (mcs != NULL) {                                                                            \
+        if (UseLoopCounter) {                                                                       \
+          bool do_OSR = UseOnStackReplacement;                                                      \
+          mcs->backedge_counter()->increment();                                                     \
+          if (do_OSR) do_OSR = mcs->backedge_counter()->reached_InvocationLimit();                  \
+          if (do_OSR) {                                                                             \
+            nmethod*  osr_nmethod;                                                                  \
+            OSR_REQUEST(osr_nmethod, branch_pc);                                                    \
+            if (osr_nmethod != NULL && osr_nmethod->osr_entry_bci() != InvalidOSREntryBci) {        \
+              intptr_t* buf = SharedRuntime::OSR_migration_begin(THREAD);                           \
+              istate->set_msg(do_osr);                                                              \
+              istate->set_osr_buf((address)buf);                                                    \
+              istate->set_osr_entry(osr_nmethod->osr_entry());                                      \
+              return;                                                                               \
+            }                                                                                       \
           }                                                                                         \
-        }                                                                                           \
-      }  /* UseCompiler ... */                                                                      \
-      mcs->invocation_counter()->increment();                                                       \
+        }  /* UseCompiler ... */                                                                    \
+        mcs->invocation_counter()->increment();                                                     \
+      }                                                                                             \
       SAFEPOINT;                                                                                    \
     }
 
@@ -642,18 +674,22 @@ BytecodeInterpreter::run(interpreterState istate) {
       if (_compiling) {
         MethodCounters* mcs;
         GET_METHOD_COUNTERS(mcs);
-        if (ProfileInterpreter) {
-          METHOD->increment_interpreter_invocation_count(THREAD);
-        }
-        mcs->invocation_counter()->increment();
-        if (mcs->invocation_counter()->reached_InvocationLimit()) {
-            CALL_VM((void)InterpreterRuntime::frequency_counter_overflow(THREAD, NULL), handle_exception);
+        // mcs is NULL while allocation is deferred or after an OOM -
+        // skip counting this invocation
+        if (mcs != NULL) {
+          if (ProfileInterpreter) {
+            METHOD->increment_interpreter_invocation_count(THREAD);
+          }
+          mcs->invocation_counter()->increment();
+          if (mcs->invocation_counter()->reached_InvocationLimit()) {
+              CALL_VM((void)InterpreterRuntime::frequency_counter_overflow(THREAD, NULL), handle_exception);
 
-            // We no longer retry on a counter overflow
+              // We no longer retry on a counter overflow
 
-            // istate->set_msg(retry_method);
-            // THREAD->clr_do_not_unlock();
-            // return;
+              // istate->set_msg(retry_method);
+              // THREAD->clr_do_not_unlock();
+              // return;
+          }
         }
         SAFEPOINT;
       }
@@ -1012,6 +1048,21 @@ run:
                                                                         \
       CASE(_iload_##num):                                               \
       CASE(_fload_##num):                                               \
+          if (SUPERINSTRUCTION_OK()) {                                  \
+            if (pc[1] >= Bytecodes::_iload_0 &&                         \
+                pc[1] <= Bytecodes::_iload_3) {                         \
+              /* iload_N iload_M pair: one dispatch for both loads */   \
+              SET_STACK_SLOT(LOCALS_SLOT(num), 0);                      \
+              SET_STACK_SLOT(LOCALS_SLOT(pc[1] - Bytecodes::_iload_0), 1); \
+              UPDATE_PC_AND_TOS_AND_CONTINUE(2, 2);                     \
+            }                                                           \
+            if (pc[1] == Bytecodes::_iadd) {                            \
+              /* iload_N iadd pair: accumulate into the current top.    \
+                 Verified bytecode guarantees int semantics here. */    \
+              SET_STACK_INT(STACK_INT(-1) + LOCALS_INT(num), -1);       \
+              UPDATE_PC_AND_CONTINUE(2);                                \
+            }                                                           \
+          }                                                             \
           SET_STACK_SLOT(LOCALS_SLOT(num), 0);                          \
           UPDATE_PC_AND_TOS_AND_CONTINUE(1, 1);                         \
                                                                         \
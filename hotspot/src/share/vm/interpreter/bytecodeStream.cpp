@@ -53,6 +53,46 @@ Bytecodes::Code RawBytecodeStream::raw_next_special(Bytecodes::Code code) {
   return code;
 }
 
+BytecodeTable::BytecodeTable(methodHandle method) : _method(method) {
+  // Each instruction is at least one byte long, so code_size() bounds the
+  // number of entries.  The table is resource allocated like the rest of
+  // the analysis passes' data structures; a slightly generous allocation
+  // is cheaper than decoding the method twice to count instructions.
+  int code_size = method->code_size();
+  _entries = NEW_RESOURCE_ARRAY(Entry, code_size == 0 ? 1 : code_size);
+  _length  = 0;
+
+  BytecodeStream s(method);
+  Bytecodes::Code code;
+  while ((code = s.next()) >= 0) {
+    Entry* e     = &_entries[_length++];
+    e->_bci      = (u2) s.bci();
+    e->_next_bci = (u2) s.next_bci();
+    e->_code     = (u1) code;
+    e->_raw_code = (u1) s.raw_code();
+    e->_is_wide  = s.is_wide() ? 1 : 0;
+  }
+  assert(_length <= code_size, "more instructions than code bytes");
+}
+
+int BytecodeTable::index_of(int bci) const {
+  // Entries are sorted by bci by construction
+  int lo = 0;
+  int hi = _length - 1;
+  while (lo <= hi) {
+    int mid     = (lo + hi) >> 1;
+    int mid_bci = _entries[mid]._bci;
+    if (mid_bci == bci) {
+      return mid;
+    } else if (mid_bci < bci) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return -1;
+}
+
 #ifdef ASSERT
 void BaseBytecodeStream::assert_raw_index_size(int size) const {
   if (raw_code() == Bytecodes::_invokedynamic && is_raw()) {
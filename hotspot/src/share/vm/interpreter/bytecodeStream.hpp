@@ -238,4 +238,64 @@ class BytecodeStream: public BaseBytecodeStream {
   bool            has_index_u4() const           { return bytecode().has_index_u4(raw_code()); }
 };
 
+// A BytecodeTable is a decode-once representation of a method's bytecodes.
+// It is built with a single BytecodeStream pass and lets analysis passes
+// that walk the same method several times (oop map generation, liveness,
+// abstract interpretation) iterate a compact resource-allocated array
+// instead of re-decoding the instruction stream on every pass.  Entries
+// record the translated (java) bytecode, so iterating the table matches
+// iteration with BytecodeStream, not RawBytecodeStream.
+//
+// Usage:
+//
+// BytecodeTable table(method);
+// for (int i = 0; i < table.length(); i++) {
+//   Bytecodes::Code c = table.code_at(i);
+//   ...
+// }
+
+class BytecodeTable: public ResourceObj {
+ private:
+  // One entry per instruction: the bcis delimiting the instruction, the
+  // translated code, the raw code (needed for operand access through
+  // Bytecode) and the wide prefix flag.
+  struct Entry {
+    u2 _bci;                                     // bci of this instruction
+    u2 _next_bci;                                // bci of the next instruction
+    u1 _code;                                    // translated (java) bytecode
+    u1 _raw_code;                                // bytecode as present in the method
+    u1 _is_wide;                                 // instruction has a wide prefix
+    u1 _pad;
+  };
+
+  methodHandle _method;                          // the decoded method
+  Entry*       _entries;
+  int          _length;                          // number of instructions
+
+ public:
+  BytecodeTable(methodHandle method);
+
+  methodHandle    method() const                 { return _method; }
+  int             length() const                 { return _length; }
+
+  // Per-instruction attributes, indexed by table position
+  int             bci_at(int i) const            { assert(0 <= i && i < _length, "index out of bounds"); return _entries[i]._bci; }
+  int             next_bci_at(int i) const       { assert(0 <= i && i < _length, "index out of bounds"); return _entries[i]._next_bci; }
+  Bytecodes::Code code_at(int i) const           { assert(0 <= i && i < _length, "index out of bounds"); return (Bytecodes::Code)_entries[i]._code; }
+  Bytecodes::Code raw_code_at(int i) const       { assert(0 <= i && i < _length, "index out of bounds"); return (Bytecodes::Code)_entries[i]._raw_code; }
+  bool            is_wide_at(int i) const        { assert(0 <= i && i < _length, "index out of bounds"); return _entries[i]._is_wide != 0; }
+  int             instruction_size_at(int i) const { return next_bci_at(i) - bci_at(i); }
+
+  // Operand access goes through the method's code, as for the streams
+  Bytecode        bytecode_at(int i) const       { return Bytecode(_method(), _method->code_base() + bci_at(i)); }
+
+  // Branch destinations
+  int             dest_at(int i) const           { return bci_at(i) + bytecode_at(i).get_offset_s2(raw_code_at(i)); }
+  int             dest_w_at(int i) const         { return bci_at(i) + bytecode_at(i).get_offset_s4(raw_code_at(i)); }
+
+  // Maps a bci to its table position by binary search; returns -1 if the
+  // bci does not start an instruction.
+  int             index_of(int bci) const;
+};
+
 #endif // SHARE_VM_INTERPRETER_BYTECODESTREAM_HPP
@@ -267,6 +267,7 @@ class Bytecodes: AllStatic {
     _fast_iaccess_0       ,
     _fast_aaccess_0       ,
     _fast_faccess_0       ,
+    _fast_laccess_0       ,
 
     _fast_iload           ,
     _fast_iload2          ,
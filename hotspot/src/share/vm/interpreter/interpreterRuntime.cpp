@@ -930,6 +930,15 @@ IRT_ENTRY(void, InterpreterRuntime::update_mdp_for_ret(JavaThread* thread, int r
 IRT_END
 
 IRT_ENTRY(MethodCounters*, InterpreterRuntime::build_method_counters(JavaThread* thread, Method* m))
+  // Most methods only run a handful of times; defer the metaspace
+  // allocation until this method has come through here often enough to
+  // look like it will keep executing.  Returning NULL makes the caller
+  // skip counting for this visit, exactly like the out-of-memory case.
+  // Callers outside the interpreter (breakpoints, JVMTI) go through
+  // Method::build_method_counters directly and are not deferred.
+  if (MethodCounters::defer_allocation(m)) {
+    return NULL;
+  }
   MethodCounters* mcs = Method::build_method_counters(m, thread);
   if (HAS_PENDING_EXCEPTION) {
     assert((PENDING_EXCEPTION->is_a(SystemDictionary::OutOfMemoryError_klass())), "we expect only an OOM error here");
@@ -28,8 +28,38 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiRedefineClassesTrace.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/signature.hpp"
+#ifdef TARGET_OS_ARCH_linux_x86
+# include "orderAccess_linux_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_sparc
+# include "orderAccess_linux_sparc.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_zero
+# include "orderAccess_linux_zero.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_solaris_x86
+# include "orderAccess_solaris_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_solaris_sparc
+# include "orderAccess_solaris_sparc.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_windows_x86
+# include "orderAccess_windows_x86.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_arm
+# include "orderAccess_linux_arm.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_linux_ppc
+# include "orderAccess_linux_ppc.inline.hpp"
+#endif
+#ifdef TARGET_OS_ARCH_bsd_x86
+# include "orderAccess_bsd_x86.inline.hpp"
+#endif
 
 class OopMapCacheEntry: private InterpreterOopMap {
   friend class InterpreterOopMap;
@@ -37,6 +67,9 @@ class OopMapCacheEntry: private InterpreterOopMap {
   friend class OopMapCache;
   friend class VerifyClosure;
 
+ private:
+  OopMapCacheEntry* _next;    // link in OopMapCache's deferred-free list
+
  protected:
   // Initialization
   void fill(methodHandle method, int bci);
@@ -47,6 +80,9 @@ class OopMapCacheEntry: private InterpreterOopMap {
   // Deallocate bit masks and initialize fields
   void flush();
 
+  static OopMapCacheEntry* allocate();
+  static void deallocate(OopMapCacheEntry* entry);
+
  private:
   void allocate_bit_mask();   // allocates the bit mask on C heap f necessary
   void deallocate_bit_mask(); // allocates the bit mask on C heap f necessary
@@ -54,6 +90,7 @@ class OopMapCacheEntry: private InterpreterOopMap {
 
  public:
   OopMapCacheEntry() : InterpreterOopMap() {
+    _next = NULL;
 #ifdef ASSERT
      _resource_allocate_bit_mask = false;
 #endif
@@ -436,6 +473,24 @@ long OopMapCache::memory_usage() {
 
 #endif
 
+OopMapCacheEntry* OopMapCacheEntry::allocate() {
+  OopMapCacheEntry* entry = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
+  // NEW_C_HEAP_OBJ does not run the constructor
+  entry->initialize();
+  entry->_next = NULL;
+#ifdef ASSERT
+  entry->_resource_allocate_bit_mask = false;
+#endif
+  NOT_PRODUCT(_total_memory_usage += sizeof(OopMapCacheEntry);)
+  return entry;
+}
+
+void OopMapCacheEntry::deallocate(OopMapCacheEntry* entry) {
+  entry->flush();
+  NOT_PRODUCT(_total_memory_usage -= sizeof(OopMapCacheEntry);)
+  FREE_C_HEAP_OBJ(entry, mtClass);
+}
+
 void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
   assert(_resource_allocate_bit_mask,
     "Should not resource allocate the _bit_mask");
@@ -477,14 +532,12 @@ inline unsigned int OopMapCache::hash_value_for(methodHandle method, int bci) {
 }
 
 
-OopMapCache::OopMapCache() :
-  _mut(Mutex::leaf, "An OopMapCache lock", true)
-{
-  _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry, _size, mtClass);
-  // Cannot call flush for initialization, since flush
-  // will check if memory should be deallocated
-  for(int i = 0; i < _size; i++) _array[i].initialize();
-  NOT_PRODUCT(_total_memory_usage += sizeof(OopMapCache) + (sizeof(OopMapCacheEntry) * _size);)
+OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
+
+OopMapCache::OopMapCache() {
+  _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
+  for(int i = 0; i < _size; i++) _array[i] = NULL;  // no barrier needed, cache not published yet
+  NOT_PRODUCT(_total_memory_usage += sizeof(OopMapCache) + (sizeof(OopMapCacheEntry*) * _size);)
 }
 
 
@@ -493,44 +546,60 @@ OopMapCache::~OopMapCache() {
   // Deallocate oop maps that are allocated out-of-line
   flush();
   // Deallocate array
-  NOT_PRODUCT(_total_memory_usage -= sizeof(OopMapCache) + (sizeof(OopMapCacheEntry) * _size);)
-  FREE_C_HEAP_ARRAY(OopMapCacheEntry, _array, mtClass);
+  NOT_PRODUCT(_total_memory_usage -= sizeof(OopMapCache) + (sizeof(OopMapCacheEntry*) * _size);)
+  FREE_C_HEAP_ARRAY(OopMapCacheEntry*, _array, mtClass);
 }
 
 OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return &_array[i % _size];
+  return (OopMapCacheEntry*)OrderAccess::load_ptr_acquire(&(_array[i % _size]));
+}
+
+bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
+  return Atomic::cmpxchg_ptr(entry, &_array[i % _size], old) == old;
 }
 
 void OopMapCache::flush() {
-  for (int i = 0; i < _size; i++) _array[i].flush();
+  // The cache is only discarded along with its holder class, so no
+  // thread can still be probing it.
+  for (int i = 0; i < _size; i++) {
+    OopMapCacheEntry* entry = _array[i];
+    if (entry != NULL) {
+      _array[i] = NULL;  // no barrier needed, see above
+      OopMapCacheEntry::deallocate(entry);
+    }
+  }
 }
 
 void OopMapCache::flush_obsolete_entries() {
-  for (int i = 0; i < _size; i++)
-    if (!_array[i].is_empty() && _array[i].method()->is_old()) {
+  assert(SafepointSynchronize::is_at_safepoint(), "called by RedefineClasses in a safepoint");
+  for (int i = 0; i < _size; i++) {
+    OopMapCacheEntry* entry = _array[i];
+    if (entry != NULL && !entry->is_empty() && entry->method()->is_old()) {
       // Cache entry is occupied by an old redefined method and we don't want
       // to pin it down so flush the entry.
       RC_TRACE(0x08000000, ("flush: %s(%s): cached entry @%d",
-        _array[i].method()->name()->as_C_string(),
-        _array[i].method()->signature()->as_C_string(), i));
+        entry->method()->name()->as_C_string(),
+        entry->method()->signature()->as_C_string(), i));
 
-      _array[i].flush();
+      _array[i] = NULL;
+      OopMapCacheEntry::deallocate(entry);
     }
+  }
 }
 
 void OopMapCache::lookup(methodHandle method,
                          int bci,
                          InterpreterOopMap* entry_for) {
-  MutexLocker x(&_mut);
-
   OopMapCacheEntry* entry = NULL;
   int probe = hash_value_for(method, bci);
 
-  // Search hashtable for match
+  // Search hashtable for match.  Entries are immutable once published,
+  // so probing requires no lock; the acquire in entry_at pairs with the
+  // CAS in put_at below.
   int i;
   for(i = 0; i < _probe_depth; i++) {
     entry = entry_at(probe + i);
-    if (entry->match(method, bci)) {
+    if (entry != NULL && entry->match(method, bci)) {
       entry_for->resource_copy(entry);
       assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
       return;
@@ -545,65 +614,83 @@ void OopMapCache::lookup(methodHandle method,
   }
 
   // Entry is not in hashtable.
-  // Compute entry and return it
+  // Compute entry and try to cache it
+
+  OopMapCacheEntry* tmp = OopMapCacheEntry::allocate();
+  tmp->fill(method, bci);
+  entry_for->resource_copy(tmp);
+  assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
 
   if (method->should_not_be_cached()) {
     // It is either not safe or not a good idea to cache this Method*
     // at this time. We give the caller of lookup() a copy of the
     // interesting info via parameter entry_for, but we don't add it to
     // the cache. See the gory details in Method*.cpp.
-    compute_one_oop_map(method, bci, entry_for);
+    OopMapCacheEntry::deallocate(tmp);
     return;
   }
 
   // First search for an empty slot
   for(i = 0; i < _probe_depth; i++) {
-    entry  = entry_at(probe + i);
-    if (entry->is_empty()) {
-      entry->fill(method, bci);
-      entry_for->resource_copy(entry);
-      assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
-      return;
+    entry = entry_at(probe + i);
+    if (entry == NULL) {
+      if (put_at(probe + i, tmp, NULL)) {
+        return;
+      }
+      // A racing thread took the slot; it may even have installed
+      // (method, bci), but re-probing is not worth it - fall through
+      // and try the remaining slots.
     }
   }
 
   if (TraceOopMapGeneration) {
     ResourceMark rm;
-    tty->print_cr("*** collision in oopmap cache - flushing item ***");
+    tty->print_cr("*** collision in oopmap cache - replacing item ***");
   }
 
-  // No empty slot (uncommon case). Use (some approximation of a) LRU algorithm
-  //entry_at(probe + _probe_depth - 1)->flush();
-  //for(i = _probe_depth - 1; i > 0; i--) {
-  //  // Coping entry[i] = entry[i-1];
-  //  OopMapCacheEntry *to   = entry_at(probe + i);
-  //  OopMapCacheEntry *from = entry_at(probe + i - 1);
-  //  to->copy(from);
-  // }
-
-  assert(method->is_method(), "gaga");
-
+  // No empty slot (uncommon case). Use (some approximation of a) LRU algorithm.
+  // The displaced entry cannot be freed here because a concurrent reader
+  // may have fetched the pointer just before the swap; it is freed at the
+  // next safepoint cleanup, by which time any such reader is done with it.
   entry = entry_at(probe + 0);
-  entry->fill(method, bci);
-
-  // Copy the  newly cached entry to input parameter
-  entry_for->resource_copy(entry);
-
-  if (TraceOopMapGeneration) {
-    ResourceMark rm;
-    tty->print("Done with ");
-    method->print_value(); tty->cr();
+  if (put_at(probe + 0, tmp, entry)) {
+    if (entry != NULL) {
+      enqueue_for_cleanup(entry);
+    }
+  } else {
+    OopMapCacheEntry::deallocate(tmp);
   }
-  assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
 
   return;
 }
 
+void OopMapCache::enqueue_for_cleanup(OopMapCacheEntry* entry) {
+  bool success = false;
+  OopMapCacheEntry* head;
+  do {
+    head = _old_entries;
+    entry->_next = head;
+    success = Atomic::cmpxchg_ptr(entry, &_old_entries, head) == head;
+  } while (!success);
+}
+
+void OopMapCache::cleanup_old_entries() {
+  // Called during safepoint cleanup, after the readers that could have
+  // been copying a displaced entry have all reached the safepoint, so
+  // the list can be walked and freed without synchronization.
+  OopMapCacheEntry* entry = _old_entries;
+  _old_entries = NULL;
+  while (entry != NULL) {
+    OopMapCacheEntry* next = entry->_next;
+    OopMapCacheEntry::deallocate(entry);
+    entry = next;
+  }
+}
+
 void OopMapCache::compute_one_oop_map(methodHandle method, int bci, InterpreterOopMap* entry) {
   // Due to the invariants above it's tricky to allocate a temporary OopMapCacheEntry on the stack
-  OopMapCacheEntry* tmp = NEW_C_HEAP_ARRAY(OopMapCacheEntry, 1, mtClass);
-  tmp->initialize();
+  OopMapCacheEntry* tmp = OopMapCacheEntry::allocate();
   tmp->fill(method, bci);
   entry->resource_copy(tmp);
-  FREE_C_HEAP_ARRAY(OopMapCacheEntry, tmp, mtInternal);
+  OopMapCacheEntry::deallocate(tmp);
 }
@@ -26,13 +26,20 @@
 #define SHARE_VM_INTERPRETER_OOPMAPCACHE_HPP
 
 #include "oops/generateOopMap.hpp"
-#include "runtime/mutex.hpp"
 
 // A Cache for storing (method, bci) -> oopMap.
 // The memory management system uses the cache when locating object
 // references in an interpreted frame.
 //
 // OopMapCache's are allocated lazily per InstanceKlass.
+//
+// The cache is lock free: readers probe the table of entry pointers
+// without synchronization, and writers publish fully constructed
+// entries with an atomic exchange, so neither GC threads walking
+// interpreter frames nor mutator threads taking the lookup slow path
+// ever block on each other.  Entries displaced by a collision are put
+// on a deferred-free list that is emptied during safepoint cleanup,
+// when no reader can still hold a pointer into a displaced entry.
 
 // The oopMap (InterpreterOopMap) is stored as a bit mask. If the
 // bit_mask can fit into two words it is stored in
@@ -159,12 +166,18 @@ class OopMapCache : public CHeapObj<mtClass> {
          _probe_depth = 3       // probe depth in case of collisions
   };
 
-  OopMapCacheEntry* _array;
+  // Entries are allocated from the C heap and published by CAS, so
+  // readers can probe the table without taking a lock.
+  OopMapCacheEntry* volatile * _array;
+
+  // Entries displaced by a hash collision; freed at safepoint cleanup.
+  static OopMapCacheEntry* volatile _old_entries;
 
   unsigned int hash_value_for(methodHandle method, int bci);
   OopMapCacheEntry* entry_at(int i) const;
+  bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
 
-  Mutex _mut;
+  static void enqueue_for_cleanup(OopMapCacheEntry* entry);
 
   void flush();
 
@@ -179,6 +192,10 @@ class OopMapCache : public CHeapObj<mtClass> {
   // Returns false if an oop map was not found.
   void lookup(methodHandle method, int bci, InterpreterOopMap* entry);
 
+  // Frees entries displaced from the caches since the last safepoint;
+  // called during safepoint cleanup, when no thread can be reading them.
+  static void cleanup_old_entries();
+
   // Compute an oop map without updating the cache or grabbing any locks (for debugging)
   static void compute_one_oop_map(methodHandle method, int bci, InterpreterOopMap* entry);
 
@@ -39,13 +39,48 @@ void Rewriter::compute_index_maps() {
   const int length  = _pool->length();
   init_maps(length);
   bool saw_mh_symbol = false;
+
+  // Lay out member-reference cache entries in the order the bytecodes first
+  // touch them rather than in constant pool order, so that entries used by
+  // neighbouring bytecodes share cache lines in the interpreter.  Member
+  // references no bytecode mentions get their entries appended by the
+  // constant pool walk below, so every Fieldref/Methodref still has one.
+  for (int m = 0; m < _methods->length(); m++) {
+    methodHandle method(_methods->at(m));
+    RawBytecodeStream bcs(method);
+    while (!bcs.is_last_bytecode()) {
+      switch (bcs.raw_next()) {
+        case Bytecodes::_getstatic      : // fall through
+        case Bytecodes::_putstatic      : // fall through
+        case Bytecodes::_getfield       : // fall through
+        case Bytecodes::_putfield       : // fall through
+        case Bytecodes::_invokevirtual  : // fall through
+        case Bytecodes::_invokespecial  : // fall through
+        case Bytecodes::_invokestatic   : // fall through
+        case Bytecodes::_invokeinterface: {
+          int cp_index = Bytes::get_Java_u2(bcs.bcp() + 1);
+          if ((uint)cp_index < (uint)length &&
+              _pool->tag_at(cp_index).is_field_or_method() &&
+              !has_cp_cache(cp_index)) {
+            add_cp_cache_entry(cp_index);
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+
   for (int i = 0; i < length; i++) {
     int tag = _pool->tag_at(i).value();
     switch (tag) {
       case JVM_CONSTANT_InterfaceMethodref:
       case JVM_CONSTANT_Fieldref          : // fall through
       case JVM_CONSTANT_Methodref         : // fall through
-        add_cp_cache_entry(i);
+        if (!has_cp_cache(i)) {
+          add_cp_cache_entry(i);
+        }
         break;
       case JVM_CONSTANT_String:
       case JVM_CONSTANT_MethodHandle      : // fall through
@@ -242,6 +277,10 @@ void Rewriter::rewrite_invokedynamic(address bcp, int offset, bool reverse) {
     Bytes::put_native_u4(p, ConstantPool::encode_invokedynamic_index(cache_index));
     // add the bcp in case we need to patch this bytecode if we also find a
     // invokespecial/InterfaceMethodref in the bytecode stream
+    if (_patch_invokedynamic_bcps == NULL) {
+      _patch_invokedynamic_bcps = new GrowableArray<address>(8);
+      _patch_invokedynamic_refs = new GrowableArray<int>(8);
+    }
     _patch_invokedynamic_bcps->push(p);
     _patch_invokedynamic_refs->push(resolved_index);
   } else {
@@ -264,7 +303,7 @@ void Rewriter::patch_invokedynamic_bytecodes() {
   // cpool, nothing needs to be done.  Invokedynamic bytecodes are at the
   // correct offsets. ie. no invokespecials added
   int delta = cp_cache_delta();
-  if (delta > 0) {
+  if (delta > 0 && _patch_invokedynamic_bcps != NULL) {
     int length = _patch_invokedynamic_bcps->length();
     assert(length == _patch_invokedynamic_refs->length(),
            "lengths should match");
@@ -434,6 +473,7 @@ void Rewriter::scan_method(Method* method, bool reverse, bool* invokespecial_err
   // have to be rewritten, so we run the oopMapGenerator on the method
   if (nof_jsrs > 0) {
     method->set_has_jsrs();
+    _has_jsr_methods = true;
     // Second pass will revisit this method.
     assert(method->has_jsrs(), "didn't we just set this?");
   }
@@ -463,7 +503,8 @@ void Rewriter::rewrite(instanceKlassHandle klass, TRAPS) {
 Rewriter::Rewriter(instanceKlassHandle klass, constantPoolHandle cpool, Array<Method*>* methods, TRAPS)
   : _klass(klass),
     _pool(cpool),
-    _methods(methods)
+    _methods(methods),
+    _has_jsr_methods(false)
 {
   assert(_pool->cache() == NULL, "constant pool cache must not be set yet");
 
@@ -523,20 +564,22 @@ Rewriter::Rewriter(instanceKlassHandle klass, constantPoolHandle cpool, Array<Me
   // so methods with jsrs in custom class lists in aren't attempted to be
   // rewritten in the RO section of the shared archive.
   // Relocated bytecodes don't have to be restored, only the cp cache entries
-  for (int i = len-1; i >= 0; i--) {
-    methodHandle m(THREAD, _methods->at(i));
-
-    if (m->has_jsrs()) {
-      m = rewrite_jsrs(m, THREAD);
-      // Restore bytecodes to their unrewritten state if there are exceptions
-      // relocating bytecodes.  If some are relocated, that is ok because that
-      // doesn't affect constant pool to cpCache rewriting.
-      if (HAS_PENDING_EXCEPTION) {
-        restore_bytecodes();
-        return;
+  if (_has_jsr_methods) {
+    for (int i = len-1; i >= 0; i--) {
+      methodHandle m(THREAD, _methods->at(i));
+
+      if (m->has_jsrs()) {
+        m = rewrite_jsrs(m, THREAD);
+        // Restore bytecodes to their unrewritten state if there are exceptions
+        // relocating bytecodes.  If some are relocated, that is ok because that
+        // doesn't affect constant pool to cpCache rewriting.
+        if (HAS_PENDING_EXCEPTION) {
+          restore_bytecodes();
+          return;
+        }
+        // Method might have gotten rewritten.
+        methods->at_put(i, m());
       }
-      // Method might have gotten rewritten.
-      methods->at_put(i, m());
     }
   }
 }
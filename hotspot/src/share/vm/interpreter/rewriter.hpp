@@ -57,6 +57,10 @@ class Rewriter: public StackObj {
   GrowableArray<address>* _patch_invokedynamic_bcps;
   GrowableArray<int>*     _patch_invokedynamic_refs;
 
+  // Set during scanning if any method has jsr bytecodes, so classes
+  // without them (everything compiled since 1.5) skip the relocation pass.
+  bool                    _has_jsr_methods;
+
   void init_maps(int length) {
     _cp_map.initialize(length, -1);
     // Choose an initial value large enough that we don't get frequent
@@ -71,8 +75,10 @@ class Rewriter: public StackObj {
 
     // invokedynamic specific fields
     _invokedynamic_cp_cache_map.initialize(length/4);
-    _patch_invokedynamic_bcps = new GrowableArray<address>(length/4);
-    _patch_invokedynamic_refs = new GrowableArray<int>(length/4);
+    // The patch arrays are only needed for classes that actually have
+    // invokedynamic bytecodes, so they are allocated on first use.
+    _patch_invokedynamic_bcps = NULL;
+    _patch_invokedynamic_refs = NULL;
   }
 
   int _first_iteration_cp_cache_limit;
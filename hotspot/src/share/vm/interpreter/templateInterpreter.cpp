@@ -414,8 +414,61 @@ address TemplateInterpreterGenerator::generate_error_exit(const char* msg) {
 
 //------------------------------------------------------------------------------------------------------------------------
 
+// Bytecodes that dominate dynamic execution in interpreted code:
+// local loads and stores, field access, invocation, common constants,
+// comparisons and control flow. Their codelets are generated first so
+// that they end up adjacent in the codelet area and share fewer icache
+// lines with rarely executed codelets. The dispatch tables are indexed
+// by bytecode and do not care about generation order.
+static const Bytecodes::Code hot_codelet_order[] = {
+  Bytecodes::_aload_0,       Bytecodes::_aload_1,       Bytecodes::_aload_2,
+  Bytecodes::_aload_3,       Bytecodes::_aload,         Bytecodes::_iload_0,
+  Bytecodes::_iload_1,       Bytecodes::_iload_2,       Bytecodes::_iload_3,
+  Bytecodes::_iload,         Bytecodes::_getfield,      Bytecodes::_putfield,
+  Bytecodes::_fast_agetfield, Bytecodes::_fast_igetfield, Bytecodes::_fast_aputfield,
+  Bytecodes::_fast_iputfield, Bytecodes::_fast_aload_0, Bytecodes::_fast_iaccess_0,
+  Bytecodes::_fast_aaccess_0,
+  Bytecodes::_invokevirtual, Bytecodes::_invokespecial, Bytecodes::_invokestatic,
+  Bytecodes::_invokeinterface,
+  Bytecodes::_goto,          Bytecodes::_ifeq,          Bytecodes::_ifne,
+  Bytecodes::_iflt,          Bytecodes::_ifge,          Bytecodes::_if_icmpeq,
+  Bytecodes::_if_icmpne,     Bytecodes::_if_icmplt,     Bytecodes::_if_icmpge,
+  Bytecodes::_if_icmpgt,     Bytecodes::_if_icmple,     Bytecodes::_if_acmpeq,
+  Bytecodes::_if_acmpne,     Bytecodes::_ifnull,        Bytecodes::_ifnonnull,
+  Bytecodes::_iconst_0,      Bytecodes::_iconst_1,      Bytecodes::_aconst_null,
+  Bytecodes::_bipush,        Bytecodes::_sipush,        Bytecodes::_ldc,
+  Bytecodes::_istore_0,      Bytecodes::_istore_1,      Bytecodes::_istore_2,
+  Bytecodes::_istore_3,      Bytecodes::_istore,        Bytecodes::_astore_0,
+  Bytecodes::_astore_1,      Bytecodes::_astore_2,      Bytecodes::_astore_3,
+  Bytecodes::_astore,
+  Bytecodes::_iadd,          Bytecodes::_isub,          Bytecodes::_iinc,
+  Bytecodes::_arraylength,   Bytecodes::_iaload,        Bytecodes::_aaload,
+  Bytecodes::_baload,        Bytecodes::_caload,        Bytecodes::_iastore,
+  Bytecodes::_aastore,       Bytecodes::_bastore,       Bytecodes::_castore,
+  Bytecodes::_dup,           Bytecodes::_pop,           Bytecodes::_new,
+  Bytecodes::_checkcast,     Bytecodes::_instanceof,
+  Bytecodes::_return,        Bytecodes::_ireturn,       Bytecodes::_areturn
+};
+
 void TemplateInterpreterGenerator::set_entry_points_for_all_bytes() {
+  bool generated[DispatchTable::length];
+  for (int i = 0; i < DispatchTable::length; i++) {
+    generated[i] = false;
+  }
+  if (InterpreterHotCodeletLayout) {
+    for (uint j = 0; j < ARRAY_SIZE(hot_codelet_order); j++) {
+      Bytecodes::Code code = hot_codelet_order[j];
+      assert((int)code < DispatchTable::length, "hot list holds dispatchable bytecodes only");
+      if (Bytecodes::is_defined(code)) {
+        set_entry_points(code);
+        generated[code] = true;
+      }
+    }
+  }
   for (int i = 0; i < DispatchTable::length; i++) {
+    if (generated[i]) {
+      continue;
+    }
     Bytecodes::Code code = (Bytecodes::Code)i;
     if (Bytecodes::is_defined(code)) {
       set_entry_points(code);
@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.inline.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
@@ -236,7 +237,8 @@ class ChunkPool: public CHeapObj<mtInternal> {
   size_t       _num_used;     // number of chunks currently checked out
   const size_t _size;         // size of each chunk (must be uniform)
 
-  // Our four static pools
+  // Our five static pools
+  static ChunkPool* _giant_pool;
   static ChunkPool* _large_pool;
   static ChunkPool* _medium_pool;
   static ChunkPool* _small_pool;
@@ -317,12 +319,14 @@ class ChunkPool: public CHeapObj<mtInternal> {
       }
 
   // Accessors to preallocated pool's
+  static ChunkPool* giant_pool()  { assert(_giant_pool  != NULL, "must be initialized"); return _giant_pool;  }
   static ChunkPool* large_pool()  { assert(_large_pool  != NULL, "must be initialized"); return _large_pool;  }
   static ChunkPool* medium_pool() { assert(_medium_pool != NULL, "must be initialized"); return _medium_pool; }
   static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
   static void initialize() {
+    _giant_pool  = new ChunkPool(Chunk::giant_size  + Chunk::aligned_overhead_size());
     _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
     _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
     _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
@@ -335,9 +339,11 @@ class ChunkPool: public CHeapObj<mtInternal> {
      _small_pool->free_all_but(BlocksToKeep);
      _medium_pool->free_all_but(BlocksToKeep);
      _large_pool->free_all_but(BlocksToKeep);
+     _giant_pool->free_all_but(BlocksToKeep);
   }
 };
 
+ChunkPool* ChunkPool::_giant_pool  = NULL;
 ChunkPool* ChunkPool::_large_pool  = NULL;
 ChunkPool* ChunkPool::_medium_pool = NULL;
 ChunkPool* ChunkPool::_small_pool  = NULL;
@@ -367,6 +373,87 @@ class ChunkPoolCleaner : public PeriodicTask {
    }
 };
 
+//--------------------------------------------------------------------------------------
+// ChunkCache implementation
+
+ChunkCache::ChunkCache(uint max_per_class) : _max_per_class(max_per_class) {
+  for (int i = 0; i < _num_size_classes; i++) {
+    _first[i] = NULL;
+    _count[i] = 0;
+  }
+}
+
+int ChunkCache::size_class_index(size_t length) {
+  switch (length) {
+   case Chunk::tiny_size:   return 0;
+   case Chunk::init_size:   return 1;
+   case Chunk::medium_size: return 2;
+   case Chunk::size:        return 3;
+   case Chunk::giant_size:  return 4;
+   default:                 return -1;
+  }
+}
+
+void* ChunkCache::allocate(size_t bytes) {
+  int index = size_class_index(bytes - Chunk::aligned_overhead_size());
+  if (index < 0) return NULL;
+  Chunk* c = _first[index];
+  if (c != NULL) {
+    _first[index] = c->next();
+    _count[index]--;
+  }
+  return c;
+}
+
+bool ChunkCache::free(Chunk* chunk) {
+  int index = size_class_index(chunk->length());
+  if (index < 0) {
+    return false;
+  }
+  // Giant chunks are 128K each; keep only a handful per thread even in
+  // the deep compiler-thread caches.
+  uint max_cached = chunk->length() == Chunk::giant_size ?
+      MIN2(_max_per_class, (uint)default_cached_per_class) : _max_per_class;
+  if (_count[index] >= max_cached) {
+    return false;
+  }
+  chunk->set_next(_first[index]);
+  _first[index] = chunk;
+  _count[index]++;
+  return true;
+}
+
+void ChunkCache::clear() {
+  for (int i = 0; i < _num_size_classes; i++) {
+    Chunk* c = _first[i];
+    while (c != NULL) {
+      Chunk* next = c->next();
+      os::free(c, mtChunk);
+      c = next;
+    }
+    _first[i] = NULL;
+    _count[i] = 0;
+  }
+}
+
+// Return the chunk cache of the current thread, if it has one.  Every
+// thread carries a small cache for handle and resource area churn;
+// compiler threads carry a larger one because the node and resource
+// arenas grow and die with every compilation.
+static ChunkCache* current_thread_chunk_cache() {
+  if (!ThreadLocalStorage::is_initialized()) {
+    return NULL;
+  }
+  Thread* thread = ThreadLocalStorage::thread();
+  if (thread == NULL) {
+    return NULL;
+  }
+  if (thread->is_Compiler_thread()) {
+    return UseCompilerThreadChunkCache ? thread->chunk_cache() : NULL;
+  }
+  return UseThreadChunkCache ? thread->chunk_cache() : NULL;
+}
+
 //--------------------------------------------------------------------------------------
 // Chunk implementation
 
@@ -377,8 +464,16 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   // expect requested_size but if sizeof(Chunk) doesn't match isn't proper size we must align it.
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
+  ChunkCache* cache = current_thread_chunk_cache();
+  if (cache != NULL) {
+    void* p = cache->allocate(bytes);
+    if (p != NULL) {
+      return p;
+    }
+  }
   switch (length) {
    case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
+   case Chunk::giant_size:  return ChunkPool::giant_pool()->allocate(bytes, alloc_failmode);
    case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
    case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
@@ -394,8 +489,13 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
 
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
+  ChunkCache* cache = current_thread_chunk_cache();
+  if (cache != NULL && cache->free(c)) {
+    return;
+  }
   switch (c->length()) {
    case Chunk::size:        ChunkPool::large_pool()->free(c); break;
+   case Chunk::giant_size:  ChunkPool::giant_pool()->free(c); break;
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
    case Chunk::tiny_size:   ChunkPool::tiny_pool()->free(c); break;
@@ -441,6 +541,9 @@ NOT_PRODUCT(volatile jint Arena::_instance_count = 0;)
 Arena::Arena(size_t init_size) {
   size_t round_size = (sizeof (char *)) - 1;
   init_size = (init_size+round_size) & ~round_size;
+  _size_in_bytes = 0;
+  _peak_size = 0;
+  _retained_size = 0;
   _first = _chunk = new (AllocFailStrategy::EXIT_OOM, init_size) Chunk(init_size);
   _hwm = _chunk->bottom();      // Save the cached hwm, max
   _max = _chunk->top();
@@ -449,6 +552,9 @@ Arena::Arena(size_t init_size) {
 }
 
 Arena::Arena() {
+  _size_in_bytes = 0;
+  _peak_size = 0;
+  _retained_size = 0;
   _first = _chunk = new (AllocFailStrategy::EXIT_OOM, Chunk::init_size) Chunk(Chunk::init_size);
   _hwm = _chunk->bottom();      // Save the cached hwm, max
   _max = _chunk->top();
@@ -462,6 +568,7 @@ Arena *Arena::move_contents(Arena *copy) {
   copy->_hwm   = _hwm;
   copy->_max   = _max;
   copy->_first = _first;
+  copy->_retained_size = _retained_size;
 
   // workaround rare racing condition, which could double count
   // the arena size by native memory tracking
@@ -531,6 +638,9 @@ void Arena::destruct_contents() {
 void Arena::set_size_in_bytes(size_t size) {
   if (_size_in_bytes != size) {
     _size_in_bytes = size;
+    if (size > _peak_size) {
+      _peak_size = size;
+    }
     MemTracker::record_arena_size((address)this, size);
   }
 }
@@ -552,9 +662,42 @@ void Arena::signal_out_of_memory(size_t sz, const char* whence) const {
 
 // Grow a new Chunk
 void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
+  if (_retained_size > 0) {
+    // A ResourceMark rollback left its chunk chain attached (see
+    // reset_to_mark); reuse it in place instead of allocating.
+    assert(_chunk != NULL && _chunk->next() != NULL, "retained bytes but no retained chunks");
+    Chunk* reuse = _chunk->next();
+    if (reuse->length() >= x) {
+      assert(_retained_size >= reuse->length(), "retained size out of sync");
+      _retained_size -= reuse->length();
+      set_size_in_bytes(size_in_bytes() + reuse->length());
+      _chunk = reuse;
+      if (ZapResourceArea) memset(reuse->bottom(), badResourceValue, reuse->length());
+      _hwm = _chunk->bottom();
+      _max = _chunk->top();
+      void* result = _hwm;
+      _hwm += x;
+      return result;
+    }
+    // The request does not fit the retained chunk; release the chain
+    // (its bytes are not in size_in_bytes) and allocate normally.
+    _retained_size = 0;
+    _chunk->next_chop();
+  }
+
   // Get minimal required size.  Either real big, or even bigger for giant objs
   size_t len = MAX2(x, (size_t) Chunk::size);
 
+  // An arena that is well below a previously reached peak is very likely
+  // climbing back to it: resource and compiler arenas repeat the same
+  // allocation pattern between marks or compilations.  Take the step with
+  // a giant chunk instead, so the climb costs a few pooled allocations
+  // rather than one per default-sized chunk.
+  if (len == (size_t) Chunk::size &&
+      _peak_size > size_in_bytes() + 2 * (size_t) Chunk::size) {
+    len = Chunk::giant_size;
+  }
+
   Chunk *k = _chunk;            // Get filled-up chunk address
   _chunk = new (alloc_failmode, len) Chunk(len);
 
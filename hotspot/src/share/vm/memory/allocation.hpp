@@ -357,6 +357,7 @@ class Chunk: CHeapObj<mtChunk> {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
+    giant_size = 128*K - slack, // Growth step for arenas climbing back to a large peak
     non_pool_size = init_size + 32 // An initial size which is not one of above
   };
 
@@ -379,6 +380,53 @@ class Chunk: CHeapObj<mtChunk> {
   static void clean_chunk_pool();
 };
 
+//------------------------------ChunkCache-------------------------------------
+// A small cache of standard-sized chunks owned by a single thread.
+// Arena chunks freed when a HandleMark or ResourceMark pops, or at the
+// end of a compilation, are kept here and handed back to the next mark
+// or compilation on the same thread, so the common arena churn does not
+// go through the ThreadCritical-protected global ChunkPool or
+// os::malloc.  The cache needs no locking because only the owning
+// thread touches it.
+class ChunkCache VALUE_OBJ_CLASS_SPEC {
+ public:
+  enum {
+    // Default cap per size class.  Enough to absorb the mark push/pop
+    // churn of JNI-heavy call paths while keeping the footprint of an
+    // idle thread small.
+    default_cached_per_class  = 4,
+    // Compiler threads cycle whole node and resource arenas per
+    // compilation, so they keep many more chunks; worst case is a few
+    // megabytes per compiler thread.
+    compiler_cached_per_class = 64
+  };
+ private:
+  enum {
+    _num_size_classes = 5       // tiny, small (init), medium, default and giant size
+  };
+  Chunk* _first[_num_size_classes];  // free list heads, linked through Chunk::next
+  uint   _count[_num_size_classes];
+  uint   _max_per_class;             // upper bound on cached chunks per size class
+
+  // Map a chunk payload length to a size class, or -1 for odd-sized chunks.
+  static int size_class_index(size_t length);
+
+ public:
+  ChunkCache(uint max_per_class = default_cached_per_class);
+  ~ChunkCache() { clear(); }
+
+  void set_max_per_class(uint n)     { _max_per_class = n; }
+
+  // Return a cached chunk with the given total byte size, or NULL.
+  void* allocate(size_t bytes);
+  // Take ownership of the chunk; returns false if the chunk is of a
+  // non-standard size or the cache is full, in which case the caller
+  // must dispose of it.
+  bool  free(Chunk* chunk);
+  // Give all cached chunks back to the C heap.
+  void  clear();
+};
+
 //------------------------------Arena------------------------------------------
 // Fast allocation of memory
 class Arena : public CHeapObj<mtNone|otArena> {
@@ -394,6 +442,12 @@ protected:
   // Get a new Chunk of at least size x
   void* grow(size_t x, AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   size_t _size_in_bytes;        // Size of arena (used for native memory tracking)
+  size_t _peak_size;            // Largest size this arena has reached; survives
+                                // reset and destruct_contents and steers the
+                                // chunk size chosen by grow()
+  size_t _retained_size;        // Bytes in chunks kept linked past _chunk by a
+                                // ResourceMark rollback (see resourceArea.hpp);
+                                // grow() reuses them before allocating
 
   NOT_PRODUCT(static julong _bytes_allocated;) // total #bytes allocated since start
   friend class AllocStats;
@@ -510,6 +564,7 @@ protected:
 
   // Total # of bytes used
   size_t size_in_bytes() const         {  return _size_in_bytes; };
+  size_t peak_size_in_bytes() const    {  return _peak_size; };
   void set_size_in_bytes(size_t size);
 
   static void free_malloced_objects(Chunk* chunk, char* hwm, char* max, char* hwm2)  PRODUCT_RETURN;
@@ -522,6 +577,7 @@ private:
   void   reset(void) {
     _first = _chunk = NULL;
     _hwm = _max = NULL;
+    _retained_size = 0;
     set_size_in_bytes(0);
   }
 };
@@ -512,6 +512,45 @@ BlockOffsetArrayNonContigSpace::mark_block(HeapWord* blk_start,
   do_block_internal(blk_start, blk_end, Action_mark, reducing);
 }
 
+// Bulk equivalent of a mark_block() loop over "num_blocks" contiguous
+// uniform blocks of "blk_size" words starting at "blk_start".  A card
+// is an "offset card" of the block that crosses onto it; because the
+// blocks are uniform and abut, a card boundary at offset "delta" from
+// blk_start is the first boundary inside its block exactly when
+// delta % blk_size < N_words.  As with mark_block(), cards beyond the
+// first one a block spans are left untouched.
+void
+BlockOffsetArrayNonContigSpace::mark_uniform_blocks(HeapWord* blk_start,
+                                                    size_t num_blocks,
+                                                    size_t blk_size,
+                                                    bool reducing) {
+  check_reducing_assertion(reducing);
+  assert(num_blocks > 0 && blk_size > 0, "phantom blocks");
+  HeapWord* blk_end = blk_start + num_blocks * blk_size;
+  assert(Universe::heap()->is_in_reserved(blk_start),
+         "reference must be into the heap");
+  assert(Universe::heap()->is_in_reserved(blk_end - 1),
+         "limit must be within the heap");
+
+  // The first card boundary at or after blk_start.
+  size_t    index    = _array->index_for(blk_start);
+  HeapWord* boundary = _array->address_for_index(index);
+  if (boundary != blk_start) {
+    boundary += N_words;
+    index++;
+  }
+  while (boundary < blk_end) {
+    size_t delta = pointer_delta(boundary, blk_start) % blk_size;
+    if (delta < N_words) {
+      // "boundary" is the first card boundary inside its block;
+      // record the offset back to the block's start.
+      _array->set_offset_array(index, boundary, boundary - delta, reducing);
+    }
+    boundary += N_words;
+    index++;
+  }
+}
+
 HeapWord* BlockOffsetArrayNonContigSpace::block_start_unsafe(
   const void* addr) const {
   assert(_array->offset_array(0) == 0, "objects can't cross covered areas");
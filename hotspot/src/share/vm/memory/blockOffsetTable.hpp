@@ -467,6 +467,15 @@ class BlockOffsetArrayNonContigSpace: public BlockOffsetArray {
     mark_block(blk, blk + size, reducing);
   }
 
+  // Bulk equivalent of calling mark_block() on each of "num_blocks"
+  // contiguous uniform blocks of "blk_size" words, the first starting
+  // at "blk_start".  Walks the affected cards once in ascending order,
+  // computing each offset card directly, instead of doing per-block
+  // bookkeeping.  The caller must make the block headers parsable
+  // (with a fence) before calling this.
+  void mark_uniform_blocks(HeapWord* blk_start, size_t num_blocks,
+                           size_t blk_size, bool reducing = false);
+
   // Adjust _unallocated_block to indicate that a particular
   // block has been newly allocated or freed. It is assumed (and
   // verified in the non-product VM) that the BOT is correct for
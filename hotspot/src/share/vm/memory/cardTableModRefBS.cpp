@@ -122,15 +122,27 @@ CardTableModRefBS::CardTableModRefBS(MemRegion whole_heap,
     NEW_C_HEAP_ARRAY(uintptr_t, max_covered_regions, mtGC);
   _last_LNC_resizing_collection =
     NEW_C_HEAP_ARRAY(int, max_covered_regions, mtGC);
+  _stride_order =
+    NEW_C_HEAP_ARRAY(uint*, max_covered_regions, mtGC);
+  _stride_order_len =
+    NEW_C_HEAP_ARRAY(uint, max_covered_regions, mtGC);
+  _last_stride_order_collection =
+    NEW_C_HEAP_ARRAY(int, max_covered_regions, mtGC);
   if (_lowest_non_clean == NULL
       || _lowest_non_clean_chunk_size == NULL
       || _lowest_non_clean_base_chunk_index == NULL
-      || _last_LNC_resizing_collection == NULL)
+      || _last_LNC_resizing_collection == NULL
+      || _stride_order == NULL
+      || _stride_order_len == NULL
+      || _last_stride_order_collection == NULL)
     vm_exit_during_initialization("couldn't allocate an LNC array.");
   for (int i = 0; i < max_covered_regions; i++) {
     _lowest_non_clean[i] = NULL;
     _lowest_non_clean_chunk_size[i] = 0;
     _last_LNC_resizing_collection[i] = -1;
+    _stride_order[i] = NULL;
+    _stride_order_len[i] = 0;
+    _last_stride_order_collection[i] = -1;
   }
 
   if (TraceCardTableModRefBS) {
@@ -171,6 +183,23 @@ CardTableModRefBS::~CardTableModRefBS() {
     FREE_C_HEAP_ARRAY(int, _last_LNC_resizing_collection, mtGC);
     _last_LNC_resizing_collection = NULL;
   }
+  if (_stride_order) {
+    for (int i = 0; i < _max_covered_regions; i++) {
+      if (_stride_order[i] != NULL) {
+        FREE_C_HEAP_ARRAY(uint, _stride_order[i], mtGC);
+      }
+    }
+    FREE_C_HEAP_ARRAY(uint*, _stride_order, mtGC);
+    _stride_order = NULL;
+  }
+  if (_stride_order_len) {
+    FREE_C_HEAP_ARRAY(uint, _stride_order_len, mtGC);
+    _stride_order_len = NULL;
+  }
+  if (_last_stride_order_collection) {
+    FREE_C_HEAP_ARRAY(int, _last_stride_order_collection, mtGC);
+    _last_stride_order_collection = NULL;
+  }
 }
 
 int CardTableModRefBS::find_covering_region_by_base(HeapWord* base) {
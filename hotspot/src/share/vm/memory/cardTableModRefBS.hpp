@@ -214,6 +214,27 @@ class CardTableModRefBS: public ModRefBarrierSet {
   uintptr_t* _lowest_non_clean_base_chunk_index;
   int* _last_LNC_resizing_collection;
 
+  // Per covered region, the strides of the current parallel scan ordered
+  // by decreasing dirty-card count, so that the densest strides are
+  // claimed first and the cheap ones backfill the tail of the scan.
+  // Built once per collection by the first thread to ask (see
+  // get_stride_order_for_space).  Unused (NULL) when
+  // ParGCStrideDensityOrdering is off.
+  uint** _stride_order;
+  uint*  _stride_order_len;
+  int*   _last_stride_order_collection;
+
+  // Returns the stride claim order for the covered region containing
+  // "sp", computing it for this collection if this is the first thread
+  // to ask, or NULL if strides should be claimed in index order.
+  // May be called by several threads concurrently.
+  uint* get_stride_order_for_space(Space* sp, MemRegion mr, uint n_strides);
+
+  // Counts the non-clean cards of "mr" in each of "n_strides" strides,
+  // a card table word at a time.
+  void count_dirty_cards_per_stride(MemRegion mr, uint n_strides,
+                                    size_t* counts);
+
   // Initializes "lowest_non_clean" to point to the array for the region
   // covering "sp", and "lowest_non_clean_base_chunk_index" to the chunk
   // index of the corresponding to the first element of that array.
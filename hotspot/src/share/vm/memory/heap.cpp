@@ -41,7 +41,9 @@ CodeHeap::CodeHeap() {
   _segment_size                 = 0;
   _log2_segment_size            = 0;
   _next_segment                 = 0;
-  _freelist                     = NULL;
+  for (int i = 0; i < free_list_count; i++) {
+    _free_lists[i] = NULL;
+  }
   _freelist_segments            = 0;
 }
 
@@ -87,29 +89,18 @@ void CodeHeap::on_code_mapping(char* base, size_t size) {
 }
 
 
-bool CodeHeap::reserve(size_t reserved_size, size_t committed_size,
+bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size,
                        size_t segment_size) {
-  assert(reserved_size >= committed_size, "reserved < committed");
+  assert(rs.size() >= committed_size, "reserved < committed");
   assert(segment_size >= sizeof(FreeBlock), "segment size is too small");
   assert(is_power_of_2(segment_size), "segment_size must be a power of 2");
 
   _segment_size      = segment_size;
   _log2_segment_size = exact_log2(segment_size);
 
-  // Reserve and initialize space for _memory.
-  const size_t page_size = os::can_execute_large_page_memory() ?
-          os::page_size_for_region(committed_size, reserved_size, 8) :
-          os::vm_page_size();
-  const size_t granularity = os::vm_allocation_granularity();
-  const size_t r_align = MAX2(page_size, granularity);
-  const size_t r_size = align_size_up(reserved_size, r_align);
-  const size_t c_size = align_size_up(committed_size, page_size);
-
-  const size_t rs_align = page_size == (size_t) os::vm_page_size() ? 0 :
-    MAX2(page_size, granularity);
-  ReservedCodeSpace rs(r_size, rs_align, rs_align > 0);
-  os::trace_page_sizes("code heap", committed_size, reserved_size, page_size,
-                       rs.base(), rs.size());
+  // Reserved space for _memory is allocated by the caller, so that several
+  // heaps can be carved out of one contiguous code space reservation.
+  const size_t c_size = align_to_page_size(committed_size);
   if (!_memory.initialize(rs, c_size)) {
     return false;
   }
@@ -118,6 +109,7 @@ bool CodeHeap::reserve(size_t reserved_size, size_t committed_size,
   _number_of_committed_segments = size_to_segments(_memory.committed_size());
   _number_of_reserved_segments  = size_to_segments(_memory.reserved_size());
   assert(_number_of_reserved_segments >= _number_of_committed_segments, "just checking");
+  const size_t granularity = os::vm_allocation_granularity();
   const size_t reserved_segments_alignment = MAX2((size_t)os::vm_page_size(), granularity);
   const size_t reserved_segments_size = align_size_up(_number_of_reserved_segments, reserved_segments_alignment);
   const size_t committed_segments_size = align_to_page_size(_number_of_committed_segments);
@@ -175,6 +167,10 @@ void CodeHeap::shrink_by(size_t size) {
 
 void CodeHeap::clear() {
   _next_segment = 0;
+  for (int i = 0; i < free_list_count; i++) {
+    _free_lists[i] = NULL;
+  }
+  _freelist_segments = 0;
   mark_segmap_as_free(0, _number_of_committed_segments);
 }
 
@@ -325,107 +321,118 @@ size_t CodeHeap::heap_unallocated_capacity() const {
 
 // Free list management
 
+// Map a block length in segments to its size class
+int CodeHeap::free_list_index(size_t length) {
+  assert(length > 0, "0 length block");
+  int index = log2_intptr((intptr_t)length);
+  if (index >= free_list_count) {
+    index = free_list_count - 1;
+  }
+  return index;
+}
+
 FreeBlock *CodeHeap::following_block(FreeBlock *b) {
   return (FreeBlock*)(((address)b) + _segment_size * b->length());
 }
 
-// Inserts block b after a
-void CodeHeap::insert_after(FreeBlock* a, FreeBlock* b) {
-  assert(a != NULL && b != NULL, "must be real pointers");
-
-  // Link b into the list after a
-  b->set_link(a->link());
-  a->set_link(b);
-
-  // See if we can merge blocks
-  merge_right(b); // Try to make b bigger
-  merge_right(a); // Try to make a include b
+void CodeHeap::push_on_free_list(FreeBlock* b) {
+  assert(b->free(), "must be a free block");
+  int index = free_list_index(b->length());
+  FreeBlock* head = _free_lists[index];
+  b->set_prev(NULL);
+  b->set_link(head);
+  if (head != NULL) {
+    head->set_prev(b);
+  }
+  _free_lists[index] = b;
 }
 
-// Try to merge this block with the following block
-void CodeHeap::merge_right(FreeBlock *a) {
-  assert(a->free(), "must be a free block");
-  if (following_block(a) == a->link()) {
-    assert(a->link() != NULL && a->link()->free(), "must be free too");
-    // Update block a to include the following block
-    a->set_length(a->length() + a->link()->length());
-    a->set_link(a->link()->link());
-    // Update find_start map
-    size_t beg = segment_for(a);
-    mark_segmap_as_used(beg, beg + a->length());
+void CodeHeap::remove_from_free_list(FreeBlock* b) {
+  assert(b->free(), "must be a free block");
+  int index = free_list_index(b->length());
+  if (b->prev() == NULL) {
+    assert(_free_lists[index] == b, "not on its size class list");
+    _free_lists[index] = b->link();
+  } else {
+    b->prev()->set_link(b->link());
+  }
+  if (b->link() != NULL) {
+    b->link()->set_prev(b->prev());
   }
 }
 
 void CodeHeap::add_to_freelist(HeapBlock *a) {
   FreeBlock* b = (FreeBlock*)a;
-  assert(b != _freelist, "cannot be removed twice");
+  assert(b->length() > 0, "0 length block");
 
   // Mark as free and update free space count
   _freelist_segments += b->length();
   b->set_free();
 
-  // First element in list?
-  if (_freelist == NULL) {
-    _freelist = b;
-    b->set_link(NULL);
-    return;
+  // Merge with a free following block, if any. The segment map keeps
+  // its "used" encoding for blocks on the free lists, so block starts
+  // can still be found; the free bit in the header tells them apart.
+  size_t next = segment_for(b) + b->length();
+  if (next < _next_segment) {
+    FreeBlock* following = (FreeBlock*)block_at(next);
+    if (following->free()) {
+      remove_from_free_list(following);
+      b->set_length(b->length() + following->length());
+    }
   }
 
-  // Scan for right place to put into list. List
-  // is sorted by increasing addresseses
-  FreeBlock* prev = NULL;
-  FreeBlock* cur  = _freelist;
-  while(cur != NULL && cur < b) {
-    assert(prev == NULL || prev < cur, "must be ordered");
-    prev = cur;
-    cur  = cur->link();
+  // Merge into a free preceding block, if any. The segment map entry
+  // just before this block leads to the start of its predecessor.
+  size_t beg = segment_for(b);
+  if (beg > 0) {
+    address map = (address)_segmap.low();
+    size_t i = beg - 1;
+    if (map[i] != 0xFF) {
+      while (map[i] > 0) i -= (int)map[i];
+      FreeBlock* preceding = (FreeBlock*)block_at(i);
+      if (preceding->free()) {
+        remove_from_free_list(preceding);
+        preceding->set_length(preceding->length() + b->length());
+        b = preceding;
+      }
+    }
   }
 
-  assert( (prev == NULL && b < _freelist) ||
-          (prev < b && (cur == NULL || b < cur)), "list must be ordered");
-
-  if (prev == NULL) {
-    // Insert first in list
-    b->set_link(_freelist);
-    _freelist = b;
-    merge_right(_freelist);
-  } else {
-    insert_after(prev, b);
-  }
+  // Re-mark the (possibly merged) block so find_start keeps working,
+  // then file it under its size class
+  size_t first = segment_for(b);
+  mark_segmap_as_used(first, first + b->length());
+  push_on_free_list(b);
 }
 
-// Search freelist for an entry on the list with the best fit
+// Search the size class lists for the best fitting free block.
 // Return NULL if no one was found
 FreeBlock* CodeHeap::search_freelist(size_t length, bool is_critical) {
-  FreeBlock *best_block = NULL;
-  FreeBlock *best_prev  = NULL;
-  size_t best_length = 0;
+  FreeBlock* best_block = NULL;
 
-  // Search for smallest block which is bigger than length
-  FreeBlock *prev = NULL;
-  FreeBlock *cur = _freelist;
-  while(cur != NULL) {
-    size_t l = cur->length();
-    if (l >= length && (best_block == NULL || best_length > l)) {
+  // The class this length maps to may also hold smaller blocks, so the
+  // best fit among its entries has to be searched for. Every block in a
+  // higher class is big enough, so the first non-empty one can satisfy
+  // the request; its smallest entry is taken to limit fragmentation.
+  for (int index = free_list_index(length); index < free_list_count; index++) {
+    for (FreeBlock* cur = _free_lists[index]; cur != NULL; cur = cur->link()) {
+      size_t l = cur->length();
+      if (l < length) continue;
 
       // Non critical allocations are not allowed to use the last part of the code heap.
       if (!is_critical) {
         // Make sure the end of the allocation doesn't cross into the last part of the code heap
-        if (((size_t)cur + length) > ((size_t)high_boundary() - CodeCacheMinimumFreeSpace)) {
-          // the freelist is sorted by address - if one fails, all consecutive will also fail.
-          break;
+        if (((size_t)cur + segments_to_size(length)) > ((size_t)high_boundary() - CodeCacheMinimumFreeSpace)) {
+          continue;
         }
       }
 
-      // Remember best block, its previous element, and its length
-      best_block = cur;
-      best_prev  = prev;
-      best_length = best_block->length();
+      if (best_block == NULL || l < best_block->length()) {
+        best_block = cur;
+        if (l == length) break;    // perfect fit
+      }
     }
-
-    // Next element in list
-    prev = cur;
-    cur  = cur->link();
+    if (best_block != NULL) break;
   }
 
   if (best_block == NULL) {
@@ -433,23 +440,18 @@ FreeBlock* CodeHeap::search_freelist(size_t length, bool is_critical) {
     return NULL;
   }
 
-  assert((best_prev == NULL && _freelist == best_block ) ||
-         (best_prev != NULL && best_prev->link() == best_block), "sanity check");
+  size_t best_length = best_block->length();
+  remove_from_free_list(best_block);
 
-  // Exact (or at least good enough) fit. Remove from list.
+  // Exact (or at least good enough) fit?
   // Don't leave anything on the freelist smaller than CodeCacheMinBlockLength.
   if (best_length < length + CodeCacheMinBlockLength) {
     length = best_length;
-    if (best_prev == NULL) {
-      assert(_freelist == best_block, "sanity check");
-      _freelist = _freelist->link();
-    } else {
-      // Unmap element
-      best_prev->set_link(best_block->link());
-    }
   } else {
-    // Truncate block and return a pointer to the following block
+    // Truncate block and return a pointer to the following block;
+    // what remains of the front goes back on a free list
     best_block->set_length(best_length - length);
+    push_on_free_list(best_block);
     best_block = following_block(best_block);
     // Set used bit and length on new block
     size_t beg = segment_for(best_block);
@@ -478,9 +480,12 @@ void CodeHeap::verify() {
   // represented.
   int count = 0;
   size_t len = 0;
-  for(FreeBlock* b = _freelist; b != NULL; b = b->link()) {
-    len += b->length();
-    count++;
+  for (int index = 0; index < free_list_count; index++) {
+    for(FreeBlock* b = _free_lists[index]; b != NULL; b = b->link()) {
+      assert(free_list_index(b->length()) == index, "filed under wrong size class");
+      len += b->length();
+      count++;
+    }
   }
 
   // Verify that freelist contains the right amount of free space
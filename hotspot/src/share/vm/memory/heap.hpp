@@ -64,10 +64,11 @@ class FreeBlock: public HeapBlock {
   friend class VMStructs;
  protected:
   FreeBlock* _link;
+  FreeBlock* _prev;
 
  public:
   // Initialization
-  void initialize(size_t length)             { HeapBlock::initialize(length); _link= NULL; }
+  void initialize(size_t length)             { HeapBlock::initialize(length); _link = NULL; _prev = NULL; }
 
   // Merging
   void set_length(size_t l)                  { _header._length = l; }
@@ -75,6 +76,8 @@ class FreeBlock: public HeapBlock {
   // Accessors
   FreeBlock* link() const                    { return _link; }
   void set_link(FreeBlock* link)             { _link = link; }
+  FreeBlock* prev() const                    { return _prev; }
+  void set_prev(FreeBlock* prev)             { _prev = prev; }
 };
 
 class CodeHeap : public CHeapObj<mtCode> {
@@ -90,8 +93,13 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   size_t       _next_segment;
 
-  FreeBlock*   _freelist;
-  size_t       _freelist_segments;               // No. of segments in freelist
+  // Free blocks are segregated into doubly-linked lists by size class.
+  // Class i holds blocks of [2^i, 2^(i+1)) segments; the last class is
+  // unbounded. Segregation keeps the best-fit search short even when
+  // sweeping has left many free blocks behind.
+  enum { free_list_count = 16 };
+  FreeBlock*   _free_lists[free_list_count];
+  size_t       _freelist_segments;               // No. of segments on free lists
 
   // Helper functions
   size_t   size_to_segments(size_t size) const { return (size + _segment_size - 1) >> _log2_segment_size; }
@@ -104,9 +112,10 @@ class CodeHeap : public CHeapObj<mtCode> {
   void  mark_segmap_as_used(size_t beg, size_t end);
 
   // Freelist management helpers
+  static int free_list_index(size_t length);
   FreeBlock* following_block(FreeBlock *b);
-  void insert_after(FreeBlock* a, FreeBlock* b);
-  void merge_right (FreeBlock* a);
+  void push_on_free_list(FreeBlock* b);
+  void remove_from_free_list(FreeBlock* b);
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock *b);
@@ -125,7 +134,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   CodeHeap();
 
   // Heap extents
-  bool  reserve(size_t reserved_size, size_t committed_size, size_t segment_size);
+  bool  reserve(ReservedSpace rs, size_t committed_size, size_t segment_size);
   void  release();                               // releases all allocated memory
   bool  expand_by(size_t size);                  // expands commited memory by size
   void  shrink_by(size_t size);                  // shrinks commited memory by size
@@ -28,11 +28,17 @@
 #include "memory/genCollectedHeap.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_ALL_GCS
+#include "gc_implementation/g1/g1CollectedHeap.hpp"
+#include "gc_implementation/g1/heapRegion.hpp"
 #include "gc_implementation/parallelScavenge/parallelScavengeHeap.hpp"
+#include "utilities/workgroup.hpp"
 #endif // INCLUDE_ALL_GCS
 
 // HeapInspection
@@ -198,6 +204,45 @@ size_t KlassInfoTable::size_of_instances_in_words() const {
   return _size_of_instances_in_words;
 }
 
+// Return false if the entry could not be recorded on account
+// of running out of space required to create a new entry.
+bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
+  Klass*          k = cie->klass();
+  KlassInfoEntry* elt = lookup(k);
+  // elt may be NULL if it's a new klass for which we
+  // could not allocate space for a new entry in the hashtable.
+  if (elt != NULL) {
+    elt->set_count(elt->count() + cie->count());
+    elt->set_words(elt->words() + cie->words());
+    _size_of_instances_in_words += cie->words();
+    return true;
+  }
+  return false;
+}
+
+class KlassInfoTableMergeClosure : public KlassInfoClosure {
+ private:
+  KlassInfoTable* _dest;
+  bool _success;
+ public:
+  KlassInfoTableMergeClosure(KlassInfoTable* table) : _dest(table), _success(true) {}
+  void do_cinfo(KlassInfoEntry* cie) {
+    _success &= _dest->merge_entry(cie);
+  }
+  bool success() { return _success; }
+};
+
+// Merge <table> into this table; used to combine the per-worker tables
+// built by a parallel heap walk.
+bool KlassInfoTable::merge(KlassInfoTable* table) {
+  if (table == NULL || table->allocation_failed()) {
+    return false;
+  }
+  KlassInfoTableMergeClosure closure(this);
+  table->iterate(&closure);
+  return closure.success();
+}
+
 int KlassInfoHisto::sort_helper(KlassInfoEntry** e1, KlassInfoEntry** e2) {
   return (*e1)->compare(*e1,*e2);
 }
@@ -471,9 +516,109 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
+#if INCLUDE_ALL_GCS
+class InspectRegionClosure : public HeapRegionClosure {
+ private:
+  ObjectClosure* _cl;
+ public:
+  InspectRegionClosure(ObjectClosure* cl) : _cl(cl) {}
+  bool doHeapRegion(HeapRegion* r) {
+    if (! r->continuesHumongous()) {
+      r->object_iterate(_cl);
+    }
+    return false;
+  }
+};
+
+// Walks the heap regions in parallel, each worker recording into a
+// private KlassInfoTable that is merged into the shared table at the
+// end. Follows the claim value protocol of G1ParVerifyTask.
+class ParHeapInspectTask : public AbstractGangTask {
+ private:
+  G1CollectedHeap*   _g1h;
+  KlassInfoTable*    _shared_cit;
+  BoolObjectClosure* _filter;
+  uint               _n_workers;
+  volatile jint      _missed_count;
+  Mutex              _mutex;
+
+ public:
+  ParHeapInspectTask(G1CollectedHeap* g1h, KlassInfoTable* shared_cit,
+                     BoolObjectClosure* filter, uint n_workers) :
+    AbstractGangTask("Parallel heap inspect task"),
+    _g1h(g1h),
+    _shared_cit(shared_cit),
+    _filter(filter),
+    _n_workers(n_workers),
+    _missed_count(0),
+    _mutex(Mutex::leaf, "Parallel heap inspection merge lock", true) { }
+
+  size_t missed_count() const {
+    return (size_t) _missed_count;
+  }
+
+  void work(uint worker_id) {
+    ResourceMark rm;
+    size_t missed = 0;
+    KlassInfoTable cit(false);
+    if (!cit.allocation_failed()) {
+      RecordInstanceClosure ric(&cit, _filter);
+      InspectRegionClosure blk(&ric);
+      _g1h->heap_region_par_iterate_chunked(&blk, worker_id, _n_workers,
+                                            HeapRegion::ParInspectClaimValue);
+      missed = ric.missed_count();
+      MutexLockerEx ml(&_mutex, Mutex::_no_safepoint_check_flag);
+      // A failed merge means some entries could not be allocated in the
+      // shared table; the caller already warns when instances go
+      // uncounted, so nothing further to do here.
+      _shared_cit->merge(&cit);
+    } else {
+      // Ran out of C heap for a private table; record straight into the
+      // shared table under the merge lock instead.
+      MutexLockerEx ml(&_mutex, Mutex::_no_safepoint_check_flag);
+      RecordInstanceClosure ric(_shared_cit, _filter);
+      InspectRegionClosure blk(&ric);
+      _g1h->heap_region_par_iterate_chunked(&blk, worker_id, _n_workers,
+                                            HeapRegion::ParInspectClaimValue);
+      missed = ric.missed_count();
+    }
+    Atomic::add((jint) missed, &_missed_count);
+  }
+};
+#endif // INCLUDE_ALL_GCS
+
 size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter) {
   ResourceMark rm;
 
+#if INCLUDE_ALL_GCS
+  // With G1 the heap regions can be claimed in parallel, so spread the
+  // walk over the GC worker gang and merge the per-worker tables at the
+  // end. The other collectors have no parallel object iteration support
+  // and take the serial walk below.
+  if (ParallelClassHistogram && UseG1GC &&
+      SafepointSynchronize::is_at_safepoint() &&
+      Thread::current()->is_VM_thread()) {
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    FlexibleWorkGang* workers = g1h->workers();
+    if (workers != NULL && workers->active_workers() > 1) {
+      assert(g1h->check_heap_region_claim_values(HeapRegion::InitialClaimValue),
+             "sanity check");
+
+      uint n_workers = workers->active_workers();
+      ParHeapInspectTask task(g1h, cit, filter, n_workers);
+      g1h->set_par_threads(n_workers);
+      workers->run_task(&task);
+      g1h->set_par_threads(0);
+
+      assert(g1h->check_heap_region_claim_values(HeapRegion::ParInspectClaimValue),
+             "sanity check");
+      g1h->reset_heap_region_claim_values();
+
+      return task.missed_count();
+    }
+  }
+#endif // INCLUDE_ALL_GCS
+
   RecordInstanceClosure ric(cit, filter);
   Universe::heap()->object_iterate(&ric);
   return ric.missed_count();
@@ -254,6 +254,11 @@ class KlassInfoTable: public StackObj {
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
   size_t size_of_instances_in_words() const;
+  // Folds the counts of another table (typically built by one worker of
+  // a parallel heap walk) into this one. Returns false if an entry could
+  // not be allocated.
+  bool merge(KlassInfoTable* table);
+  bool merge_entry(const KlassInfoEntry* cie);
 
   friend class KlassInfoHisto;
 };
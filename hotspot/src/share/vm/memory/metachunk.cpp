@@ -56,8 +56,8 @@ Metachunk::Metachunk(size_t word_size,
     _container(container)
 {
   _top = initial_top();
-#ifdef ASSERT
   set_is_tagged_free(false);
+#ifdef ASSERT
   size_t data_word_size = pointer_delta(end(),
                                         _top,
                                         sizeof(MetaWord));
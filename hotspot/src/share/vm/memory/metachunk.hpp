@@ -102,7 +102,11 @@ class Metachunk : public Metabase<Metachunk> {
   // Current allocation top.
   MetaWord* _top;
 
-  DEBUG_ONLY(bool _is_tagged_free;)
+  // True when the chunk is on one of the ChunkManager's free lists (or
+  // in its humongous dictionary).  Kept in product builds so that the
+  // chunk walks in VirtualSpaceNode::purge() and the free-chunk
+  // coalescing pass can tell free chunks from in-use ones.
+  bool _is_tagged_free;
 
   MetaWord* initial_top() const { return (MetaWord*)this + overhead(); }
   MetaWord* top() const         { return _top; }
@@ -138,10 +142,8 @@ class Metachunk : public Metabase<Metachunk> {
   size_t used_word_size() const;
   size_t free_word_size() const;
 
-#ifdef ASSERT
   bool is_tagged_free() { return _is_tagged_free; }
   void set_is_tagged_free(bool v) { _is_tagged_free = v; }
-#endif
 
   NOT_PRODUCT(void mangle();)
 
@@ -159,6 +159,12 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // of type index.
   void return_chunks(ChunkIndex index, Metachunk* chunks);
 
+  // Add a single chunk that is not on any freelist (e.g. the result of
+  // coalescing) to the freelist of chunks of type index.  Unlike
+  // return_chunks() this does not adjust the container count, since a
+  // chunk being coalesced was already free.
+  void return_single_chunk(ChunkIndex index, Metachunk* chunk);
+
   // Total of the space in the free chunks list
   size_t free_chunks_total_words();
   size_t free_chunks_total_bytes();
@@ -320,6 +326,11 @@ class VirtualSpaceNode : public CHeapObj<mtClass> {
   // in the node from any freelist.
   void purge(ChunkManager* chunk_manager);
 
+  // Rebuild runs of adjacent free chunks in this node into the largest
+  // chunk sizes the runs can hold.  Returns the number of chunks
+  // eliminated by merging.
+  size_t coalesce_free_chunks(ChunkManager* chunk_manager);
+
   // If an allocation doesn't fit in the current node a new node is created.
   // Allocate chunks out of the remaining committed space in this node
   // to avoid wasting that memory.
@@ -409,6 +420,89 @@ void VirtualSpaceNode::purge(ChunkManager* chunk_manager) {
   }
 }
 
+// Walk this node's chunks and rebuild each run of two or more adjacent
+// free chunks into the largest chunk sizes the run can hold, so that
+// freed specialized and small chunks become allocatable as small and
+// medium chunks again instead of forcing the virtual space list to
+// grow.  Runs are never rebuilt into humongous chunks: this tree never
+// splits a humongous chunk on allocation, so memory merged into the
+// humongous dictionary would be stranded for the common chunk sizes.
+// A humongous chunk that is free on its own stays in the dictionary;
+// it is only rebuilt when it sits in a run with other free chunks.
+size_t VirtualSpaceNode::coalesce_free_chunks(ChunkManager* chunk_manager) {
+  assert_lock_strong(SpaceManager::expand_lock());
+  const size_t medium_size      = chunk_manager->free_chunks(MediumIndex)->size();
+  const size_t small_size       = chunk_manager->free_chunks(SmallIndex)->size();
+  const size_t specialized_size = chunk_manager->free_chunks(SpecializedIndex)->size();
+
+  size_t merged = 0;
+  Metachunk* chunk = first_chunk();
+  Metachunk* invalid_chunk = (Metachunk*) top();
+  while (chunk < invalid_chunk) {
+    Metachunk* next = (Metachunk*)((MetaWord*)chunk + chunk->word_size());
+    if (chunk->is_tagged_free()) {
+      // Find the extent of the run of adjacent free chunks starting here.
+      Metachunk* run_end    = chunk;
+      size_t     run_size   = 0;
+      size_t     run_chunks = 0;
+      size_t     run_min    = max_uintx;
+      while (run_end < invalid_chunk && run_end->is_tagged_free()) {
+        run_size   += run_end->word_size();
+        run_min     = MIN2(run_min, run_end->word_size());
+        run_chunks += 1;
+        run_end = (Metachunk*)((MetaWord*)run_end + run_end->word_size());
+      }
+      next = (Metachunk*) run_end;
+
+      // The largest piece the rebuild below would produce.  Only
+      // rebuild when the run actually contains a chunk smaller than
+      // that, otherwise the rebuild would reproduce the same layout.
+      const size_t target = run_size >= medium_size ? medium_size :
+                            (run_size >= small_size ? small_size :
+                                                      specialized_size);
+      if (run_chunks > 1 && run_min < target) {
+        // Pull every chunk in the run off its freelist ...
+        Metachunk* cur = chunk;
+        while (cur < run_end) {
+          Metachunk* cur_next = (Metachunk*)((MetaWord*)cur + cur->word_size());
+          chunk_manager->remove_chunk(cur);
+          cur = cur_next;
+        }
+        // ... and carve the run greedily into the largest exact chunk
+        // sizes, which always adds up because all the chunk sizes are
+        // multiples of the smallest chunk size.
+        MetaWord* p         = (MetaWord*) chunk;
+        size_t    remaining = run_size;
+        size_t    pieces    = 0;
+        while (remaining > 0) {
+          size_t     piece_size;
+          ChunkIndex index;
+          if (remaining >= medium_size) {
+            piece_size = medium_size;
+            index      = MediumIndex;
+          } else if (remaining >= small_size) {
+            piece_size = small_size;
+            index      = SmallIndex;
+          } else {
+            piece_size = specialized_size;
+            index      = SpecializedIndex;
+          }
+          assert(remaining >= piece_size, "Chunk sizes are not multiples of the smallest");
+          Metachunk* piece = ::new (p) Metachunk(piece_size, this);
+          chunk_manager->return_single_chunk(index, piece);
+          p         += piece_size;
+          remaining -= piece_size;
+          pieces    += 1;
+        }
+        assert(p == (MetaWord*) run_end, "Rebuilt run has wrong extent");
+        merged += run_chunks - pieces;
+      }
+    }
+    chunk = next;
+  }
+  return merged;
+}
+
 #ifdef ASSERT
 uint VirtualSpaceNode::container_count_slow() {
   uint count = 0;
@@ -513,6 +607,9 @@ class VirtualSpaceList : public CHeapObj<mtClass> {
   // Unlink empty VirtualSpaceNodes and free it.
   void purge(ChunkManager* chunk_manager);
 
+  // Merge adjacent free chunks in all the nodes on this list.
+  void coalesce_free_chunks(ChunkManager* chunk_manager);
+
   bool contains(const void *ptr);
 
   void print_on(outputStream* st) const;
@@ -1070,6 +1167,20 @@ void VirtualSpaceList::purge(ChunkManager* chunk_manager) {
 #endif
 }
 
+void VirtualSpaceList::coalesce_free_chunks(ChunkManager* chunk_manager) {
+  assert_lock_strong(SpaceManager::expand_lock());
+  size_t merged = 0;
+  VirtualSpaceListIterator iter(virtual_space_list());
+  while (iter.repeat()) {
+    VirtualSpaceNode* vsn = iter.get_next();
+    merged += vsn->coalesce_free_chunks(chunk_manager);
+  }
+  if (TraceMetadataChunkAllocation && merged > 0) {
+    gclog_or_tty->print_cr("VirtualSpaceList::coalesce_free_chunks: "
+                           "merged away " SIZE_FORMAT " free chunks", merged);
+  }
+}
+
 void VirtualSpaceList::retire_current_virtual_space() {
   assert_lock_strong(SpaceManager::expand_lock());
 
@@ -1735,11 +1846,8 @@ Metachunk* ChunkManager::free_chunks_get(size_t word_size) {
   // Remove it from the links to this freelist
   chunk->set_next(NULL);
   chunk->set_prev(NULL);
-#ifdef ASSERT
-  // Chunk is no longer on any freelist. Setting to false make container_count_slow()
-  // work.
+  // Chunk is no longer on any freelist.
   chunk->set_is_tagged_free(false);
-#endif
   chunk->container()->inc_container_count();
 
   slow_locked_verify();
@@ -2114,12 +2222,21 @@ void ChunkManager::return_chunks(ChunkIndex index, Metachunk* chunks) {
     // Capture the next link before it is changed
     // by the call to return_chunk_at_head();
     Metachunk* next = cur->next();
-    DEBUG_ONLY(cur->set_is_tagged_free(true);)
+    cur->set_is_tagged_free(true);
     list->return_chunk_at_head(cur);
     cur = next;
   }
 }
 
+void ChunkManager::return_single_chunk(ChunkIndex index, Metachunk* chunk) {
+  assert_lock_strong(SpaceManager::expand_lock());
+  assert(free_chunks(index)->size() == chunk->word_size(),
+         "Mismatch in chunk sizes");
+  chunk->set_is_tagged_free(true);
+  free_chunks(index)->return_chunk_at_head(chunk);
+  inc_free_chunks_total(chunk->word_size());
+}
+
 SpaceManager::~SpaceManager() {
   // This call this->_lock which can't be done while holding expand_lock()
   assert(sum_capacity_in_chunks_in_use() == allocated_chunks_words(),
@@ -2185,9 +2302,7 @@ SpaceManager::~SpaceManager() {
   Metachunk* humongous_chunks = chunks_in_use(HumongousIndex);
 
   while (humongous_chunks != NULL) {
-#ifdef ASSERT
     humongous_chunks->set_is_tagged_free(true);
-#endif
     if (TraceMetadataChunkAllocation && Verbose) {
       gclog_or_tty->print(PTR_FORMAT " (" SIZE_FORMAT ") ",
                           humongous_chunks,
@@ -3442,6 +3557,9 @@ void Metaspace::iterate(Metaspace::AllocRecordClosure *closure) {
 
 void Metaspace::purge(MetadataType mdtype) {
   get_space_list(mdtype)->purge(get_chunk_manager(mdtype));
+  if (MetaspaceCoalesceFreeChunks) {
+    get_space_list(mdtype)->coalesce_free_chunks(get_chunk_manager(mdtype));
+  }
 }
 
 void Metaspace::purge() {
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "memory/metaspace.hpp"
 #include "memory/metaspaceCounters.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/globals.hpp"
@@ -64,6 +65,7 @@ class MetaspacePerfCounters: public CHeapObj<mtInternal> {
 };
 
 MetaspacePerfCounters* MetaspaceCounters::_perf_counters = NULL;
+PerfVariable* MetaspaceCounters::_target_size = NULL;
 
 size_t MetaspaceCounters::used() {
   return MetaspaceAux::allocated_used_bytes();
@@ -77,6 +79,10 @@ size_t MetaspaceCounters::max_capacity() {
   return MetaspaceAux::reserved_bytes();
 }
 
+size_t MetaspaceCounters::target_size() {
+  return MetaspaceGC::capacity_until_GC();
+}
+
 void MetaspaceCounters::initialize_performance_counters() {
   if (UsePerfData) {
     assert(_perf_counters == NULL, "Should only be initialized once");
@@ -84,6 +90,14 @@ void MetaspaceCounters::initialize_performance_counters() {
     size_t min_capacity = 0;
     _perf_counters = new MetaspacePerfCounters("metaspace", min_capacity,
                                                capacity(), max_capacity(), used());
+
+    // The committed size that purging and chunk coalescing work
+    // towards; this is the high-water-mark the next GC is induced at.
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    const char* path = PerfDataManager::counter_name("metaspace", "targetCapacity");
+    _target_size = PerfDataManager::create_variable(SUN_GC, path, PerfData::U_Bytes,
+                                                    target_size(), THREAD);
   }
 }
 
@@ -92,6 +106,7 @@ void MetaspaceCounters::update_performance_counters() {
     assert(_perf_counters != NULL, "Should be initialized");
 
     _perf_counters->update(capacity(), max_capacity(), used());
+    _target_size->set_value(target_size());
   }
 }
 
@@ -28,12 +28,17 @@
 #include "memory/allocation.hpp"
 
 class MetaspacePerfCounters;
+class PerfVariable;
 
 class MetaspaceCounters: public AllStatic {
   static MetaspacePerfCounters* _perf_counters;
+  // The committed size the purge and coalescing machinery works
+  // against (MetaspaceGC::capacity_until_GC).
+  static PerfVariable* _target_size;
   static size_t used();
   static size_t capacity();
   static size_t max_capacity();
+  static size_t target_size();
 
  public:
   static void initialize_performance_counters();
@@ -95,6 +95,20 @@ static void remove_unshareable_in_classes() {
   }
 }
 
+// Resolve the constant pool Class entries that refer to the holder or one
+// of its supertypes, so runs using the archive skip resolving them.  See
+// ConstantPool::pre_resolve_shared_supertypes() for why only this subset
+// of entries can be archived in resolved form.
+static void pre_resolve_supertype_entries() {
+  for (int i = 0; i < _global_klass_objects->length(); i++) {
+    Klass* k = _global_klass_objects->at(i);
+    if (k->oop_is_instance()) {
+      InstanceKlass* ik = InstanceKlass::cast(k);
+      ik->constants()->pre_resolve_shared_supertypes();
+    }
+  }
+}
+
 // Walk all methods in the class list and assign a fingerprint.
 // so that this part of the ConstMethod* is read only.
 static void calculate_fingerprints() {
@@ -448,6 +462,11 @@ void VM_PopulateDumpSharedSpace::doit() {
   calculate_fingerprints();
   tty->print_cr("done. ");
 
+  // Archive supertype constant pool entries in resolved form.
+  tty->print("Pre-resolving supertype constant pool entries ... ");
+  pre_resolve_supertype_entries();
+  tty->print_cr("done. ");
+
   // Remove all references outside the metadata
   tty->print("Removing unshareable information ... ");
   remove_unshareable_in_classes();
@@ -726,6 +726,14 @@ void ReferenceProcessor::abandon_partial_discovery() {
   }
 }
 
+int AbstractRefProcTaskExecutor::ProcessTask::claim_queue() {
+  jint id = Atomic::add(1, &_next_queue) - 1;
+  if (id < (jint) _ref_processor.max_num_q()) {
+    return id;
+  }
+  return -1;
+}
+
 class RefProcPhase1Task: public AbstractRefProcTaskExecutor::ProcessTask {
 public:
   RefProcPhase1Task(ReferenceProcessor& ref_processor,
@@ -739,6 +747,13 @@ public:
                     OopClosure& keep_alive,
                     VoidClosure& complete_gc)
   {
+    if (ParallelRefProcWorkStealing) {
+      for (int idx = claim_queue(); idx >= 0; idx = claim_queue()) {
+        _ref_processor.process_phase1(_refs_lists[idx], _policy,
+                                      &is_alive, &keep_alive, &complete_gc);
+      }
+      return;
+    }
     Thread* thr = Thread::current();
     int refs_list_index = ((WorkerThread*)thr)->id();
     _ref_processor.process_phase1(_refs_lists[refs_list_index], _policy,
@@ -759,6 +774,13 @@ public:
                     OopClosure& keep_alive,
                     VoidClosure& complete_gc)
   {
+    if (ParallelRefProcWorkStealing) {
+      for (int idx = claim_queue(); idx >= 0; idx = claim_queue()) {
+        _ref_processor.process_phase2(_refs_lists[idx],
+                                      &is_alive, &keep_alive, &complete_gc);
+      }
+      return;
+    }
     _ref_processor.process_phase2(_refs_lists[i],
                                   &is_alive, &keep_alive, &complete_gc);
   }
@@ -777,6 +799,13 @@ public:
                     OopClosure& keep_alive,
                     VoidClosure& complete_gc)
   {
+    if (ParallelRefProcWorkStealing) {
+      for (int idx = claim_queue(); idx >= 0; idx = claim_queue()) {
+        _ref_processor.process_phase3(_refs_lists[idx], _clear_referent,
+                                      &is_alive, &keep_alive, &complete_gc);
+      }
+      return;
+    }
     // Don't use "refs_list_index" calculated in this way because
     // balance_queues() has moved the Ref's into the first n queues.
     // Thread* thr = Thread::current();
@@ -801,8 +830,10 @@ void ReferenceProcessor::set_discovered(oop ref, oop value) {
 // Move entries from all queues[0, 1, ..., _max_num_q-1] to
 // queues[0, 1, ..., _num_q-1] because only the first _num_q
 // corresponding to the active workers will be processed.
-void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[])
+void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[],
+                                        uint n_queues)
 {
+  assert(n_queues > 0 && n_queues <= _max_num_q, "Sanity Check!");
   // calculate total length
   size_t total_refs = 0;
   if (TraceReferenceGC && PrintGCDetails) {
@@ -818,11 +849,11 @@ void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[])
   if (TraceReferenceGC && PrintGCDetails) {
     gclog_or_tty->print_cr(" = %d", total_refs);
   }
-  size_t avg_refs = total_refs / _num_q + 1;
+  size_t avg_refs = total_refs / n_queues + 1;
   uint to_idx = 0;
   for (uint from_idx = 0; from_idx < _max_num_q; from_idx++) {
     bool move_all = false;
-    if (from_idx >= _num_q) {
+    if (from_idx >= n_queues) {
       move_all = ref_lists[from_idx].length() > 0;
     }
     while ((ref_lists[from_idx].length() > avg_refs) ||
@@ -873,7 +904,7 @@ void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[])
           break;
         }
       } else {
-        to_idx = (to_idx + 1) % _num_q;
+        to_idx = (to_idx + 1) % n_queues;
       }
     }
   }
@@ -894,10 +925,10 @@ void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[])
 }
 
 void ReferenceProcessor::balance_all_queues() {
-  balance_queues(_discoveredSoftRefs);
-  balance_queues(_discoveredWeakRefs);
-  balance_queues(_discoveredFinalRefs);
-  balance_queues(_discoveredPhantomRefs);
+  balance_queues(_discoveredSoftRefs, _num_q);
+  balance_queues(_discoveredWeakRefs, _num_q);
+  balance_queues(_discoveredFinalRefs, _num_q);
+  balance_queues(_discoveredPhantomRefs, _num_q);
 }
 
 size_t
@@ -921,7 +952,17 @@ ReferenceProcessor::process_discovered_reflist(
 
   if ((mt_processing && ParallelRefProcBalancingEnabled) ||
       must_balance) {
-    balance_queues(refs_lists);
+    // With work stealing, over-partition the references into more lists
+    // than workers so that early finishers have something to claim; the
+    // per-list granularity then bounds the skew a single expensive list
+    // can cause.
+    uint balance_target = _num_q;
+    if (mt_processing && ParallelRefProcWorkStealing) {
+      balance_target = MIN2(_num_q * (uint) ParallelRefProcOverPartitionFactor,
+                            _max_num_q);
+      balance_target = MAX2(balance_target, _num_q);
+    }
+    balance_queues(refs_lists, balance_target);
   }
 
   size_t total_list_count = total_count(refs_lists);
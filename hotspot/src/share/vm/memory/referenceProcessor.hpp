@@ -414,7 +414,9 @@ class ReferenceProcessor : public CHeapObj<mtGC> {
   unsigned int count_jni_refs();
 
   // Balances reference queues.
-  void balance_queues(DiscoveredList ref_lists[]);
+  // Distribute the discovered references evenly over the first
+  // n_queues lists, by measured list lengths.
+  void balance_queues(DiscoveredList ref_lists[], uint n_queues);
 
   // Update (advance) the soft ref master clock field.
   void update_soft_ref_master_clock();
@@ -686,6 +688,7 @@ protected:
               bool                marks_oops_alive)
     : _ref_processor(ref_processor),
       _refs_lists(refs_lists),
+      _next_queue(0),
       _marks_oops_alive(marks_oops_alive)
   { }
 
@@ -698,9 +701,16 @@ public:
   bool marks_oops_alive() const
   { return _marks_oops_alive; }
 
+  // Claim the next unprocessed list index, or -1 when all lists have
+  // been claimed. With ParallelRefProcWorkStealing, workers loop on
+  // this instead of being bound to the list matching their worker id,
+  // so a worker that finishes a short list picks up another one.
+  int claim_queue();
+
 protected:
   ReferenceProcessor& _ref_processor;
   DiscoveredList*     _refs_lists;
+  volatile jint       _next_queue;
   const bool          _marks_oops_alive;
 };
 
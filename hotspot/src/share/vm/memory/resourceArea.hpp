@@ -136,12 +136,23 @@ protected:
   void reset_to_mark() {
     if (UseMallocOnly) free_malloced_objects();
 
-    if( _chunk->next() ) {       // Delete later chunks
-      // reset arena size before delete chunks. Otherwise, the total
+    if( _chunk->next() ) {       // Later chunks exist
+      // reset arena size before releasing chunks. Otherwise, the total
       // arena size could exceed total chunk size
-      assert(_area->size_in_bytes() > size_in_bytes(), "Sanity check");
+      assert(_area->size_in_bytes() >= size_in_bytes(), "Sanity check");
+      size_t tail = _area->size_in_bytes() - size_in_bytes();
       _area->set_size_in_bytes(size_in_bytes());
-      _chunk->next_chop();
+      if (ResourceAreaRetentionSize > 0 &&
+          _area->_retained_size + tail <= (size_t)ResourceAreaRetentionSize) {
+        // Keep the chunk chain attached; nested mark cycles on parsing-
+        // heavy threads climb right back to the same watermark, and
+        // Arena::grow() reuses the retained chunks in place instead of
+        // round-tripping them through the chunk pools.
+        _area->_retained_size += tail;
+      } else {
+        _area->_retained_size = 0;
+        _chunk->next_chop();
+      }
     } else {
       assert(_area->size_in_bytes() == size_in_bytes(), "Sanity check");
     }
@@ -239,12 +250,20 @@ protected:
   void reset_to_mark() {
     if (UseMallocOnly) free_malloced_objects();
 
-    if( _chunk->next() ) {        // Delete later chunks
-      // reset arena size before delete chunks. Otherwise, the total
+    if( _chunk->next() ) {        // Later chunks exist
+      // reset arena size before releasing chunks. Otherwise, the total
       // arena size could exceed total chunk size
-      assert(_area->size_in_bytes() > size_in_bytes(), "Sanity check");
+      assert(_area->size_in_bytes() >= size_in_bytes(), "Sanity check");
+      size_t tail = _area->size_in_bytes() - size_in_bytes();
       _area->set_size_in_bytes(size_in_bytes());
-      _chunk->next_chop();
+      if (ResourceAreaRetentionSize > 0 &&
+          _area->_retained_size + tail <= (size_t)ResourceAreaRetentionSize) {
+        // Same retention policy as ResourceMark::reset_to_mark() above.
+        _area->_retained_size += tail;
+      } else {
+        _area->_retained_size = 0;
+        _chunk->next_chop();
+      }
     } else {
       assert(_area->size_in_bytes() == size_in_bytes(), "Sanity check");
     }
@@ -80,13 +80,14 @@ void ThreadLocalAllocBuffer::accumulate_statistics() {
       // thread for use in the next resize operation.
       // _gc_waste is not subtracted because it's included in
       // "used".
-      size_t allocation = _number_of_refills * desired_size();
-      double alloc_frac = allocation / (double) used;
+      // The allocation is tracked separately from the refill count
+      // because the desired size may have changed between refills.
+      double alloc_frac = _allocated_size / (double) used;
       _allocation_fraction.sample(alloc_frac);
     }
     global_stats()->update_allocating_threads();
     global_stats()->update_number_of_refills(_number_of_refills);
-    global_stats()->update_allocation(_number_of_refills * desired_size());
+    global_stats()->update_allocation(_allocated_size);
     global_stats()->update_gc_waste(_gc_waste);
     global_stats()->update_slow_refill_waste(_slow_refill_waste);
     global_stats()->update_fast_refill_waste(_fast_refill_waste);
@@ -157,16 +158,53 @@ void ThreadLocalAllocBuffer::resize() {
 
 void ThreadLocalAllocBuffer::initialize_statistics() {
     _number_of_refills = 0;
+    _allocated_size    = 0;
     _fast_refill_waste = 0;
     _slow_refill_waste = 0;
     _gc_waste          = 0;
     _slow_allocations  = 0;
 }
 
+// Called at each refill. Once a thread has taken more refills in the
+// current epoch than the target for the whole epoch, its TLAB is too
+// small for the thread's current allocation phase; the fraction-based
+// resize only runs at the next GC, which can be a long way off for a
+// thread that has just shifted into an allocation-heavy phase. Double
+// the desired size instead of waiting, so the refill cadence converges
+// geometrically. The size is recomputed from the allocation fraction
+// at the next GC as usual, which also takes care of shrinking again.
+void ThreadLocalAllocBuffer::resize_on_excess_refills() {
+  if (_number_of_refills <= _target_refills) {
+    return;
+  }
+  size_t aligned_new_size =
+    align_object_size(MIN2(desired_size() * 2, max_size()));
+  if (aligned_new_size == desired_size()) {
+    return;
+  }
+
+  if (PrintTLAB && Verbose) {
+    gclog_or_tty->print("TLAB grow: thread: " INTPTR_FORMAT " [id: %2d]"
+                        " refills %d (target: %d) desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT "\n",
+                        myThread(), myThread()->osthread()->thread_id(),
+                        _number_of_refills, _target_refills,
+                        desired_size(), aligned_new_size);
+  }
+  set_desired_size(aligned_new_size);
+
+  set_refill_waste_limit(initial_refill_waste_limit());
+}
+
 void ThreadLocalAllocBuffer::fill(HeapWord* start,
                                   HeapWord* top,
                                   size_t    new_size) {
   _number_of_refills++;
+  _allocated_size += new_size;
+  // Track the allocation volume for the sampled JVMTI allocation event.
+  // Counting whole TLABs as they are handed out keeps the bookkeeping
+  // off the allocation fast path; the granularity error is at most one
+  // TLAB per sample.
+  _bytes_since_last_sample += new_size * HeapWordSize;
   if (PrintTLAB && Verbose) {
     print_stats("fill");
   }
@@ -175,6 +213,10 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
 
   // Reset amount of internal fragmentation
   set_refill_waste_limit(initial_refill_waste_limit());
+
+  if (ResizeTLAB && TLABResizeQuicker) {
+    resize_on_excess_refills();
+  }
 }
 
 void ThreadLocalAllocBuffer::initialize(HeapWord* start,
@@ -205,6 +247,8 @@ void ThreadLocalAllocBuffer::initialize() {
 
   set_refill_waste_limit(initial_refill_waste_limit());
 
+  reset_bytes_since_last_sample();
+
   initialize_statistics();
 }
 
@@ -268,7 +312,7 @@ const size_t ThreadLocalAllocBuffer::max_size() {
 void ThreadLocalAllocBuffer::print_stats(const char* tag) {
   Thread* thrd = myThread();
   size_t waste = _gc_waste + _slow_refill_waste + _fast_refill_waste;
-  size_t alloc = _number_of_refills * _desired_size;
+  size_t alloc = _allocated_size;
   double waste_percent = alloc == 0 ? 0.0 :
                       100.0 * waste / alloc;
   size_t tlab_used  = Universe::heap()->tlab_capacity(thrd) -
@@ -307,6 +351,50 @@ Thread* ThreadLocalAllocBuffer::myThread() {
                    in_bytes(Thread::tlab_start_offset()));
 }
 
+// Called from the GC.tlab_stats diagnostic command. The per-thread
+// counters are read without synchronization while their owners keep
+// allocating, so the report is a diagnostic snapshot, not an exact
+// accounting.
+void ThreadLocalAllocBuffer::print_waste_report(outputStream* st) {
+  ResourceMark rm;
+  MutexLocker ml(Threads_lock);
+  st->print_cr("Per-thread TLAB statistics since the last GC"
+               " (threads with no refills are omitted):");
+  unsigned total_refills = 0;
+  size_t total_allocation = 0;
+  size_t total_waste      = 0;
+  for (JavaThread* thread = Threads::first(); thread != NULL; thread = thread->next()) {
+    ThreadLocalAllocBuffer& tlab = thread->tlab();
+    if (tlab._number_of_refills == 0) {
+      continue;
+    }
+    size_t waste = tlab._gc_waste + tlab._slow_refill_waste + tlab._fast_refill_waste;
+    double waste_percent = tlab._allocated_size == 0 ? 0.0 :
+                           100.0 * waste / tlab._allocated_size;
+    st->print_cr("\"%s\" [id: %2d]"
+                 " desired_size: " SIZE_FORMAT "KB"
+                 " refills: %u  slow allocs: %u"
+                 " alloc: " SIZE_FORMAT "KB waste %4.1f%%"
+                 " (slow: " SIZE_FORMAT "B fast: " SIZE_FORMAT "B)",
+                 thread->get_thread_name(), thread->osthread()->thread_id(),
+                 tlab._desired_size / (K / HeapWordSize),
+                 tlab._number_of_refills, tlab._slow_allocations,
+                 tlab._allocated_size / (K / HeapWordSize),
+                 waste_percent,
+                 tlab._slow_refill_waste * (size_t)HeapWordSize,
+                 tlab._fast_refill_waste * (size_t)HeapWordSize);
+    total_refills    += tlab._number_of_refills;
+    total_allocation += tlab._allocated_size;
+    total_waste      += waste;
+  }
+  double total_waste_percent = total_allocation == 0 ? 0.0 :
+                               100.0 * total_waste / total_allocation;
+  st->print_cr("Total: refills: %u  alloc: " SIZE_FORMAT "KB waste %4.1f%%",
+               total_refills,
+               total_allocation / (K / HeapWordSize),
+               total_waste_percent);
+}
+
 
 GlobalTLABStats::GlobalTLABStats() :
   _allocating_threads_avg(TLABAllocationWeight) {
@@ -49,11 +49,20 @@ private:
   static unsigned _target_refills;               // expected number of refills between GCs
 
   unsigned  _number_of_refills;
+  size_t    _allocated_size;                     // words allocated in tlabs since last gc;
+                                                 // kept separately from _number_of_refills
+                                                 // because the desired size may change
+                                                 // between refills
   unsigned  _fast_refill_waste;
   unsigned  _slow_refill_waste;
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
 
+  size_t    _bytes_since_last_sample;            // bytes allocated since the last
+                                                 // sampled JVMTI allocation event;
+                                                 // only updated in the refill
+                                                 // slow path
+
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
   void accumulate_statistics();
@@ -79,6 +88,10 @@ private:
   // Resize based on amount of allocation, etc.
   void resize();
 
+  // Grow the desired size between GCs when refills outpace the
+  // per-epoch target (see fill()).
+  void resize_on_excess_refills();
+
   void invariants() const { assert(top() >= start() && top() <= end(), "invalid tlab"); }
 
   void initialize(HeapWord* start, HeapWord* top, HeapWord* end);
@@ -118,6 +131,10 @@ public:
   // Don't discard tlab if remaining space is larger than this.
   size_t refill_waste_limit() const              { return _refill_waste_limit; }
 
+  // Support for the sampled JVMTI allocation extension event.
+  size_t bytes_since_last_sample() const         { return _bytes_since_last_sample; }
+  void reset_bytes_since_last_sample()           { _bytes_since_last_sample = 0; }
+
   // Allocate size HeapWords. The memory is NOT initialized to zero.
   inline HeapWord* allocate(size_t size);
 
@@ -152,6 +169,9 @@ public:
   // Resize tlabs for all threads
   static void resize_all_tlabs();
 
+  // Per-thread waste report for the GC.tlab_stats diagnostic command
+  static void print_waste_report(outputStream* st);
+
   void fill(HeapWord* start, HeapWord* top, size_t new_size);
   void initialize();
 
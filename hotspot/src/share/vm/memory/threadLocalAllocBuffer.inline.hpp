@@ -91,6 +91,9 @@ void ThreadLocalAllocBuffer::record_slow_allocation(size_t obj_size) {
   set_refill_waste_limit(refill_waste_limit() + refill_waste_limit_increment());
 
   _slow_allocations++;
+  // Objects allocated outside the TLAB also count towards the sampled
+  // JVMTI allocation event.
+  _bytes_since_last_sample += obj_size * HeapWordSize;
 
   if (PrintTLAB && Verbose) {
     Thread* thrd = myThread();
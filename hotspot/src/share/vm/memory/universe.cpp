@@ -868,6 +868,12 @@ jint Universe::initialize_heap() {
     }
 
     if (verbose) {
+      // Estimated per-decode cost of the mode that was achieved, so a
+      // regression to a costlier mode is visible in the log.
+      tty->print(", decode cost: %s",
+                 (Universe::narrow_oop_base() != NULL) ? "add base + shift (base register reserved)" :
+                 (Universe::narrow_oop_shift() != 0)   ? "shift only"
+                                                       : "none (narrow oop is the address)");
       tty->cr();
       tty->cr();
     }
@@ -893,6 +899,46 @@ jint Universe::initialize_heap() {
 }
 
 
+// Probe a descending ladder of candidate bases for one compressed oops
+// mode.  'preferred' is the mode's best base, computed by
+// preferred_heap_base() so that the heap top sits against the mode's
+// encoding ceiling.  When the launcher or a randomized mmap layout has
+// already taken that spot, a lower base usually still fits the same mode
+// (a lower base only lowers the heap top), so try HeapPlacementProbes
+// evenly spaced bases down toward HeapBaseMinAddress before the caller
+// falls back to the next, costlier decode mode.
+static ReservedHeapSpace reserve_heap_probing(size_t total_reserved, size_t alignment,
+                                              bool use_large_pages, char* preferred) {
+  ReservedHeapSpace preferred_rs(total_reserved, alignment, use_large_pages, preferred);
+  if (preferred == NULL || preferred_rs.is_reserved() || HeapPlacementProbes == 0) {
+    return preferred_rs;
+  }
+  uintx min_base = align_size_up(HeapBaseMinAddress, alignment);
+  if ((uintptr_t)preferred <= min_base) {
+    return preferred_rs;
+  }
+  size_t range = (uintptr_t)preferred - min_base;
+  size_t step  = align_size_up(MAX2(range / (HeapPlacementProbes + 1), alignment), alignment);
+  for (uintx i = 1; i <= HeapPlacementProbes; i++) {
+    if ((uintptr_t)preferred < min_base + i * step) {
+      break;
+    }
+    char* candidate = preferred - i * step;
+    ReservedHeapSpace probe_rs(total_reserved, alignment, use_large_pages, candidate);
+    if (probe_rs.is_reserved()) {
+      if (PrintCompressedOopsMode || (PrintMiscellaneous && Verbose)) {
+        tty->print_cr("Preferred heap base " PTR_FORMAT " unavailable, "
+                      "probe %u/%u reserved at " PTR_FORMAT,
+                      preferred, (uint)i, (uint)HeapPlacementProbes, candidate);
+      }
+      return probe_rs;
+    }
+  }
+  // Hand the failed reservation at 'preferred' back so the caller moves
+  // on to the next mode.
+  return preferred_rs;
+}
+
 // Reserve the Java heap, which is now the same for all GCs.
 ReservedSpace Universe::reserve_heap(size_t heap_size, size_t alignment) {
   assert(alignment <= Arguments::conservative_max_heap_alignment(),
@@ -909,16 +955,17 @@ ReservedSpace Universe::reserve_heap(size_t heap_size, size_t alignment) {
 
   char* addr = Universe::preferred_heap_base(total_reserved, alignment, Universe::UnscaledNarrowOop);
 
-  ReservedHeapSpace total_rs(total_reserved, alignment, use_large_pages, addr);
+  ReservedHeapSpace total_rs = reserve_heap_probing(total_reserved, alignment, use_large_pages, addr);
 
   if (UseCompressedOops) {
     if (addr != NULL && !total_rs.is_reserved()) {
-      // Failed to reserve at specified address - the requested memory
-      // region is taken already, for example, by 'java' launcher.
+      // Failed to reserve at specified address and the probed
+      // alternatives - the low part of the address space is taken
+      // already, for example, by 'java' launcher.
       // Try again to reserver heap higher.
       addr = Universe::preferred_heap_base(total_reserved, alignment, Universe::ZeroBasedNarrowOop);
 
-      ReservedHeapSpace total_rs0(total_reserved, alignment,
+      ReservedHeapSpace total_rs0 = reserve_heap_probing(total_reserved, alignment,
           use_large_pages, addr);
 
       if (addr != NULL && !total_rs0.is_reserved()) {
@@ -1251,6 +1298,38 @@ void Universe::flush_evol_dependents_on(instanceKlassHandle ev_k_h) {
     CodeCache::make_marked_nmethods_not_entrant();
   }
 }
+
+// Flushes compiled methods dependent on the changed or deleted methods
+// of an evolving class. Compiled code whose evolution dependencies all
+// refer to methods that remained EMCP is left alone.
+void Universe::flush_evol_dependents_on(instanceKlassHandle ev_k_h,
+                                        GrowableArray<Method*>* changed_methods) {
+  // --- Compile_lock is not held. However we are at a safepoint.
+  assert_locked_or_safepoint(Compile_lock);
+  if (CodeCache::number_of_nmethods_with_dependencies() == 0) return;
+
+  // CodeCache can only be updated by a thread_in_VM and they will all be
+  // stopped dring the safepoint so CodeCache will be safe to update without
+  // holding the CodeCache_lock.
+
+  // Compute the dependent nmethods
+  if (CodeCache::mark_for_evol_deoptimization(ev_k_h, changed_methods) > 0) {
+    // At least one nmethod has been marked for deoptimization
+
+    // All this already happens inside a VM_Operation, so we'll do all the work here.
+    // Stuff copied from VM_Deoptimize and modified slightly.
+
+    // We do not want any GCs to happen while we are in the middle of this VM operation
+    ResourceMark rm;
+    DeoptimizationMarker dm;
+
+    // Deoptimize all activations depending on marked nmethods
+    Deoptimization::deoptimize_dependents();
+
+    // Make the dependent methods not entrant (in VM_Deoptimize they are made zombies)
+    CodeCache::make_marked_nmethods_not_entrant();
+  }
+}
 #endif // HOTSWAP
 
 
@@ -457,6 +457,10 @@ class Universe: AllStatic {
 #ifdef HOTSWAP
   // Flushing and deoptimization in case of evolution
   static void flush_evol_dependents_on(instanceKlassHandle dependee);
+  // As above, but restricted to the methods of dependee that were
+  // actually changed or deleted by the current redefinition
+  static void flush_evol_dependents_on(instanceKlassHandle dependee,
+                                       GrowableArray<Method*>* changed_methods);
 #endif // HOTSWAP
   // Support for fullspeed debugging
   static void flush_dependents_on_method(methodHandle dependee);
@@ -160,6 +160,49 @@ void ConstantPool::restore_unshareable_info(TRAPS) {
   }
 }
 
+// Resolve the JVM_CONSTANT_UnresolvedClass entries that name the pool
+// holder itself or one of its supertypes, so the archive carries them in
+// resolved form and first use at runtime skips the system dictionary.
+// This subset is safe to archive: the targets are themselves archived
+// (everything loaded at dump time is), resolve to the same class for any
+// run using the archive (shared classes are boot loader only), and are
+// guaranteed to be loaded before the holder's bytecodes can execute.
+// Access was already checked when the holder was loaded and linked.
+void ConstantPool::pre_resolve_shared_supertypes() {
+  assert(DumpSharedSpaces, "dump time only");
+  InstanceKlass* holder = InstanceKlass::cast(pool_holder());
+  for (int index = 1; index < length(); index++) {
+    if (!tag_at(index).is_unresolved_klass() ||
+        tag_at(index).is_unresolved_klass_in_error()) {
+      continue;
+    }
+    Symbol* name = unresolved_klass_at(index);
+    Klass* resolved = NULL;
+    if (name == holder->name()) {
+      resolved = holder;
+    } else {
+      for (Klass* s = holder->super(); s != NULL; s = s->super()) {
+        if (s->name() == name) {
+          resolved = s;
+          break;
+        }
+      }
+      if (resolved == NULL) {
+        Array<Klass*>* interfaces = holder->transitive_interfaces();
+        for (int i = 0; i < interfaces->length(); i++) {
+          if (interfaces->at(i)->name() == name) {
+            resolved = interfaces->at(i);
+            break;
+          }
+        }
+      }
+    }
+    if (resolved != NULL) {
+      klass_at_put(index, resolved);
+    }
+  }
+}
+
 void ConstantPool::remove_unshareable_info() {
   // Resolved references are not in the shared archive.
   // Save the length for restoration.  It is not necessarily the same length
@@ -375,6 +418,24 @@ Klass* ConstantPool::klass_ref_at_if_loaded(constantPoolHandle this_oop, int whi
 }
 
 
+// Eagerly resolve the JVM_CONSTANT_UnresolvedClass entries whose target
+// classes are already loaded and visible to the holder's loader, so the
+// first execution of a large class does not take one resolution stall per
+// class reference.  Entries whose targets are not loaded are left alone:
+// resolving them here would trigger class loading the program may never
+// need.  klass_at_if_loaded performs the access check, so the klass_at_impl
+// call below only fills in the resolved entry under the pool lock.
+void ConstantPool::eagerly_resolve_loaded_klasses(constantPoolHandle this_oop, TRAPS) {
+  for (int index = 1; index < this_oop->length(); index++) { // Index 0 is unused
+    if (this_oop->tag_at(index).is_unresolved_klass() &&
+        !this_oop->tag_at(index).is_unresolved_klass_in_error() &&
+        klass_at_if_loaded(this_oop, index) != NULL) {
+      klass_at_impl(this_oop, index, CHECK);
+    }
+  }
+}
+
+
 Method* ConstantPool::method_at_if_loaded(constantPoolHandle cpool,
                                                    int which) {
   if (cpool->cache() == NULL)  return NULL;  // nothing to load yet
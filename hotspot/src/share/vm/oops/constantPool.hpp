@@ -691,6 +691,7 @@ class ConstantPool : public Metadata {
   // CDS support
   void remove_unshareable_info();
   void restore_unshareable_info(TRAPS);
+  void pre_resolve_shared_supertypes();
   bool resolve_class_constants(TRAPS);
   // The ConstantPool vtable is restored by this call when the ConstantPool is
   // in the shared archive.  See patch_klass_vtables() in metaspaceShared.cpp for
@@ -755,6 +756,10 @@ class ConstantPool : public Metadata {
   static Klass*            klass_at_if_loaded      (constantPoolHandle this_oop, int which);
   static Klass*        klass_ref_at_if_loaded      (constantPoolHandle this_oop, int which);
 
+  // Used at link time when EagerResolveClassConstants is set: resolves the
+  // class entries whose targets are already loaded, never loads anything.
+  static void eagerly_resolve_loaded_klasses(constantPoolHandle this_oop, TRAPS);
+
   // Routines currently used for annotations (only called by jvm.cpp) but which might be used in the
   // future by other Java code. These take constant pool indices rather than
   // constant pool cache indices as do the peer methods above.
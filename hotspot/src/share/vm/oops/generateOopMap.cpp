@@ -222,17 +222,14 @@ void RetTableEntry::add_delta(int bci, int delta) {
   }
 }
 
-void RetTable::compute_ret_table(methodHandle method) {
-  BytecodeStream i(method);
-  Bytecodes::Code bytecode;
-
-  while( (bytecode = i.next()) >= 0) {
-    switch (bytecode) {
+void RetTable::compute_ret_table(const BytecodeTable* table) {
+  for (int i = 0; i < table->length(); i++) {
+    switch (table->code_at(i)) {
       case Bytecodes::_jsr:
-        add_jsr(i.next_bci(), i.dest());
+        add_jsr(table->next_bci_at(i), table->dest_at(i));
         break;
       case Bytecodes::_jsr_w:
-        add_jsr(i.next_bci(), i.dest_w());
+        add_jsr(table->next_bci_at(i), table->dest_w_at(i));
         break;
     }
   }
@@ -917,22 +914,19 @@ void GenerateOopMap::init_basic_blocks() {
 
   ALLOC_RESOURCE_ARRAY(_basic_blocks, BasicBlock, _bb_count);
 
-  // Make a pass through the bytecodes.  Count the number of monitorenters.
-  // This can be used an upper bound on the monitor stack depth in programs
-  // which obey stack discipline with their monitor usage.  Initialize the
-  // known information about basic blocks.
-  BytecodeStream j(_method);
-  Bytecodes::Code bytecode;
-
+  // Make a pass over the decoded bytecodes.  Count the number of
+  // monitorenters.  This can be used an upper bound on the monitor stack
+  // depth in programs which obey stack discipline with their monitor
+  // usage.  Initialize the known information about basic blocks.
   int bbNo = 0;
   int monitor_count = 0;
   int prev_bci = -1;
-  while( (bytecode = j.next()) >= 0) {
-    if (j.code() == Bytecodes::_monitorenter) {
+  for (int j = 0; j < _bc_table->length(); j++) {
+    if (_bc_table->code_at(j) == Bytecodes::_monitorenter) {
       monitor_count++;
     }
 
-    int bci = j.bci();
+    int bci = _bc_table->bci_at(j);
     if (is_bb_header(bci)) {
       // Initialize the basicblock structure
       BasicBlock *bb   = _basic_blocks + bbNo;
@@ -2080,6 +2074,7 @@ void GenerateOopMap::compute_map(TRAPS) {
   _report_result  = false;
   _report_result_for_send = false;
   _new_var_map    = NULL;
+  _bc_table       = NULL;
   _ret_adr_tos    = new GrowableArray<intptr_t>(5);  // 5 seems like a good number;
   _did_rewriting  = false;
   _did_relocation = false;
@@ -2104,9 +2099,13 @@ void GenerateOopMap::compute_map(TRAPS) {
     fill_stackmap_epilog();
     return;
   }
+  // Decode the bytecodes once; the passes below make several walks over
+  // the method and can iterate the table instead of re-decoding.
+  _bc_table = new BytecodeTable(_method);
+
   // Step 1: Compute all jump targets and their return value
   if (!_got_error)
-    _rt.compute_ret_table(_method);
+    _rt.compute_ret_table(_bc_table);
 
   // Step 2: Find all basic blocks and count GC points
   if (!_got_error)
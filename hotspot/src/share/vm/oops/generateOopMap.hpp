@@ -78,7 +78,7 @@ class RetTable VALUE_OBJ_CLASS_SPEC {
   void add_jsr(int return_bci, int target_bci);   // Adds entry to list
  public:
   RetTable()                                                  { _first = NULL; }
-  void compute_ret_table(methodHandle method);
+  void compute_ret_table(const BytecodeTable* table);
   void update_ret_table(int bci, int delta);
   RetTableEntry* find_jsrs_for_target(int targBci);
 };
@@ -297,6 +297,7 @@ class GenerateOopMap VALUE_OBJ_CLASS_SPEC {
   // Main variables
   methodHandle _method;                     // The method we are examine
   RetTable     _rt;                         // Contains the return address mappings
+  BytecodeTable* _bc_table;                 // Decode-once view of the bytecodes
   int          _max_locals;                 // Cached value of no. of locals
   int          _max_stack;                  // Cached value of max. stack depth
   int          _max_monitors;               // Cached value of max. monitor stack depth
@@ -260,6 +260,7 @@ InstanceKlass::InstanceKlass(int vtable_len,
 
   set_vtable_length(vtable_len);
   set_itable_length(itable_len);
+  set_itable_lookup_hint(0);
   set_static_field_size(static_field_size);
   set_nonstatic_oop_map_size(nonstatic_oop_map_size);
   set_access_flags(access_flags);
@@ -725,6 +726,14 @@ bool InstanceKlass::link_class_impl(
       }
     }
   }
+  // Optionally resolve the constant pool class entries whose targets are
+  // already loaded, so first execution does not stall on serial resolution.
+  // Shared classes are skipped: their pools are pre-resolved at dump time
+  // and must not diverge from the archived state.
+  if (EagerResolveClassConstants && !this_oop()->is_shared()) {
+    constantPoolHandle cp(THREAD, this_oop->constants());
+    ConstantPool::eagerly_resolve_loaded_klasses(cp, CHECK_false);
+  }
   return true;
 }
 
@@ -1206,7 +1215,7 @@ void InstanceKlass::mask_for(methodHandle method, int bci,
       _oop_map_cache = new OopMapCache();
     }
   }
-  // _oop_map_cache is constant after init; lookup below does is own locking.
+  // _oop_map_cache is constant after init; lookup below is lock free.
   _oop_map_cache->lookup(method, bci, entry_for);
 }
 
@@ -2661,15 +2670,27 @@ Method* InstanceKlass::method_at_itable(Klass* holder, int index, TRAPS) {
   int nof_interfaces = (method_table_offset_in_words - itable_offset_in_words())
                        / itableOffsetEntry::size();
 
-  for (int cnt = 0 ; ; cnt ++, ioe ++) {
-    // If the interface isn't implemented by the receiver class,
-    // the VM should throw IncompatibleClassChangeError.
-    if (cnt >= nof_interfaces) {
-      THROW_NULL(vmSymbols::java_lang_IncompatibleClassChangeError());
-    }
+  // The hint remembers which offset entry the last lookup on this klass
+  // matched, so call sites that keep asking for the same interface (the
+  // common megamorphic shape: many receiver classes, one interface) skip
+  // the scan.  A concurrently updated hint at worst fails the interface
+  // compare below and we fall back to the scan.
+  int hint = itable_lookup_hint();
+  itableOffsetEntry* hinted = (itableOffsetEntry*)((address)this + hint);
+  if (hint != 0 && hinted->interface_klass() == holder) {
+    ioe = hinted;
+  } else {
+    for (int cnt = 0 ; ; cnt ++, ioe ++) {
+      // If the interface isn't implemented by the receiver class,
+      // the VM should throw IncompatibleClassChangeError.
+      if (cnt >= nof_interfaces) {
+        THROW_NULL(vmSymbols::java_lang_IncompatibleClassChangeError());
+      }
 
-    Klass* ik = ioe->interface_klass();
-    if (ik == holder) break;
+      Klass* ik = ioe->interface_klass();
+      if (ik == holder) break;
+    }
+    set_itable_lookup_hint((int)((address)ioe - (address)this));
   }
 
   itableMethodEntry* ime = ioe->first_method_entry(this);
@@ -2723,11 +2744,27 @@ void InstanceKlass::add_osr_nmethod(nmethod* n) {
   // This is a short non-blocking critical region, so the no safepoint check is ok.
   OsrList_lock->lock_without_safepoint_check();
   assert(n->is_osr_method(), "wrong kind of nmethod");
-  n->set_osr_link(osr_nmethods_head());
-  set_osr_nmethods_head(n);
+  // Keep all entries for the same method adjacent, so that searches can
+  // stop at the end of a method's group instead of walking the whole
+  // list of the klass. This lookup runs on every backedge counter
+  // overflow of an interpreted or limited-profile loop, so repeated OSR
+  // requests should not pay for the OSR nmethods of unrelated methods.
+  Method* m = n->method();
+  nmethod* prev = NULL;
+  nmethod* group = osr_nmethods_head();
+  while (group != NULL && group->method() != m) {
+    prev = group;
+    group = group->osr_link();
+  }
+  if (prev == NULL) {
+    n->set_osr_link(osr_nmethods_head());
+    set_osr_nmethods_head(n);
+  } else {
+    n->set_osr_link(group);
+    prev->set_osr_link(n);
+  }
   // Raise the highest osr level if necessary
   if (TieredCompilation) {
-    Method* m = n->method();
     m->set_highest_osr_comp_level(MAX2(m->highest_osr_comp_level(), n->comp_level()));
   }
   // Remember to unlock again
@@ -2755,8 +2792,9 @@ void InstanceKlass::remove_osr_nmethod(nmethod* n) {
   Method* m = n->method();
   // Search for match
   while(cur != NULL && cur != n) {
-    if (TieredCompilation) {
-      // Find max level before n
+    if (TieredCompilation && cur->method() == m) {
+      // Find max level of m before n; entries of other methods do not
+      // contribute to m's highest osr level.
       max_level = MAX2(max_level, cur->comp_level());
     }
     last = cur;
@@ -2775,7 +2813,9 @@ void InstanceKlass::remove_osr_nmethod(nmethod* n) {
   n->set_osr_link(NULL);
   if (TieredCompilation) {
     cur = next;
-    while (cur != NULL) {
+    // Entries for one method are adjacent (see add_osr_nmethod), so m's
+    // remaining entries, if any, immediately follow the removed one.
+    while (cur != NULL && cur->method() == m) {
       // Find max level after n
       max_level = MAX2(max_level, cur->comp_level());
       cur = cur->osr_link();
@@ -2791,16 +2831,26 @@ nmethod* InstanceKlass::lookup_osr_nmethod(const Method* m, int bci, int comp_le
   OsrList_lock->lock_without_safepoint_check();
   nmethod* osr = osr_nmethods_head();
   nmethod* best = NULL;
+  bool found_method = false;
   while (osr != NULL) {
     assert(osr->is_osr_method(), "wrong kind of nmethod found in chain");
+    if (osr->method() != m) {
+      if (found_method) {
+        // Entries for one method are adjacent (see add_osr_nmethod), so
+        // the search is over at the end of the method's group.
+        break;
+      }
+      osr = osr->osr_link();
+      continue;
+    }
+    found_method = true;
     // There can be a time when a c1 osr method exists but we are waiting
     // for a c2 version. When c2 completes its osr nmethod we will trash
     // the c1 version and only be able to find the c2 version. However
     // while we overflow in the c1 code at back branches we don't want to
     // try and switch to the same code as we are already running
 
-    if (osr->method() == m &&
-        (bci == InvocationEntryBci || osr->osr_entry_bci() == bci)) {
+    if (bci == InvocationEntryBci || osr->osr_entry_bci() == bci) {
       if (match_level) {
         if (osr->comp_level() == comp_level) {
           // Found a match - return it.
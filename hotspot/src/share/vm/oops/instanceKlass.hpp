@@ -241,6 +241,8 @@ class InstanceKlass: public Klass {
   Thread*         _init_thread;          // Pointer to current thread doing initialization (to handle recusive initialization)
   int             _vtable_len;           // length of Java vtable (in words)
   int             _itable_len;           // length of Java itable (in words)
+  int             _itable_lookup_hint;   // byte offset from this klass of the itableOffsetEntry
+                                         // matched by the most recent itable lookup (0 = none yet)
   OopMapCache*    volatile _oop_map_cache;   // OopMapCache for all methods in the klass (allocated lazily)
   MemberNameTable* _member_names;        // Member names
   JNIid*          _jni_ids;              // First JNI identifier for static fields in this class
@@ -348,6 +350,15 @@ class InstanceKlass: public Klass {
   int  itable_length() const               { return _itable_len; }
   void set_itable_length(int len)          { _itable_len = len; }
 
+  // One-entry memo of the last successful itable lookup on this klass.  The
+  // hint is only ever set to the byte offset of a real itableOffsetEntry of
+  // this itable, so readers validate it simply by comparing the hinted
+  // entry's interface against the one they are looking for; a stale value
+  // fails that compare and the lookup falls back to the scan.
+  int  itable_lookup_hint() const          { return _itable_lookup_hint; }
+  void set_itable_lookup_hint(int offset)  { _itable_lookup_hint = offset; }
+  static ByteSize itable_lookup_hint_offset() { return in_ByteSize(offset_of(InstanceKlass, _itable_lookup_hint)); }
+
   // array klasses
   Klass* array_klasses() const             { return _array_klasses; }
   void set_array_klasses(Klass* k)         { _array_klasses = k; }
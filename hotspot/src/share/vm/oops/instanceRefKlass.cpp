@@ -249,6 +249,47 @@ int InstanceRefKlass::oop_adjust_pointers(oop obj) {
   }                                                                             \
                                                                                 \
   T* referent_addr = (T*)java_lang_ref_Reference::referent_addr(obj);           \
+  T* next_addr = (T*)java_lang_ref_Reference::next_addr(obj);                   \
+  T next_oop  = oopDesc::load_heap_oop(next_addr);                              \
+  if (!oopDesc::is_null(next_oop)) {                                            \
+    /* Ref is not "active": it can never be (re)discovered, so skip the     */  \
+    /* discovery test and the referent mark check and treat all fields as   */  \
+    /* normal oops.  A ref never goes back from inactive to active, so the  */  \
+    /* early load of next is safe even under concurrent marking.            */  \
+    T heap_oop = oopDesc::load_heap_oop(referent_addr);                         \
+    if (!oopDesc::is_null(heap_oop) && contains(referent_addr)) {               \
+      SpecializationStats::record_do_oop_call##nv_suffix(SpecializationStats::irk);\
+      closure->do_oop##nv_suffix(referent_addr);                                \
+    }                                                                           \
+    if (ReferenceProcessor::pending_list_uses_discovered_field()) {             \
+      if (contains(disc_addr)) {                                                \
+        debug_only(                                                             \
+          if(TraceReferenceGC && PrintGCDetails) {                              \
+            gclog_or_tty->print_cr("   Process discovered as normal "           \
+                                   INTPTR_FORMAT, disc_addr);                   \
+          }                                                                     \
+        )                                                                       \
+        SpecializationStats::record_do_oop_call##nv_suffix(SpecializationStats::irk);\
+        closure->do_oop##nv_suffix(disc_addr);                                  \
+      }                                                                         \
+    } else {                                                                    \
+      /* In the case of older JDKs which do not use the discovered field for */ \
+      /* the pending list, an inactive ref (next != NULL) must always have a */ \
+      /* NULL discovered field. */                                              \
+      debug_only(                                                               \
+        T disc_oop = oopDesc::load_heap_oop(disc_addr);                         \
+        assert(oopDesc::is_null(disc_oop),                                      \
+             err_msg("Found an inactive reference " PTR_FORMAT " with a non-NULL" \
+                     "discovered field", (oopDesc*)obj));                       \
+      )                                                                         \
+    }                                                                           \
+    if (contains(next_addr)) {                                                  \
+      SpecializationStats::record_do_oop_call##nv_suffix(SpecializationStats::irk); \
+      closure->do_oop##nv_suffix(next_addr);                                    \
+    }                                                                           \
+    return size;                                                                \
+  }                                                                             \
+  /* Ref is "active": run the discovery protocol on the referent. */            \
   T heap_oop = oopDesc::load_heap_oop(referent_addr);                           \
   ReferenceProcessor* rp = closure->_ref_processor;                             \
   if (!oopDesc::is_null(heap_oop)) {                                            \
@@ -262,33 +303,6 @@ int InstanceRefKlass::oop_adjust_pointers(oop obj) {
       closure->do_oop##nv_suffix(referent_addr);                                \
     }                                                                           \
   }                                                                             \
-  T* next_addr = (T*)java_lang_ref_Reference::next_addr(obj);                   \
-  if (ReferenceProcessor::pending_list_uses_discovered_field()) {               \
-    T next_oop  = oopDesc::load_heap_oop(next_addr);                            \
-    /* Treat discovered as normal oop, if ref is not "active" (next non-NULL) */\
-    if (!oopDesc::is_null(next_oop) && contains(disc_addr)) {                   \
-        /* i.e. ref is not "active" */                                          \
-      debug_only(                                                               \
-        if(TraceReferenceGC && PrintGCDetails) {                                \
-          gclog_or_tty->print_cr("   Process discovered as normal "             \
-                                 INTPTR_FORMAT, disc_addr);                     \
-        }                                                                       \
-      )                                                                         \
-      SpecializationStats::record_do_oop_call##nv_suffix(SpecializationStats::irk);\
-      closure->do_oop##nv_suffix(disc_addr);                                    \
-    }                                                                           \
-  } else {                                                                      \
-    /* In the case of older JDKs which do not use the discovered field for  */  \
-    /* the pending list, an inactive ref (next != NULL) must always have a  */  \
-    /* NULL discovered field. */                                                \
-    debug_only(                                                                 \
-      T next_oop = oopDesc::load_heap_oop(next_addr);                           \
-      T disc_oop = oopDesc::load_heap_oop(disc_addr);                           \
-      assert(oopDesc::is_null(next_oop) || oopDesc::is_null(disc_oop),          \
-           err_msg("Found an inactive reference " PTR_FORMAT " with a non-NULL" \
-                   "discovered field", (oopDesc*)obj));                                   \
-    )                                                                           \
-  }                                                                             \
   /* treat next as normal oop */                                                \
   if (contains(next_addr)) {                                                    \
     SpecializationStats::record_do_oop_call##nv_suffix(SpecializationStats::irk); \
@@ -64,6 +64,27 @@ bool Klass::is_subclass_of(const Klass* k) const {
   return false;
 }
 
+void Klass::set_secondary_supers(Array<Klass*>* k) {
+  _secondary_supers = k;
+  // Precompute the hash filter consulted before any scan of the list.
+  // During bootstrapping the shared array-interfaces list is installed
+  // before its entries are patched in (see Universe::genesis); a list
+  // with still-NULL entries gets an all-ones filter, which merely
+  // disables the shortcut for the few klasses set up that early.
+  uintx bitmap = 0;
+  if (k != NULL) {
+    for (int i = 0; i < k->length(); i++) {
+      Klass* s = k->at(i);
+      if (s == NULL) {
+        bitmap = ~(uintx)0;
+        break;
+      }
+      bitmap |= secondary_supers_bitmap_bit(s);
+    }
+  }
+  _secondary_supers_bitmap = bitmap;
+}
+
 bool Klass::search_secondary_supers(Klass* k) const {
   // Put some extra logic here out-of-line, before the search proper.
   // This cuts down the size of the inline method.
@@ -71,6 +92,11 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+  // A clear filter bit proves k is not on the list; this ends most
+  // failing checks, which the secondary super cache never helps with
+  // because only successes are cached.
+  if ((_secondary_supers_bitmap & secondary_supers_bitmap_bit(k)) == 0)
+    return false;
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
@@ -143,6 +143,10 @@ class Klass : public Metadata {
   Klass*      _secondary_super_cache;
   // Array of all secondary supertypes
   Array<Klass*>* _secondary_supers;
+  // One-word hash filter over _secondary_supers: the bit for each listed
+  // klass's hash is set, so a clear bit proves a klass is not on the list
+  // without scanning it.  See search_secondary_supers.
+  uintx       _secondary_supers_bitmap;
   // Ordered list of all primary supertypes
   Klass*      _primary_supers[_primary_super_limit];
   // java/lang/Class instance mirroring this class
@@ -206,7 +210,15 @@ class Klass : public Metadata {
   void set_secondary_super_cache(Klass* k) { _secondary_super_cache = k; }
 
   Array<Klass*>* secondary_supers() const { return _secondary_supers; }
-  void set_secondary_supers(Array<Klass*>* k) { _secondary_supers = k; }
+  void set_secondary_supers(Array<Klass*>* k);  // also recomputes the hash filter
+
+  // Hashing scheme of the secondary-supers filter word.  The shift is
+  // mirrored by the subtype-check stubs, which rely on the hardware
+  // taking the shift count modulo the word size in place of the mask.
+  enum { _secondary_supers_bitmap_shift = 6 };
+  static uintx secondary_supers_bitmap_bit(const Klass* k) {
+    return (uintx)1 << (((uintptr_t)k >> _secondary_supers_bitmap_shift) & (BitsPerWord - 1));
+  }
 
   // Return the element of the _super chain of the given depth.
   // If there is no such element, return either NULL or this.
@@ -294,6 +306,7 @@ class Klass : public Metadata {
   static ByteSize primary_supers_offset()        { return in_ByteSize(offset_of(Klass, _primary_supers)); }
   static ByteSize secondary_super_cache_offset() { return in_ByteSize(offset_of(Klass, _secondary_super_cache)); }
   static ByteSize secondary_supers_offset()      { return in_ByteSize(offset_of(Klass, _secondary_supers)); }
+  static ByteSize secondary_supers_bitmap_offset() { return in_ByteSize(offset_of(Klass, _secondary_supers_bitmap)); }
   static ByteSize java_mirror_offset()           { return in_ByteSize(offset_of(Klass, _java_mirror)); }
   static ByteSize modifier_flags_offset()        { return in_ByteSize(offset_of(Klass, _modifier_flags)); }
   static ByteSize layout_helper_offset()         { return in_ByteSize(offset_of(Klass, _layout_helper)); }
@@ -553,9 +553,19 @@ bool Method::is_accessor() const {
   if (size_of_parameters() != 1) return false;
   if (java_code_at(0) != Bytecodes::_aload_0 ) return false;
   if (java_code_at(1) != Bytecodes::_getfield) return false;
-  if (java_code_at(4) != Bytecodes::_areturn &&
-      java_code_at(4) != Bytecodes::_ireturn ) return false;
-  return true;
+  switch (java_code_at(4)) {
+    case Bytecodes::_ireturn:
+    case Bytecodes::_areturn:
+    case Bytecodes::_lreturn:
+    case Bytecodes::_freturn:
+    case Bytecodes::_dreturn:
+      // The accessor entry points handle the wide results where the
+      // return convention allows and fall back to the normal entry
+      // where it does not.
+      return true;
+    default:
+      return false;
+  }
 }
 
 
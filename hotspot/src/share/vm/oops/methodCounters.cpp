@@ -29,6 +29,28 @@ MethodCounters* MethodCounters::allocate(ClassLoaderData* loader_data, TRAPS) {
   return new(loader_data, size(), false, MetaspaceObj::MethodCountersType, THREAD) MethodCounters();
 }
 
+// Lossy prefilter used to defer MethodCounters allocation.  Entries are
+// small saturating counters hashed by Method*; increments are done
+// without atomics on purpose.  A lost update merely delays allocation by
+// one more slow-path visit, and a hash collision only makes the counters
+// appear earlier - neither affects correctness, since methods without
+// counters simply are not counted toward compilation yet.
+static const int pre_count_table_size = 1024;   // must be a power of two
+static jint _pre_counts[pre_count_table_size];
+
+bool MethodCounters::defer_allocation(const Method* m) {
+  if (MethodCountersDeferredCount <= 0) {
+    return false;
+  }
+  int index = (int)(((uintptr_t)m >> 3) & (pre_count_table_size - 1));
+  jint count = _pre_counts[index];
+  if (count >= MethodCountersDeferredCount) {
+    return false;
+  }
+  _pre_counts[index] = count + 1;
+  return true;
+}
+
 void MethodCounters::clear_counters() {
   invocation_counter()->reset();
   backedge_counter()->reset();
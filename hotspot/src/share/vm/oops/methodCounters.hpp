@@ -28,6 +28,8 @@
 #include "oops/metadata.hpp"
 #include "interpreter/invocationCounter.hpp"
 
+class Method;
+
 class MethodCounters: public MetaspaceObj {
  friend class VMStructs;
  private:
@@ -57,6 +59,12 @@ class MethodCounters: public MetaspaceObj {
  public:
   static MethodCounters* allocate(ClassLoaderData* loader_data, TRAPS);
 
+  // Returns true while allocation for m should still be deferred.  The
+  // interpreter keeps running a method without MethodCounters until this
+  // prefilter has seen it MethodCountersDeferredCount times, so methods
+  // that only ever execute a few times never pay for a counters object.
+  static bool defer_allocation(const Method* m);
+
   void deallocate_contents(ClassLoaderData* loader_data) {}
   DEBUG_ONLY(bool on_stack() { return false; })  // for template
 
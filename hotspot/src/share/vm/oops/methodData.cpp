@@ -972,6 +972,19 @@ ProfileData* MethodData::next_data(ProfileData* current) const {
   return next;
 }
 
+// Halve the receiver type rows of every virtual call and type check
+// profile.  Called during counter decay so dominant receivers that
+// changed after a program phase change are re-learned over time.
+void MethodData::decay_receiver_type_profile() {
+  ResourceMark rm;
+  ProfileData* data;
+  for (data = first_data(); is_valid(data); data = next_data(data)) {
+    if (data->is_ReceiverTypeData()) {
+      data->as_ReceiverTypeData()->decay_row_counts();
+    }
+  }
+}
+
 // Give each of the data entries a chance to perform specific
 // data initialization.
 void MethodData::post_initialize(BytecodeStream* stream) {
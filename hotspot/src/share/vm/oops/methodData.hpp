@@ -1142,6 +1142,20 @@ public:
     set_receiver_count(row, 0);
   }
 
+  // Halve all row counts and free rows whose count has decayed to zero,
+  // so a dominant receiver that changed after a program phase change
+  // can be re-learned (see clear_row above for why this is safe).
+  void decay_row_counts() {
+    for (uint row = 0; row < row_limit(); row++) {
+      uint count = receiver_count(row) / 2;
+      if (count == 0 && receiver(row) != NULL) {
+        clear_row(row);
+      } else {
+        set_receiver_count(row, count);
+      }
+    }
+  }
+
   // Code generation support
   static ByteSize receiver_offset(uint row) {
     return cell_offset(receiver_cell_index(row));
@@ -1828,12 +1842,20 @@ private:
   // These counters are used to determine the exact age of MDO.
   // We need those because in tiered a method can be concurrently
   // executed at different levels.
+  // Compiled code at tiers 2 and 3 increments them racily on every
+  // invocation and backedge, so for a hot method they are by far the
+  // most written cells of the MDO. Sequester them on their own cache
+  // line; otherwise the coherence traffic they generate also evicts
+  // the read-mostly fields around them and the first profile cells
+  // in _data from every other core's cache.
+  char              _pad_before_counters[DEFAULT_CACHE_LINE_SIZE];
   InvocationCounter _invocation_counter;
   // Same for backedges.
   InvocationCounter _backedge_counter;
   // Counter values at the time profiling started.
   int               _invocation_counter_start;
   int               _backedge_counter_start;
+  char              _pad_after_counters[DEFAULT_CACHE_LINE_SIZE];
   // Number of loops and blocks is computed when compiling the first
   // time with C1. It is used to determine if method is trivial.
   short             _num_loops;
@@ -2055,6 +2077,9 @@ public:
   ProfileData* next_data(ProfileData* current) const;
   bool is_valid(ProfileData* current) const { return current != NULL; }
 
+  // Decay the receiver type rows of all profiled call sites.
+  void decay_receiver_type_profile();
+
   // Convert a dp (data pointer) to a di (data index).
   int dp_to_di(address dp) const {
     return dp - ((address)_data);
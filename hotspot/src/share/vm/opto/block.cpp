@@ -1297,6 +1297,59 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
   }
 }
 
+// Break maximal runs of uncommon blocks out of the traces that contain
+// them, giving each run a trace of its own.  When the traces are sorted by
+// frequency in reorder_traces(), the cold code then sinks to the end of the
+// method behind all of the hot traces, instead of sitting between two hot
+// blocks and occupying i-cache lines on the fall-through path.  The block
+// frequencies driving is_uncommon() are seeded from the branch counts the
+// interpreter collected in the MethodData, so on profiled code this amounts
+// to profile-guided hot/cold placement.  fixup_flow() later supplies the
+// jumps into and around the blocks which no longer fall through.
+void PhaseBlockLayout::split_cold_paths(int count) {
+  for (int i = 0; i < count; i++) {
+    Trace *tr = traces[i];
+    if (tr == NULL) continue;
+
+    Block *first = tr->first_block();
+
+    // The trace of connector blocks stays as it is, and a trace that
+    // already starts cold (including the runs split off below) sinks as a
+    // whole in reorder_traces().  The latter test also keeps this loop
+    // from re-splitting the traces it creates.
+    if (first->is_connector() || _cfg.is_uncommon(first)) continue;
+
+    Block *b = tr->next(first);
+    while (b != NULL) {
+      if (b->is_connector() || !_cfg.is_uncommon(b)) {
+        b = tr->next(b);
+        continue;
+      }
+
+      // Found the start of a cold run; look for its end.
+      Block *e = b;
+      bool holds_trace_id = (b->_pre_order == tr->id());
+      while (tr->next(e) != NULL &&
+             !tr->next(e)->is_connector() &&
+             _cfg.is_uncommon(tr->next(e))) {
+        e = tr->next(e);
+        holds_trace_id = holds_trace_id || (e->_pre_order == tr->id());
+      }
+      Block *next_b = tr->next(e);
+
+      // A trace is identified by the pre_order of one of its blocks.  If
+      // that block is part of the run, leave the run in place so that the
+      // trace keeps its slot in the trace list.
+      if (!holds_trace_id) {
+        Trace *cold = tr->split_out(b, e);
+        assert(traces[cold->id()] == NULL, "trace slot already in use");
+        traces[cold->id()] = cold;
+      }
+      b = next_b;
+    }
+  }
+}
+
 // Order the sequence of the traces in some desirable way, and fixup the
 // jumps at the end of each block.
 void PhaseBlockLayout::reorder_traces(int count) {
@@ -1368,6 +1421,12 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   // related traces to be near each other.
   merge_traces(false);
 
+  // Move cold paths out of the hot traces so that they end up behind all
+  // of the hot code once the traces are re-ordered.
+  if (BlockLayoutSplitColdPaths) {
+    split_cold_paths(size);
+  }
+
   // Re-order all the remaining traces by frequency
   reorder_traces(size);
 
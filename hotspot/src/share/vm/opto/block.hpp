@@ -759,6 +759,7 @@ class CFGEdge : public ResourceObj {
 //-----------------------------------Trace-------------------------------------
 // An ordered list of basic blocks.
 class Trace : public ResourceObj {
+  friend class PhaseBlockLayout;
  private:
   uint _id;             // Unique Trace id (derived from initial block)
   Block ** _next_list;  // Array mapping index to next block
@@ -795,6 +796,18 @@ class Trace : public ResourceObj {
     set_prev(b, NULL);
   };
 
+  // Wrap an already linked run of blocks, detached from another trace,
+  // in a trace of its own.
+  Trace(Block *b, Block *e, Block **next_list, Block **prev_list) :
+    _first(b),
+    _last(e),
+    _next_list(next_list),
+    _prev_list(prev_list),
+    _id(b->_pre_order) {
+    set_next(e, NULL);
+    set_prev(b, NULL);
+  };
+
   // Return the id number
   uint id() const { return _id; }
   void set_id(uint id) { _id = id; }
@@ -838,6 +851,22 @@ class Trace : public ResourceObj {
     _last = b;
   }
 
+  // Detach the blocks from "b" through "e" from this trace, reconnecting
+  // their former neighbors, and return the run as a new trace.  "b" must
+  // not be the first block of the trace.
+  Trace* split_out(Block *b, Block *e) {
+    Block *p = prev(b);
+    Block *n = next(e);
+    assert(p != NULL, "cannot split off the head of a trace");
+    set_next(p, n);
+    if (n != NULL) {
+      set_prev(n, p);
+    } else {
+      _last = p;
+    }
+    return new Trace(b, e, _next_list, _prev_list);
+  }
+
   // Adjust the the blocks in this trace
   void fixup_blocks(PhaseCFG &cfg);
   bool backedge(CFGEdge *e);
@@ -869,6 +898,7 @@ class PhaseBlockLayout : public Phase {
   void find_edges();
   void grow_traces();
   void merge_traces(bool loose_connections);
+  void split_cold_paths(int count);
   void reorder_traces(int count);
   void union_traces(Trace* from, Trace* to);
 };
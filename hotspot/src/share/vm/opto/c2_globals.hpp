@@ -186,6 +186,13 @@
           "Minimum number of unroll loop bodies before checking progress"   \
           "of rounds of unroll,optimize,..")                                \
                                                                             \
+  product(bool, UseCountedLoopSafepoints, false,                            \
+          "Force counted loops to keep a safepoint on the backedge")        \
+                                                                            \
+  product(intx, CountedLoopSafepointTripLimit, 1024,                        \
+          "Constant trip count below which a counted loop still drops "     \
+          "its safepoint when UseCountedLoopSafepoints is enabled")         \
+                                                                            \
   develop(intx, UnrollLimitForProfileCheck, 1,                              \
           "Don't use profile_trip_cnt() to restrict unrolling until "       \
           "unrolling would push the number of unrolled iterations above "   \
@@ -229,6 +236,13 @@
   develop(bool, TraceOptimizeFill, false,                                   \
           "print detailed information about fill conversion")               \
                                                                             \
+  diagnostic(bool, PrintIdealLoopNodeCounts, false,                         \
+          "Print live node counts after each pass of loop optimizations")   \
+                                                                            \
+  product(bool, HoistPureCalls, false,                                      \
+          "Hoist loop-invariant calls to known-pure methods out of "        \
+          "counted loops")                                                  \
+                                                                            \
   develop(bool, OptoCoalesce, true,                                         \
           "Use Conservative Copy Coalescing in the Register Allocator")     \
                                                                             \
@@ -253,6 +267,14 @@
   product(bool, UseFPUForSpilling, false,                                   \
           "Spill integer registers to FPU instead of stack when possible")  \
                                                                             \
+  product(bool, SplitSpillsByFrequency, true,                               \
+          "Place live range split copies on the colder control flow "       \
+          "edges when the reaching defs at a merge disagree")               \
+                                                                            \
+  diagnostic(bool, PrintHotLoopSpills, false,                               \
+          "Report per method the spill copies that ended up in "            \
+          "frequently executed loop blocks")                                \
+                                                                            \
   develop_pd(intx, RegisterCostAreaRatio,                                   \
           "Spill selection in reg allocator: scale area by (X/64K) before " \
           "adding cost")                                                    \
@@ -314,6 +336,9 @@
   develop(bool, SuperWordRTDepCheck, false,                                 \
           "Enable runtime dependency checks.")                              \
                                                                             \
+  product(bool, SuperWordReductions, true,                                  \
+          "Enable reductions support in superword.")                        \
+                                                                            \
   notproduct(bool, TraceSuperWord, false,                                   \
           "Trace superword transforms")                                     \
                                                                             \
@@ -359,6 +384,9 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UseTrimorphicInlining, true,                                \
+          "Profiling based inlining for three receivers")                   \
+                                                                            \
   product(bool, InsertMemBarAfterArraycopy, true,                           \
           "Insert memory barrier after arraycopy call")                     \
                                                                             \
@@ -481,6 +509,10 @@
   notproduct(bool, PrintOptimizePtrCompare, false,                          \
           "Print information about optimized pointers compare")             \
                                                                             \
+  experimental(bool, OptimizeNullMerges, false,                             \
+          "Use escape analysis to keep unique instance types for "          \
+          "non-escaping allocations which are merged only with null")       \
+                                                                            \
   notproduct(bool, VerifyConnectionGraph , true,                            \
           "Verify Connection Graph construction in Escape Analysis")        \
                                                                             \
@@ -512,6 +544,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layour")    \
                                                                             \
+  product(bool, BlockLayoutSplitColdPaths, true,                            \
+          "Split runs of uncommon blocks out of hot traces and emit them "  \
+          "at the end of the method")                                       \
+                                                                            \
   develop(bool, InlineReflectionGetCallerClass, true,                       \
           "inline sun.reflect.Reflection.getCallerClass(), known to be part "\
           "of base library DLL")                                            \
@@ -628,6 +664,10 @@
   product(bool, IncrementalInline, true,                                    \
           "do post parse inlining")                                         \
                                                                             \
+  product(bool, IncrementalInlineByFrequency, true,                         \
+          "expand the most frequently executed post parse inlining "        \
+          "candidates first, so hot call sites get the node budget")        \
+                                                                            \
   develop(bool, AlwaysIncrementalInline, false,                             \
           "do all inlining incrementally")                                  \
                                                                             \
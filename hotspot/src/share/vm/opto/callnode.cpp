@@ -1687,6 +1687,13 @@ Node *LockNode::Ideal(PhaseGVN *phase, bool can_reshape) {
         // this lock back on the worklist so we can check again once any
         // region simplification has occurred.
         iter->_worklist.push(this);
+      } else if (ctrl->is_Proj() && ctrl->in(0)->is_AbstractLock() &&
+                 iter->_worklist.member(ctrl->in(0))) {
+        // The immediately preceding lock or unlock hasn't been processed
+        // yet.  If it is later eliminated (by escape analysis or nested
+        // lock elision) next_control will see through it and may expose
+        // a matching unlock, so check again once it has been visited.
+        iter->_worklist.push(this);
       }
     }
   }
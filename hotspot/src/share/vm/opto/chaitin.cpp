@@ -651,12 +651,62 @@ void PhaseChaitin::Register_Allocate() {
     }
   }
 
+  if (PrintHotLoopSpills) {
+    report_hot_loop_spills();
+  }
+
   // Done!
   _live = NULL;
   _ifg = NULL;
   C->set_indexSet_arena(NULL);  // ResourceArea is at end of scope
 }
 
+//------------------------------report_hot_loop_spills-------------------------
+// Count the spill copies which survived allocation in frequently executed
+// loop blocks and touch memory.  The split heuristics try to place spill
+// code in cold blocks; this surfaces per-method regressions without wading
+// through a full assembly dump.
+void PhaseChaitin::report_hot_loop_spills() {
+  uint spills = 0;
+  float worst_freq = 0.0f;
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* b = _cfg.get_block(i);
+    // Only look at blocks in real loops which actually run hot; the parent
+    // of a block's loop is NULL only for the method-level pseudo loop.
+    if (b->_loop == NULL || b->_loop->parent() == NULL) {
+      continue;
+    }
+    if (b->_freq < BLOCK_FREQUENCY(2.0f)) {
+      continue;
+    }
+    for (uint j = 1; j < b->number_of_nodes(); j++) {
+      Node* n = b->get_node(j);
+      if (!n->is_SpillCopy()) {
+        continue;
+      }
+      // Only count copies which touch memory; reg-reg copies are cheap.
+      OptoReg::Name def_reg = get_reg_first(n);
+      OptoReg::Name use_reg = get_reg_first(n->in(1));
+      if (OptoReg::is_stack(def_reg) || OptoReg::is_stack(use_reg)) {
+        spills++;
+        if (b->_freq > worst_freq) {
+          worst_freq = b->_freq;
+        }
+      }
+    }
+  }
+  if (spills > 0) {
+    tty->print("%u memory spill cop%s in hot loop blocks (worst block frequency %g) in method ",
+               spills, (spills == 1) ? "y" : "ies", worst_freq);
+    if (C->method() != NULL) {
+      C->method()->print_short_name(tty);
+    } else {
+      tty->print("(no method)");
+    }
+    tty->cr();
+  }
+}
+
 void PhaseChaitin::de_ssa() {
   // Set initial Names for all Nodes.  Most Nodes get the virtual register
   // number.  A few get the ZERO live range number.  These do not
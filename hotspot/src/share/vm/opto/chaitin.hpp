@@ -548,6 +548,9 @@ private:
   // Set C->failing when fixup spills could not complete, node limit exceeded.
   void fixup_spills();
 
+  // Report spill copies that ended up in frequently executed loop blocks
+  void report_hot_loop_spills();
+
   // Post-Allocation peephole copy removal
   void post_allocate_copy_removal();
   Node *skip_copies( Node *c );
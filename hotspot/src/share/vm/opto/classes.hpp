@@ -40,6 +40,7 @@ macro(AllocateArray)
 macro(AndI)
 macro(AndL)
 macro(AryEq)
+macro(AryEqB)
 macro(AtanD)
 macro(Binary)
 macro(Bool)
@@ -269,9 +270,13 @@ macro(Vector)
 macro(AddVB)
 macro(AddVS)
 macro(AddVI)
+macro(AddReductionVI)
 macro(AddVL)
+macro(AddReductionVL)
 macro(AddVF)
+macro(AddReductionVF)
 macro(AddVD)
+macro(AddReductionVD)
 macro(SubVB)
 macro(SubVS)
 macro(SubVI)
@@ -280,8 +285,11 @@ macro(SubVF)
 macro(SubVD)
 macro(MulVS)
 macro(MulVI)
+macro(MulReductionVI)
 macro(MulVF)
+macro(MulReductionVF)
 macro(MulVD)
+macro(MulReductionVD)
 macro(DivVF)
 macro(DivVD)
 macro(LShiftCntV)
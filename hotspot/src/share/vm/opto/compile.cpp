@@ -1876,6 +1876,31 @@ void Compile::inline_boxing_calls(PhaseIterGVN& igvn) {
   }
 }
 
+// Estimate how often the call site of a late inlining candidate executes,
+// using the counts the interpreter collected in the caller's MethodData.
+// Candidates whose call node went dead rank last.
+static int late_inline_site_count(CallGenerator* cg) {
+  CallStaticJavaNode* call = cg->call_node();
+  if (call == NULL || call->outcnt() == 0 || call->jvms() == NULL) {
+    return -1;
+  }
+  JVMState* jvms = call->jvms();
+  ciCallProfile profile = jvms->method()->call_profile_at_bci(jvms->bci());
+  return profile.count();
+}
+
+// Order late inlining candidates so that the most frequently executed call
+// sites are expanded first and the cold ones are the first to be left out
+// when the live node limit cuts inlining off.
+static int late_inline_profit_order(CallGenerator** cg1, CallGenerator** cg2) {
+  int count1 = late_inline_site_count(*cg1);
+  int count2 = late_inline_site_count(*cg2);
+  if (count1 != count2) {
+    return (count2 > count1) ? 1 : -1;
+  }
+  return 0;
+}
+
 void Compile::inline_incrementally_one(PhaseIterGVN& igvn) {
   assert(IncrementalInline, "incremental inlining should be on");
   PhaseGVN* gvn = initial_gvn();
@@ -1884,6 +1909,14 @@ void Compile::inline_incrementally_one(PhaseIterGVN& igvn) {
   for_igvn()->clear();
   gvn->replace_with(&igvn);
 
+  // Rank the pending candidates by call site frequency, so that hot call
+  // sites consume the node budget before cold ones.  Re-ranking on every
+  // pass also positions the candidates queued by the previous round of
+  // inlining.  The queue is small, so the repeated sort is cheap.
+  if (IncrementalInlineByFrequency && _late_inlines.length() > 1) {
+    _late_inlines.sort(late_inline_profit_order);
+  }
+
   int i = 0;
 
   for (; i <_late_inlines.length() && !inlining_progress(); i++) {
@@ -1968,6 +2001,18 @@ void Compile::inline_incrementally(PhaseIterGVN& igvn) {
 
 //------------------------------Optimize---------------------------------------
 // Given a graph, optimize it.
+//------------------------------print_loop_opts_progress-----------------------
+// Report the live node count after one pass of loop optimizations in a
+// greppable one-line format, so replay-based harnesses can track the
+// per-iteration growth of the ideal graph across builds.
+void Compile::print_loop_opts_progress(int loop_opts_cnt) {
+  if (PrintIdealLoopNodeCounts) {
+    tty->print_cr("%4d idealLoop %d: %d unique nodes, %d live",
+                  _compile_id, num_loop_opts() - loop_opts_cnt,
+                  unique(), live_nodes());
+  }
+}
+
 void Compile::Optimize() {
   TracePhase t1("optimizer", &_t_optimizer, true);
 
@@ -2071,6 +2116,7 @@ void Compile::Optimize() {
       loop_opts_cnt--;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP1, 2);
       if (failing())  return;
+      print_loop_opts_progress(loop_opts_cnt);
     }
     // Loop opts pass if partial peeling occurred in previous pass
     if(PartialPeelLoop && major_progress() && (loop_opts_cnt > 0)) {
@@ -2079,6 +2125,7 @@ void Compile::Optimize() {
       loop_opts_cnt--;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP2, 2);
       if (failing())  return;
+      print_loop_opts_progress(loop_opts_cnt);
     }
     // Loop opts pass for loop-unrolling before CCP
     if(major_progress() && (loop_opts_cnt > 0)) {
@@ -2086,6 +2133,7 @@ void Compile::Optimize() {
       PhaseIdealLoop ideal_loop( igvn, false );
       loop_opts_cnt--;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP3, 2);
+      print_loop_opts_progress(loop_opts_cnt);
     }
     if (!failing()) {
       // Verify that last round of loop opts produced a valid graph
@@ -2128,6 +2176,7 @@ void Compile::Optimize() {
       loop_opts_cnt--;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP_ITERATIONS, 2);
       if (failing())  return;
+      print_loop_opts_progress(loop_opts_cnt);
     }
   }
 
@@ -544,6 +544,7 @@ class Compile : public Phase {
   void        clear_major_progress()            { _major_progress = 0; }
   int               num_loop_opts() const       { return _num_loop_opts; }
   void          set_num_loop_opts(int n)        { _num_loop_opts = n; }
+  void          print_loop_opts_progress(int loop_opts_cnt);
   int               max_inline_size() const     { return _max_inline_size; }
   void          set_freq_inline_size(int n)     { _freq_inline_size = n; }
   int               freq_inline_size() const    { return _freq_inline_size; }
@@ -230,7 +230,8 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
       }
       if (receiver_method == NULL &&
           (have_major_receiver || morphism == 1 ||
-           (morphism == 2 && UseBimorphicInlining))) {
+           (morphism == 2 && UseBimorphicInlining) ||
+           (morphism == 3 && UseTrimorphicInlining))) {
         // receiver_method = profile.method();
         // Profiles do not suggest methods now.  Look it up in the major receiver.
         receiver_method = callee->resolve_invoke(jvms->method()->holder(),
@@ -241,10 +242,13 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
         CallGenerator* hit_cg = this->call_generator(receiver_method,
               vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
         if (hit_cg != NULL) {
-          // Look up second receiver.
+          // Look up second and third receivers.
           CallGenerator* next_hit_cg = NULL;
+          CallGenerator* third_hit_cg = NULL;
           ciMethod* next_receiver_method = NULL;
-          if (morphism == 2 && UseBimorphicInlining) {
+          ciMethod* third_receiver_method = NULL;
+          if ((morphism == 2 && UseBimorphicInlining) ||
+              (morphism == 3 && UseTrimorphicInlining)) {
             next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
                                                                profile.receiver(1));
             if (next_receiver_method != NULL) {
@@ -258,11 +262,27 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
               }
             }
           }
+          if (morphism == 3 && UseTrimorphicInlining && next_hit_cg != NULL) {
+            third_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
+                                                                profile.receiver(2));
+            if (third_receiver_method != NULL) {
+              third_hit_cg = this->call_generator(third_receiver_method,
+                                   vtable_index, !call_does_dispatch, jvms,
+                                   allow_inline, prof_factor);
+              if (third_hit_cg != NULL && !third_hit_cg->is_inline() &&
+                  have_major_receiver && UseOnlyInlinedBimorphic) {
+                  // Skip if we can't inline third receiver's method
+                  third_hit_cg = NULL;
+              }
+            }
+          }
           CallGenerator* miss_cg;
-          Deoptimization::DeoptReason reason = morphism == 2 ?
+          Deoptimization::DeoptReason reason = morphism >= 2 ?
                                     Deoptimization::Reason_bimorphic :
                                     Deoptimization::Reason_class_check;
-          if ((morphism == 1 || (morphism == 2 && next_hit_cg != NULL)) &&
+          if ((morphism == 1 ||
+               (morphism == 2 && next_hit_cg != NULL) ||
+               (morphism == 3 && next_hit_cg != NULL && third_hit_cg != NULL)) &&
               !too_many_traps(jvms->method(), jvms->bci(), reason)
              ) {
             // Generate uncommon trap for class check failure path
@@ -275,6 +295,11 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
             miss_cg = CallGenerator::for_virtual_call(callee, vtable_index);
           }
           if (miss_cg != NULL) {
+            if (third_hit_cg != NULL) {
+              assert(speculative_receiver_type == NULL, "shouldn't end up here if we used speculation");
+              trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), third_receiver_method, profile.receiver(2), site_count, profile.receiver_count(2));
+              miss_cg = CallGenerator::for_predicted_call(profile.receiver(2), miss_cg, third_hit_cg, PROB_MAX);
+            }
             if (next_hit_cg != NULL) {
               assert(speculative_receiver_type == NULL, "shouldn't end up here if we used speculation");
               trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_method, profile.receiver(1), site_count, profile.receiver_count(1));
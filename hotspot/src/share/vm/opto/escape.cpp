@@ -105,16 +105,17 @@ bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
 
-  // Worklists used by EA.
+  // Worklists used by EA.  Inline capacity covers the common small
+  // compilations without resource allocation or early regrow copies.
   Unique_Node_List delayed_worklist;
-  GrowableArray<Node*> alloc_worklist;
-  GrowableArray<Node*> ptr_cmp_worklist;
-  GrowableArray<Node*> storestore_worklist;
-  GrowableArray<PointsToNode*>   ptnodes_worklist;
-  GrowableArray<JavaObjectNode*> java_objects_worklist;
-  GrowableArray<JavaObjectNode*> non_escaped_worklist;
-  GrowableArray<FieldNode*>      oop_fields_worklist;
-  DEBUG_ONLY( GrowableArray<Node*> addp_worklist; )
+  SmallGrowableArray<Node*, 32> alloc_worklist;
+  SmallGrowableArray<Node*, 32> ptr_cmp_worklist;
+  SmallGrowableArray<Node*, 32> storestore_worklist;
+  SmallGrowableArray<PointsToNode*, 32>   ptnodes_worklist;
+  SmallGrowableArray<JavaObjectNode*, 32> java_objects_worklist;
+  SmallGrowableArray<JavaObjectNode*, 32> non_escaped_worklist;
+  SmallGrowableArray<FieldNode*, 32>      oop_fields_worklist;
+  DEBUG_ONLY( SmallGrowableArray<Node*, 32> addp_worklist; )
 
   { Compile::TracePhase t3("connectionGraph", &Phase::_t_connectionGraph, true);
 
@@ -540,6 +541,7 @@ void ConnectionGraph::add_node_to_connection_graph(Node *n, Unique_Node_List *de
       break;
     }
     case Op_AryEq:
+    case Op_AryEqB:
     case Op_StrComp:
     case Op_StrEquals:
     case Op_StrIndexOf:
@@ -723,6 +725,7 @@ void ConnectionGraph::add_final_edges(Node *n) {
       ELSE_FAIL("Op_StoreP");
     }
     case Op_AryEq:
+    case Op_AryEqB:
     case Op_StrComp:
     case Op_StrEquals:
     case Op_StrIndexOf:
@@ -1560,6 +1563,62 @@ int ConnectionGraph::find_init_values(JavaObjectNode* pta, PointsToNode* init_va
   return new_edges;
 }
 
+// Returns true if the value of this node is consumed only by safepoints'
+// debug information, pointer compares and copies of the value, i.e. it is
+// never loaded from, stored through, stored anywhere or passed to a call.
+bool ConnectionGraph::has_only_safepoint_or_compare_uses(Node* n) {
+  for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+    Node* use = n->fast_out(i);
+    if (use->is_SafePoint()) {
+      if (use->is_Call() && use->as_Call()->has_non_debug_use(n)) {
+        return false; // Passed as argument.
+      }
+      continue;
+    }
+    uint op = use->Opcode();
+    if (op == Op_CmpP || op == Op_CmpN || op == Op_Conv2B) {
+      continue; // Value test, the pointer does not flow any further.
+    }
+    if (use->is_Phi() || use->is_CheckCastPP() ||
+        use->is_EncodeNarrowPtr() || use->is_DecodeNarrowPtr() ||
+        (use->is_ConstraintCast() && op == Op_CastPP)) {
+      continue; // Copy of the value, vetted separately by the caller.
+    }
+    return false;
+  }
+  return true;
+}
+
+// Returns true if this node points to exactly one java object and null.
+bool ConnectionGraph::points_to_unique_object_and_null(Node* n) {
+  assert(!_collecting, "should not call when contructed graph");
+  uint idx = n->_idx;
+  if (idx >= nodes_size()) {
+    return false;
+  }
+  PointsToNode* ptn = ptnode_adr(idx);
+  if (!ptn->is_LocalVar()) {
+    return false;
+  }
+  bool points_to_null = false;
+  JavaObjectNode* jobj = NULL;
+  for (EdgeIterator i(ptn); i.has_next(); i.next()) {
+    PointsToNode* e = i.get();
+    if (e->is_JavaObject()) {
+      if (e == null_obj) {
+        points_to_null = true;
+      } else if (e == phantom_obj) {
+        return false;
+      } else if (jobj == NULL) {
+        jobj = e->as_JavaObject();
+      } else if (jobj != e) {
+        return false;
+      }
+    }
+  }
+  return points_to_null && (jobj != NULL) && jobj->scalar_replaceable();
+}
+
 // Adjust scalar_replaceable state after Connection Graph is built.
 void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
   // Search for non-escaping objects which are not scalar replaceable
@@ -1585,6 +1644,21 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
     for (EdgeIterator j(use); j.has_next(); j.next()) {
       PointsToNode* ptn = j.get();
       if (ptn->is_JavaObject() && ptn != jobj) {
+        if (OptimizeNullMerges && ptn == null_obj && use->is_LocalVar() &&
+            has_only_safepoint_or_compare_uses(use->ideal_node())) {
+          // The object is merged only with null at a Phi (or a cast of
+          // such a Phi) whose value is never loaded from, stored through
+          // or passed anywhere - it is referenced only by safepoints'
+          // debug info and pointer compares. It is safe to keep jobj
+          // scalar replaceable then: no memory is accessed through the
+          // merged value so the unique instance typing of jobj's fields
+          // can't be bypassed. Copies of the merged value point to both
+          // jobj and null as well and are vetted by their own pass over
+          // this check. The allocation itself is still kept by macro
+          // expansion (the Phi is a use it can't remove) unless the
+          // merging Phi goes away before that.
+          continue;
+        }
         // Mark all objects.
         jobj->set_scalar_replaceable(false);
          ptn->set_scalar_replaceable(false);
@@ -2910,6 +2984,13 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist)
       }
       JavaObjectNode* jobj = unique_java_object(n);
       if (jobj == NULL || jobj == phantom_obj) {
+        if (jobj == NULL && points_to_unique_object_and_null(n)) {
+          // A scalar replaceable object merged only with null (see
+          // adjust_scalar_replaceable_state()). The merging node is not
+          // loaded from or stored through so it does not need the unique
+          // instance type - leave it for igvn to retype from its inputs.
+          continue;
+        }
 #ifdef ASSERT
         ptnode_adr(n->_idx)->dump();
         assert(jobj != NULL && jobj != phantom_obj, "escaped allocation");
@@ -2996,7 +3077,7 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist)
         uint op = use->Opcode();
         if (!(op == Op_CmpP || op == Op_Conv2B ||
               op == Op_CastP2X || op == Op_StoreCM ||
-              op == Op_FastLock || op == Op_AryEq || op == Op_StrComp ||
+              op == Op_FastLock || op == Op_AryEq || op == Op_AryEqB || op == Op_StrComp ||
               op == Op_StrEquals || op == Op_StrIndexOf)) {
           n->dump();
           use->dump();
@@ -3097,7 +3178,7 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist)
         if (!(op == Op_StoreCM ||
               (op == Op_CallLeaf && use->as_CallLeaf()->_name != NULL &&
                strcmp(use->as_CallLeaf()->_name, "g1_wb_pre") == 0) ||
-              op == Op_AryEq || op == Op_StrComp ||
+              op == Op_AryEq || op == Op_AryEqB || op == Op_StrComp ||
               op == Op_StrEquals || op == Op_StrIndexOf)) {
           n->dump();
           use->dump();
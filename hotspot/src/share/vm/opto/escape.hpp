@@ -445,6 +445,13 @@ private:
   // Adjust scalar_replaceable state after Connection Graph is built.
   void adjust_scalar_replaceable_state(JavaObjectNode* jobj);
 
+  // Returns true if the value of this node is consumed only by safepoints'
+  // debug information, pointer compares and copies of the value.
+  bool has_only_safepoint_or_compare_uses(Node* n);
+
+  // Returns true if this node points to exactly one java object and null.
+  bool points_to_unique_object_and_null(Node* n);
+
   // Optimize ideal graph.
   void optimize_ideal_graph(GrowableArray<Node*>& ptr_cmp_worklist,
                             GrowableArray<Node*>& storestore_worklist);
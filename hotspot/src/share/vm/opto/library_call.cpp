@@ -348,6 +348,7 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     case vmIntrinsics::_compareTo:
     case vmIntrinsics::_equals:
     case vmIntrinsics::_equalsC:
+    case vmIntrinsics::_equalsB:
     case vmIntrinsics::_getAndAddInt:
     case vmIntrinsics::_getAndAddLong:
     case vmIntrinsics::_getAndSetInt:
@@ -383,6 +384,10 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     if (!SpecialArraysEquals)  return NULL;
     if (!Matcher::match_rule_supported(Op_AryEq))  return NULL;
     break;
+  case vmIntrinsics::_equalsB:
+    if (!SpecialArraysEquals)  return NULL;
+    if (!Matcher::match_rule_supported(Op_AryEqB))  return NULL;
+    break;
   case vmIntrinsics::_arraycopy:
     if (!InlineArrayCopy)  return NULL;
     break;
@@ -830,6 +835,7 @@ bool LibraryCallKit::try_to_inline() {
   case vmIntrinsics::_copyOf:                   return inline_array_copyOf(false);
   case vmIntrinsics::_copyOfRange:              return inline_array_copyOf(true);
   case vmIntrinsics::_equalsC:                  return inline_array_equals();
+  case vmIntrinsics::_equalsB:                  return inline_array_equals();
   case vmIntrinsics::_clone:                    return inline_native_clone(intrinsic()->is_virtual());
 
   case vmIntrinsics::_isAssignableFrom:         return inline_native_subtype_check();
@@ -1255,7 +1261,14 @@ bool LibraryCallKit::inline_string_equals() {
 bool LibraryCallKit::inline_array_equals() {
   Node* arg1 = argument(0);
   Node* arg2 = argument(1);
-  set_result(_gvn.transform(new (C) AryEqNode(control(), memory(TypeAryPtr::CHARS), arg1, arg2)));
+  Node* result;
+  if (intrinsic_id() == vmIntrinsics::_equalsB) {
+    result = new (C) AryEqBNode(control(), memory(TypeAryPtr::BYTES), arg1, arg2);
+  } else {
+    assert(intrinsic_id() == vmIntrinsics::_equalsC, "sanity");
+    result = new (C) AryEqNode(control(), memory(TypeAryPtr::CHARS), arg1, arg2);
+  }
+  set_result(_gvn.transform(result));
   return true;
 }
 
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "ci/ciMethod.hpp"
 #include "compiler/compileLog.hpp"
 #include "memory/allocation.inline.hpp"
 #include "opto/addnode.hpp"
@@ -34,6 +35,7 @@
 #include "opto/rootnode.hpp"
 #include "opto/runtime.hpp"
 #include "opto/subnode.hpp"
+#include "opto/vectornode.hpp"
 
 //------------------------------is_loop_exit-----------------------------------
 // Given an IfNode, return the loop-exiting projection or NULL if both
@@ -614,7 +616,8 @@ bool IdealLoopTree::policy_maximally_unroll( PhaseIdealLoop *phase ) const {
       case Op_StrEquals:
       case Op_StrIndexOf:
       case Op_EncodeISOArray:
-      case Op_AryEq: {
+      case Op_AryEq:
+      case Op_AryEqB: {
         return false;
       }
     } // switch
@@ -721,7 +724,8 @@ bool IdealLoopTree::policy_unroll( PhaseIdealLoop *phase ) const {
       case Op_StrEquals:
       case Op_StrIndexOf:
       case Op_EncodeISOArray:
-      case Op_AryEq: {
+      case Op_AryEq:
+      case Op_AryEqB: {
         // Do not unroll a loop with String intrinsics code.
         // String intrinsics are large and have loops.
         return false;
@@ -1148,6 +1152,73 @@ bool IdealLoopTree::is_invariant(Node* n) const {
 }
 
 
+//------------------------------mark_reductions--------------------------------
+// Mark all scalar reduction operations (e.g. sum += a[i]) in the loop.
+// This is done before the loop body is doubled by unrolling so that the
+// unrolled copies of the operation inherit the mark and superword can
+// later combine the whole chain into a single vector reduction.
+void PhaseIdealLoop::mark_reductions( IdealLoopTree *loop ) {
+  assert(SuperWordReductions, "should be checked by the caller");
+  if (!loop->_head->is_CountedLoop()) {
+    return;
+  }
+  CountedLoopNode* loop_head = loop->_head->as_CountedLoop();
+  if (loop_head->unrolled_count() > 1) {
+    return; // The original operations were marked before the first unroll.
+  }
+
+  Node* trip_phi = loop_head->phi();
+  for (DUIterator_Fast imax, i = loop_head->fast_outs(imax); i < imax; i++) {
+    Node* phi = loop_head->fast_out(i);
+    if (!phi->is_Phi() || phi->outcnt() == 0 || phi == trip_phi) {
+      continue;
+    }
+    // For definitions which are loop inclusive and not tripcounts.
+    Node* def_node = phi->in(LoopNode::LoopBackControl);
+    if (def_node == NULL) {
+      continue;
+    }
+    Node* n_ctrl = get_ctrl(def_node);
+    if (n_ctrl == NULL || !loop->is_member(get_loop(n_ctrl))) {
+      continue;
+    }
+    // Now test it to see if it fits the standard pattern for a reduction
+    // operator: an arithmetic operation with a vector reduction form which
+    // takes the phi as one input and provides the phi's backedge value.
+    int opc = def_node->Opcode();
+    if (opc == ReductionNode::opcode(opc, def_node->bottom_type()->basic_type())) {
+      continue; // No reduction form for this operation.
+    }
+    if (def_node->is_reduction()) {
+      continue; // Already marked.
+    }
+    bool ok = false;
+    for (uint j = 1; j < def_node->req(); j++) {
+      if (def_node->in(j) == phi) {
+        ok = true;
+        break;
+      }
+    }
+    if (!ok) {
+      continue;
+    }
+    // The result of the reduction must not be used in the loop itself,
+    // except to provide the next iteration's value through the phi.
+    for (DUIterator_Fast jmax, j = def_node->fast_outs(jmax); j < jmax && ok; j++) {
+      Node* u = def_node->fast_out(j);
+      if (u == phi) {
+        continue;
+      }
+      if (loop->is_member(get_loop(ctrl_or_self(u)))) {
+        ok = false;
+      }
+    }
+    if (ok) {
+      def_node->add_flag(Node::Flag_is_reduction);
+    }
+  }
+}
+
 //------------------------------do_unroll--------------------------------------
 // Unroll the loop body one step - make each trip do 2 iterations.
 void PhaseIdealLoop::do_unroll( IdealLoopTree *loop, Node_List &old_new, bool adjust_min_trip ) {
@@ -2325,8 +2396,12 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
     // an even number of trips).  If we are peeling, we might enable some RCE
     // and we'd rather unroll the post-RCE'd loop SO... do not unroll if
     // peeling.
-    if (should_unroll && !should_peel)
+    if (should_unroll && !should_peel) {
+      if (SuperWordReductions) {
+        phase->mark_reductions(this);
+      }
       phase->do_unroll(this,old_new, true);
+    }
 
     // Adjust the pre-loop limits to align the main body
     // iterations.
@@ -2772,3 +2847,229 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
 
   return true;
 }
+
+//=============================================================================
+//------------------------------hoist_pure_calls-------------------------------
+// Hoist calls to known-pure methods with loop-invariant arguments out of
+// counted loops.  A pure call computes the same value on every iteration,
+// so one execution on the loop entry edge can stand in for all of them.
+bool PhaseIdealLoop::hoist_pure_calls() {
+  bool progress = false;
+  for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+    IdealLoopTree* lpt = iter.current();
+    if (!lpt->is_counted()) continue;
+    for (uint i = 0; i < lpt->_body.size(); i++) {
+      Node* n = lpt->_body.at(i);
+      if (n->is_CallStaticJava() &&
+          try_hoist_pure_call(lpt, n->as_CallStaticJava())) {
+        progress = true;
+      }
+    }
+  }
+  return progress;
+}
+
+//------------------------exception_path_state_is_invariant--------------------
+// Check that no state hanging off an exception-path CatchProj names a value
+// computed in the loop.  The call's own debug edges are rewound to their
+// loop-entry values when the call is hoisted, but state along this path is
+// not: an uncommon trap's JVMState, or a phi input at an exit region, can
+// reference a phi at the loop head, and after the splice that use would be
+// controlled from the entry edge while its def stays in the loop - def no
+// longer dominates use.  Walks the control cluster below the projection,
+// checking every node pinned on it and every phi input merged in from it;
+// a floating intermediate value computed from a loop phi is caught too,
+// because its early control is inside the loop.  Gives up (returns false)
+// if the cluster grows beyond a small bound.
+bool PhaseIdealLoop::exception_path_state_is_invariant(IdealLoopTree* lpt, Node* eproj) {
+  const uint walk_limit = 32;
+  Unique_Node_List wq;
+  wq.push(eproj);
+  for (uint next = 0; next < wq.size(); next++) {
+    if (wq.size() > walk_limit) {
+      return false;
+    }
+    Node* c = wq.at(next);
+    for (DUIterator_Fast imax, i = c->fast_outs(imax); i < imax; i++) {
+      Node* u = c->fast_out(i);
+      if (u->is_Region()) {
+        // Only the phi inputs flowing in along our edge matter.
+        for (DUIterator_Fast kmax, k = u->fast_outs(kmax); k < kmax; k++) {
+          Node* phi = u->fast_out(k);
+          if (!phi->is_Phi() || phi->in(0) != u)  continue;
+          for (uint j = 1; j < u->req(); j++) {
+            if (u->in(j) != c)  continue;
+            Node* in = phi->in(j);
+            if (in == NULL || in->is_top())  continue;
+            Node* ctrl = has_ctrl(in) ? get_ctrl(in) : in;
+            if (lpt->is_member(get_loop(ctrl)))  return false;
+          }
+        }
+      } else if (u->in(0) == c) {
+        // A node pinned on the path (e.g. an uncommon trap call with its
+        // JVMState): every input must be loop invariant.
+        for (uint j = 1; j < u->req(); j++) {
+          Node* in = u->in(j);
+          if (in == NULL || in->is_top())  continue;
+          Node* ctrl = has_ctrl(in) ? get_ctrl(in) : in;
+          if (lpt->is_member(get_loop(ctrl)))  return false;
+        }
+      }
+      if (u->is_CFG() && u != C->root()) {
+        wq.push(u);
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------try_hoist_pure_call----------------------------
+// Splice one pure call, together with its Proj/Catch/CatchProj control
+// cluster, out of the loop body and into the loop entry edge.  Returns
+// true if the call was hoisted.
+bool PhaseIdealLoop::try_hoist_pure_call(IdealLoopTree* lpt, CallStaticJavaNode* call) {
+  // Uncommon traps and runtime stubs have no method; leave them alone.
+  ciMethod* method = call->method();
+  if (method == NULL || !method->is_pure()) {
+    return false;
+  }
+  Node* in_ctrl = call->in(0);
+  if (in_ctrl == NULL || get_loop(in_ctrl) != lpt) {
+    return false;               // Dead, or already moved out of this loop
+  }
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+
+  // Every argument must be loop invariant.  Debug edges may also refer to
+  // phis at the loop head: those carry the interpreter state of the first
+  // iteration once they are rewound to the phi entry value below.
+  uint parms_cnt = call->tf()->domain()->cnt();
+  for (uint i = TypeFunc::Parms; i < call->req(); i++) {
+    Node* in = call->in(i);
+    if (in == NULL || in->is_top())  continue;
+    Node* ctrl = has_ctrl(in) ? get_ctrl(in) : in;
+    if (!lpt->is_member(get_loop(ctrl)))  continue;   // Invariant input
+    if (i >= parms_cnt && in->is_Phi() && in->in(0) == head)  continue;
+    return false;
+  }
+
+  // The memory and i/o states flowing into the call must either be loop
+  // invariant or be phis at the loop head whose only in-loop contribution
+  // is the call's own projection, i.e. the call is the only kill in the
+  // loop.  Any store or second call in the body breaks this shape.
+  Node* mem = call->in(TypeFunc::Memory);
+  Node* io  = call->in(TypeFunc::I_O);
+  ProjNode* memproj = call->proj_out(TypeFunc::Memory);
+  ProjNode* ioproj  = call->proj_out(TypeFunc::I_O);
+  Node* memphi = NULL;
+  Node* iophi  = NULL;
+  if (lpt->is_member(get_loop(has_ctrl(mem) ? get_ctrl(mem) : mem))) {
+    if (!mem->is_Phi() || mem->in(0) != head ||
+        memproj == NULL || mem->in(LoopNode::LoopBackControl) != memproj) {
+      return false;
+    }
+    memphi = mem;
+  }
+  if (lpt->is_member(get_loop(has_ctrl(io) ? get_ctrl(io) : io))) {
+    if (!io->is_Phi() || io->in(0) != head ||
+        ioproj == NULL || io->in(LoopNode::LoopBackControl) != ioproj) {
+      return false;
+    }
+    iophi = io;
+  }
+
+  // Locate the control diamond below the call: Proj -> Catch -> CatchProjs.
+  ProjNode* cproj = call->proj_out(TypeFunc::Control);
+  if (cproj == NULL)  return false;
+  Node* catchn = cproj->unique_ctrl_out();
+  if (catchn == NULL || !catchn->is_Catch())  return false;
+  CatchProjNode* fall = NULL;
+  for (DUIterator_Fast jmax, j = catchn->fast_outs(jmax); j < jmax; j++) {
+    Node* u = catchn->fast_out(j);
+    if (!u->is_CatchProj())  return false;
+    if (u->as_CatchProj()->_con == CatchProjNode::fall_through_index) {
+      if (fall != NULL)  return false;
+      fall = u->as_CatchProj();
+    } else {
+      // The exception path must leave the loop at once; a handler in the
+      // loop body would resume with state this transformation ignores.
+      Node* esucc = u->unique_ctrl_out();
+      if (esucc == NULL || lpt->is_member(get_loop(esucc)))  return false;
+      // And nothing on it may depend on values computed in the loop; see
+      // exception_path_state_is_invariant().
+      if (!exception_path_state_is_invariant(lpt, u))  return false;
+    }
+  }
+  if (fall == NULL)  return false;
+  Node* succ = fall->unique_ctrl_out();
+  if (succ == NULL)  return false;
+
+  // The call must execute on every iteration.  A counted loop runs at
+  // least once past the zero trip guard, so hoisting preserves any
+  // exception the first iteration would have thrown.
+  if (!is_dominator(fall, head->in(LoopNode::LoopBackControl)))  return false;
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("PureCallHoist %s ", method->name()->as_utf8());
+    lpt->dump_head();
+  }
+#endif
+
+  Node* entry = head->in(LoopNode::EntryControl);
+  IdealLoopTree* outer = get_loop(entry);
+
+  // Rewind debug state to the values live at loop entry; the hoisted call
+  // then carries exactly the interpreter state of the first iteration.
+  for (uint i = parms_cnt; i < call->req(); i++) {
+    Node* in = call->in(i);
+    if (in != NULL && in->is_Phi() && in->in(0) == head) {
+      _igvn.replace_input_of(call, i, in->in(LoopNode::EntryControl));
+    }
+  }
+
+  // Feed the call the loop-entry memory and i/o state.  The loop phis then
+  // see the call's projection on both inputs and collapse in igvn.
+  if (memphi != NULL) {
+    _igvn.replace_input_of(call, TypeFunc::Memory, memphi->in(LoopNode::EntryControl));
+    _igvn.replace_input_of(memphi, LoopNode::EntryControl, memproj);
+  }
+  if (iophi != NULL) {
+    _igvn.replace_input_of(call, TypeFunc::I_O, iophi->in(LoopNode::EntryControl));
+    _igvn.replace_input_of(iophi, LoopNode::EntryControl, ioproj);
+  }
+
+  // Splice the control cluster out of the body and into the entry edge.
+  // Nodes pinned below the call stay in the loop; once the hoisted call
+  // has succeeded on the entry edge they are safe at its old control.
+  while (fall->outcnt() > 0) {
+    Node* u = fall->raw_out(0);
+    _igvn.rehash_node_delayed(u);
+    u->replace_edge(fall, in_ctrl);
+    if (has_ctrl(u) && get_ctrl(u) == fall) {
+      set_ctrl(u, in_ctrl);
+    }
+  }
+  _igvn.replace_input_of(call, 0, entry);
+  _igvn.replace_input_of(head, LoopNode::EntryControl, fall);
+
+  // The hoisted cluster now lives in the enclosing loop.
+  set_loop(call,   outer);
+  set_loop(cproj,  outer);
+  set_loop(catchn, outer);
+  set_idom(call,   entry, dom_depth(entry) + 1);
+  set_idom(cproj,  call,  dom_depth(entry) + 2);
+  set_idom(catchn, cproj, dom_depth(entry) + 3);
+  for (DUIterator_Fast jmax, j = catchn->fast_outs(jmax); j < jmax; j++) {
+    Node* u = catchn->fast_out(j);
+    set_loop(u, outer);
+    set_idom(u, catchn, dom_depth(entry) + 4);
+  }
+  set_idom(head, fall, dom_depth(entry) + 5);
+  if (!succ->is_Region()) {
+    set_idom(succ, in_ctrl, dom_depth(in_ctrl) + 1);
+  }
+  // Depths below the insertion point are stale now; recompute them so the
+  // dominance queries for the remaining candidates stay monotone.
+  recompute_dom_depth();
+  return true;
+}
@@ -672,9 +672,13 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
 
   } // LoopLimitCheck
 
-  // Check for SafePoint on backedge and remove
+  // Check for SafePoint on backedge and remove.  When counted loop
+  // safepoints are kept, only loops with a provably short trip count
+  // may drop their poll.
   Node *sfpt = x->in(LoopNode::LoopBackControl);
-  if (sfpt->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt)) {
+  if (sfpt->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt) &&
+      (!UseCountedLoopSafepoints ||
+       is_short_counted_loop(init_trip, limit, stride_con))) {
     lazy_replace( sfpt, iftrue );
     if (loop->_safepts != NULL) {
       loop->_safepts->yank(sfpt);
@@ -770,7 +774,9 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
 
   // Check for immediately preceding SafePoint and remove
   Node *sfpt2 = le->in(0);
-  if (sfpt2->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt2)) {
+  if (sfpt2->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt2) &&
+      (!UseCountedLoopSafepoints ||
+       is_short_counted_loop(init_trip, limit, stride_con))) {
     lazy_replace( sfpt2, sfpt2->in(TypeFunc::Control));
     if (loop->_safepts != NULL) {
       loop->_safepts->yank(sfpt2);
@@ -1691,6 +1697,24 @@ void IdealLoopTree::check_safepts(VectorSet &visited, Node_List &stack) {
   }
 }
 
+//---------------------------is_short_counted_loop---------------------------
+// Is the trip count a constant small enough that the loop cannot delay a
+// safepoint for long?  Such loops may drop their polls even when
+// UseCountedLoopSafepoints keeps polls in counted loops.
+bool PhaseIdealLoop::is_short_counted_loop(Node* init, Node* limit, int stride_con) {
+  if (init == NULL || limit == NULL || stride_con == 0) {
+    return false;
+  }
+  const TypeInt* init_t  = _igvn.type(init)->isa_int();
+  const TypeInt* limit_t = _igvn.type(limit)->isa_int();
+  if (init_t == NULL  || !init_t->is_con() ||
+      limit_t == NULL || !limit_t->is_con()) {
+    return false;               // Unknown trip count, assume it can be long
+  }
+  jlong trip_count = ((jlong)limit_t->get_con() - (jlong)init_t->get_con()) / stride_con;
+  return trip_count <= (jlong)CountedLoopSafepointTripLimit;
+}
+
 //---------------------------is_deleteable_safept----------------------------
 // Is safept not required by an outer loop?
 bool PhaseIdealLoop::is_deleteable_safept(Node* sfpt) {
@@ -1806,12 +1830,23 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
       phase->is_counted_loop(_head, this)) {
     _has_sfpt = 1;              // Indicate we do not need a safepoint here
 
-    // Look for safepoints to remove.
+    // Look for safepoints to remove.  When counted loop safepoints are
+    // kept and the trip count is not provably short, keep one poll so
+    // time-to-safepoint stays bounded, and delete only the rest.
+    CountedLoopNode* cl = _head->as_CountedLoop();
+    bool keep_one_sfpt = UseCountedLoopSafepoints &&
+                         cl->loopexit() != NULL &&
+                         !phase->is_short_counted_loop(cl->init_trip(), cl->limit(),
+                                                       cl->stride_con());
     Node_List* sfpts = _safepts;
     if (sfpts != NULL) {
       for (uint i = 0; i < sfpts->size(); i++) {
         Node* n = sfpts->at(i);
         assert(phase->get_loop(n) == this, "");
+        if (keep_one_sfpt) {
+          keep_one_sfpt = false;  // Keep the first one, delete the rest
+          continue;
+        }
         if (phase->is_deleteable_safept(n)) {
           phase->lazy_replace(n, n->in(TypeFunc::Control));
         }
@@ -2341,6 +2376,15 @@ void PhaseIdealLoop::build_and_optimize(bool do_split_ifs, bool skip_loop_opts)
     }
   }
 
+  // Hoist loop-invariant pure calls out of counted loops.  The control
+  // flow change invalidates the loop tree, so force another round of
+  // loop opts when something was moved.
+  if (HoistPureCalls && C->has_loops() && !C->major_progress()) {
+    if (hoist_pure_calls()) {
+      C->set_major_progress();
+    }
+  }
+
   // Perform iteration-splitting on inner loops.  Split iterations to avoid
   // range checks or one-shot null checks.
 
@@ -3469,6 +3513,7 @@ void PhaseIdealLoop::build_loop_late_post( Node *n ) {
     case Op_StrEquals:
     case Op_StrIndexOf:
     case Op_AryEq:
+    case Op_AryEqB:
       pinned = false;
     }
     if( pinned ) {
@@ -31,6 +31,7 @@
 #include "opto/subnode.hpp"
 #include "opto/type.hpp"
 
+class CallStaticJavaNode;
 class CmpNode;
 class CountedLoopEndNode;
 class CountedLoopNode;
@@ -753,6 +754,10 @@ private:
   // Is safept not required by an outer loop?
   bool is_deleteable_safept(Node* sfpt);
 
+  // Is the trip count a constant small enough that the loop cannot
+  // delay a safepoint for long?
+  bool is_short_counted_loop(Node* init, Node* limit, int stride_con);
+
   // Replace parallel induction variable (parallel to trip counter)
   void replace_parallel_iv(IdealLoopTree *loop);
 
@@ -870,6 +875,10 @@ public:
   // Unroll the loop body one step - make each trip do 2 iterations.
   void do_unroll( IdealLoopTree *loop, Node_List &old_new, bool adjust_min_trip );
 
+  // Mark loop carried scalar reduction operations before the loop is
+  // unrolled so that superword can recognize their unrolled copies.
+  void mark_reductions( IdealLoopTree *loop );
+
   // Return true if exp is a constant times an induction var
   bool is_scaled_iv(Node* exp, Node* iv, int* p_scale);
 
@@ -1038,6 +1047,11 @@ public:
   bool match_fill_loop(IdealLoopTree* lpt, Node*& store, Node*& store_value,
                        Node*& shift, Node*& offset);
 
+  // Hoist loop-invariant calls to known-pure methods out of counted loops.
+  bool hoist_pure_calls();
+  bool try_hoist_pure_call(IdealLoopTree* lpt, CallStaticJavaNode* call);
+  bool exception_path_state_is_invariant(IdealLoopTree* lpt, Node* eproj);
+
 private:
   // Return a type based on condition control flow
   const TypeInt* filtered_type( Node *n, Node* n_ctrl);
@@ -937,6 +937,7 @@ static void match_alias_type(Compile* C, Node* n, Node* m) {
     case Op_StrEquals:
     case Op_StrIndexOf:
     case Op_AryEq:
+    case Op_AryEqB:
     case Op_MemBarVolatile:
     case Op_MemBarCPUOrder: // %%% these ideals should have narrower adr_type?
     case Op_EncodeISOArray:
@@ -1998,6 +1999,7 @@ void Matcher::find_shared( Node *n ) {
       case Op_StrEquals:
       case Op_StrIndexOf:
       case Op_AryEq:
+      case Op_AryEqB:
       case Op_EncodeISOArray:
         set_shared(n); // Force result into register (it will be anyways)
         break;
@@ -879,6 +879,17 @@ public:
   virtual const Type* bottom_type() const { return TypeInt::BOOL; }
 };
 
+//------------------------------AryEqB---------------------------------------
+// byte[] array equality; same shape as AryEq but on the byte[] memory slice
+class AryEqBNode: public StrIntrinsicNode {
+public:
+  AryEqBNode(Node* control, Node* byte_array_mem, Node* s1, Node* s2):
+    StrIntrinsicNode(control, byte_array_mem, s1, s2) {};
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::BOOL; }
+  virtual const TypePtr* adr_type() const { return TypeAryPtr::BYTES; }
+};
+
 
 //------------------------------EncodeISOArray--------------------------------
 // encode char[] to byte[] in ISO_8859_1
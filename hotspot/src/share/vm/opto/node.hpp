@@ -654,7 +654,8 @@ public:
     Flag_avoid_back_to_back  = Flag_may_be_short_branch << 1,
     Flag_has_call            = Flag_avoid_back_to_back << 1,
     Flag_is_expensive        = Flag_has_call << 1,
-    _max_flags = (Flag_is_expensive << 1) - 1 // allow flags combination
+    Flag_is_reduction        = Flag_is_expensive << 1,
+    _max_flags = (Flag_is_reduction << 1) - 1 // allow flags combination
   };
 
 private:
@@ -677,6 +678,10 @@ protected:
   }
 
 public:
+  void add_flag(jushort fl) { init_flags(fl); }
+
+  void remove_flag(jushort fl) { clear_flag(fl); }
+
   const jushort class_id() const { return _class_id; }
 
   const jushort flags() const { return _flags; }
@@ -831,6 +836,8 @@ public:
   bool is_macro() const { return (_flags & Flag_is_macro) != 0; }
   // The node is expensive: the best control is set during loop opts
   bool is_expensive() const { return (_flags & Flag_is_expensive) != 0 && in(0) != NULL; }
+  // The node is a reduction of a loop carried dependency, e.g. sum += a[i]
+  bool is_reduction() const { return (_flags & Flag_is_reduction) != 0; }
 
 //----------------- Optimization
 
@@ -174,3 +174,28 @@ void Phase::print_timers() {
   tty->print_cr ("      bldOopMaps     : %3.3f sec", Phase::_t_buildOopMaps.seconds());
 }
 #endif
+
+//------------------------------TimerSnapshot----------------------------------
+void Phase::TimerSnapshot::take() {
+  _parser             = _t_parser.seconds();
+  _optimizer          = _t_optimizer.seconds();
+  _escapeAnalysis     = _t_escapeAnalysis.seconds();
+  _idealLoop          = _t_idealLoop.seconds();
+  _ccp                = _t_ccp.seconds();
+  _matcher            = _t_matcher.seconds();
+  _registerAllocation = _t_registerAllocation.seconds();
+  _output             = _t_output.seconds();
+}
+
+void Phase::TimerSnapshot::print_delta_on(outputStream* st, const TimerSnapshot& start) const {
+  st->print("parse %1.4f optimize %1.4f (ea %1.4f idealLoop %1.4f ccp %1.4f) "
+            "match %1.4f regalloc %1.4f output %1.4f",
+            _parser             - start._parser,
+            _optimizer          - start._optimizer,
+            _escapeAnalysis     - start._escapeAnalysis,
+            _idealLoop          - start._idealLoop,
+            _ccp                - start._ccp,
+            _matcher            - start._matcher,
+            _registerAllocation - start._registerAllocation,
+            _output             - start._output);
+}
@@ -117,6 +117,26 @@ protected:
 public:
   Compile * C;
   Phase( PhaseNumber pnum );
+
+  // Snapshot of the accumulated phase timers.  Two snapshots bracketing
+  // a compilation give the per-phase cost of just that compilation; used
+  // by the replay timing harness (-XX:+ReplayTiming).  The timers only
+  // accumulate with -XX:+TimeCompiler.
+  class TimerSnapshot : public StackObj {
+    double _parser;
+    double _optimizer;
+    double _escapeAnalysis;
+    double _idealLoop;
+    double _ccp;
+    double _matcher;
+    double _registerAllocation;
+    double _output;
+  public:
+    TimerSnapshot() { take(); }
+    void take();
+    void print_delta_on(outputStream* st, const TimerSnapshot& start) const;
+  };
+
 #ifndef PRODUCT
   static void print_timers();
 #endif
@@ -855,6 +855,41 @@ void PhaseIterGVN::init_worklist( Node *n ) {
   }
 }
 
+//------------------------------transform_rank---------------------------------
+// Rough cost rank of transforming a node, used to order worklist pops.
+// Constants are free, plain data nodes are cheap, memory nodes are more
+// expensive, and control, phi and call nodes are the most expensive since
+// their transforms walk regions and memory slices.
+static int transform_rank( Node *n ) {
+  if( n->is_Con() )                 return 0;
+  if( n->is_CFG() || n->is_Phi() )  return 3;
+  if( n->is_Mem() )                 return 2;
+  return 1;
+}
+
+//-------------------------pop_transform_candidate-----------------------------
+// Pop the cheapest node among a small window at the tail of the worklist.
+// Transforming cheap data nodes first lets local simplifications collapse
+// before their control, memory and phi consumers are visited, so those
+// expensive transforms mostly run once against final operands.  IterGVN
+// runs to a fixpoint, so any pop order yields the same graph.
+Node *PhaseIterGVN::pop_transform_candidate() {
+  const uint window = 8;        // Bounded scan keeps pop cost O(1)
+  uint size = _worklist.size();
+  uint best_i = size-1;
+  int  best_rank = transform_rank(_worklist.at(best_i));
+  uint limit = MIN2(window, size);
+  for( uint k = 2; k <= limit && best_rank > 0; k++ ) {
+    uint i = size - k;
+    int rank = transform_rank(_worklist.at(i));
+    if( rank < best_rank ) {
+      best_rank = rank;
+      best_i = i;
+    }
+  }
+  return _worklist.remove(best_i);
+}
+
 //------------------------------optimize---------------------------------------
 void PhaseIterGVN::optimize() {
   debug_only(uint num_processed  = 0;);
@@ -425,6 +425,11 @@ protected:
   // Usually returns new_type.  Returns old_type if new_type is only a slight
   // improvement, such that it would take many (>>10) steps to reach 2**32.
 
+  // Pop the next node to transform, preferring cheap data nodes over
+  // control, memory and call nodes among a small window at the tail of
+  // the worklist.
+  Node *pop_transform_candidate();
+
 public:
   PhaseIterGVN( PhaseIterGVN *igvn ); // Used by CCP constructor
   PhaseIterGVN( PhaseGVN *gvn ); // Used after Parser
@@ -684,6 +684,22 @@ uint PhaseChaitin::Split(uint maxlrg, ResourceArea* split_arena) {
         // assume Phi is DOWN
         if( is_high_pressure( b, &lrgs(lidx), b->end_idx()) && !prompt_use(b,lidx) )
           UPblock[slidx] = false;
+        // If the reaching defs disagree UP vs. DOWN, every input edge whose
+        // state differs from the Phi gets a reconciling SpillCopy in the
+        // Phi-resolving pass below.  Side with the most frequent
+        // predecessor so those copies land on the colder incoming edges -
+        // in particular not on a hot loop backedge.
+        else if( SplitSpillsByFrequency && needs_split ) {
+          float hot_freq = -1.0f;
+          for( inpidx = 1; inpidx < b->num_preds(); inpidx++ ) {
+            pred = _cfg.get_block_for_node(b->pred(inpidx));
+            pidx = pred->_pre_order;
+            if( Reaches[pidx][slidx] != NULL && pred->_freq > hot_freq ) {
+              hot_freq = pred->_freq;
+              UPblock[slidx] = UP[pidx][slidx];
+            }
+          }
+        }
         // If we are not split up/down and all inputs are down, then we
         // are down
         if( !needs_split && !u3 )
@@ -27,6 +27,7 @@
 #include "ci/ciReplay.hpp"
 #include "classfile/altHashing.hpp"
 #include "classfile/classLoader.hpp"
+#include "classfile/classPreloader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -3853,6 +3854,31 @@ DEFINE_GETSCALARARRAYREGION(T_DOUBLE,  jdouble, Double,  double
                             HOTSPOT_JNI_GETDOUBLEARRAYREGION_RETURN());
 #endif /* USDT2 */
 
+address jni_GetBooleanArrayRegion_addr() {
+  return (address)jni_GetBooleanArrayRegion;
+}
+address jni_GetByteArrayRegion_addr() {
+  return (address)jni_GetByteArrayRegion;
+}
+address jni_GetCharArrayRegion_addr() {
+  return (address)jni_GetCharArrayRegion;
+}
+address jni_GetShortArrayRegion_addr() {
+  return (address)jni_GetShortArrayRegion;
+}
+address jni_GetIntArrayRegion_addr() {
+  return (address)jni_GetIntArrayRegion;
+}
+address jni_GetLongArrayRegion_addr() {
+  return (address)jni_GetLongArrayRegion;
+}
+address jni_GetFloatArrayRegion_addr() {
+  return (address)jni_GetFloatArrayRegion;
+}
+address jni_GetDoubleArrayRegion_addr() {
+  return (address)jni_GetDoubleArrayRegion;
+}
+
 #ifndef USDT2
 #define DEFINE_SETSCALARARRAYREGION(ElementTag,ElementType,Result, Tag) \
   DT_VOID_RETURN_MARK_DECL(Set##Result##ArrayRegion);\
@@ -3985,7 +4011,18 @@ static Method* find_prefixed_native(KlassHandle k,
 }
 
 static bool register_native(KlassHandle k, Symbol* name, Symbol* signature, address entry, TRAPS) {
-  Method* method = k()->lookup_method(name, signature);
+  // The overwhelmingly common case is a method declared in k itself
+  // (the JNI spec asks for exactly that), so consult the class's own
+  // sorted method table directly before falling back to the general
+  // hierarchy walk. Libraries registering thousands of natives in one
+  // RegisterNatives call go through here once per method.
+  Method* method = NULL;
+  if (k()->oop_is_instance()) {
+    method = InstanceKlass::cast(k())->find_method(name, signature);
+  }
+  if (method == NULL) {
+    method = k()->lookup_method(name, signature);
+  }
   if (method == NULL) {
     ResourceMark rm;
     stringStream st;
@@ -4245,6 +4282,11 @@ JNI_ENTRY(void*, jni_GetPrimitiveArrayCritical(JNIEnv *env, jarray array, jboole
     *isCopy = JNI_FALSE;
   }
   oop a = JNIHandles::resolve_non_null(array);
+  if (Universe::heap()->supports_object_pinning()) {
+    // Pin the object's region so that evacuation pauses can proceed
+    // during the critical section without moving the array.
+    a = Universe::heap()->pin_object(thread, a);
+  }
   assert(a->is_array(), "just checking");
   BasicType type;
   if (a->is_objArray()) {
@@ -4271,7 +4313,11 @@ JNI_ENTRY(void, jni_ReleasePrimitiveArrayCritical(JNIEnv *env, jarray array, voi
   HOTSPOT_JNI_RELEASEPRIMITIVEARRAYCRITICAL_ENTRY(
                                                   env, array, carray, mode);
 #endif /* USDT2 */
-  // The array, carray and mode arguments are ignored
+  // The carray and mode arguments are ignored
+  if (Universe::heap()->supports_object_pinning()) {
+    oop a = JNIHandles::resolve_non_null(array);
+    Universe::heap()->unpin_object(thread, a);
+  }
   GC_locker::unlock_critical(thread);
 #ifndef USDT2
   DTRACE_PROBE(hotspot_jni, ReleasePrimitiveArrayCritical__return);
@@ -4281,6 +4327,63 @@ HOTSPOT_JNI_RELEASEPRIMITIVEARRAYCRITICAL_RETURN(
 #endif /* USDT2 */
 JNI_END
 
+// Scoped bulk pinning of primitive arrays, exported for native agents
+// and FFI layers (see the make/*/makefiles/mapfile-vers* files). The
+// bulk form serves scatter-gather I/O paths that pin many buffers per
+// operation. When the collector supports object pinning (G1 with
+// -XX:+G1UseRegionPinning), each array's region is pinned individually
+// and the collector stays fully enabled; otherwise the thread enters
+// the same critical section as GetPrimitiveArrayCritical, but only once
+// per call instead of once per buffer. Every successful pin call must
+// be balanced by an unpin call with the same arrays, on the same
+// thread, and the addresses must not be used after the unpin.
+
+JNI_ENTRY(jboolean, JVM_PinPrimitiveArrays(JNIEnv *env, jint count, jarray* arrays, void** addrs))
+  JNIWrapper("JVM_PinPrimitiveArrays");
+  if (count <= 0 || arrays == NULL || addrs == NULL) {
+    return JNI_FALSE;
+  }
+
+  // Validate all the arrays before pinning anything so failure does
+  // not leave a partially pinned batch behind.
+  for (jint i = 0; i < count; i++) {
+    if (arrays[i] == NULL ||
+        !JNIHandles::resolve_non_null(arrays[i])->is_typeArray()) {
+      return JNI_FALSE;
+    }
+  }
+
+  const bool use_pinning = Universe::heap()->supports_object_pinning();
+  if (!use_pinning) {
+    GC_locker::lock_critical(thread);
+  }
+
+  for (jint i = 0; i < count; i++) {
+    oop a = JNIHandles::resolve_non_null(arrays[i]);
+    if (use_pinning) {
+      a = Universe::heap()->pin_object(thread, a);
+    }
+    BasicType type = TypeArrayKlass::cast(a->klass())->element_type();
+    addrs[i] = arrayOop(a)->base(type);
+  }
+
+  return JNI_TRUE;
+JNI_END
+
+JNI_ENTRY(void, JVM_UnpinPrimitiveArrays(JNIEnv *env, jint count, jarray* arrays))
+  JNIWrapper("JVM_UnpinPrimitiveArrays");
+  if (Universe::heap()->supports_object_pinning()) {
+    for (jint i = 0; i < count; i++) {
+      if (arrays[i] != NULL) {
+        Universe::heap()->unpin_object(thread,
+                                       JNIHandles::resolve_non_null(arrays[i]));
+      }
+    }
+  } else {
+    GC_locker::unlock_critical(thread);
+  }
+JNI_END
+
 
 JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jboolean *isCopy))
   JNIWrapper("GetStringCritical");
@@ -4969,6 +5072,39 @@ void quicken_jni_functions() {
     if (func != (address)-1) {
       jni_NativeInterface.GetDoubleField = (GetDoubleField_t)func;
     }
+    // Replace small Get<Primitive>ArrayRegion copies with fast versions
+    func = JNI_FastGetField::generate_fast_get_boolean_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetBooleanArrayRegion = (GetBooleanArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_byte_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetByteArrayRegion = (GetByteArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_char_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetCharArrayRegion = (GetCharArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_short_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetShortArrayRegion = (GetShortArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_int_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetIntArrayRegion = (GetIntArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_long_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetLongArrayRegion = (GetLongArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_float_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetFloatArrayRegion = (GetFloatArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_double_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetDoubleArrayRegion = (GetDoubleArrayRegion_t)func;
+    }
   }
 }
 
@@ -5184,6 +5320,29 @@ _JNI_IMPORT_OR_EXPORT_ jint JNICALL JNI_CreateJavaVM(JavaVM **vm, void **penv, v
       event.commit();
     }
 
+    // Start background class preloading before the synchronous warmup
+    // below so the two can overlap
+    if (ClassPreloadFile != NULL) {
+      ClassPreloader::start(thread);
+      if (thread->has_pending_exception()) {
+        thread->clear_pending_exception();
+      }
+    }
+
+    // Pre-charge method counters recorded by a previous run, before any
+    // warmup compile requests so seeded MethodData is in place first
+    if (ProfileSeedFile != NULL) {
+      CompileBroker::seed_profiles(thread);
+      if (thread->has_pending_exception()) {
+        thread->clear_pending_exception();
+      }
+    }
+
+    // Eagerly request compilation of methods recorded by a previous run
+    if (CompilationWarmUpFile != NULL) {
+      CompileBroker::warm_up_compilations(thread);
+    }
+
 #ifndef PRODUCT
   #ifndef TARGET_OS_FAMILY_windows
     #define CALL_TEST_FUNC_WITH_WRAPPER_IF_NEEDED(f) f()
@@ -5492,7 +5651,7 @@ jint JNICALL jni_DetachCurrentThread(JavaVM *vm)  {
   // (platform-dependent) methods where we do alternate stack
   // maintenance work?)
   thread->exit(false, JavaThread::jni_detach);
-  delete thread;
+  Threads::smr_delete(thread);
 
 #ifndef USDT2
   DTRACE_PROBE1(hotspot_jni, DetachCurrentThread__return, JNI_OK);
@@ -53,6 +53,21 @@
 //
 // There is a hypothetical safepoint counter wraparound. But it's not
 // a practical concern.
+//
+// jfieldIDs do not record volatility, so the fast versions service
+// volatile field reads as well. A volatile read requires acquire
+// semantics, which plain loads already provide on TSO platforms; ports
+// with weaker memory models must emit the acquire barrier after the
+// speculative load.
+//
+// The same speculation scheme is used for small Get<Primitive>ArrayRegion
+// copies on platforms that implement generate_fast_get_array_region0():
+// if the safepoint counter is unchanged after the copy, no GC could have
+// moved the array and the caller's buffer holds a consistent snapshot;
+// otherwise the region is copied again from scratch by the slow version
+// (partial speculative stores into the caller's buffer are simply
+// overwritten). Large copies stay on the slow path since re-copying
+// them on a collision would be costly.
 
 class JNI_FastGetField : AllStatic {
  private:
@@ -64,6 +79,7 @@ class JNI_FastGetField : AllStatic {
 
   static address generate_fast_get_int_field0(BasicType type);
   static address generate_fast_get_float_field0(BasicType type);
+  static address generate_fast_get_array_region0(BasicType type);
 
  public:
 #if defined(_WINDOWS) && !defined(_WIN64)
@@ -86,6 +102,17 @@ class JNI_FastGetField : AllStatic {
   static address generate_fast_get_float_field();
   static address generate_fast_get_double_field();
 
+  // Fast paths for small Get<Primitive>ArrayRegion copies. A port that
+  // does not implement them returns (address)-1 like the field accessors.
+  static address generate_fast_get_boolean_array_region();
+  static address generate_fast_get_byte_array_region();
+  static address generate_fast_get_char_array_region();
+  static address generate_fast_get_short_array_region();
+  static address generate_fast_get_int_array_region();
+  static address generate_fast_get_long_array_region();
+  static address generate_fast_get_float_array_region();
+  static address generate_fast_get_double_array_region();
+
   // If pc is in speculative_load_pclist, return the corresponding
   // slow case entry pc. Otherwise, return -1.
   // This is used by signal/exception handler to handle such case:
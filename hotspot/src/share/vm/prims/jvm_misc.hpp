@@ -66,6 +66,23 @@ extern "C" {
       (JNIEnv *env, jobject obj, jfieldID fieldID);
   typedef jdouble (JNICALL *GetDoubleField_t)
     (JNIEnv *env, jobject obj, jfieldID fieldID);
+
+  typedef void (JNICALL *GetBooleanArrayRegion_t)
+      (JNIEnv *env, jbooleanArray array, jsize start, jsize len, jboolean *buf);
+  typedef void (JNICALL *GetByteArrayRegion_t)
+      (JNIEnv *env, jbyteArray array, jsize start, jsize len, jbyte *buf);
+  typedef void (JNICALL *GetCharArrayRegion_t)
+      (JNIEnv *env, jcharArray array, jsize start, jsize len, jchar *buf);
+  typedef void (JNICALL *GetShortArrayRegion_t)
+      (JNIEnv *env, jshortArray array, jsize start, jsize len, jshort *buf);
+  typedef void (JNICALL *GetIntArrayRegion_t)
+      (JNIEnv *env, jintArray array, jsize start, jsize len, jint *buf);
+  typedef void (JNICALL *GetLongArrayRegion_t)
+      (JNIEnv *env, jlongArray array, jsize start, jsize len, jlong *buf);
+  typedef void (JNICALL *GetFloatArrayRegion_t)
+      (JNIEnv *env, jfloatArray array, jsize start, jsize len, jfloat *buf);
+  typedef void (JNICALL *GetDoubleArrayRegion_t)
+      (JNIEnv *env, jdoubleArray array, jsize start, jsize len, jdouble *buf);
 }
 
 void    quicken_jni_functions();
@@ -77,5 +94,13 @@ address jni_GetIntField_addr();
 address jni_GetLongField_addr();
 address jni_GetFloatField_addr();
 address jni_GetDoubleField_addr();
+address jni_GetBooleanArrayRegion_addr();
+address jni_GetByteArrayRegion_addr();
+address jni_GetCharArrayRegion_addr();
+address jni_GetShortArrayRegion_addr();
+address jni_GetIntArrayRegion_addr();
+address jni_GetLongArrayRegion_addr();
+address jni_GetFloatArrayRegion_addr();
+address jni_GetDoubleArrayRegion_addr();
 
 #endif // SHARE_VM_PRIMS_JVM_MISC_HPP
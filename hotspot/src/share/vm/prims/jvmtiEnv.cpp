@@ -1301,11 +1301,19 @@ JvmtiEnv::GetStackTrace(JavaThread* java_thread, jint start_depth, jint max_fram
   if (is_thread_fully_suspended(java_thread, true, &debug_bits)) {
     err = get_stack_trace(java_thread, start_depth, max_frame_count, frame_buffer, count_ptr);
   } else {
-    // JVMTI get stack trace at safepoint. Do not require target thread to
-    // be suspended.
-    VM_GetStackTrace op(this, java_thread, start_depth, max_frame_count, frame_buffer, count_ptr);
-    VMThread::execute(&op);
-    err = op.result();
+    // Try to sample the stack via a handshake, which pins only the target
+    // thread instead of bringing every thread to a safepoint.
+    GetStackTraceClosure hs_op(this, start_depth, max_frame_count, frame_buffer, count_ptr);
+    ThreadsListHandle tlh;
+    if (tlh.includes(java_thread) && Handshake::try_execute(&hs_op, java_thread)) {
+      err = hs_op.result();
+    } else {
+      // JVMTI get stack trace at safepoint. Do not require target thread to
+      // be suspended.
+      VM_GetStackTrace op(this, java_thread, start_depth, max_frame_count, frame_buffer, count_ptr);
+      VMThread::execute(&op);
+      err = op.result();
+    }
   }
 
   return err;
@@ -816,8 +816,9 @@ JvmtiEnvBase::get_stack_trace(JavaThread *java_thread,
   uint32_t debug_bits = 0;
 #endif
   assert((SafepointSynchronize::is_at_safepoint() ||
+          java_thread->is_handshake_pinned() ||
           is_thread_fully_suspended(java_thread, false, &debug_bits)),
-         "at safepoint or target thread is suspended");
+         "at safepoint or target thread is pinned or suspended");
   int count = 0;
   if (java_thread->has_last_Java_frame()) {
     RegisterMap reg_map(java_thread);
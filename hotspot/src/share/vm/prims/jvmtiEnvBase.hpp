@@ -32,6 +32,7 @@
 #include "runtime/fieldDescriptor.hpp"
 #include "runtime/frame.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/thread.hpp"
 #include "runtime/vm_operations.hpp"
 #include "utilities/growableArray.hpp"
@@ -445,6 +446,37 @@ public:
   }
 };
 
+// Handshake closure to get a stack trace while only the target thread is
+// pinned - see JvmtiEnv::GetStackTrace.
+class GetStackTraceClosure : public HandshakeClosure {
+private:
+  JvmtiEnv *_env;
+  jint _start_depth;
+  jint _max_count;
+  jvmtiFrameInfo *_frame_buffer;
+  jint *_count_ptr;
+  jvmtiError _result;
+
+public:
+  GetStackTraceClosure(JvmtiEnv *env, jint start_depth, jint max_count,
+                       jvmtiFrameInfo* frame_buffer, jint* count_ptr) {
+    _env = env;
+    _start_depth = start_depth;
+    _max_count = max_count;
+    _frame_buffer = frame_buffer;
+    _count_ptr = count_ptr;
+    _result = JVMTI_ERROR_THREAD_NOT_ALIVE;
+  }
+  jvmtiError result() { return _result; }
+  void do_thread(JavaThread* target) {
+    if (!target->is_exiting() && target->threadObj() != NULL) {
+      _result = ((JvmtiEnvBase *)_env)->get_stack_trace(target,
+                                                        _start_depth, _max_count,
+                                                        _frame_buffer, _count_ptr);
+    }
+  }
+};
+
 // forward declaration
 struct StackInfoNode;
 
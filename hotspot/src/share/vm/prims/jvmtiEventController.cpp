@@ -85,6 +85,8 @@ static const jlong  VM_OBJECT_ALLOC_BIT = (((jlong)1) << (JVMTI_EVENT_VM_OBJECT_
 
 // bits for extension events
 static const jlong  CLASS_UNLOAD_BIT = (((jlong)1) << (EXT_EVENT_CLASS_UNLOAD - TOTAL_MIN_EVENT_TYPE_VAL));
+static const jlong  SAMPLED_MONITOR_CONTENDED_ENTER_BIT = (((jlong)1) << (EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER - TOTAL_MIN_EVENT_TYPE_VAL));
+static const jlong  SAMPLED_ALLOCATION_BIT = (((jlong)1) << (EXT_EVENT_SAMPLED_ALLOCATION - TOTAL_MIN_EVENT_TYPE_VAL));
 
 
 static const jlong  MONITOR_BITS = MONITOR_CONTENDED_ENTER_BIT | MONITOR_CONTENDED_ENTERED_BIT |
@@ -604,6 +606,8 @@ JvmtiEventControllerPrivate::recompute_enabled() {
     JvmtiExport::set_should_post_data_dump((any_env_thread_enabled & DATA_DUMP_BIT) != 0);
     JvmtiExport::set_should_post_class_prepare((any_env_thread_enabled & CLASS_PREPARE_BIT) != 0);
     JvmtiExport::set_should_post_class_unload((any_env_thread_enabled & CLASS_UNLOAD_BIT) != 0);
+    JvmtiExport::set_should_post_sampled_monitor_contended_enter((any_env_thread_enabled & SAMPLED_MONITOR_CONTENDED_ENTER_BIT) != 0);
+    JvmtiExport::set_should_post_sampled_allocation((any_env_thread_enabled & SAMPLED_ALLOCATION_BIT) != 0);
     JvmtiExport::set_should_post_monitor_contended_enter((any_env_thread_enabled & MONITOR_CONTENDED_ENTER_BIT) != 0);
     JvmtiExport::set_should_post_monitor_contended_entered((any_env_thread_enabled & MONITOR_CONTENDED_ENTERED_BIT) != 0);
     JvmtiExport::set_should_post_monitor_wait((any_env_thread_enabled & MONITOR_WAIT_BIT) != 0);
@@ -730,6 +734,12 @@ JvmtiEventControllerPrivate::set_extension_event_callback(JvmtiEnvBase *env,
     case EXT_EVENT_CLASS_UNLOAD :
       ext_callbacks->ClassUnload = callback;
       break;
+    case EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER :
+      ext_callbacks->SampledMonitorContendedEnter = callback;
+      break;
+    case EXT_EVENT_SAMPLED_ALLOCATION :
+      ext_callbacks->SampledAllocation = callback;
+      break;
     default:
       ShouldNotReachHere();
   }
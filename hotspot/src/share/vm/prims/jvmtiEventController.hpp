@@ -46,12 +46,16 @@ class JvmtiEnvBase;
 // Extension events start JVMTI_MIN_EVENT_TYPE_VAL-1 and work towards 0.
 typedef enum {
   EXT_EVENT_CLASS_UNLOAD = JVMTI_MIN_EVENT_TYPE_VAL-1,
-  EXT_MIN_EVENT_TYPE_VAL = EXT_EVENT_CLASS_UNLOAD,
+  EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER = JVMTI_MIN_EVENT_TYPE_VAL-2,
+  EXT_EVENT_SAMPLED_ALLOCATION = JVMTI_MIN_EVENT_TYPE_VAL-3,
+  EXT_MIN_EVENT_TYPE_VAL = EXT_EVENT_SAMPLED_ALLOCATION,
   EXT_MAX_EVENT_TYPE_VAL = EXT_EVENT_CLASS_UNLOAD
 } jvmtiExtEvent;
 
 typedef struct {
   jvmtiExtensionEvent ClassUnload;
+  jvmtiExtensionEvent SampledMonitorContendedEnter;
+  jvmtiExtensionEvent SampledAllocation;
 } jvmtiExtEventCallbacks;
 
 
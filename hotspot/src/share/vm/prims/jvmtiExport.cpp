@@ -43,10 +43,12 @@
 #include "prims/jvmtiThreadState.inline.hpp"
 #include "prims/jvmtiRedefineClasses.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/handles.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
+#include "runtime/serviceThread.hpp"
 #include "runtime/thread.hpp"
 #include "runtime/vframe.hpp"
 #include "services/attachListener.hpp"
@@ -1075,7 +1077,11 @@ void JvmtiExport::post_thread_end(JavaThread *thread) {
 }
 
 void JvmtiExport::post_object_free(JvmtiEnv* env, jlong tag) {
-  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at safepoint");
+  // Posted either directly from the GC safepoint, or afterwards from the
+  // service thread when the tag map defers the events (DeferObjectFreeEvents).
+  assert(SafepointSynchronize::is_at_safepoint() ||
+         ServiceThread::is_service_thread(Thread::current()),
+         "must be executed at safepoint or in the service thread");
   assert(env->is_enabled(JVMTI_EVENT_OBJECT_FREE), "checking");
 
   EVT_TRIG_TRACE(JVMTI_EVENT_OBJECT_FREE, ("JVMTI [?] Trg Object Free triggered" ));
@@ -2052,6 +2058,82 @@ void JvmtiExport::post_monitor_contended_entered(JavaThread *thread, ObjectMonit
   }
 }
 
+// Running count of contended monitor enters used for the rate limiting
+// of the sampled extension event. Lost updates under races only perturb
+// the sampling slightly, which is acceptable for statistical data.
+static volatile jint _sampled_monitor_contended_count = 0;
+
+void JvmtiExport::post_sampled_monitor_contended_enter(JavaThread *thread, ObjectMonitor *obj_mntr) {
+  oop object = (oop)obj_mntr->object();
+  if (!ServiceUtil::visible_oop(object)) {
+    // Ignore monitor contended enter for vm internal object.
+    return;
+  }
+
+  // Built-in rate limiting: only every
+  // JvmtiMonitorContendedSampleInterval-th contended enter is reported.
+  jint count = Atomic::add(1, &_sampled_monitor_contended_count);
+  if (JvmtiMonitorContendedSampleInterval > 1 &&
+      (count % (jint)JvmtiMonitorContendedSampleInterval) != 0) {
+    return;
+  }
+
+  HandleMark hm(thread);
+  Handle h(thread, object);
+
+  EVT_TRIG_TRACE(EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER,
+                     ("JVMTI [%s] sampled monitor contended enter event triggered",
+                      JvmtiTrace::safe_get_thread_name(thread)));
+
+  JvmtiEnvIterator it;
+  for (JvmtiEnv* env = it.first(); env != NULL; env = it.next(env)) {
+    if (env->is_enabled((jvmtiEvent)EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER)) {
+      EVT_TRACE(EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER,
+                   ("JVMTI [%s] sampled monitor contended enter event sent",
+                    JvmtiTrace::safe_get_thread_name(thread)));
+      JvmtiMonitorEventMark  jem(thread, h());
+      JvmtiThreadEventTransition jet(thread);
+      jvmtiExtensionEvent callback = env->ext_callbacks()->SampledMonitorContendedEnter;
+      if (callback != NULL) {
+        (*callback)(env->jvmti_external(), jem.jni_env(), jem.jni_thread(), jem.jni_object());
+      }
+    }
+  }
+}
+
+void JvmtiExport::post_sampled_allocation(JavaThread *thread) {
+  // Built-in rate limiting: stay silent until the thread has allocated
+  // at least JvmtiAllocationSampleInterval bytes since the last sample.
+  // The counter is maintained by the TLAB refill slow path, so neither
+  // the check nor the bookkeeping touches the allocation fast path.
+  if (thread->tlab().bytes_since_last_sample() < (size_t)JvmtiAllocationSampleInterval) {
+    return;
+  }
+  thread->tlab().reset_bytes_since_last_sample();
+
+  jlong allocated = thread->cooked_allocated_bytes();
+
+  EVT_TRIG_TRACE(EXT_EVENT_SAMPLED_ALLOCATION,
+                     ("JVMTI [%s] sampled allocation event triggered",
+                      JvmtiTrace::safe_get_thread_name(thread)));
+
+  HandleMark hm(thread);
+  JvmtiEnvIterator it;
+  for (JvmtiEnv* env = it.first(); env != NULL; env = it.next(env)) {
+    if (env->is_enabled((jvmtiEvent)EXT_EVENT_SAMPLED_ALLOCATION)) {
+      EVT_TRACE(EXT_EVENT_SAMPLED_ALLOCATION,
+                   ("JVMTI [%s] sampled allocation event sent",
+                    JvmtiTrace::safe_get_thread_name(thread)));
+      JvmtiThreadEventMark jem(thread);
+      JvmtiJavaThreadEventTransition jet(thread);
+      jvmtiExtensionEvent callback = env->ext_callbacks()->SampledAllocation;
+      if (callback != NULL) {
+        (*callback)(env->jvmti_external(), jem.jni_env(), jem.jni_thread(), allocated);
+      }
+    }
+  }
+}
+
 void JvmtiExport::post_monitor_wait(JavaThread *thread, oop object,
                                           jlong timeout) {
   JvmtiThreadState *state = thread->jvmti_thread_state();
@@ -106,6 +106,8 @@ class JvmtiExport : public AllStatic {
   JVMTI_SUPPORT_FLAG(should_post_monitor_contended_entered)
   JVMTI_SUPPORT_FLAG(should_post_monitor_wait)
   JVMTI_SUPPORT_FLAG(should_post_monitor_waited)
+  JVMTI_SUPPORT_FLAG(should_post_sampled_monitor_contended_enter)
+  JVMTI_SUPPORT_FLAG(should_post_sampled_allocation)
   JVMTI_SUPPORT_FLAG(should_post_data_dump)
   JVMTI_SUPPORT_FLAG(should_post_garbage_collection_start)
   JVMTI_SUPPORT_FLAG(should_post_garbage_collection_finish)
@@ -344,6 +346,10 @@ class JvmtiExport : public AllStatic {
   static void post_monitor_contended_entered(JavaThread *thread, ObjectMonitor *obj_mntr) NOT_JVMTI_RETURN;
   static void post_monitor_wait(JavaThread *thread, oop obj, jlong timeout) NOT_JVMTI_RETURN;
   static void post_monitor_waited(JavaThread *thread, ObjectMonitor *obj_mntr, jboolean timed_out) NOT_JVMTI_RETURN;
+  // Rate-limited extension events; see JvmtiMonitorContendedSampleInterval
+  // and JvmtiAllocationSampleInterval.
+  static void post_sampled_monitor_contended_enter(JavaThread *thread, ObjectMonitor *obj_mntr) NOT_JVMTI_RETURN;
+  static void post_sampled_allocation(JavaThread *thread) NOT_JVMTI_RETURN;
   static void post_object_free(JvmtiEnv* env, jlong tag) NOT_JVMTI_RETURN;
   static void post_resource_exhausted(jint resource_exhausted_flags, const char* detail) NOT_JVMTI_RETURN;
   static void record_vm_internal_object_allocation(oop object) NOT_JVMTI_RETURN;
@@ -82,6 +82,41 @@ void JvmtiExtensions::register_extensions() {
     event_params
   };
   _ext_events->append(&ext_event);
+
+  // sampled monitor contention event; only every
+  // JvmtiMonitorContendedSampleInterval-th contended monitor enter is
+  // reported so the event stays cheap enough for always-on agents
+
+  static jvmtiParamInfo monitor_event_params[] = {
+    { (char*)"JNI Environment", JVMTI_KIND_IN, JVMTI_TYPE_JNIENV, JNI_FALSE },
+    { (char*)"Thread", JVMTI_KIND_IN, JVMTI_TYPE_JTHREAD, JNI_FALSE },
+    { (char*)"Object", JVMTI_KIND_IN, JVMTI_TYPE_JOBJECT, JNI_FALSE }
+  };
+  static jvmtiExtensionEventInfo monitor_ext_event = {
+    EXT_EVENT_SAMPLED_MONITOR_CONTENDED_ENTER,
+    (char*)"com.sun.hotspot.events.SampledMonitorContendedEnter",
+    (char*)"Rate-limited MONITOR_CONTENDED_ENTER event",
+    sizeof(monitor_event_params)/sizeof(monitor_event_params[0]),
+    monitor_event_params
+  };
+  _ext_events->append(&monitor_ext_event);
+
+  // sampled allocation event; posted from the TLAB refill slow path at
+  // most once per JvmtiAllocationSampleInterval allocated bytes
+
+  static jvmtiParamInfo alloc_event_params[] = {
+    { (char*)"JNI Environment", JVMTI_KIND_IN, JVMTI_TYPE_JNIENV, JNI_FALSE },
+    { (char*)"Thread", JVMTI_KIND_IN, JVMTI_TYPE_JTHREAD, JNI_FALSE },
+    { (char*)"Allocated Bytes", JVMTI_KIND_IN, JVMTI_TYPE_JLONG, JNI_FALSE }
+  };
+  static jvmtiExtensionEventInfo alloc_ext_event = {
+    EXT_EVENT_SAMPLED_ALLOCATION,
+    (char*)"com.sun.hotspot.events.SampledAllocation",
+    (char*)"Per-thread allocation sample event",
+    sizeof(alloc_event_params)/sizeof(alloc_event_params[0]),
+    alloc_event_params
+  };
+  _ext_events->append(&alloc_ext_event);
 }
 
 
@@ -940,6 +940,14 @@ JvmtiDeferredEvent JvmtiDeferredEvent::dynamic_code_generated_event(
   return event;
 }
 
+JvmtiDeferredEvent JvmtiDeferredEvent::object_free_event(JvmtiEnv* env,
+                                                         jlong tag) {
+  JvmtiDeferredEvent event = JvmtiDeferredEvent(TYPE_OBJECT_FREE);
+  event._event_data.object_free.env = env;
+  event._event_data.object_free.tag = tag;
+  return event;
+}
+
 void JvmtiDeferredEvent::post() {
   assert(ServiceThread::is_service_thread(Thread::current()),
          "Service thread must post enqueued events");
@@ -973,6 +981,15 @@ void JvmtiDeferredEvent::post() {
       }
       break;
     }
+    case TYPE_OBJECT_FREE: {
+      JvmtiEnv* env = _event_data.object_free.env;
+      // The environment may have been disposed, or the event disabled,
+      // while the event sat in the queue.
+      if (env->is_valid() && env->is_enabled(JVMTI_EVENT_OBJECT_FREE)) {
+        JvmtiExport::post_object_free(env, _event_data.object_free.tag);
+      }
+      break;
+    }
     default:
       ShouldNotReachHere();
   }
@@ -456,7 +456,8 @@ class JvmtiDeferredEvent VALUE_OBJ_CLASS_SPEC {
     TYPE_NONE,
     TYPE_COMPILED_METHOD_LOAD,
     TYPE_COMPILED_METHOD_UNLOAD,
-    TYPE_DYNAMIC_CODE_GENERATED
+    TYPE_DYNAMIC_CODE_GENERATED,
+    TYPE_OBJECT_FREE
   } Type;
 
   Type _type;
@@ -472,6 +473,10 @@ class JvmtiDeferredEvent VALUE_OBJ_CLASS_SPEC {
       const void* code_begin;
       const void* code_end;
     } dynamic_code_generated;
+    struct {
+      JvmtiEnv* env;
+      jlong tag;
+    } object_free;
   } _event_data;
 
   JvmtiDeferredEvent(Type t) : _type(t) {}
@@ -488,6 +493,8 @@ class JvmtiDeferredEvent VALUE_OBJ_CLASS_SPEC {
   static JvmtiDeferredEvent dynamic_code_generated_event(
       const char* name, const void* begin, const void* end)
           NOT_JVMTI_RETURN_(JvmtiDeferredEvent());
+  static JvmtiDeferredEvent object_free_event(JvmtiEnv* env, jlong tag)
+    NOT_JVMTI_RETURN_(JvmtiDeferredEvent());
 
   // Actually posts the event.
   void post() NOT_JVMTI_RETURN;
@@ -3137,7 +3137,34 @@ void VM_RedefineClasses::flush_dependent_code(instanceKlassHandle k_h, TRAPS) {
   // All dependencies have been recorded from startup or this is a second or
   // subsequent use of RedefineClasses
   if (JvmtiExport::all_dependencies_are_recorded()) {
-    Universe::flush_evol_dependents_on(k_h);
+    if (RedefineTargetedDeoptimization) {
+      // Limit the deoptimization to compiled code that depends on
+      // methods whose bytecodes actually changed. Methods that are
+      // EMCP (equivalent modulo constant pool) with their replacement
+      // keep their semantics, so code that inlined only EMCP methods
+      // can keep running; its inline caches are still cleared so that
+      // new calls resolve against the new method versions. The EMCP
+      // determination is repeated by check_methods_and_mark_as_obsolete()
+      // later in the operation; doing it twice is much cheaper than the
+      // recompilations that blanket deoptimization causes.
+      ResourceMark rm(THREAD);
+      GrowableArray<Method*>* changed_methods =
+        new GrowableArray<Method*>(_old_methods->length());
+      for (int i = 0; i < _matching_methods_length; i++) {
+        if (!MethodComparator::methods_EMCP(_matching_old_methods[i],
+                                            _matching_new_methods[i])) {
+          changed_methods->append(_matching_old_methods[i]);
+        }
+      }
+      for (int i = 0; i < _deleted_methods_length; i++) {
+        changed_methods->append(_deleted_methods[i]);
+      }
+      // Added methods need no entry; no existing compiled code can
+      // depend on a method that did not exist before this operation.
+      Universe::flush_evol_dependents_on(k_h, changed_methods);
+    } else {
+      Universe::flush_evol_dependents_on(k_h);
+    }
   } else {
     CodeCache::mark_all_nmethods_for_deoptimization();
 
@@ -3271,13 +3298,18 @@ void VM_RedefineClasses::redefine_single_class(jclass the_jclass,
   JvmtiBreakpoints& jvmti_breakpoints = JvmtiCurrentBreakpoints::get_jvmti_breakpoints();
   jvmti_breakpoints.clearall_in_class_at_safepoint(the_class_oop);
 
-  // Deoptimize all compiled code that depends on this class
-  flush_dependent_code(the_class, THREAD);
-
+  // Compute the method delta between the old and the new class version
+  // before any code is flushed so that flush_dependent_code() can limit
+  // the deoptimization to compiled code that depends on methods that
+  // actually changed.
   _old_methods = the_class->methods();
   _new_methods = scratch_class->methods();
   _the_class_oop = the_class_oop;
   compute_added_deleted_matching_methods();
+
+  // Deoptimize all compiled code that depends on this class
+  flush_dependent_code(the_class, THREAD);
+
   update_jmethod_ids();
 
   // Attach new constant pool to the original klass. The original
@@ -3323,7 +3323,23 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
 
         // post the event to the profiler
         if (post_object_free) {
-          JvmtiExport::post_object_free(env(), tag);
+          if (DeferObjectFreeEvents) {
+            // Hand the event to the service thread so the agent callback
+            // runs after the pause instead of inside it. With many tagged
+            // objects the callbacks dominate tag map processing time.
+            JvmtiDeferredEvent event =
+              JvmtiDeferredEvent::object_free_event(env(), tag);
+            if (SafepointSynchronize::is_at_safepoint()) {
+              // Don't want to take the queueing lock. Add it as pending and
+              // it will get enqueued later.
+              JvmtiDeferredEventQueue::add_pending_event(event);
+            } else {
+              MutexLockerEx ml(Service_lock, Mutex::_no_safepoint_check_flag);
+              JvmtiDeferredEventQueue::enqueue(event);
+            }
+          } else {
+            JvmtiExport::post_object_free(env(), tag);
+          }
         }
 
         ++freed;
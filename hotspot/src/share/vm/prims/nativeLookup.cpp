@@ -33,10 +33,13 @@
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/symbol.hpp"
+#include "code/nmethod.hpp"
 #include "prims/jvm_misc.hpp"
 #include "prims/nativeLookup.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
@@ -268,26 +271,97 @@ address NativeLookup::lookup_entry(methodHandle method, bool& in_base_library, T
 
 // Check all the formats of native implementation name to see if there is one
 // for the specified method.
-address NativeLookup::lookup_critical_entry(methodHandle method) {
-  if (!CriticalJNINatives) return NULL;
-
+// A method is eligible for the critical native calling convention if it
+// is a static non-synchronized method whose signature contains no object
+// types (arrays are allowed, they are passed as length/pointer pairs).
+static bool critical_native_eligible(methodHandle method) {
   if (method->is_synchronized() ||
       !method->is_static()) {
     // Only static non-synchronized methods are allowed
-    return NULL;
+    return false;
   }
 
-  ResourceMark rm;
-  address entry = NULL;
-
   Symbol* signature = method->signature();
   for (int end = 0; end < signature->utf8_length(); end++) {
     if (signature->byte_at(end) == 'L') {
       // Don't allow object types
-      return NULL;
+      return false;
     }
   }
 
+  return true;
+}
+
+// Critical entries registered explicitly through
+// JVM_RegisterCriticalNative. The list is only ever appended to, with a
+// CAS on the head, so lookups can walk it without synchronization.
+// Entries are keyed by jmethodID rather than Method* so that a
+// registration does not outlive its method version: after a class is
+// redefined, resolving the jmethodID yields the new Method and the
+// stale entry no longer matches.
+class CriticalNativeOverride : public CHeapObj<mtInternal> {
+ public:
+  jmethodID               _method_id;
+  address                 _entry;
+  CriticalNativeOverride* _next;
+
+  CriticalNativeOverride(jmethodID method_id, address entry) :
+    _method_id(method_id), _entry(entry), _next(NULL) { }
+};
+
+static CriticalNativeOverride* volatile _critical_overrides = NULL;
+
+address NativeLookup::lookup_critical_override(methodHandle method) {
+  for (CriticalNativeOverride* co = _critical_overrides;
+       co != NULL; co = co->_next) {
+    if (Method::resolve_jmethod_id(co->_method_id) == method()) {
+      return co->_entry;
+    }
+  }
+  return NULL;
+}
+
+bool NativeLookup::register_critical_override(methodHandle method, address entry) {
+  if (entry == NULL || !method->is_native() ||
+      !critical_native_eligible(method)) {
+    return false;
+  }
+
+  CriticalNativeOverride* co =
+    new CriticalNativeOverride(method->jmethod_id(), entry);
+  do {
+    co->_next = _critical_overrides;
+  } while (Atomic::cmpxchg_ptr(co, &_critical_overrides, co->_next) != co->_next);
+
+  // A native wrapper compiled before the registration bound the regular
+  // entry; make it not_entrant so it is regenerated with the critical
+  // entry, mirroring what Method::set_native_function does on
+  // re-registration.
+  nmethod* nm = method->code();
+  if (nm != NULL) {
+    nm->make_not_entrant();
+  }
+
+  return true;
+}
+
+address NativeLookup::lookup_critical_entry(methodHandle method) {
+  if (!CriticalJNINatives) return NULL;
+
+  if (!critical_native_eligible(method)) {
+    return NULL;
+  }
+
+  ResourceMark rm;
+  address entry = NULL;
+
+  // An explicitly registered critical entry takes precedence over the
+  // JavaCritical_ symbol lookup. It is also the only way to provide a
+  // critical implementation for natives bound via RegisterNatives to
+  // entry points that are not exported from a shared library.
+  entry = lookup_critical_override(method);
+  if (entry != NULL) return entry;
+
   // Compute critical name
   char* critical_name = critical_jni_name(method);
 
@@ -411,3 +485,24 @@ address NativeLookup::base_library_lookup(const char* class_name, const char* me
   guarantee(result != NULL, "must be non NULL");
   return result;
 }
+
+// Supported entry point for native agents and FFI layers, exported from
+// the JVM (see the make/*/makefiles/mapfile-vers* files). It registers
+// a critical implementation for a native method, which the JavaCritical_
+// symbol lookup cannot find when the method was bound via RegisterNatives
+// to an entry point in generated code rather than a shared library. The
+// critical function must follow the JavaCritical_ calling convention:
+// no JNIEnv or jclass arguments, arrays passed as length/pointer pairs.
+// Returns JNI_TRUE if the entry was registered, JNI_FALSE if the method
+// is not eligible; eligibility follows lookup_critical_entry (a static,
+// non-synchronized native method with no object types in its signature).
+JVM_ENTRY(jboolean, JVM_RegisterCriticalNative(JNIEnv *env, jmethodID method_id, void* entry))
+  Method* method = Method::checked_resolve_jmethod_id(method_id);
+  if (method == NULL) {
+    return JNI_FALSE;
+  }
+
+  methodHandle mh(THREAD, method);
+  return NativeLookup::register_critical_override(mh, (address)entry) ?
+           JNI_TRUE : JNI_FALSE;
+JVM_END
@@ -44,11 +44,20 @@ class NativeLookup : AllStatic {
   static address lookup_base (methodHandle method, bool& in_base_library, TRAPS);
   static address lookup_entry(methodHandle method, bool& in_base_library, TRAPS);
   static address lookup_entry_prefixed(methodHandle method, bool& in_base_library, TRAPS);
+  // Critical entry explicitly registered through
+  // JVM_RegisterCriticalNative, or NULL if none was registered.
+  static address lookup_critical_override(methodHandle method);
+
  public:
   // Lookup native function. May throw UnsatisfiedLinkError.
   static address lookup(methodHandle method, bool& in_base_library, TRAPS);
   static address lookup_critical_entry(methodHandle method);
 
+  // Record an explicitly registered critical entry for a native method.
+  // Returns false if the method is not eligible for a critical native
+  // calling convention.
+  static bool register_critical_override(methodHandle method, address entry);
+
   // Lookup native functions in base library.
   static address base_library_lookup(const char* class_name, const char* method_name, const char* signature);
 };
@@ -64,6 +64,33 @@ static char* jstr_to_utf(JNIEnv *env, jstring str, TRAPS) {
   return utfstr;
 }
 
+// Wrap a VM-internal buffer in a DirectByteBuffer without copying it.
+// The read-only view shares the underlying memory with the writable
+// buffer it is derived from, so reads stay zero-copy while Java code
+// cannot scribble over VM data. Used for the PerfData memory region
+// below; any other VM buffer that should be visible to Java-side
+// monitoring can be exposed the same way. Must be called with a
+// pending ThreadToNativeFromVM-compatible state (i.e. from a JVM_
+// entry); returns NULL with a pending exception on failure.
+static jobject make_direct_buffer(JavaThread* thread, JNIEnv* env,
+                                  char* address, size_t capacity,
+                                  bool read_only) {
+  ThreadToNativeFromVM ttnfv(thread);
+
+  jobject buffer = env->NewDirectByteBuffer(address, (jlong)capacity);
+  if (buffer == NULL || !read_only) {
+    return buffer;
+  }
+
+  jclass clazz = env->GetObjectClass(buffer);
+  jmethodID mid = env->GetMethodID(clazz, "asReadOnlyBuffer",
+                                   "()Ljava/nio/ByteBuffer;");
+  if (mid == NULL) {
+    return NULL;  // exception pending
+  }
+  return env->CallObjectMethod(buffer, mid);
+}
+
 PERF_ENTRY(jobject, Perf_Attach(JNIEnv *env, jobject unused, jstring user, int vmid, int mode))
 
   PerfWrapper("Perf_Attach");
@@ -89,10 +116,12 @@ PERF_ENTRY(jobject, Perf_Attach(JNIEnv *env, jobject unused, jstring user, int v
   PerfMemory::attach(user_utf, vmid, (PerfMemory::PerfMemoryMode) mode,
                      &address, &capacity, CHECK_NULL);
 
-  {
-    ThreadToNativeFromVM ttnfv(thread);
-    return env->NewDirectByteBuffer(address, (jlong)capacity);
-  }
+  // For a read-only attach, hand out a read-only view so monitoring
+  // code cannot corrupt the counters it is sampling. The attach(int,
+  // String) contract has always promised no more than read access for
+  // mode "r"; this enforces it.
+  return make_direct_buffer(thread, env, address, capacity,
+                            mode == PerfMemory::PERF_MODE_RO);
 
 PERF_END
 
@@ -284,6 +313,91 @@ PERF_ENTRY(jlong, Perf_HighResFrequency(JNIEnv *env, jobject perf))
 
 PERF_END
 
+// Supported entry points for native agents. These are exported from the
+// JVM (see the make/*/makefiles/mapfile-vers* files) so that JVMTI agents
+// and other in-process native code can allocate counters in the PerfData
+// memory region and look up existing ones, without incurring JNI
+// crossings on their update paths. The returned address refers directly
+// to the counter's value slot in the PerfData memory region and remains
+// valid for the life of the VM, as PerfData items are never deallocated.
+// The value slot is sampled asynchronously by external tools, so updates
+// must be made with a single store of the complete jlong value. Both
+// entry points must be called from a thread attached to the VM.
+
+JVM_ENTRY_NO_ENV(jlong*, JVM_CreatePerfLong(const char* name, jint variability,
+                                            jint units, jlong value))
+
+  PerfWrapper("JVM_CreatePerfLong");
+
+  if (name == NULL || strlen(name) == 0 ||
+      units <= 0 || units > PerfData::U_Last) {
+    return NULL;
+  }
+
+  // without UsePerfData, the PerfData lists are never initialized
+  if (!UsePerfData || PerfDataManager::exists(name)) {
+    return NULL;
+  }
+
+  PerfLong* pl = NULL;
+
+  switch(variability) {
+  case PerfData::V_Constant:
+    pl = PerfDataManager::create_long_constant(NULL_NS, (char*)name,
+                                               (PerfData::Units)units, value,
+                                               THREAD);
+    break;
+
+  case PerfData::V_Monotonic:
+    pl = PerfDataManager::create_long_counter(NULL_NS, (char*)name,
+                                              (PerfData::Units)units, value,
+                                              THREAD);
+    break;
+
+  case PerfData::V_Variable:
+    pl = PerfDataManager::create_long_variable(NULL_NS, (char*)name,
+                                               (PerfData::Units)units, value,
+                                               THREAD);
+    break;
+
+  default: /* Illegal Argument */
+    debug_only(warning("unexpected variability value: %d", variability));
+    return NULL;
+  }
+
+  if (HAS_PENDING_EXCEPTION) {
+    // an agent cannot reasonably handle a Java exception raised from a
+    // C entry point; report the failure by returning NULL instead.
+    CLEAR_PENDING_EXCEPTION;
+    return NULL;
+  }
+
+  if (pl == NULL || !pl->is_valid()) {
+    return NULL;
+  }
+
+  return (jlong*)pl->get_address();
+
+JVM_END
+
+JVM_ENTRY_NO_ENV(jlong*, JVM_FindPerfLong(const char* name))
+
+  PerfWrapper("JVM_FindPerfLong");
+
+  if (name == NULL || !UsePerfData) {
+    return NULL;
+  }
+
+  PerfData* pd = PerfDataManager::find_by_name(name);
+
+  if (pd == NULL || !pd->is_valid() || pd->data_type() != T_LONG) {
+    return NULL;
+  }
+
+  return (jlong*)pd->get_address();
+
+JVM_END
+
 /// JVM_RegisterPerfMethods
 
 #define CC (char*)  /*cast a literal from (const char*)*/
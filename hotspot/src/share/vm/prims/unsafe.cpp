@@ -34,6 +34,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/reflection.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.hpp"
 #include "services/threadService.hpp"
 #include "trace/tracing.hpp"
@@ -626,6 +627,27 @@ UNSAFE_ENTRY(void, Unsafe_FreeMemory(JNIEnv *env, jobject unsafe, jlong addr))
   os::free(p);
 UNSAFE_END
 
+// Fill path shared by the setMemory entry points. The byte fill stub,
+// when one was generated for this CPU, stores the pattern with wide
+// vector stores, which still preserves the byte-level store atomicity
+// setMemory guarantees. The stub takes a jint count, so very large
+// fills are done in max_jint chunks.
+static void unsafe_set_memory(void* p, size_t sz, jbyte value) {
+  typedef void (*fill_func_t)(void* to, jbyte value, jint count);
+  fill_func_t fill = CAST_TO_FN_PTR(fill_func_t, StubRoutines::jbyte_fill());
+  if (fill == NULL) {
+    Copy::fill_to_memory_atomic(p, sz, value);
+    return;
+  }
+  char* to = (char*) p;
+  while (sz > 0) {
+    jint chunk = (jint) MIN2(sz, (size_t) max_jint);
+    fill(to, value, chunk);
+    to += chunk;
+    sz -= (size_t) chunk;
+  }
+}
+
 UNSAFE_ENTRY(void, Unsafe_SetMemory(JNIEnv *env, jobject unsafe, jlong addr, jlong size, jbyte value))
   UnsafeWrapper("Unsafe_SetMemory");
   size_t sz = (size_t)size;
@@ -633,7 +655,7 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory(JNIEnv *env, jobject unsafe, jlong addr, jlo
     THROW(vmSymbols::java_lang_IllegalArgumentException());
   }
   char* p = (char*) addr_from_java(addr);
-  Copy::fill_to_memory_atomic(p, sz, value);
+  unsafe_set_memory(p, sz, value);
 UNSAFE_END
 
 UNSAFE_ENTRY(void, Unsafe_SetMemory2(JNIEnv *env, jobject unsafe, jobject obj, jlong offset, jlong size, jbyte value))
@@ -644,7 +666,7 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory2(JNIEnv *env, jobject unsafe, jobject obj, j
   }
   oop base = JNIHandles::resolve(obj);
   void* p = index_oop_from_field_offset_long(base, offset);
-  Copy::fill_to_memory_atomic(p, sz, value);
+  unsafe_set_memory(p, sz, value);
 UNSAFE_END
 
 UNSAFE_ENTRY(void, Unsafe_CopyMemory(JNIEnv *env, jobject unsafe, jlong srcAddr, jlong dstAddr, jlong size))
@@ -683,6 +705,29 @@ UNSAFE_ENTRY(void, Unsafe_CopyMemory2(JNIEnv *env, jobject unsafe, jobject srcOb
   Copy::conjoint_memory_atomic(src, dst, sz);
 UNSAFE_END
 
+UNSAFE_ENTRY(void, Unsafe_CopySwapMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size, jlong elemSize))
+  UnsafeWrapper("Unsafe_CopySwapMemory0");
+  if (size == 0) {
+    return;
+  }
+  size_t sz = (size_t)size;
+  size_t esz = (size_t)elemSize;
+  if (sz != (julong)size || size < 0 ||
+      (esz != 2 && esz != 4 && esz != 8) ||
+      (sz % esz) != 0) {
+    THROW(vmSymbols::java_lang_IllegalArgumentException());
+  }
+  oop srcp = JNIHandles::resolve(srcObj);
+  oop dstp = JNIHandles::resolve(dstObj);
+  if (dstp != NULL && !dstp->is_typeArray()) {
+    // This works only for non-oop arrays at present, as in copyMemory.
+    THROW(vmSymbols::java_lang_IllegalArgumentException());
+  }
+  address src = (address) index_oop_from_field_offset_long(srcp, srcOffset);
+  address dst = (address) index_oop_from_field_offset_long(dstp, dstOffset);
+  Copy::conjoint_swap(src, dst, sz, esz);
+UNSAFE_END
+
 
 ////// Random queries
 
@@ -1635,6 +1680,10 @@ JNINativeMethod memcopy_methods_15[] = {
     {CC"copyMemory",         CC"("ADR ADR"J)V",          FN_PTR(Unsafe_CopyMemory)}
 };
 
+JNINativeMethod copyswap_methods[] = {
+    {CC"copySwapMemory0",    CC"("OBJ"J"OBJ"JJJ)V",      FN_PTR(Unsafe_CopySwapMemory0)}
+};
+
 JNINativeMethod anonk_methods[] = {
     {CC"defineAnonymousClass", CC"("DAC_Args")"CLS,      FN_PTR(Unsafe_DefineAnonymousClass)},
 };
@@ -1736,6 +1785,9 @@ JVM_ENTRY(void, JVM_RegisterUnsafeMethods(JNIEnv *env, jclass unsafecls))
       }
     }
 
+    // Unsafe.copySwapMemory0 (optional, depends on the JDK version)
+    register_natives("copySwapMemory0 method", env, unsafecls, copyswap_methods, sizeof(copyswap_methods)/sizeof(JNINativeMethod));
+
     // Unsafe.defineAnonymousClass
     if (EnableInvokeDynamic) {
       register_natives("1.7 define anonymous class method", env, unsafecls, anonk_methods, sizeof(anonk_methods)/sizeof(JNINativeMethod));
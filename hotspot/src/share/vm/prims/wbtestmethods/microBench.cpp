@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+
+#include "classfile/javaClasses.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "memory/barrierSet.inline.hpp"
+#include "memory/oopFactory.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/objArrayOop.hpp"
+#include "oops/oop.inline.hpp"
+#include "prims/jni.h"
+#include "prims/whitebox.hpp"
+#include "prims/wbtestmethods/microBench.hpp"
+#include "runtime/basicLock.hpp"
+#include "runtime/interfaceSupport.hpp"
+#include "runtime/os.hpp"
+#include "runtime/synchronizer.hpp"
+#include "utilities/macros.hpp"
+#if INCLUDE_ALL_GCS
+#include "gc_implementation/g1/g1SATBCardTableModRefBS.hpp"
+#endif // INCLUDE_ALL_GCS
+
+// In-VM microbenchmark kernels.
+//
+// Each kernel sets up its own scratch objects and then executes the
+// measured path 'iterations' times. The kernels allocate nothing inside
+// the measured loop (except alloc.tlab, whose loop body IS the
+// allocation path), so raw oops obtained during setup stay valid for a
+// run unless the loop itself can safepoint, in which case a Handle is
+// used instead.
+
+// The TLAB fast path: java.lang.Object has no fields, so nearly all of
+// the loop is CollectedHeap::common_mem_allocate plus header setup.
+static void bench_tlab_alloc(jlong iterations, TRAPS) {
+  instanceKlassHandle ik(THREAD, SystemDictionary::Object_klass());
+  for (jlong i = 0; i < iterations; i++) {
+    (void) ik->allocate_instance(CHECK);
+  }
+}
+
+// The reference write barrier of the current collector (the card mark
+// for the card-table collectors, the post barrier for G1). Only the
+// barrier is exercised, not the store itself: the target slot is an
+// element of a scratch object array and stays NULL throughout, so
+// re-dirtying its card is harmless.
+static void bench_write_barrier(jlong iterations, TRAPS) {
+  BarrierSet* bs = Universe::heap()->barrier_set();
+  objArrayOop arr = oopFactory::new_objArray(SystemDictionary::Object_klass(), 2, CHECK);
+  void* field = arr->base();
+  for (jlong i = 0; i < iterations; i++) {
+    bs->write_ref_field(field, (oop)arr);
+  }
+}
+
+// G1's pre (SATB) plus post barrier pair, as emitted around every
+// reference store. With marking inactive the pre barrier measures its
+// fast-path filter; the slot's pre-value is NULL, so nothing is ever
+// enqueued even if marking starts mid-run.
+static void bench_g1_barriers(jlong iterations, TRAPS) {
+#if INCLUDE_ALL_GCS
+  if (!UseG1GC) {
+    THROW_MSG(vmSymbols::java_lang_UnsupportedOperationException(),
+              "barrier.g1 requires -XX:+UseG1GC");
+  }
+  G1SATBCardTableModRefBS* bs =
+      (G1SATBCardTableModRefBS*)Universe::heap()->barrier_set();
+  objArrayOop arr = oopFactory::new_objArray(SystemDictionary::Object_klass(), 2, CHECK);
+  void* field = arr->base();
+  if (UseCompressedOops) {
+    for (jlong i = 0; i < iterations; i++) {
+      bs->write_ref_field_pre((narrowOop*)field, (oop)arr);
+      bs->write_ref_field(field, (oop)arr);
+    }
+  } else {
+    for (jlong i = 0; i < iterations; i++) {
+      bs->write_ref_field_pre((oop*)field, (oop)arr);
+      bs->write_ref_field(field, (oop)arr);
+    }
+  }
+#else
+  THROW_MSG(vmSymbols::java_lang_UnsupportedOperationException(),
+            "barrier.g1 requires a VM built with INCLUDE_ALL_GCS");
+#endif // INCLUDE_ALL_GCS
+}
+
+// Uncontended monitor enter/exit on a scratch object, taking the same
+// route as InterpreterRuntime::monitorenter. A bias revoke inside
+// fast_enter can safepoint, hence the Handle.
+static void bench_monitor(jlong iterations, TRAPS) {
+  oop obj = InstanceKlass::cast(SystemDictionary::Object_klass())->allocate_instance(CHECK);
+  Handle h_obj(THREAD, obj);
+  BasicLock lock;
+  for (jlong i = 0; i < iterations; i++) {
+    if (UseBiasedLocking) {
+      ObjectSynchronizer::fast_enter(h_obj, &lock, true, CHECK);
+    } else {
+      ObjectSynchronizer::slow_enter(h_obj, &lock, CHECK);
+    }
+    ObjectSynchronizer::fast_exit(h_obj(), &lock, THREAD);
+  }
+}
+
+typedef void (*BenchFn)(jlong iterations, TRAPS);
+
+typedef struct {
+  const char* name;
+  BenchFn     fn;
+} MicroBenchmarkEntry;
+
+static const MicroBenchmarkEntry micro_benchmarks[] = {
+  { "alloc.tlab",        bench_tlab_alloc    },
+  { "barrier.write",     bench_write_barrier },
+  { "barrier.g1",        bench_g1_barriers   },
+  { "monitor.enterexit", bench_monitor       },
+};
+
+WB_ENTRY(jlong, WB_RunMicroBenchmark(JNIEnv* env, jobject o, jstring name, jlong iterations))
+  ResourceMark rm(THREAD);
+  const char* bench_name = java_lang_String::as_utf8_string(JNIHandles::resolve_non_null(name));
+  if (iterations <= 0) {
+    THROW_MSG_0(vmSymbols::java_lang_IllegalArgumentException(),
+                "iterations must be positive");
+  }
+  BenchFn fn = NULL;
+  for (size_t i = 0; i < ARRAY_SIZE(micro_benchmarks); i++) {
+    if (strcmp(bench_name, micro_benchmarks[i].name) == 0) {
+      fn = micro_benchmarks[i].fn;
+      break;
+    }
+  }
+  if (fn == NULL) {
+    THROW_MSG_0(vmSymbols::java_lang_IllegalArgumentException(),
+                "unknown microbenchmark (expected alloc.tlab, barrier.write, "
+                "barrier.g1 or monitor.enterexit)");
+  }
+
+  // Time several independent runs so the report carries the run-to-run
+  // variance along with the mean; a noisy machine shows up as a large
+  // deviation instead of silently skewing a single number.
+  const int runs = 5;
+  double ns_per_op[runs];
+  double ns_per_tick = (double)NANOSECS_PER_SEC / (double)os::elapsed_frequency();
+  double sum = 0.0;
+  for (int run = 0; run < runs; run++) {
+    HandleMark hm(THREAD);
+    jlong start_ticks = os::elapsed_counter();
+    fn(iterations, CHECK_0);
+    jlong ticks = os::elapsed_counter() - start_ticks;
+    ns_per_op[run] = (double)ticks * ns_per_tick / (double)iterations;
+    sum += ns_per_op[run];
+  }
+  double mean = sum / runs;
+  double variance = 0.0;
+  for (int run = 0; run < runs; run++) {
+    double d = ns_per_op[run] - mean;
+    variance += d * d;
+  }
+  variance /= runs;
+  double stddev = sqrt(variance);
+
+  tty->print_cr("MicroBenchmark %s: " JLONG_FORMAT " iterations x %d runs",
+                bench_name, iterations, runs);
+  for (int run = 0; run < runs; run++) {
+    tty->print_cr("  run %d: %.1f ns/op", run + 1, ns_per_op[run]);
+  }
+  tty->print_cr("  mean: %.1f ns/op, stddev: %.1f ns/op (%.1f%%)",
+                mean, stddev, (mean > 0.0) ? (stddev * 100.0 / mean) : 0.0);
+  return (jlong)mean;
+WB_END
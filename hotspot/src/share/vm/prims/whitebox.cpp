@@ -31,6 +31,7 @@
 #include "classfile/classLoaderData.hpp"
 
 #include "prims/whitebox.hpp"
+#include "prims/wbtestmethods/microBench.hpp"
 #include "prims/wbtestmethods/parserTests.hpp"
 
 #include "runtime/arguments.hpp"
@@ -42,6 +43,7 @@
 
 #if INCLUDE_ALL_GCS
 #include "gc_implementation/g1/concurrentMark.hpp"
+#include "gc_implementation/g1/concurrentMarkThread.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
 #endif // INCLUDE_ALL_GCS
@@ -52,6 +54,7 @@
 
 #include "compiler/compileBroker.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/perfData.hpp"
 
 #define SIZE_T_MAX_VALUE ((size_t) -1)
 
@@ -240,6 +243,17 @@ WB_END
 WB_ENTRY(jint, WB_G1RegionSize(JNIEnv* env, jobject o))
   return (jint)HeapRegion::GrainBytes;
 WB_END
+
+WB_ENTRY(jboolean, WB_G1StartConcMarkCycle(JNIEnv* env, jobject o))
+  G1CollectedHeap* g1 = G1CollectedHeap::heap();
+  if (g1->concurrent_mark()->cmThread()->during_cycle()) {
+    // A cycle is already running; the caller should wait for it to
+    // finish (g1InConcurrentMark() turning false) and retry.
+    return false;
+  }
+  g1->collect(GCCause::_wb_conc_mark);
+  return true;
+WB_END
 #endif // INCLUDE_ALL_GCS
 
 #if INCLUDE_NMT
@@ -462,6 +476,76 @@ WB_ENTRY(void, WB_ClearMethodState(JNIEnv* env, jobject o, jobject method))
   }
 WB_END
 
+WB_ENTRY(jint, WB_CompileMethodAtLevel(JNIEnv* env, jobject o, jobject method, jint comp_level, jint bci))
+  jmethodID jmid = reflected_method_to_jmid(thread, env, method);
+  methodHandle mh(THREAD, Method::checked_resolve_jmethod_id(jmid));
+  bool is_osr = (bci != InvocationEntryBci);
+  if (is_osr ? !CompilationPolicy::can_be_osr_compiled(mh, comp_level)
+             : !CompilationPolicy::can_be_compiled(mh, comp_level)) {
+    return CompLevel_none;
+  }
+  nmethod* nm = CompileBroker::compile_method(mh, bci, comp_level, mh, mh->invocation_count(), "WhiteBox", THREAD);
+  while (nm == NULL && mh->queued_for_compilation()) {
+    // The request went to a background compiler thread; wait for it to
+    // be processed instead of making the test sleep and hope.
+    os::sleep(thread, 10, true);
+    nm = is_osr ? mh->lookup_osr_nmethod_for(bci, comp_level, false) : mh->code();
+  }
+  if (nm == NULL) {
+    nm = is_osr ? mh->lookup_osr_nmethod_for(bci, comp_level, false) : mh->code();
+  }
+  return (nm != NULL ? nm->comp_level() : CompLevel_none);
+WB_END
+
+WB_ENTRY(void, WB_DrainCompileQueue(JNIEnv* env, jobject o))
+  // Wait until the compile queues are empty and every compiler thread
+  // is idle so that a test observes a quiescent compiler before taking
+  // measurements.
+  while (CompileBroker::queue_size(CompLevel_full_optimization) > 0 ||
+         CompileBroker::queue_size(CompLevel_full_profile) > 0 ||
+         CompileBroker::is_compiling()) {
+    os::sleep(thread, 10, true);
+  }
+WB_END
+
+WB_ENTRY(jlongArray, WB_GetNMethodInfo(JNIEnv* env, jobject o, jobject method, jboolean is_osr))
+  jmethodID jmid = reflected_method_to_jmid(thread, env, method);
+  nmethod* code;
+  {
+    MutexLockerEx mu(Compile_lock);
+    methodHandle mh(THREAD, Method::checked_resolve_jmethod_id(jmid));
+    code = is_osr ? mh->lookup_osr_nmethod_for(InvocationEntryBci, CompLevel_none, false) : mh->code();
+  }
+  if (code == NULL) {
+    return NULL;
+  }
+  jlong info[4];
+  info[0] = (jlong) code->comp_level();
+  info[1] = (jlong) (intptr_t) code->insts_begin();
+  info[2] = (jlong) code->insts_size();
+  info[3] = (jlong) code->total_size();
+  ThreadToNativeFromVM ttn(thread);
+  jlongArray result = env->NewLongArray(4);
+  if (result == NULL) {
+    return NULL;
+  }
+  env->SetLongArrayRegion(result, 0, 4, info);
+  return result;
+WB_END
+
+WB_ENTRY(jlong, WB_GetPerfCounterLong(JNIEnv* env, jobject o, jstring name))
+  ResourceMark rm(THREAD);
+  const char* counter_name = java_lang_String::as_utf8_string(JNIHandles::resolve_non_null(name));
+  if (UsePerfData) {
+    PerfData* pd = PerfDataManager::find_by_name(counter_name);
+    if (pd != NULL && pd->is_valid() && pd->data_type() == T_LONG) {
+      return *(jlong*) pd->get_address();
+    }
+  }
+  THROW_MSG_0(vmSymbols::java_lang_IllegalArgumentException(),
+              "no long perf counter with the given name");
+WB_END
+
 WB_ENTRY(jboolean, WB_IsInStringTable(JNIEnv* env, jobject o, jstring javaString))
   ResourceMark rm(THREAD);
   int len;
@@ -561,6 +645,7 @@ static JNINativeMethod methods[] = {
   {CC"g1IsHumongous",      CC"(Ljava/lang/Object;)Z", (void*)&WB_G1IsHumongous     },
   {CC"g1NumFreeRegions",   CC"()J",                   (void*)&WB_G1NumFreeRegions  },
   {CC"g1RegionSize",       CC"()I",                   (void*)&WB_G1RegionSize      },
+  {CC"g1StartConcMarkCycle", CC"()Z",                 (void*)&WB_G1StartConcMarkCycle},
 #endif // INCLUDE_ALL_GCS
 #if INCLUDE_NMT
   {CC"NMTMalloc",           CC"(J)J",                 (void*)&WB_NMTMalloc          },
@@ -597,9 +682,18 @@ static JNINativeMethod methods[] = {
       CC"(Ljava/lang/reflect/Executable;II)Z",        (void*)&WB_EnqueueMethodForCompilation},
   {CC"clearMethodState",
       CC"(Ljava/lang/reflect/Executable;)V",          (void*)&WB_ClearMethodState},
+  {CC"compileMethodAtLevel",
+      CC"(Ljava/lang/reflect/Executable;II)I",        (void*)&WB_CompileMethodAtLevel},
+  {CC"drainCompileQueue", CC"()V",                    (void*)&WB_DrainCompileQueue},
+  {CC"getNMethodInfo",
+      CC"(Ljava/lang/reflect/Executable;Z)[J",        (void*)&WB_GetNMethodInfo},
+  {CC"getPerfCounterLong",
+      CC"(Ljava/lang/String;)J",                      (void*)&WB_GetPerfCounterLong},
   {CC"isInStringTable",   CC"(Ljava/lang/String;)Z",  (void*)&WB_IsInStringTable  },
   {CC"fullGC",   CC"()V",                             (void*)&WB_FullGC },
   {CC"readReservedMemory", CC"()V",                   (void*)&WB_ReadReservedMemory },
+  {CC"runMicroBenchmark",
+      CC"(Ljava/lang/String;J)J",                     (void*)&WB_RunMicroBenchmark },
 };
 
 #undef CC
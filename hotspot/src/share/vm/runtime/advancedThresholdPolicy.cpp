@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "runtime/advancedThresholdPolicy.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/simpleThresholdPolicy.inline.hpp"
 
 #ifdef TIERED
@@ -105,6 +106,42 @@ void AdvancedThresholdPolicy::update_rate(jlong t, Method* m) {
   }
 }
 
+// Sample the aggregate event rate every TieredPhaseDetectionInterval ms
+// and update the phase estimate. The application is considered to be in
+// steady state once the rate slope has stayed flat (within 25% of the
+// previous sample) for TieredPhaseStableSamples consecutive samples; a
+// new burst of activity flips the estimate back to startup. Racing
+// threads hand off the right to sample with a cmpxchg on the sample
+// time; losers simply skip the sample.
+void AdvancedThresholdPolicy::update_phase(jlong t) {
+  jlong prev_t = _phase_sample_time;
+  if (t - prev_t < (jlong)TieredPhaseDetectionInterval) return;
+  if (Atomic::cmpxchg(t, &_phase_sample_time, prev_t) != prev_t) return;
+
+  jlong events = _total_events;
+  double rate = (double)(events - _phase_sample_events) / (double)MAX2((jlong)1, t - prev_t);
+  _phase_sample_events = events;
+  double prev_rate = _phase_prev_rate;
+  _phase_prev_rate = rate;
+
+  if (prev_t != 0 && prev_rate > 0.0 && fabsd(rate - prev_rate) <= 0.25 * prev_rate) {
+    if (++_phase_stable_count >= (int)TieredPhaseStableSamples && !_steady_state) {
+      _steady_state = true;
+      if (PrintTieredEvents) {
+        tty->print_cr("Tiered phase detection: steady state (rate=%f events/ms)", rate);
+      }
+    }
+  } else {
+    _phase_stable_count = 0;
+    if (_steady_state) {
+      _steady_state = false;
+      if (PrintTieredEvents) {
+        tty->print_cr("Tiered phase detection: startup (rate=%f events/ms)", rate);
+      }
+    }
+  }
+}
+
 // Check if this method has been stale from a given number of milliseconds.
 // See select_task().
 bool AdvancedThresholdPolicy::is_stale(jlong t, jlong timeout, Method* m) {
@@ -129,14 +166,28 @@ double AdvancedThresholdPolicy::weight(Method* method) {
   return (method->rate() + 1) * ((method->invocation_count() + 1) *  (method->backedge_count() + 1));
 }
 
+// Weight of a queued task: the decaying event rate of the method scaled by
+// its accumulated activity, aged by the time the task has spent in the queue.
+// Without the age component a steady stream of hotter newcomers could starve
+// a moderately warm method indefinitely; with it, the weight of a waiting
+// task doubles every TieredCompileTaskTimeout milliseconds, which bounds its
+// wait relative to the hottest method in the queue. 'c' is the current value
+// of os::elapsed_counter().
+double AdvancedThresholdPolicy::task_weight(jlong c, CompileTask* task) {
+  jlong wait_ms = (c - task->time_queued()) * 1000 / os::elapsed_frequency();
+  return weight(task->method()) * (1.0 + (double)wait_ms / TieredCompileTaskTimeout);
+}
+
 // Apply heuristics and return true if x should be compiled before y
-bool AdvancedThresholdPolicy::compare_methods(Method* x, Method* y) {
-  if (x->highest_comp_level() > y->highest_comp_level()) {
+bool AdvancedThresholdPolicy::compare_tasks(jlong c, CompileTask* x, CompileTask* y) {
+  Method* mx = x->method();
+  Method* my = y->method();
+  if (mx->highest_comp_level() > my->highest_comp_level()) {
     // recompilation after deopt
     return true;
   } else
-    if (x->highest_comp_level() == y->highest_comp_level()) {
-      if (weight(x) > weight(y)) {
+    if (mx->highest_comp_level() == my->highest_comp_level()) {
+      if (task_weight(c, x) > task_weight(c, y)) {
         return true;
       }
     }
@@ -159,6 +210,7 @@ CompileTask* AdvancedThresholdPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_task = NULL;
   Method* max_method = NULL;
   jlong t = os::javaTimeMillis();
+  jlong c = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
@@ -181,8 +233,8 @@ CompileTask* AdvancedThresholdPolicy::select_task(CompileQueue* compile_queue) {
         continue;
       }
 
-      // Select a method with a higher rate
-      if (compare_methods(method, max_method)) {
+      // Select a method with a higher aged rate
+      if (compare_tasks(c, task, max_task)) {
         max_task = task;
         max_method = method;
       }
@@ -259,11 +311,19 @@ bool AdvancedThresholdPolicy::call_predicate(int i, int b, CompLevel cur_level)
 
 // If a method is old enough and is still in the interpreter we would want to
 // start profiling without waiting for the compiled method to arrive.
-// We also take the load on compilers into the account.
+// The interpreter updates the MDO cells with racy single-word increments,
+// so the profile costs nothing beyond the increments themselves, and it
+// pays off on both sides of the C2 queue feedback: with a short queue the
+// method can take the direct 0 -> 4 shortcut in common() once the profile
+// matures, and with a backed-up queue the method is headed for level 2,
+// from where an interpreter-collected profile enables the direct 2 -> 4
+// transition that skips level 3 entirely. Tier0InterpreterProfiling turned
+// off restores the old behavior of only profiling when C2 is keeping up.
 bool AdvancedThresholdPolicy::should_create_mdo(Method* method, CompLevel cur_level) {
   if (cur_level == CompLevel_none &&
-      CompileBroker::queue_size(CompLevel_full_optimization) <=
-      Tier3DelayOn * compiler_count(CompLevel_full_optimization)) {
+      (Tier0InterpreterProfiling ||
+       CompileBroker::queue_size(CompLevel_full_optimization) <=
+       Tier3DelayOn * compiler_count(CompLevel_full_optimization))) {
     int i = method->invocation_count();
     int b = method->backedge_count();
     double k = Tier0ProfilingStartPercentage / 100.0;
@@ -352,8 +412,12 @@ CompLevel AdvancedThresholdPolicy::common(Predicate p, Method* method, CompLevel
         // we introduce a feedback on the C2 queue size. If the C2 queue is sufficiently long
         // we choose to compile a limited profiled version and then recompile with full profiling
         // when the load on C2 goes down.
-        if (!disable_feedback && CompileBroker::queue_size(CompLevel_full_optimization) >
-                                 Tier3DelayOn * compiler_count(CompLevel_full_optimization)) {
+        // The same 0 -> 2 route is taken in steady state (see TieredPhaseDetection): methods
+        // becoming hot that late are usually the result of a phase change and should prove
+        // themselves at level 2 before we front the profiling overhead of level 3.
+        if (!disable_feedback && (in_steady_state() ||
+                                  CompileBroker::queue_size(CompLevel_full_optimization) >
+                                  Tier3DelayOn * compiler_count(CompLevel_full_optimization))) {
           next_level = CompLevel_limited_profile;
         } else {
           next_level = CompLevel_full_profile;
@@ -445,6 +509,10 @@ void AdvancedThresholdPolicy::submit_compile(methodHandle mh, int bci, CompLevel
 // Handle the invocation event.
 void AdvancedThresholdPolicy::method_invocation_event(methodHandle mh, methodHandle imh,
                                                       CompLevel level, nmethod* nm, JavaThread* thread) {
+  if (TieredPhaseDetection) {
+    _total_events++;
+    update_phase(os::javaTimeMillis());
+  }
   if (should_create_mdo(mh(), level)) {
     create_mdo(mh, thread);
   }
@@ -460,6 +528,10 @@ void AdvancedThresholdPolicy::method_invocation_event(methodHandle mh, methodHan
 // with a regular entry from here.
 void AdvancedThresholdPolicy::method_back_branch_event(methodHandle mh, methodHandle imh,
                                                        int bci, CompLevel level, nmethod* nm, JavaThread* thread) {
+  if (TieredPhaseDetection) {
+    _total_events++;
+    update_phase(os::javaTimeMillis());
+  }
   if (should_create_mdo(mh(), level)) {
     create_mdo(mh, thread);
   }
@@ -155,12 +155,32 @@ class CompileQueue;
  * - TieredRateUpdateMinTime and TieredRateUpdateMaxTime are parameters of the rate computation.
  *   Basically, the rate is not computed more frequently than TieredRateUpdateMinTime and is considered
  *   to be zero if no events occurred in TieredRateUpdateMaxTime.
+ *
+ * - TieredPhaseDetection enables a coarse estimate of the application phase. The aggregate event
+ *   rate (all invocation and backedge notifications per unit of time) grows while the application
+ *   is still warming up and flattens out once the hot set has been compiled. We sample the rate
+ *   every TieredPhaseDetectionInterval ms and declare steady state once the slope has stayed flat
+ *   for TieredPhaseStableSamples consecutive samples. During steady state methods becoming hot are
+ *   compiled at level 2 first (pattern b. below) instead of going straight to level 3, since at
+ *   that point the profiling overhead of level 3 is usually no longer worth fronting: such methods
+ *   are typically the result of a phase change and prove themselves at level 2 before we pay for
+ *   full profiling. A new burst of activity flips the estimate back to startup.
  */
 
 
 class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
   jlong _start_time;
 
+  // Application phase detection (see TieredPhaseDetection above).
+  // The event count and the steady state flag are updated racily like
+  // the per-method rates; phase detection only needs a coarse estimate.
+  jlong          _total_events;        // all invocation/backedge notifications seen
+  volatile jlong _phase_sample_time;   // time of the last aggregate rate sample
+  jlong          _phase_sample_events; // _total_events at the last sample
+  double         _phase_prev_rate;     // aggregate rate over the previous interval
+  int            _phase_stable_count;  // consecutive samples with a flat rate slope
+  volatile bool  _steady_state;        // true once the rate slope has flattened out
+
   // Call and loop predicates determine whether a transition to a higher compilation
   // level should be performed (pointers to predicate functions are passed to common().
   // Predicates also take compiler load into account.
@@ -185,8 +205,11 @@ class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
   inline bool is_stale(jlong t, jlong timeout, Method* m);
   // Compute the weight of the method for the compilation scheduling
   inline double weight(Method* method);
+  // Compute the weight of a queued task, aged by the time it has spent
+  // in the queue so that low-rate methods cannot be starved forever.
+  inline double task_weight(jlong c, CompileTask* task);
   // Apply heuristics and return true if x should be compiled before y
-  inline bool compare_methods(Method* x, Method* y);
+  inline bool compare_tasks(jlong c, CompileTask* x, CompileTask* y);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline void update_rate(jlong t, Method* m);
@@ -200,6 +223,9 @@ class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
   void create_mdo(methodHandle mh, JavaThread* thread);
   // Is method profiled enough?
   bool is_method_profiled(Method* method);
+  // Sample the aggregate event rate and update the phase estimate.
+  void update_phase(jlong t);
+  bool in_steady_state() const { return TieredPhaseDetection && _steady_state; }
 
   double _increase_threshold_at_ratio;
 
@@ -218,7 +244,9 @@ protected:
   virtual void method_back_branch_event(methodHandle method, methodHandle inlinee,
                                         int bci, CompLevel level, nmethod* nm, JavaThread* thread);
 public:
-  AdvancedThresholdPolicy() : _start_time(0) { }
+  AdvancedThresholdPolicy() : _start_time(0),
+    _total_events(0), _phase_sample_time(0), _phase_sample_events(0),
+    _phase_prev_rate(0.0), _phase_stable_count(0), _steady_state(false) { }
   // Select task is called by CompileBroker. We should return a task or NULL.
   virtual CompileTask* select_task(CompileQueue* compile_queue);
   virtual void initialize();
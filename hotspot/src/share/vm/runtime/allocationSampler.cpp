@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/threadLocalAllocBuffer.hpp"
+#include "oops/klass.hpp"
+#include "oops/method.hpp"
+#include "runtime/allocationSampler.hpp"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/vframe.hpp"
+#include "trace/tracing.hpp"
+#include "utilities/ostream.hpp"
+
+AllocationSampler::StackEntry AllocationSampler::_table[AllocationSampler::table_size];
+volatile jint AllocationSampler::_total_samples   = 0;
+volatile jint AllocationSampler::_dropped_samples = 0;
+
+intptr_t AllocationSampler::record_stack(JavaThread* thread, jlong bytes) {
+  if (!thread->has_last_Java_frame()) {
+    return 0;
+  }
+  Method* methods[max_frames];
+  int     bcis[max_frames];
+  int     depth = 0;
+  int     max_depth = (int)MIN2((intx)max_frames, AllocationSampleStackDepth);
+
+  {
+    ResourceMark rm(thread);
+    vframeStream vfst(thread);
+    for (; !vfst.at_end() && depth < max_depth; vfst.next()) {
+      methods[depth] = vfst.method();
+      bcis[depth]    = vfst.bci();
+      depth++;
+    }
+  }
+  if (depth == 0) {
+    return 0;
+  }
+
+  // Hash the frames into a stack id (never 0, which marks a free slot).
+  intptr_t id = 0;
+  for (int i = 0; i < depth; i++) {
+    id = id * 31 + (intptr_t)methods[i] + bcis[i];
+  }
+  if (id == 0) {
+    id = 1;
+  }
+
+  int idx = (int)(((uintptr_t)id >> 3) & (table_size - 1));
+  for (int probe = 0; probe < max_probes; probe++) {
+    StackEntry* e = &_table[(idx + probe) & (table_size - 1)];
+    intptr_t key = e->_id;
+    if (key == 0) {
+      key = Atomic::cmpxchg_ptr(id, &e->_id, (intptr_t)0);
+      if (key == 0) {
+        // We own the slot; publish the frames.  A concurrent loser with
+        // the same id may bump the counters before the frames are fully
+        // visible, which at worst garbles one printed stack - acceptable
+        // for a sampling profiler, and it avoids any locking here.
+        e->_depth = depth;
+        for (int i = 0; i < depth; i++) {
+          e->_methods[i] = methods[i];
+          e->_bcis[i]    = bcis[i];
+        }
+        key = id;
+      }
+    }
+    if (key == id) {
+      Atomic::inc(&e->_count);
+      Atomic::add(bytes, &e->_bytes);
+      Atomic::inc(&_total_samples);
+      return id;
+    }
+  }
+  Atomic::inc(&_dropped_samples);
+  return id;
+}
+
+void AllocationSampler::sample_if_due(JavaThread* thread, Klass* klass, size_t alloc_bytes) {
+  // The bytes allocated since the last refill are sitting in the tlab
+  // that is about to be discarded; slow-path allocations between refills
+  // are not counted, which under-weights humongous allocators slightly
+  // but keeps this accounting to two loads and an add.
+  size_t acc = thread->allocation_sample_bytes()
+             + thread->tlab().used_bytes() + alloc_bytes;
+  if (acc < (size_t)AllocationSampleInterval) {
+    thread->set_allocation_sample_bytes(acc);
+    return;
+  }
+  thread->set_allocation_sample_bytes(0);
+
+  intptr_t id = record_stack(thread, (jlong)acc);
+
+  EventAllocationSample event;
+  if (event.should_commit()) {
+    event.set_class(klass);
+    event.set_allocationSize(alloc_bytes);
+    event.set_sampleWeight(acc);
+    event.set_stackId((s8)id);
+    event.commit();
+  }
+}
+
+void AllocationSampler::reset() {
+  memset((void*)_table, 0, sizeof(_table));
+  _total_samples   = 0;
+  _dropped_samples = 0;
+}
+
+void AllocationSampler::print_on(outputStream* st) {
+  if (AllocationSampleInterval == 0) {
+    st->print_cr("Allocation sampling is disabled "
+                 "(use -XX:AllocationSampleInterval=<bytes> to enable).");
+    return;
+  }
+  st->print_cr("Allocation samples: %d (dropped: %d), interval: " UINTX_FORMAT " bytes",
+               _total_samples, _dropped_samples, AllocationSampleInterval);
+  ResourceMark rm;
+  for (int i = 0; i < table_size; i++) {
+    StackEntry* e = &_table[i];
+    if (e->_id == 0) {
+      continue;
+    }
+    st->print_cr("stack id " INTPTR_FORMAT ": %d samples, " JLONG_FORMAT " bytes",
+                 e->_id, e->_count, e->_bytes);
+    for (int f = 0; f < e->_depth; f++) {
+      Method* m = e->_methods[f];
+      // Methods may have been unloaded since the sample was taken.
+      if (m->is_valid_method()) {
+        st->print_cr("  at %s @ %d", m->name_and_sig_as_C_string(), e->_bcis[f]);
+      } else {
+        st->print_cr("  at (unloaded method " PTR_FORMAT ") @ %d", m, e->_bcis[f]);
+      }
+    }
+  }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_ALLOCATIONSAMPLER_HPP
+#define SHARE_VM_RUNTIME_ALLOCATIONSAMPLER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+class Klass;
+class Method;
+class outputStream;
+
+// Byte-interval allocation sampler.
+//
+// Threads accumulate their allocated bytes and, once
+// AllocationSampleInterval bytes have passed, the TLAB refill slow path
+// takes one sample: the allocating class and size, plus a bounded-depth
+// walk of the thread's own stack.  Stacks are aggregated in a fixed-size
+// lock-free table keyed by a hash of the frames (the stack id); the same
+// id is recorded in the AllocationSample trace event so binary traces can
+// be joined against the table.  Because the hook sits at TLAB boundaries
+// the overhead is bounded by the sampling interval, not by the allocation
+// rate.  Printed by jcmd VM.allocationSamples.
+class AllocationSampler : AllStatic {
+ public:
+  // Called from CollectedHeap::allocate_from_tlab_slow when the current
+  // tlab is about to be discarded; takes a sample if the thread has
+  // allocated at least AllocationSampleInterval bytes since its last one.
+  static void sample_if_due(JavaThread* thread, Klass* klass, size_t alloc_bytes);
+
+  // Resolve and print the aggregated stack table (jcmd VM.allocationSamples)
+  static void print_on(outputStream* st);
+  static void reset();
+
+ private:
+  enum {
+    table_size = 1024,    // entries; must be a power of two
+    max_probes = 8,       // linear probes before a sample is dropped
+    max_frames = 16       // hard bound on AllocationSampleStackDepth
+  };
+  struct StackEntry {
+    volatile intptr_t _id;      // stack hash, claimed once by CAS
+    volatile jint     _count;   // samples with this stack
+    volatile jlong    _bytes;   // allocated bytes attributed to this stack
+    int               _depth;
+    Method*           _methods[max_frames];
+    int               _bcis[max_frames];
+  };
+  static StackEntry    _table[table_size];
+  static volatile jint _total_samples;
+  static volatile jint _dropped_samples;
+
+  // Walks the thread's stack and returns the recorded stack id (0 if no
+  // walkable Java frames were found).
+  static intptr_t record_stack(JavaThread* thread, jlong bytes);
+};
+
+#endif // SHARE_VM_RUNTIME_ALLOCATIONSAMPLER_HPP
@@ -3632,6 +3632,14 @@ jint Arguments::apply_ergo() {
       vm_exit_during_initialization(
         "Incompatible compilation policy selected", NULL);
     }
+    // Without tiered compilation no profiled code is generated, so a
+    // separate heap for it would only waste code cache space.
+    if (SegmentedCodeCache) {
+      if (FLAG_IS_CMDLINE(SegmentedCodeCache)) {
+        warning("disabling SegmentedCodeCache; it requires TieredCompilation.");
+      }
+      FLAG_SET_DEFAULT(SegmentedCodeCache, false);
+    }
   }
   // Set NmethodSweepFraction after the size of the code cache is adapted (in case of tiered)
   if (FLAG_IS_DEFAULT(NmethodSweepFraction)) {
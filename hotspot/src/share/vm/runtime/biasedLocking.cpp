@@ -27,6 +27,7 @@
 #include "oops/markOop.hpp"
 #include "runtime/basicLock.hpp"
 #include "runtime/biasedLocking.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/task.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
@@ -501,6 +502,34 @@ public:
 };
 
 
+// Revokes the bias of one object while its bias owner is pinned in native
+// code by a handshake, without bringing the other threads to a safepoint.
+// See BiasedLocking::revoke_and_rebias.
+class RevokeOneBias : public HandshakeClosure {
+ private:
+  Handle _obj;
+  BiasedLocking::Condition _status_code;
+
+ public:
+  RevokeOneBias(Handle obj)
+    : _obj(obj)
+    , _status_code(BiasedLocking::NOT_BIASED) {}
+
+  virtual void do_thread(JavaThread* target) {
+    // Passing the pinned bias owner as the requesting thread makes
+    // revoke_bias skip its walk of the thread list, which would not be
+    // safe without the Threads_lock.
+    ResourceMark rm;
+    _status_code = revoke_bias(_obj(), false, false, target);
+    target->set_cached_monitor_info(NULL);
+  }
+
+  BiasedLocking::Condition status_code() const {
+    return _status_code;
+  }
+};
+
+
 class VM_BulkRevokeBias : public VM_RevokeBias {
 private:
   bool _bulk_rebias;
@@ -515,7 +544,61 @@ public:
     , _attempt_rebias_of_object(attempt_rebias_of_object) {}
 
   virtual VMOp_Type type() const { return VMOp_BulkRevokeBias; }
-  virtual bool doit_prologue()   { return true; }
+
+  virtual bool doit_prologue() {
+    // The heuristic decision in update_heuristics() and our safepoint
+    // are not atomic, so by the time we run, a bulk operation triggered
+    // by another thread may already have done the klass-wide work.
+    // Workloads which hand pools of objects between threads tend to
+    // trip the bulk heuristics for the same data type repeatedly, so
+    // re-check here and avoid a redundant safepoint when possible. In
+    // that case the passed object's bias is stale or its epoch has
+    // expired, and a CAS on its header -- the same fast paths
+    // revoke_and_rebias() uses -- meets the guarantees made to our
+    // caller without stopping the world.
+    oop obj = (*_obj)();
+    markOop mark = obj->mark();
+    Klass* k = obj->klass();
+    markOop prototype_header = k->prototype_header();
+
+    if (!prototype_header->has_bias_pattern()) {
+      // Another bulk revoke already disabled biasing for this data
+      // type, so any remaining bias on this object is stale.
+      if (mark->has_bias_pattern()) {
+        markOop res_mark = (markOop) Atomic::cmpxchg_ptr(prototype_header, obj->mark_addr(), mark);
+        assert(!(*(obj->mark_addr()))->has_bias_pattern(), "even if we raced, should still be revoked");
+      }
+      _status_code = BiasedLocking::BIAS_REVOKED;
+      return false;
+    }
+
+    if (_bulk_rebias &&
+        mark->has_bias_pattern() &&
+        prototype_header->bias_epoch() != mark->bias_epoch()) {
+      // A bulk rebias of this data type already ran since this
+      // object's bias was established; bumping the epoch again would
+      // accomplish nothing. The object's bias has expired, so revoke
+      // or rebias it with a CAS. If we lose a race, fall through to
+      // the safepoint rather than trying to sort out what happened.
+      if (_attempt_rebias_of_object) {
+        markOop rebiased_prototype = markOopDesc::encode(_requesting_thread, mark->age(), prototype_header->bias_epoch());
+        markOop res_mark = (markOop) Atomic::cmpxchg_ptr(rebiased_prototype, obj->mark_addr(), mark);
+        if (res_mark == mark) {
+          _status_code = BiasedLocking::BIAS_REVOKED_AND_REBIASED;
+          return false;
+        }
+      } else {
+        markOop unbiased_prototype = markOopDesc::prototype()->set_age(mark->age());
+        markOop res_mark = (markOop) Atomic::cmpxchg_ptr(unbiased_prototype, obj->mark_addr(), mark);
+        if (res_mark == mark) {
+          _status_code = BiasedLocking::BIAS_REVOKED;
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
 
   virtual void doit() {
     _status_code = bulk_revoke_or_rebias_at_safepoint((*_obj)(), _bulk_rebias, _attempt_rebias_of_object, _requesting_thread);
@@ -612,6 +695,22 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
       assert(cond == BIAS_REVOKED, "why not?");
       return cond;
     } else {
+      // If the bias owner is pinned in native code a handshake lets us
+      // revoke its bias right here, while every other thread keeps
+      // running. Concurrent revokers of the same object serialize on the
+      // bias owner's SR_lock inside the handshake and the loser sees an
+      // unbiased mark. Fall back to a global safepoint if the owner is
+      // running or has exited.
+      JavaThread* biaser = obj->mark()->biased_locker();
+      if (biaser != NULL && biaser != THREAD) {
+        ThreadsListHandle tlh;
+        if (tlh.includes(biaser)) {
+          RevokeOneBias single_revoke(obj);
+          if (Handshake::try_execute(&single_revoke, biaser)) {
+            return single_revoke.status_code();
+          }
+        }
+      }
       VM_RevokeBias revoke(&obj, (JavaThread*) THREAD);
       VMThread::execute(&revoke);
       return revoke.status_code();
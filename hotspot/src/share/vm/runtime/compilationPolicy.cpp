@@ -261,6 +261,12 @@ class CounterDecay : public AllStatic {
     if (mcs != NULL) {
       mcs->invocation_counter()->decay();
     }
+    if (DecayReceiverTypeProfile) {
+      MethodData* mdo = m->method_data();
+      if (mdo != NULL) {
+        mdo->decay_receiver_type_profile();
+      }
+    }
   }
 public:
   static void decay();
@@ -37,6 +37,7 @@
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiThreadState.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
@@ -1230,6 +1231,36 @@ void Deoptimization::load_class_by_index(constantPoolHandle constant_pool, int i
   }
 }
 
+// During a deoptimization storm many threads trap at the same site before
+// the recompiled code is installed, and each event pays for the full
+// MethodData bookkeeping even though only the first few updates can still
+// influence the recompile decision.  A small lock-free table keyed by
+// (nmethod, bci) counts traps per site so the storm tail can skip that
+// bookkeeping.  Entries are claimed and recycled racily; lost updates only
+// delay the skip, they never lose real profile state.
+struct TrapSiteCounter {
+  volatile intptr_t _site;
+  volatile jint     _count;
+};
+
+static const int _trap_site_table_size = 256;  // must be a power of two
+static TrapSiteCounter _trap_site_table[_trap_site_table_size];
+
+// Count one more trap at this site and return the total seen so far.
+static uint note_trap_site(nmethod* nm, int trap_bci) {
+  intptr_t site = (intptr_t)nm ^ ((intptr_t)(trap_bci + 1) << 3);
+  uint idx = (uint)(((uintptr_t)site >> 4) ^ ((uintptr_t)site >> 12)) &
+             (_trap_site_table_size - 1);
+  TrapSiteCounter* e = &_trap_site_table[idx];
+  if (e->_site != site) {
+    // Claim or recycle the slot.  A racing claim loses a few counts,
+    // which is harmless.
+    e->_site  = site;
+    e->_count = 0;
+  }
+  return (uint)Atomic::add(1, &e->_count);
+}
+
 JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint trap_request)) {
   HandleMark hm;
 
@@ -1250,6 +1281,8 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
   // Log a message
   Events::log(thread, "Uncommon trap: trap_request=" PTR32_FORMAT " fr.pc=" INTPTR_FORMAT,
               trap_request, fr.pc());
+  Events::log_vm_event(thread, VMTraceEvent::DEOPT,
+                       (intptr_t) trap_request, (intptr_t) fr.pc());
 
   {
     ResourceMark rm;
@@ -1274,6 +1307,15 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
     // Record this event in the histogram.
     gather_statistics(reason, action, trap_bc);
 
+    // Batch per-site bookkeeping: once a site has already driven this
+    // nmethod not entrant and its trap count is past the per-bytecode
+    // limit, further traps there are the tail of a storm from frames
+    // still executing the old code.  Their MethodData updates cannot
+    // change any recompile decision, so they are skipped below.
+    uint site_trap_count = note_trap_site(nm, trap_bci);
+    bool site_is_hot = nm->is_not_entrant() &&
+                       site_trap_count > (uint)PerBytecodeTrapLimit;
+
     // Ensure that we can record deopt. history:
     bool create_if_missing = ProfileTraps;
 
@@ -1470,7 +1512,7 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
     // aggressive optimization.
     bool inc_recompile_count = false;
     ProfileData* pdata = NULL;
-    if (ProfileTraps && update_trap_state && trap_mdo != NULL) {
+    if (ProfileTraps && !site_is_hot && update_trap_state && trap_mdo != NULL) {
       assert(trap_mdo == get_method_data(thread, trap_method, false), "sanity");
       uint this_trap_count = 0;
       bool maybe_prior_trap = false;
@@ -1529,6 +1571,11 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
         // PerBytecodeTrapLimit is more likely to take effect first,
         // if it is applicable.)
         make_not_entrant = true;
+        // A method-wide trap overflow means the profile that drove the
+        // last compile is systematically wrong, typically after a phase
+        // change, so open a re-profiling window rather than recompiling
+        // immediately from the same stale data.
+        reprofile = true;
       }
 
       // Here's more hysteresis:  If there has been a recompile at
@@ -1544,6 +1591,9 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
 
     // Recompile
     if (make_not_entrant) {
+      if (nm->is_not_entrant()) {
+        return; // another thread already ordered the recompile
+      }
       if (!nm->make_not_entrant()) {
         return; // the call did not change nmethod's state
       }
@@ -26,6 +26,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "utilities/ostream.hpp"
@@ -457,16 +458,60 @@ static Flag flagTable[] = {
 Flag* Flag::flags = flagTable;
 size_t Flag::numFlags = (sizeof(flagTable) / sizeof(Flag));
 
-inline bool str_equal(const char* s, const char* q, size_t len) {
-  // s is null terminated, q is not!
-  if (strlen(s) != (unsigned int) len) return false;
-  return strncmp(s, q, len) == 0;
+// Compares a flag name against a name fragment of the given length
+// (the fragment is not null terminated), with strcmp-compatible order.
+static int compare_flag_name(const char* flag_name, const char* name, size_t length) {
+  int cmp = strncmp(flag_name, name, length);
+  if (cmp == 0) {
+    // The flag name matches the fragment; it is greater if it has
+    // more characters.
+    cmp = (unsigned char) flag_name[length];
+  }
+  return cmp;
+}
+
+static int compare_flags_by_name(const void* a, const void* b) {
+  const Flag* fa = *(const Flag* const*) a;
+  const Flag* fb = *(const Flag* const*) b;
+  return strcmp(fa->_name, fb->_name);
+}
+
+// Index of the flag table sorted by name, so that lookups are a binary
+// search instead of a scan of the whole table. Built on first lookup,
+// which happens during argument parsing while the VM is still single
+// threaded; the race protection below is for paranoia only.
+static Flag** _sorted_flag_index = NULL;
+
+static Flag** sorted_flag_index() {
+  if (_sorted_flag_index == NULL) {
+    size_t n = Flag::numFlags - 1;  // exclude the sentinel
+    Flag** index = NEW_C_HEAP_ARRAY(Flag*, n, mtInternal);
+    for (size_t i = 0; i < n; i++) {
+      index[i] = &flagTable[i];
+    }
+    qsort(index, n, sizeof(Flag*), compare_flags_by_name);
+    if (Atomic::cmpxchg_ptr(index, &_sorted_flag_index, NULL) != NULL) {
+      // Another thread built the index first.
+      FREE_C_HEAP_ARRAY(Flag*, index, mtInternal);
+    }
+  }
+  return _sorted_flag_index;
 }
 
 // Search the flag table for a named flag
 Flag* Flag::find_flag(const char* name, size_t length, bool allow_locked) {
-  for (Flag* current = &flagTable[0]; current->_name != NULL; current++) {
-    if (str_equal(current->_name, name, length)) {
+  Flag** index = sorted_flag_index();
+  size_t lo = 0;
+  size_t hi = Flag::numFlags - 1;  // exclusive; excludes the sentinel
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    int cmp = compare_flag_name(index[mid]->_name, name, length);
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else if (cmp > 0) {
+      hi = mid;
+    } else {
+      Flag* current = index[mid];
       // Found a matching entry.
       // Don't report notproduct and develop flags in product builds.
       if (current->is_constant_in_binary()) {
@@ -494,6 +494,11 @@ class CommandLineFlags {
   product_pd(uintx, HeapBaseMinAddress,                                     \
           "OS specific low limit for heap base address")                    \
                                                                             \
+  product(uintx, HeapPlacementProbes, 4,                                    \
+          "Number of additional candidate heap bases to probe per "         \
+          "compressed oops mode when the preferred base is unavailable "    \
+          "(0 = only try the preferred base)")                              \
+                                                                            \
   diagnostic(bool, PrintCompressedOopsMode, false,                          \
           "Print compressed oops base address and encoding mode")           \
                                                                             \
@@ -621,6 +626,10 @@ class CommandLineFlags {
           "A thread requesting compilation is not blocked during "          \
           "compilation")                                                    \
                                                                             \
+  product(bool, BatchCompileRequests, false,                                \
+          "Buffer background compilation requests per thread and hand "     \
+          "them to the compile queue in batches")                           \
+                                                                            \
   product(bool, PrintVMQWaitTime, false,                                    \
           "Print out the waiting time in VM operation queue")               \
                                                                             \
@@ -900,6 +909,11 @@ class CommandLineFlags {
           "directory) of the dump file (defaults to java_pid<pid>.hprof "   \
           "in the working directory)")                                      \
                                                                             \
+  manageable(bool, HeapDumpViaFork, false,                                  \
+          "Fork the VM at the heap dump safepoint and write the dump from " \
+          "the child process so mutators resume immediately (POSIX only; "  \
+          "relies on fork being safe at the dump point)")                   \
+                                                                            \
   develop(uintx, SegmentedHeapDumpThreshold, 2*G,                           \
           "Generate a segmented heap dump (JAVA PROFILE 1.0.2 format) "     \
           "when the heap usage is larger than this")                        \
@@ -1000,6 +1014,10 @@ class CommandLineFlags {
   diagnostic(bool, PrintStubCode, false,                                    \
           "Print generated stub code")                                      \
                                                                             \
+  diagnostic(bool, BenchmarkStubRoutines, false,                            \
+          "Time the generated copy and fill stubs over a range of sizes "   \
+          "at startup and print a per-kernel report")                       \
+                                                                            \
   product(bool, StackTraceInThrowable, true,                                \
           "Collect backtrace in throwable when exception happens")          \
                                                                             \
@@ -1062,6 +1080,22 @@ class CommandLineFlags {
   develop(bool, MemProfiling, false,                                        \
           "Write memory usage profiling to log file")                       \
                                                                             \
+  product(bool, PCSampling, false,                                          \
+          "Sample the interrupted PC of running threads on a CPU-time "     \
+          "interval timer and aggregate hits by code location "             \
+          "(POSIX only; see jcmd VM.pcSamples)")                            \
+                                                                            \
+  product(intx, PCSamplingInterval, 10,                                     \
+          "CPU-time interval between PC samples, in milliseconds")          \
+                                                                            \
+  product(uintx, AllocationSampleInterval, 0,                               \
+          "Take an allocation sample every time a thread has allocated "    \
+          "this many bytes, checked at TLAB refill "                        \
+          "(0 = disabled; see jcmd VM.allocationSamples)")                  \
+                                                                            \
+  product(intx, AllocationSampleStackDepth, 8,                              \
+          "Maximum number of stack frames captured per allocation sample")  \
+                                                                            \
   notproduct(bool, PrintSystemDictionaryAtExit, false,                      \
           "Print the system dictionary at exit")                            \
                                                                             \
@@ -1118,6 +1152,16 @@ class CommandLineFlags {
                                                                             \
   product(bool, MonitorInUseLists, false, "Track Monitors for Deflation")   \
                                                                             \
+  product(bool, ProfileContendedLocks, false,                               \
+          "Record contended monitor enters (class, owner, park time) in "   \
+          "the event ring and aggregate them per class for the "            \
+          "VM.contendedLocks diagnostic command")                           \
+                                                                            \
+  product(intx, MonitorUsedDeflationThreshold, 90,                          \
+          "Percentage of used monitors before triggering deflation at a "   \
+          "dedicated cleanup safepoint (0 deflates at every safepoint, "    \
+          "the historical behavior). Valid range is 0..100")                \
+                                                                            \
   product(intx, SyncFlags, 0, "(Unsafe, Unstable) Experimental Sync flags") \
                                                                             \
   product(intx, SyncVerbose, 0, "(Unstable)")                               \
@@ -1155,6 +1199,10 @@ class CommandLineFlags {
   develop_pd(bool, ShareVtableStubs,                                        \
           "Share vtable stubs (smaller code but worse branch prediction")   \
                                                                             \
+  product(intx, PreGenerateVtableStubs, 0,                                  \
+          "Eagerly generate vtable and itable dispatch stubs for vtable "   \
+          "indices [0,n) during VM initialization")                         \
+                                                                            \
   develop(bool, LoadLineNumberTables, true,                                 \
           "Tell whether the class file parser loads line number tables")    \
                                                                             \
@@ -1207,6 +1255,10 @@ class CommandLineFlags {
   product(bool, LazyBootClassLoader, true,                                  \
           "Enable/disable lazy opening of boot class path entries")         \
                                                                             \
+  product(bool, UseClassPathIndex, true,                                    \
+          "Build an in-memory package index per boot class path jar so "    \
+          "lookups skip jars that cannot contain the requested file")       \
+                                                                            \
   product(bool, UseXMMForArrayCopy, false,                                  \
           "Use SSE2 MOVQ instruction for Arraycopy")                        \
                                                                             \
@@ -1232,6 +1284,10 @@ class CommandLineFlags {
   product(bool, UseBiasedLocking, true,                                     \
           "Enable biased locking in JVM")                                   \
                                                                             \
+  product(bool, UseThreadHandshakes, true,                                  \
+          "Execute per-thread operations via handshakes instead of "        \
+          "global safepoints when the target thread permits it")            \
+                                                                            \
   product(intx, BiasedLockingStartupDelay, 4000,                            \
           "Number of milliseconds to wait before enabling biased locking")  \
                                                                             \
@@ -1264,6 +1320,14 @@ class CommandLineFlags {
   product(ccstr, TraceJVMTI, NULL,                                          \
           "Trace flags for JVMTI functions and events")                     \
                                                                             \
+  product(intx, JvmtiMonitorContendedSampleInterval, 32,                    \
+          "Report every Nth contended monitor enter through the sampled "   \
+          "JVMTI extension event")                                          \
+                                                                            \
+  product(uintx, JvmtiAllocationSampleInterval, 512*K,                      \
+          "Minimum number of bytes a thread must allocate between two "     \
+          "sampled JVMTI allocation extension events")                      \
+                                                                            \
   /* This option can change an EMCP method into an obsolete method. */      \
   /* This can affect tests that except specific methods to be EMCP. */      \
   /* This option should be used with caution. */                            \
@@ -1273,6 +1337,11 @@ class CommandLineFlags {
   product(intx, TraceRedefineClasses, 0,                                    \
           "Trace level for JVMTI RedefineClasses")                          \
                                                                             \
+  product(bool, RedefineTargetedDeoptimization, true,                       \
+          "During RedefineClasses deoptimize only compiled code that "      \
+          "depends on methods that actually changed instead of all "        \
+          "code that depends on any method of the redefined class")         \
+                                                                            \
   develop(bool, StressMethodComparator, false,                              \
           "Run the MethodComparator on all loaded methods")                 \
                                                                             \
@@ -1334,6 +1403,10 @@ class CommandLineFlags {
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
+  product(intx, InlineCacheBufferSize, 10*K,                                \
+          "Size in bytes of the buffer holding inline cache transition "    \
+          "stubs; exhaustion between safepoints forces a safepoint")        \
+                                                                            \
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
@@ -1391,6 +1464,15 @@ class CommandLineFlags {
           "The standard deviation used by the parallel compact dead wood "  \
           "limiter (a number between 0-100)")                               \
                                                                             \
+  product(bool, ParallelOldIncrementalDensePrefix, true,                    \
+          "Extend the parallel compact dense prefix over regions whose "    \
+          "occupancy is high and whose liveness has not changed since "     \
+          "the previous full GC")                                           \
+                                                                            \
+  product(uintx, ParallelOldDenseRegionThreshold, 95,                       \
+          "Minimum region occupancy, in percent, for the incremental "      \
+          "dense prefix extension to leave a region in place")              \
+                                                                            \
   product(uintx, ParallelGCThreads, 0,                                      \
           "Number of parallel threads parallel gc will use")                \
                                                                             \
@@ -1538,6 +1620,10 @@ class CommandLineFlags {
           "The number of cards in each chunk of the parallel chunks used "  \
           "during card table scanning")                                     \
                                                                             \
+  diagnostic(bool, ParGCStrideDensityOrdering, true,                        \
+          "Pre-scan the card table for dirty-card counts per stride and "   \
+          "have worker threads claim the densest strides first")            \
+                                                                            \
   product(uintx, CMSParPromoteBlocksToClaim, 16,                            \
           "Number of blocks to attempt to claim when refilling CMS LAB's "  \
           "for parallel GC")                                                \
@@ -1894,6 +1980,14 @@ class CommandLineFlags {
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(bool, ParallelRefProcWorkStealing, true,                          \
+          "Let reference processing workers claim discovered-reference "    \
+          "lists dynamically instead of being bound to one list each")      \
+                                                                            \
+  product(uintx, ParallelRefProcOverPartitionFactor, 4,                     \
+          "Number of discovered-reference lists to balance into per "       \
+          "reference processing worker when work stealing is enabled")      \
+                                                                            \
   product(uintx, CMSTriggerRatio, 80,                                       \
           "Percentage of MinHeapFreeRatio in CMS generation that is "       \
           "allocated before a CMS collection cycle commences")              \
@@ -2253,6 +2347,10 @@ class CommandLineFlags {
   product(bool, UseGCTaskAffinity, false,                                   \
           "Use worker affinity when asking for GCTasks")                    \
                                                                             \
+  product(bool, UseGCTaskStealing, true,                                    \
+          "Dispatch GCTasks through per-worker deques with work "           \
+          "stealing instead of a single synchronized queue")                \
+                                                                            \
   product(uintx, ProcessDistributionStride, 4,                              \
           "Stride through processors when distributing processes")          \
                                                                             \
@@ -2347,6 +2445,10 @@ class CommandLineFlags {
   manageable(bool, PrintClassHistogram, false,                              \
           "Print a histogram of class instances")                           \
                                                                             \
+  product(bool, ParallelClassHistogram, true,                               \
+          "Use GC worker threads to build class histograms when the "       \
+          "collector supports parallel heap iteration")                     \
+                                                                            \
   develop(bool, TraceWorkGang, false,                                       \
           "Trace activities of work gangs")                                 \
                                                                             \
@@ -2409,11 +2511,23 @@ class CommandLineFlags {
           "GC log file size (default: 0 bytes, no rotation). "              \
           "It requires UseGCLogFileRotation")                               \
                                                                             \
+  product(bool, UseAsyncGCLog, false,                                       \
+          "Stage gclog output in memory and write it from the watcher "     \
+          "thread so slow disks cannot extend GC pauses")                   \
+                                                                            \
+  product(uintx, AsyncGCLogBufferSize, 512*K,                               \
+          "Size in bytes of each of the two gclog staging buffers used "    \
+          "with UseAsyncGCLog; overflow drops output with accounting")      \
+                                                                            \
   /* JVMTI heap profiling */                                                \
                                                                             \
   diagnostic(bool, TraceJVMTIObjectTagging, false,                          \
           "Trace JVMTI object tagging calls")                               \
                                                                             \
+  product(bool, DeferObjectFreeEvents, true,                                \
+          "Post JVMTI ObjectFree events from the service thread after "     \
+          "the GC pause instead of from within it")                         \
+                                                                            \
   diagnostic(bool, VerifyBeforeIteration, false,                            \
           "Verify memory system before JVMTI iteration")                    \
                                                                             \
@@ -2462,6 +2576,19 @@ class CommandLineFlags {
   product(intx, CICompilerCount, CI_COMPILER_COUNT,                         \
           "Number of compiler threads to run")                              \
                                                                             \
+  product(bool, UseCompilerThreadChunkCache, true,                          \
+          "Recycle arena chunks on compiler threads between compilations "  \
+          "instead of returning them to the global chunk pool")             \
+                                                                            \
+  product(bool, UseThreadChunkCache, true,                                  \
+          "Recycle a few arena chunks per thread so handle area and "      \
+          "resource area churn avoids the global chunk pool")               \
+                                                                            \
+  product(uintx, ResourceAreaRetentionSize, 256*K,                          \
+          "Maximum bytes of chunk chain a ResourceMark pop keeps "          \
+          "attached to the resource area for in-place reuse by the "        \
+          "next growth cycle (0 = release chunks immediately)")             \
+                                                                            \
   product(intx, CompilationPolicyChoice, 0,                                 \
           "which compilation policy (0/1)")                                 \
                                                                             \
@@ -2501,6 +2628,9 @@ class CommandLineFlags {
           "Print the break down of clean up tasks performed during "        \
           "safepoint")                                                      \
                                                                             \
+  product(intx, ParallelSafepointCleanupThreads, 1,                         \
+          "Number of parallel threads used for safepoint cleanup")          \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -2525,6 +2655,10 @@ class CommandLineFlags {
   develop(bool, EagerInitialization, false,                                 \
           "Eagerly initialize classes if possible")                         \
                                                                             \
+  product(bool, EagerResolveClassConstants, false,                          \
+          "At link time, resolve constant pool class entries whose "        \
+          "targets are already loaded instead of waiting for first use")    \
+                                                                            \
   develop(bool, TraceMethodReplacement, false,                              \
           "Print when methods are replaced do to recompilation")            \
                                                                             \
@@ -2577,6 +2711,11 @@ class CommandLineFlags {
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
                                                                             \
+  product(uintx, ErrorLogTimeout, 0,                                        \
+          "Number of seconds error reporting may spend before the "        \
+          "remaining expensive hs_err sections are skipped "                \
+          "(0 = no limit)")                                                 \
+                                                                            \
   product(bool, DisplayVMOutputToStderr, false,                             \
           "If DisplayVMOutput is true, display all VM output to stderr")    \
                                                                             \
@@ -2726,6 +2865,10 @@ class CommandLineFlags {
   product(bool, UseInterpreter, true,                                       \
           "Use interpreter for non-compiled methods")                       \
                                                                             \
+  product(bool, InterpreterHotCodeletLayout, true,                          \
+          "Generate the codelets of frequently executed bytecodes "         \
+          "adjacent to each other to improve interpreter icache behavior")  \
+                                                                            \
   develop(bool, UseFastSignatureHandlers, true,                             \
           "Use fast signature handlers for native calls")                   \
                                                                             \
@@ -2827,6 +2970,10 @@ class CommandLineFlags {
   product(bool, UseCounterDecay, true,                                      \
           "Adjust recompilation counters")                                  \
                                                                             \
+  product(intx, MethodCountersDeferredCount, 8,                             \
+          "Number of interpreter slow-path visits before a method's "       \
+          "MethodCounters are allocated (0 allocates on first visit)")      \
+                                                                            \
   develop(intx, CounterHalfLifeTime,    30,                                 \
           "Half-life time of invocation counters (in seconds)")             \
                                                                             \
@@ -2906,7 +3053,8 @@ class CommandLineFlags {
           "Number of invocations of sweeper to cover all nmethods")         \
                                                                             \
   product(intx, NmethodSweepCheckInterval, 5,                               \
-          "Compilers wake up every n seconds to possibly sweep nmethods")   \
+          "Sweeper thread wakes up every n seconds to possibly sweep "      \
+          "nmethods")                                                       \
                                                                             \
   product(intx, NmethodSweepActivity, 10,                                   \
           "Removes cold nmethods from code cache if > 0. Higher values "    \
@@ -3034,9 +3182,13 @@ class CommandLineFlags {
           "If non-zero, maximum number of words that malloc/realloc can "   \
           "allocate (for testing only)")                                    \
                                                                             \
-  product(intx, TypeProfileWidth,     2,                                    \
+  product(intx, TypeProfileWidth,     4,                                    \
           "Number of receiver types to record in call/cast profile")        \
                                                                             \
+  product(bool, DecayReceiverTypeProfile, true,                             \
+          "Halve receiver type profile counts during counter decay so "     \
+          "stale dominant receivers can be re-learned")                     \
+                                                                            \
   develop(intx, BciProfileWidth,      2,                                    \
           "Number of return bci's to record in ret profile")                \
                                                                             \
@@ -3110,6 +3262,11 @@ class CommandLineFlags {
   product(uintx, TLABWasteIncrement,    4,                                  \
           "Increment allowed waste at slow allocation")                     \
                                                                             \
+  product(bool, TLABResizeQuicker, true,                                    \
+          "Grow a thread's TLAB between GCs when its refill count "         \
+          "exceeds the per-epoch target, instead of waiting for the "       \
+          "resize at the next GC")                                          \
+                                                                            \
   product(uintx, SurvivorRatio, 8,                                          \
           "Ratio of eden/survivor space size")                              \
                                                                             \
@@ -3160,6 +3317,10 @@ class CommandLineFlags {
   product(uintx, MaxMetaspaceExpansion, ScaleForWordSize(4*M),              \
           "The maximum expansion of Metaspace without full GC (in bytes)")  \
                                                                             \
+  product(bool, MetaspaceCoalesceFreeChunks, true,                          \
+          "Merge adjacent free Metachunks into larger chunks when "         \
+          "Metaspace is purged after class unloading")                      \
+                                                                            \
   product(uintx, QueuedAllocationWarningCount, 0,                           \
           "Number of times an allocation that queues behind a GC "          \
           "will retry before printing a warning")                           \
@@ -3276,6 +3437,21 @@ class CommandLineFlags {
   product_pd(uintx, ReservedCodeCacheSize,                                  \
           "Reserved code cache size (in bytes) - maximum code cache size")  \
                                                                             \
+  product(bool, SegmentedCodeCache, false,                                  \
+          "Use a segmented code cache with separate heaps for "             \
+          "non-nmethod, profiled nmethod and non-profiled nmethod code")    \
+                                                                            \
+  product(uintx, NonNMethodCodeHeapSize, 5*M,                               \
+          "Size of code heap with non-nmethods (in bytes)")                 \
+                                                                            \
+  product(uintx, ProfiledCodeHeapSize, 0,                                   \
+          "Size of code heap with profiled methods (in bytes), "            \
+          "0: share the space left by NonNMethodCodeHeapSize evenly")       \
+                                                                            \
+  product(uintx, NonProfiledCodeHeapSize, 0,                                \
+          "Size of code heap with non-profiled methods (in bytes), "        \
+          "0: share the space left by NonNMethodCodeHeapSize evenly")       \
+                                                                            \
   product(uintx, CodeCacheMinimumFreeSpace, 500*K,                          \
           "When less than X space left, we stop compiling")                 \
                                                                             \
@@ -3332,9 +3508,39 @@ class CommandLineFlags {
   product(ccstrlist, CompileCommand, "",                                    \
           "Prepend to .hotspot_compiler; e.g. log,java/lang/String.<init>") \
                                                                             \
+  product(ccstr, CompilationRecordFile, NULL,                               \
+          "If non-null, write the names and levels of compiled methods "    \
+          "to this file at VM exit for use with CompilationWarmUpFile")     \
+                                                                            \
+  product(ccstr, CompilationWarmUpFile, NULL,                               \
+          "If non-null, eagerly load, initialize and request compilation "  \
+          "of the methods recorded in this file by a previous run")         \
+                                                                            \
+  product(ccstr, ProfileRecordFile, NULL,                                   \
+          "If non-null, write per-method invocation and backedge counts "   \
+          "to this file at VM exit for use with ProfileSeedFile")           \
+                                                                            \
+  product(ccstr, ProfileSeedFile, NULL,                                     \
+          "If non-null, pre-charge the invocation and backedge counters "   \
+          "of the methods recorded in this file by a previous run so the "  \
+          "compilation policy promotes them without a warmup period")       \
+                                                                            \
+  product(ccstr, ClassPreloadFile, NULL,                                    \
+          "If non-null, load the classes named in this file (one per "     \
+          "line, '#' starts a comment) in the background after VM "        \
+          "startup; linking still happens on first use")                    \
+                                                                            \
+  product(intx, ClassPreloadThreads, 1,                                     \
+          "Number of background threads used to preload classes from "     \
+          "ClassPreloadFile")                                               \
+                                                                            \
   develop(bool, ReplayCompiles, false,                                      \
           "Enable replay of compilations from ReplayDataFile")              \
                                                                             \
+  develop(bool, ReplayTiming, false,                                        \
+          "Report elapsed and per-phase compile time for each replayed "    \
+          "compilation (phase breakdown requires TimeCompiler)")            \
+                                                                            \
   product(ccstr, ReplayDataFile, NULL,                                      \
           "File containing compilation replay information"                  \
           "[default: ./replay_pid%p.log] (%p replaced with pid)")           \
@@ -3356,6 +3562,11 @@ class CommandLineFlags {
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
+  product(bool, CIPreMirrorBootClasses, true,                               \
+          "Create shared compiler interface mirrors for all bootstrap "     \
+          "classes loaded by the time the compiler starts, so every "       \
+          "compilation stops re-mirroring them")                            \
+                                                                            \
   develop(intx, CIFireOOMAt,    -1,                                         \
           "Fire OutOfMemoryErrors throughout CI for testing the compiler "  \
           "(non-negative value throws OOM after this many CI accesses "     \
@@ -3546,6 +3757,19 @@ class CommandLineFlags {
           "If C2 queue size is less than this amount per compiler thread "  \
           "allow methods compiled at tier 2 transition to tier 3")          \
                                                                             \
+  product(bool, TieredPhaseDetection, false,                                \
+          "Detect the transition from startup to steady state from the "    \
+          "slope of the aggregate compilation event rate and defer tier 3 " \
+          "profiling overhead during steady state")                         \
+                                                                            \
+  product(intx, TieredPhaseDetectionInterval, 2000,                         \
+          "Interval in milliseconds between aggregate event rate samples "  \
+          "for phase detection")                                            \
+                                                                            \
+  product(intx, TieredPhaseStableSamples, 3,                                \
+          "Number of consecutive flat rate samples after which the "        \
+          "application is considered to be in steady state")                \
+                                                                            \
   product(intx, Tier3LoadFeedback, 5,                                       \
           "Tier 3 thresholds will increase twofold when C1 queue size "     \
           "reaches this amount per compiler thread")                        \
@@ -3565,6 +3789,11 @@ class CommandLineFlags {
           "Start profiling in interpreter if the counters exceed tier 3 "   \
           "thresholds by the specified percentage")                         \
                                                                             \
+  product(bool, Tier0InterpreterProfiling, true,                            \
+          "Create MDOs for old interpreted methods even while the C2 "      \
+          "queue is backed up, so branch profiles collected by the "        \
+          "interpreter can promote methods to C2 without a tier 3 pass")    \
+                                                                            \
   product(uintx, IncreaseFirstTierCompileThresholdAt, 50,                   \
           "Increase the compile threshold for C1 compilation if the code "  \
           "cache is filled by the specified percentage")                    \
@@ -3695,9 +3924,19 @@ class CommandLineFlags {
   product(bool, StartAttachListener, false,                                 \
           "Always start Attach Listener at VM startup")                     \
                                                                             \
+  product(bool, AsyncAttachOperations, false,                               \
+          "Run long-running attach operations (heap dumps, jcmd) on a "     \
+          "dedicated handler thread so the attach listener stays "          \
+          "responsive")                                                     \
+                                                                            \
   manageable(bool, PrintConcurrentLocks, false,                             \
           "Print java.util.concurrent locks in thread dump")                \
                                                                             \
+  manageable(bool, ThreadDumpViaSuspend, false,                             \
+          "Take Thread.getAllStackTraces snapshots by suspending each "     \
+          "target thread individually instead of stopping the world; "      \
+          "falls back to a safepoint if a target is running Java code")     \
+                                                                            \
   product(bool, TransmitErrorReport, false,                                 \
           "Enable error report transmission on erroneous termination")      \
                                                                             \
@@ -3828,7 +4067,22 @@ class CommandLineFlags {
           "Enable event-based tracing")                                     \
                                                                             \
   product(bool, UseLockedTracing, false,                                    \
-          "Use locked-tracing when doing event-based tracing")
+          "Use locked-tracing when doing event-based tracing")              \
+                                                                            \
+  product(bool, UseBinaryTracing, false,                                    \
+          "Write trace events as binary records to BinaryTraceFile "        \
+          "instead of printing them to stdout "                             \
+          "(only relevant with -XX:+EnableTracing)")                        \
+                                                                            \
+  product(ccstr, BinaryTraceFile, "hotspot_trace.bin",                      \
+          "Path of the circular binary trace file")                         \
+                                                                            \
+  product(uintx, BinaryTraceBufferSize, 64*K,                               \
+          "Size of the per-thread binary trace buffers, in bytes")          \
+                                                                            \
+  product(uintx, BinaryTraceFileSize, 32*M,                                 \
+          "Size at which the binary trace file wraps around and starts "    \
+          "overwriting its oldest segments")
 
 /*
  *  Macros for factoring of globals
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/thread.inline.hpp"
+
+// The target is pinned by setting its external-suspend flag while holding
+// its SR_lock: a thread leaving _thread_in_native checks the suspend flags
+// on the exit path (see transition_from_native) and self-suspends, and the
+// self-suspend in turn needs the SR_lock we hold. The state store / flag
+// load on the target side is fenced (thread-state serialization), so the
+// re-check below closes the race with a target that was already past its
+// flag check when we set the flag.
+//
+// Holding the SR_lock also serializes concurrent handshakes with the same
+// target, and since the requester stays _thread_in_vm without polling, a
+// global safepoint cannot start while the closure runs - handshakes and
+// safepoint operations are therefore mutually exclusive, just as two
+// safepoint operations are.
+bool Handshake::try_execute(HandshakeClosure* hs, JavaThread* target) {
+  assert(target != JavaThread::current(), "handshake with self makes no sense");
+  if (!UseThreadHandshakes) {
+    return false;
+  }
+  MutexLockerEx ml(target->SR_lock(), Mutex::_no_safepoint_check_flag);
+  if (target->is_exiting() || target->is_terminated()) {
+    return false;
+  }
+  if (target->thread_state() != _thread_in_native) {
+    return false;
+  }
+  // Leave a pre-existing suspend request (e.g. from JVMTI) alone; it pins
+  // the target just as well and must not be cleared by us.
+  bool set_suspend = !target->is_external_suspend();
+  if (set_suspend) {
+    target->set_external_suspend();
+  }
+  // If the target had already passed its suspend-flag check when we set
+  // the flag it may be about to run; re-check the state now that the flag
+  // is visible. Either we see _thread_in_native_trans here or the target
+  // sees the flag and self-suspends.
+  OrderAccess::fence();
+  if (target->thread_state() != _thread_in_native) {
+    if (set_suspend) {
+      target->clear_external_suspend();
+    }
+    return false;
+  }
+  target->set_handshake_pinned(true);
+  hs->do_thread(target);
+  target->set_handshake_pinned(false);
+  if (set_suspend) {
+    target->clear_external_suspend();
+    // A target that noticed the flag is blocked acquiring the SR_lock in
+    // java_suspend_self; once it gets the lock it re-checks the flag and
+    // continues. Wake any waiter for symmetry with java_resume().
+    target->SR_lock()->notify_all();
+  }
+  return true;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_HANDSHAKE_HPP
+#define SHARE_VM_RUNTIME_HANDSHAKE_HPP
+
+#include "memory/allocation.hpp"
+
+class JavaThread;
+
+// A handshake operates on exactly one JavaThread, unlike a VM operation,
+// which brings every thread to a safepoint. The closure is executed by the
+// requesting thread while the target is pinned in a safepoint-safe state,
+// so the target's stack can be examined and its header words rewritten
+// just as during a safepoint, but all other threads keep running.
+class HandshakeClosure : public StackObj {
+ public:
+  // Executed by the requesting thread with 'target' pinned.
+  virtual void do_thread(JavaThread* target) = 0;
+};
+
+class Handshake : AllStatic {
+ public:
+  // Tries to execute 'hs' on 'target' without a global safepoint. This
+  // only succeeds while the target can be pinned in _thread_in_native:
+  // that is the one safepoint-safe state whose exit path checks the
+  // per-thread suspend flags (see transition_from_native). Returns false
+  // otherwise; the caller must then fall back to a VM operation.
+  //
+  // The caller must hold a ThreadsListHandle that includes 'target' so
+  // that the target cannot be deleted underneath us, and must not rely
+  // on 'hs' being executed - a target that is running Java or VM code
+  // cannot be handshaked with.
+  static bool try_execute(HandshakeClosure* hs, JavaThread* target);
+};
+
+#endif // SHARE_VM_RUNTIME_HANDSHAKE_HPP
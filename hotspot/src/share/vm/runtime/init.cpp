@@ -64,6 +64,7 @@ void jni_handles_init();
 void vmStructs_init();
 
 void vtableStubs_init();
+void vtableStubs_pre_generate(); // must happen after stubRoutines_init2
 void InlineCacheBuffer_init();
 void compilerOracle_init();
 void compilationPolicy_init();
@@ -130,6 +131,7 @@ jint init_globals() {
   }
   javaClasses_init();   // must happen after vtable initialization
   stubRoutines_init2(); // note: StubRoutines need 2-phase init
+  vtableStubs_pre_generate(); // the generated stubs jump to entry points from stubRoutines_init2
 
   // All the flags that get adjusted by VM_Version_init and os::init_2
   // have been set so dump the flags now.
@@ -489,6 +489,16 @@ void before_exit(JavaThread * thread) {
     os::infinite_sleep();
   }
 
+  // Record compiled methods for CompilationWarmUpFile in a future run.
+  if (CompilationRecordFile != NULL) {
+    CompileBroker::record_compilations();
+  }
+
+  // Record method hotness counters for ProfileSeedFile in a future run.
+  if (ProfileRecordFile != NULL) {
+    CompileBroker::record_profiles();
+  }
+
   // Terminate watcher thread - must before disenrolling any periodic task
   if (PeriodicTask::num_tasks() > 0)
     WatcherThread::stop();
@@ -121,8 +121,12 @@ class JavaCallArguments : public StackObj {
 
   JavaCallArguments(int max_size) {
     if (max_size > _default_size) {
-      _value  = NEW_RESOURCE_ARRAY(intptr_t, max_size + 1);
-      _is_oop = NEW_RESOURCE_ARRAY(bool, max_size + 1);
+      // Carve both arrays out of one resource allocation; the value
+      // array keeps intptr_t alignment since it comes first.
+      char* buffer = NEW_RESOURCE_ARRAY(char,
+          (max_size + 1) * (sizeof(intptr_t) + sizeof(bool)));
+      _value  = (intptr_t*)buffer;
+      _is_oop = (bool*)(buffer + (max_size + 1) * sizeof(intptr_t));
 
       // Reserve room for potential receiver in value and is_oop
       _value++; _is_oop++;
@@ -31,11 +31,19 @@
 #include "runtime/thread.inline.hpp"
 
 
-JNIHandleBlock* JNIHandles::_global_handles       = NULL;
+JNIHandleBlock* JNIHandles::_global_handles[JNIHandles::global_stripe_count];
+Mutex*          JNIHandles::_global_handle_locks[JNIHandles::global_stripe_count];
 JNIHandleBlock* JNIHandles::_weak_global_handles  = NULL;
 oop             JNIHandles::_deleted_handle       = NULL;
 
 
+int JNIHandles::stripe_for(Thread* thread) {
+  // Thread instances are large heap blocks, so the low address bits carry
+  // no information; shift them out before folding into a stripe index.
+  return (int)(((uintptr_t)thread) >> 9) & (global_stripe_count - 1);
+}
+
+
 jobject JNIHandles::make_local(oop obj) {
   if (obj == NULL) {
     return NULL;                // ignore null handles
@@ -75,9 +83,10 @@ jobject JNIHandles::make_global(Handle obj) {
   jobject res = NULL;
   if (!obj.is_null()) {
     // ignore null handles
-    MutexLocker ml(JNIGlobalHandle_lock);
+    int stripe = stripe_for(Thread::current());
+    MutexLocker ml(_global_handle_locks[stripe]);
     assert(Universe::heap()->is_in_reserved(obj()), "sanity check");
-    res = _global_handles->allocate_handle(obj());
+    res = _global_handles[stripe]->allocate_handle(obj());
   } else {
     CHECK_UNHANDLED_OOPS_ONLY(Thread::current()->clear_unhandled_oops());
   }
@@ -118,8 +127,19 @@ void JNIHandles::destroy_weak_global(jobject handle) {
 
 
 void JNIHandles::oops_do(OopClosure* f) {
-  f->do_oop(&_deleted_handle);
-  _global_handles->oops_do(f);
+  for (int i = 0; i < global_stripe_count; i++) {
+    oops_do_partition(f, i);
+  }
+}
+
+
+void JNIHandles::oops_do_partition(OopClosure* f, int partition) {
+  assert(partition >= 0 && partition < global_stripe_count, "invalid partition");
+  // The deleted handle sentinel is scanned as part of the first partition.
+  if (partition == 0) {
+    f->do_oop(&_deleted_handle);
+  }
+  _global_handles[partition]->oops_do(f);
 }
 
 
@@ -129,7 +149,10 @@ void JNIHandles::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
 
 
 void JNIHandles::initialize() {
-  _global_handles      = JNIHandleBlock::allocate_block();
+  for (int i = 0; i < global_stripe_count; i++) {
+    _global_handles[i]      = JNIHandleBlock::allocate_block();
+    _global_handle_locks[i] = new Mutex(Mutex::nonleaf, "JNIGlobalHandle stripe", true);
+  }
   _weak_global_handles = JNIHandleBlock::allocate_block();
   EXCEPTION_MARK;
   // We will never reach the CATCH below since Exceptions::_throw will cause
@@ -168,7 +191,12 @@ bool JNIHandles::is_frame_handle(JavaThread* thr, jobject obj) {
 
 
 bool JNIHandles::is_global_handle(jobject handle) {
-  return _global_handles->chain_contains(handle);
+  for (int i = 0; i < global_stripe_count; i++) {
+    if (_global_handles[i]->chain_contains(handle)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 
@@ -177,7 +205,11 @@ bool JNIHandles::is_weak_global_handle(jobject handle) {
 }
 
 long JNIHandles::global_handle_memory_usage() {
-  return _global_handles->memory_usage();
+  long usage = 0;
+  for (int i = 0; i < global_stripe_count; i++) {
+    usage += _global_handles[i]->memory_usage();
+  }
+  return usage;
 }
 
 long JNIHandles::weak_global_handle_memory_usage() {
@@ -205,7 +237,7 @@ public:
 // We assume this is called at a safepoint: no lock is needed.
 void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-  assert(_global_handles != NULL && _weak_global_handles != NULL,
+  assert(_global_handles[0] != NULL && _weak_global_handles != NULL,
          "JNIHandles not initialized");
 
   CountHandleClosure global_handle_count;
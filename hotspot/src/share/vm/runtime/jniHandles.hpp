@@ -29,6 +29,7 @@
 #include "utilities/top.hpp"
 
 class JNIHandleBlock;
+class Mutex;
 
 
 // Interface for creating and resolving local/global JNI handles
@@ -36,10 +37,22 @@ class JNIHandleBlock;
 class JNIHandles : AllStatic {
   friend class VMStructs;
  private:
-  static JNIHandleBlock* _global_handles;             // First global handle block
+  enum SomeConstants {
+    global_stripe_count = 8                           // Number of independently locked global handle chains
+  };
+
+  // Strong global handles are striped over several block chains, each with
+  // its own lock, so that threads creating global refs concurrently do not
+  // all serialize on a single lock. A handle stays in the stripe it was
+  // allocated from; deletion only stores the sentinel and needs no lock.
+  static JNIHandleBlock* _global_handles[global_stripe_count]; // First block of each global handle chain
+  static Mutex*   _global_handle_locks[global_stripe_count];   // One lock per chain
   static JNIHandleBlock* _weak_global_handles;        // First weak global handle block
   static oop _deleted_handle;                         // Sentinel marking deleted handles
 
+  // Maps the current thread to the stripe its global handles are allocated from
+  static int stripe_for(Thread* thread);
+
  public:
   // Resolve handle into oop
   inline static oop resolve(jobject handle);
@@ -84,6 +97,11 @@ class JNIHandles : AllStatic {
   // Garbage collection support(global handles only, local handles are traversed from thread)
   // Traversal of regular global handles
   static void oops_do(OopClosure* f);
+  // Partitioned traversal for parallel root scanning: partitions are
+  // independent of each other and may be claimed by different worker
+  // threads. Scanning all partitions is equivalent to oops_do.
+  static int  oops_do_partition_count()               { return global_stripe_count; }
+  static void oops_do_partition(OopClosure* f, int partition);
   // Traversal of weak global handles. Unreachable oops are cleared.
   static void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f);
 };
@@ -40,7 +40,7 @@
 Mutex*   Patching_lock                = NULL;
 Monitor* SystemDictionary_lock        = NULL;
 Mutex*   PackageTable_lock            = NULL;
-Mutex*   CompiledIC_lock              = NULL;
+Mutex*   CompiledIC_locks[CompiledICLock_stripes];
 Mutex*   InlineCacheBuffer_lock       = NULL;
 Mutex*   VMStatistic_lock             = NULL;
 Mutex*   JNIGlobalHandle_lock         = NULL;
@@ -106,6 +106,8 @@ Mutex*   Debug2_lock                  = NULL;
 Mutex*   Debug3_lock                  = NULL;
 
 Mutex*   tty_lock                     = NULL;
+Mutex*   AsyncGCLog_lock              = NULL;
+Mutex*   BinaryTrace_lock             = NULL;
 
 Mutex*   RawMonitor_lock              = NULL;
 Mutex*   PerfDataMemAlloc_lock        = NULL;
@@ -117,7 +119,6 @@ Monitor* SecondaryFreeList_lock       = NULL;
 Mutex*   OldSets_lock                 = NULL;
 Monitor* RootRegionScan_lock          = NULL;
 Mutex*   MMUTracker_lock              = NULL;
-Mutex*   HotCardCache_lock            = NULL;
 
 Monitor* GCTaskManager_lock           = NULL;
 
@@ -169,6 +170,8 @@ void assert_lock_strong(const Monitor * lock) {
 
 void mutex_init() {
   def(tty_lock                     , Mutex  , event,       true ); // allow to lock in VM
+  def(AsyncGCLog_lock              , Mutex  , event,       true ); // guards the gclog staging buffer
+  def(BinaryTrace_lock             , Mutex  , event,       true ); // guards the binary trace file
 
   def(CGC_lock                   , Monitor, special,     true ); // coordinate between fore- and background GC
   def(STS_init_lock              , Mutex,   leaf,        true );
@@ -194,7 +197,6 @@ void mutex_init() {
     def(OldSets_lock               , Mutex  , leaf     ,   true );
     def(RootRegionScan_lock        , Monitor, leaf     ,   true );
     def(MMUTracker_lock            , Mutex  , leaf     ,   true );
-    def(HotCardCache_lock          , Mutex  , special  ,   true );
     def(EvacFailureStack_lock      , Mutex  , nonleaf  ,   true );
   }
   def(ParGCRareEvent_lock          , Mutex  , leaf     ,   true );
@@ -254,7 +256,14 @@ void mutex_init() {
   def(JfieldIdCreation_lock        , Mutex  , nonleaf+1,   true ); // jfieldID, Used in VM_Operation
   def(MemberNameTable_lock         , Mutex  , nonleaf+1,   false); // Used to protect MemberNameTable
 
-  def(CompiledIC_lock              , Mutex  , nonleaf+2,   false); // locks VtableStubs_lock, InlineCacheBuffer_lock
+  // Striped per-nmethod IC patching locks; each locks VtableStubs_lock,
+  // InlineCacheBuffer_lock. The equal ranks guarantee (in debug builds)
+  // that no thread ever holds two stripes at once.
+  for (int i = 0; i < CompiledICLock_stripes; i++) {
+    CompiledIC_locks[i] = new Mutex(Mutex::nonleaf+2, "CompiledIC_lock", false);
+    assert(_num_mutex < MAX_NUM_MUTEX, "increase MAX_NUM_MUTEX");
+    _mutex_array[_num_mutex++] = CompiledIC_locks[i];
+  }
   def(CompileTaskAlloc_lock        , Mutex  , nonleaf+2,   true );
   def(CompileStatistics_lock       , Mutex  , nonleaf+2,   false);
   def(MultiArray_lock              , Mutex  , nonleaf+2,   false); // locks SymbolTable_lock
@@ -39,6 +39,7 @@
 #include "trace/tracing.hpp"
 #include "trace/traceMacros.hpp"
 #include "utilities/dtrace.hpp"
+#include "utilities/events.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/preserveException.hpp"
 #ifdef TARGET_OS_FAMILY_linux
@@ -291,6 +292,75 @@ static volatile int InitDone       = 0 ;
 // * See also http://blogs.sun.com/dave
 
 
+// -----------------------------------------------------------------------------
+// Contended-lock profiling (-XX:+ProfileContendedLocks)
+
+ContendedLockTable::Entry ContendedLockTable::_table[ContendedLockTable::table_size];
+volatile jlong ContendedLockTable::_dropped = 0;
+
+// No Atomic::add for jlong on all platforms - emulate with cmpxchg.
+static void add_to_jlong(volatile jlong* dest, jlong value) {
+  for (;;) {
+    jlong cur = *dest;
+    if (Atomic::cmpxchg(cur + value, dest, cur) == cur) return;
+  }
+}
+
+void ContendedLockTable::record(Klass* k, jlong wait_ns) {
+  Symbol* name = k->name();
+  if (name == NULL) return;
+  unsigned int index = ((unsigned int)((uintptr_t)k >> 3)) & (table_size - 1);
+  for (int probes = 0; probes < table_size; probes++) {
+    Entry* e = &_table[index];
+    Klass* cur = e->_klass;
+    if (cur == NULL) {
+      cur = (Klass*)Atomic::cmpxchg_ptr(k, &e->_klass, NULL);
+      if (cur == NULL) {
+        // We claimed the slot.  Pin the name so the entry stays
+        // printable if the class is later unloaded.
+        name->increment_refcount();
+        e->_name = name;
+        cur = k;
+      }
+    }
+    if (cur == k) {
+      add_to_jlong(&e->_contentions, 1);
+      add_to_jlong(&e->_wait_time, wait_ns);
+      return;
+    }
+    index = (index + 1) & (table_size - 1);
+  }
+  add_to_jlong(&_dropped, 1);
+}
+
+void ContendedLockTable::print_on(outputStream* st) {
+  ResourceMark rm;
+  if (!ProfileContendedLocks) {
+    st->print_cr("Contended-lock profiling is disabled; "
+                 "start the VM with -XX:+ProfileContendedLocks.");
+    return;
+  }
+  st->print_cr("Contended monitor enters by class (cumulative since VM start):");
+  st->print_cr("%10s  %13s  %s", "contended", "waited (ms)", "class");
+  int rows = 0;
+  for (int i = 0; i < table_size; i++) {
+    Entry* e = &_table[i];
+    if (e->_klass == NULL || e->_name == NULL) continue;
+    st->print_cr(UINT64_FORMAT_W(10) "  " UINT64_FORMAT_W(13) "  %s",
+                 (uint64_t)e->_contentions,
+                 (uint64_t)(e->_wait_time / 1000000),
+                 e->_name->as_C_string());
+    rows++;
+  }
+  if (rows == 0) {
+    st->print_cr("  (no contention recorded)");
+  }
+  if (_dropped != 0) {
+    st->print_cr("  (" UINT64_FORMAT " samples dropped - table full)",
+                 (uint64_t)_dropped);
+  }
+}
+
 // -----------------------------------------------------------------------------
 // Enter support
 
@@ -376,6 +446,12 @@ void ATTR ObjectMonitor::enter(TRAPS) {
 
   EventJavaMonitorEnter event;
 
+  // Capture the owner at contention time and a start-of-park timestamp
+  // before blocking.  The owner read is racy but is only reported, never
+  // dereferenced.
+  void * const contended_owner = _owner ;
+  const jlong profile_start = ProfileContendedLocks ? os::javaTimeNanos() : 0 ;
+
   { // Change java thread status to indicate blocked on monitor enter.
     JavaThreadBlockedOnMonitorEnterState jtbmes(jt, this);
 
@@ -383,6 +459,11 @@ void ATTR ObjectMonitor::enter(TRAPS) {
     if (JvmtiExport::should_post_monitor_contended_enter()) {
       JvmtiExport::post_monitor_contended_enter(jt, this);
     }
+    if (JvmtiExport::should_post_sampled_monitor_contended_enter()) {
+      // Rate-limited variant; the post routine itself decides whether
+      // this particular contended enter is reported.
+      JvmtiExport::post_sampled_monitor_contended_enter(jt, this);
+    }
 
     OSThreadContendState osts(Self->osthread());
     ThreadBlockInVM tbivm(jt);
@@ -436,6 +517,23 @@ void ATTR ObjectMonitor::enter(TRAPS) {
   // yet to acquire the lock.  While spinning that thread could
   // spinning we could increment JVMStat counters, etc.
 
+  if (ProfileContendedLocks) {
+    // We own the monitor, so the object cannot be deflated or collected
+    // underneath us.  Aggregate per-class and leave a record in the event
+    // ring; both are bounded, lock-free operations.
+    Klass * const k = ((oop)this->object())->klass() ;
+    const jlong waited = os::javaTimeNanos() - profile_start ;
+    ContendedLockTable::record(k, waited) ;
+    if (LogEvents) {
+      ResourceMark rm ;
+      Events::log_lock_contention(Self, "contended enter " INTPTR_FORMAT
+                                  " (%s) owner " INTPTR_FORMAT
+                                  " waited " JLONG_FORMAT " us",
+                                  this, k->external_name(), contended_owner,
+                                  waited / 1000) ;
+    }
+  }
+
   DTRACE_MONITOR_PROBE(contended__entered, this, object(), jt);
   if (JvmtiExport::should_post_monitor_contended_entered()) {
     JvmtiExport::post_monitor_contended_entered(jt, this);
@@ -2039,8 +2137,16 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
     // CONSIDER: use Prefetch::write() to avoid RTS->RTO upgrades
     // when preparing to LD...CAS _owner, etc and the CAS is likely
     // to succeed.
+    // Seed the back-off mask from the monitor's _SpinClock, which records
+    // the mask reached by recent failed spins on this monitor.  On a hotly
+    // contended monitor new arrivals thus start polling at the rate their
+    // predecessors backed off to, instead of each spinner rediscovering the
+    // contention level from scratch and hammering the cache line in the
+    // interim.  Like _SpinDuration, _SpinClock is updated racily without
+    // atomics; every value written is masked by BackOffMask so races can
+    // only install a different-but-legal mask.
     int hits    = 0 ;
-    int msk     = 0 ;
+    int msk     = _SpinClock & BackOffMask ;
     int caspty  = Knob_CASPenalty ;
     int oxpty   = Knob_OXPenalty ;
     int sss     = Knob_SpinSetSucc ;
@@ -2068,6 +2174,15 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
             TEVENT (Spin: safepoint) ;
             goto Abort ;           // abrupt spin egress
          }
+         // Re-sample the owner's runnability periodically even if ownership
+         // has not changed hands.  The admission check above and the
+         // owner-changed check below miss the case where a stable owner is
+         // preempted mid-spin; continuing to spin on an OFFPROC owner just
+         // burns the remaining ctr iterations with no chance of success.
+         if (Knob_OState && NotRunnable (Self, (Thread *) _owner)) {
+            TEVENT (Spin abort - notrunnable [PERIODIC]);
+            goto Abort ;
+         }
          if (Knob_UsePause & 1) SpinPause () ;
 
          int (*scb)(intptr_t,int) = SpinCallbackFunction ;
@@ -2134,6 +2249,9 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
                 if (x < Knob_Poverty) x = Knob_Poverty ;
                 _SpinDuration = x + Knob_Bonus ;
             }
+            // A successful spin means contention is easing, so decay the
+            // shared back-off seed toward frequent sampling.
+            _SpinClock = msk >> 2 ;
             return 1 ;
          }
 
@@ -2170,20 +2288,23 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
       if (sss && _succ == NULL ) _succ = Self ;
    }
 
-   // Spin failed with prejudice -- reduce _SpinDuration.
-   // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-   // AIMD is globally stable.
+   // Spin failed with prejudice -- reduce _SpinDuration with an AIMD
+   // policy: additive increase on success (Knob_Bonus, above) and
+   // multiplicative decrease here.  AIMD is globally stable and converges
+   // faster than a fixed additive penalty when the lock modality shifts
+   // from short to long hold times.
    TEVENT (Spin failure) ;
    {
      int x = _SpinDuration ;
      if (x > 0) {
-        // Consider an AIMD scheme like: x -= (x >> 3) + 100
-        // This is globally sample and tends to damp the response.
-        x -= Knob_Penalty ;
+        x -= (x >> 3) + Knob_Penalty ;
         if (x < 0) x = 0 ;
         _SpinDuration = x ;
      }
    }
+   // Publish the back-off mask this failed spin reached so later spinners
+   // on this monitor start polling at the backed-off rate.
+   _SpinClock = msk ;
 
  Abort:
    if (MaxSpin >= 0) Adjust (&_Spinner, -1) ;
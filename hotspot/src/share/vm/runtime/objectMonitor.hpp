@@ -264,7 +264,7 @@ public:
 
   volatile int _Spinner ;           // for exit->spinner handoff optimization
   volatile int _SpinFreq ;          // Spin 1-out-of-N attempts: success rate
-  volatile int _SpinClock ;
+  volatile int _SpinClock ;         // Shared back-off seed for spinners - see TrySpin
   volatile int _SpinDuration ;
   volatile intptr_t _SpinState ;    // MCS/CLH list of spinners
 
@@ -326,6 +326,32 @@ public:
   }
 };
 
+class Klass;
+class Symbol;
+
+// Per-class aggregation of contended monitor enters, maintained by
+// ObjectMonitor::enter() when ProfileContendedLocks is enabled and dumped
+// by the VM.contendedLocks diagnostic command.  A recording thread only
+// probes and CASes a small fixed table - no locks are taken on the park
+// path, and once the table fills further classes are counted as dropped.
+// The class name symbol is kept alive by an extra refcount taken when a
+// slot is claimed, so entries stay printable across class unloading.
+class ContendedLockTable : AllStatic {
+ private:
+  enum { table_size = 256 };     // must be a power of two
+  struct Entry {
+    Klass* volatile _klass;        // slot key, claimed with CAS
+    Symbol*         _name;         // klass name, set by the claiming thread
+    volatile jlong  _contentions;  // # of contended enters recorded
+    volatile jlong  _wait_time;    // cumulative nanoseconds spent parked
+  };
+  static Entry _table[table_size];
+  static volatile jlong _dropped;  // samples lost because the table was full
+ public:
+  static void record(Klass* k, jlong wait_ns);
+  static void print_on(outputStream* st);
+};
+
 #undef TEVENT
 #define TEVENT(nom) {if (SyncVerbose) FEVENT(nom); }
 
@@ -1622,6 +1622,16 @@ void os::realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   pd_realign_memory(addr, bytes, alignment_hint);
 }
 
+void os::pretouch_memory(char* start, char* end) {
+  // Note the read and write-back of each page; a plain read was
+  // optimized away (the value was unused), and a plain store of a
+  // constant would lose data if the range can already hold live
+  // objects and another thread beats us to a page.
+  for (volatile char *p = start; p < end; p += vm_page_size()) {
+    char t = *p; *p = t;
+  }
+}
+
 #ifndef TARGET_OS_FAMILY_windows
 /* try to switch state from state "from" to state "to"
  * returns the state set after the method is complete
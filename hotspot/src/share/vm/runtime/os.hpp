@@ -320,6 +320,10 @@ class os: AllStatic {
   static void   free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
 
+  // Touch every page in the range to make the OS back it with real
+  // memory, so the first access from application code does not fault.
+  static void   pretouch_memory(char* start, char* end);
+
   // NUMA-specific interface
   static bool   numa_has_static_binding();
   static bool   numa_has_group_homing();
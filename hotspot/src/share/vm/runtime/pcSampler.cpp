@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/codeCache.hpp"
+#include "code/nmethod.hpp"
+#include "interpreter/interpreter.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/extendedPC.hpp"
+#include "runtime/os.hpp"
+#include "runtime/pcSampler.hpp"
+#include "runtime/stubRoutines.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#ifndef _WINDOWS
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+PCSampler::SampleEntry PCSampler::_table[PCSampler::table_size];
+volatile jint PCSampler::_total_samples   = 0;
+volatile jint PCSampler::_dropped_samples = 0;
+volatile bool PCSampler::_active          = false;
+
+#ifndef _WINDOWS
+extern "C" {
+  static void pc_sampler_handler(int sig, siginfo_t* info, void* ucVoid) {
+    if (!PCSampler::is_active() || ucVoid == NULL) return;
+    // The only context use is reading the interrupted PC; no frame walking
+    // happens here.
+    ExtendedPC epc = os::fetch_frame_from_context(ucVoid, NULL, NULL);
+    if (epc.pc() != NULL) {
+      PCSampler::take_sample(epc.pc());
+    }
+  }
+}
+#endif
+
+void PCSampler::take_sample(address pc) {
+  Atomic::inc(&_total_samples);
+  intptr_t key = (intptr_t)pc;
+  // Phi-based hash to spread nearby PCs over the table
+  unsigned int index = (unsigned int)(((uintptr_t)key >> 2) * 2654435761UL)
+                       & (table_size - 1);
+  for (int probe = 0; probe < max_probes; probe++) {
+    intptr_t cur = _table[index]._pc;
+    if (cur == 0) {
+      // claim the empty slot; on a lost race re-examine it below
+      cur = (intptr_t)Atomic::cmpxchg_ptr((void*)key,
+                                          (volatile void*)&_table[index]._pc,
+                                          (void*)NULL);
+      if (cur == 0) cur = key;
+    }
+    if (cur == key) {
+      Atomic::inc(&_table[index]._count);
+      return;
+    }
+    index = (index + 1) & (table_size - 1);
+  }
+  Atomic::inc(&_dropped_samples);
+}
+
+void PCSampler::engage() {
+#ifndef _WINDOWS
+  if (_active) return;
+
+  struct sigaction sa;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_flags = SA_SIGINFO | SA_RESTART;
+  sa.sa_sigaction = pc_sampler_handler;
+  if (sigaction(SIGPROF, &sa, NULL) != 0) {
+    warning("PC sampler could not install SIGPROF handler");
+    return;
+  }
+
+  intx interval = PCSamplingInterval < 1 ? 1 : PCSamplingInterval;
+  struct itimerval tv;
+  tv.it_interval.tv_sec  = interval / 1000;
+  tv.it_interval.tv_usec = (interval % 1000) * 1000;
+  tv.it_value = tv.it_interval;
+  _active = true;
+  if (setitimer(ITIMER_PROF, &tv, NULL) != 0) {
+    _active = false;
+    warning("PC sampler could not start the profiling interval timer");
+  }
+#else
+  warning("PC sampling is not supported on this platform");
+#endif
+}
+
+void PCSampler::disengage() {
+#ifndef _WINDOWS
+  if (!_active) return;
+  _active = false;
+  struct itimerval tv;
+  tv.it_interval.tv_sec  = 0;
+  tv.it_interval.tv_usec = 0;
+  tv.it_value = tv.it_interval;
+  setitimer(ITIMER_PROF, &tv, NULL);
+#endif
+}
+
+void PCSampler::reset() {
+  for (int i = 0; i < table_size; i++) {
+    _table[i]._pc    = 0;
+    _table[i]._count = 0;
+  }
+  _total_samples   = 0;
+  _dropped_samples = 0;
+}
+
+// Snapshot of one table entry, taken while the handler may still be running
+struct PCSample {
+  address pc;
+  jint    count;
+};
+
+static int sort_samples_by_count(PCSample* s1, PCSample* s2) {
+  return s2->count - s1->count;
+}
+
+void PCSampler::print_on(outputStream* st) {
+  if (!_active && _total_samples == 0) {
+    st->print_cr("PC sampler is not active (start with -XX:+PCSampling)");
+    return;
+  }
+
+  ResourceMark rm;
+  GrowableArray<PCSample>* samples = new GrowableArray<PCSample>(256);
+  for (int i = 0; i < table_size; i++) {
+    jint count = _table[i]._count;
+    if (count > 0) {
+      PCSample s;
+      s.pc    = (address)_table[i]._pc;
+      s.count = count;
+      samples->append(s);
+    }
+  }
+  samples->sort(sort_samples_by_count);
+
+  st->print_cr("PC samples: %d total, %d dropped, %d distinct locations",
+               _total_samples, _dropped_samples, samples->length());
+  for (int i = 0; i < samples->length(); i++) {
+    PCSample* s = samples->adr_at(i);
+    st->print("%10d  " INTPTR_FORMAT "  ", s->count, s->pc);
+    // Attribution is best effort: the code at a sampled PC may have been
+    // flushed since the sample was taken.
+    CodeBlob* cb = CodeCache::find_blob_unsafe(s->pc);
+    if (cb != NULL) {
+      if (cb->is_nmethod()) {
+        nmethod* nm = (nmethod*)cb;
+        Method* m = nm->method();
+        if (nm->is_alive() && m != NULL) {
+          st->print("%s", m->name_and_sig_as_C_string());
+        } else {
+          st->print("<stale nmethod>");
+        }
+      } else {
+        st->print("%s", cb->name());
+      }
+    } else if (Interpreter::contains(s->pc)) {
+      st->print("<interpreter>");
+    } else if (StubRoutines::contains(s->pc)) {
+      st->print("<stub routine>");
+    } else {
+      st->print("<native>");
+    }
+    st->cr();
+  }
+}
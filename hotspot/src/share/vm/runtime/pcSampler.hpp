@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_PCSAMPLER_HPP
+#define SHARE_VM_RUNTIME_PCSAMPLER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// Signal-driven PC sampler.
+//
+// Unlike the FlatProfiler, which suspends every thread from the watcher
+// thread at each tick, the sampler lets the kernel deliver a CPU-time
+// interval signal (ITIMER_PROF/SIGPROF) to whichever thread is running
+// and records that thread's interrupted PC from the signal context.  The
+// handler only hashes the raw PC into a fixed-size lock-free table;
+// attributing a PC to a method, stub or the interpreter is done lazily
+// when the table is printed, off the sampling path.  POSIX only; engage()
+// is a no-op elsewhere.
+class PCSampler : AllStatic {
+ public:
+  // Start/stop the sampler (idiom follows MemProfiler)
+  static void engage();
+  static void disengage();
+  static bool is_active()                   { return _active; }
+
+  // Record one sample; called from the signal handler, so it must be
+  // async-signal-safe: no locks, no allocation, no VM state transitions.
+  static void take_sample(address pc);
+
+  // Resolve and print the aggregated samples (jcmd VM.pcSamples)
+  static void print_on(outputStream* st);
+  static void reset();
+
+ private:
+  enum {
+    table_size = 16*K,    // entries; must be a power of two
+    max_probes = 16       // linear probes before a sample is dropped
+  };
+  struct SampleEntry {
+    volatile intptr_t _pc;      // claimed once by CAS, never cleared while active
+    volatile jint     _count;
+  };
+  static SampleEntry   _table[table_size];
+  static volatile jint _total_samples;
+  static volatile jint _dropped_samples;
+  static volatile bool _active;
+};
+
+#endif // SHARE_VM_RUNTIME_PCSAMPLER_HPP
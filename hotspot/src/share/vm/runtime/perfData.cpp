@@ -226,6 +226,45 @@ void PerfLongVariant::sample() {
   }
 }
 
+PerfLongHistogram::PerfLongHistogram(CounterNS ns, const char* namep,
+                                     Units u, jint buckets)
+                                    : PerfData(ns, namep, u, V_Variable),
+                                      _length(buckets) {
+
+  create_entry(T_LONG, sizeof(jlong), (size_t)_length);
+}
+
+int PerfLongHistogram::bucket_for(jlong value) {
+  // The first octave's worth of values map directly onto the first
+  // sub-buckets; above that, the index is made up of the position of
+  // the most significant bit and the next sub_bucket_shift bits below
+  // it, giving four linear sub-buckets per power-of-two range.
+  if (value < sub_buckets_per_octave) {
+    return value < 0 ? 0 : (int)value;
+  }
+  int msb = 0;
+  for (jlong v = value; v > 1; v >>= 1) msb++;
+  int sub = (int)((value >> (msb - sub_bucket_shift)) &
+                  (sub_buckets_per_octave - 1));
+  int index = ((msb - 1) << sub_bucket_shift) + sub;
+  return index < _length ? index : _length - 1;
+}
+
+void PerfLongHistogram::record(jlong value) {
+  if (!is_valid()) return;
+  ((jlong*)_valuep)[bucket_for(value)] += 1;
+}
+
+int PerfLongHistogram::format(char* buffer, int length) {
+  int pos = 0;
+  for (jint i = 0; i < _length && pos < length; i++) {
+    pos += jio_snprintf(buffer + pos, length - pos,
+                        i == 0 ? JLONG_FORMAT : " " JLONG_FORMAT,
+                        ((jlong*)_valuep)[i]);
+  }
+  return pos;
+}
+
 PerfByteArray::PerfByteArray(CounterNS ns, const char* namep, Units u,
                              Variability v, jint length)
                             : PerfData(ns, namep, u, v), _length(length) {
@@ -503,6 +542,25 @@ PerfLongVariable* PerfDataManager::create_long_variable(CounterNS ns,
   return p;
 }
 
+PerfLongHistogram* PerfDataManager::create_long_histogram(CounterNS ns,
+                                                          const char* name,
+                                                          PerfData::Units u,
+                                                          jint buckets,
+                                                          TRAPS) {
+
+  PerfLongHistogram* p = new PerfLongHistogram(ns, name, u, buckets);
+
+  if (!p->is_valid()) {
+    // allocation of native resources failed.
+    delete p;
+    THROW_0(vmSymbols::java_lang_OutOfMemoryError());
+  }
+
+  add_item(p, false);
+
+  return p;
+}
+
 PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
                                                       const char* name,
                                                       PerfData::Units u,
@@ -331,6 +331,12 @@ class PerfData : public CHeapObj<mtInternal> {
     // PerfData memory region.
     inline void* get_address() { return _valuep; }
 
+    // returns the data type recorded in the item's PerfData memory
+    // region entry, or T_ILLEGAL if the entry could not be allocated.
+    BasicType data_type() {
+      return _pdep == NULL ? T_ILLEGAL : (BasicType)_pdep->data_type;
+    }
+
     // returns the value of the data portion of the item in the
     // PerfData memory region formatted as a string.
     virtual int format(char* cp, int length) = 0;
@@ -489,6 +495,51 @@ class PerfLongVariable : public PerfLongVariant {
 
 typedef PerfLongVariable PerfVariable;
 
+/*
+ * The PerfLongHistogram class implements a PerfData subtype holding a
+ * vector of jlong bucket counts that describe a latency distribution.
+ * Buckets are log-linear: each power-of-two range of the recorded value
+ * is divided into four linear sub-buckets, keeping the relative
+ * quantization error below 25% over the whole range with a modest
+ * number of buckets. Values are pushed by the instrumented code as they
+ * occur; there is no periodic sampling involved, and external tools
+ * read the complete distribution from the PerfData memory with plain
+ * memory loads. The unit recorded is up to the instrument and should be
+ * stated in the counter name. Updates are monotonic but unsynchronized;
+ * concurrent writers may drop an occasional count, which is acceptable
+ * for monitoring purposes.
+ */
+class PerfLongHistogram : public PerfData {
+
+  friend class PerfDataManager; // for access to protected constructor
+
+  public:
+    enum {
+      sub_bucket_shift = 2,
+      sub_buckets_per_octave = 1 << sub_bucket_shift
+    };
+
+  private:
+    jint _length;
+
+    // updates are pushed by the instrumented code, nothing to sample
+    void sample() { }
+
+  protected:
+
+    PerfLongHistogram(CounterNS ns, const char* namep, Units u,
+                      jint buckets);
+
+  public:
+    int format(char* buffer, int length);
+
+    // index of the bucket that counts the given value
+    int bucket_for(jlong value);
+
+    // count one occurrence of the given value
+    void record(jlong value);
+};
+
 /*
  * The PerfByteArray provides a PerfData subtype that allows the creation
  * of a contiguous region of the PerfData memory region for storing a vector
@@ -797,6 +848,12 @@ class PerfDataManager : AllStatic {
                                                   PerfLongSampleHelper* sh,
                                                   TRAPS);
 
+    // Histogram Types
+    static PerfLongHistogram* create_long_histogram(CounterNS ns,
+                                                    const char* name,
+                                                    PerfData::Units u,
+                                                    jint buckets, TRAPS);
+
 
     // Counter Types
     static PerfLongCounter* create_long_counter(CounterNS ns, const char* name,
@@ -32,10 +32,12 @@
 #include "code/scopeDesc.hpp"
 #include "gc_interface/collectedHeap.hpp"
 #include "interpreter/interpreter.hpp"
+#include "interpreter/oopMapCache.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/symbol.hpp"
+#include "prims/jvm.h"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
@@ -49,10 +51,12 @@
 #include "runtime/sweeper.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/vframe.hpp"
 #include "services/memTracker.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/workgroup.hpp"
 #ifdef TARGET_ARCH_x86
 # include "nativeInst_x86.hpp"
 # include "vmreg_x86.inline.hpp"
@@ -89,6 +93,7 @@ volatile int  SafepointSynchronize::_waiting_to_block = 0;
 volatile int SafepointSynchronize::_safepoint_counter = 0;
 int SafepointSynchronize::_current_jni_active_count = 0;
 long  SafepointSynchronize::_end_of_last_safepoint = 0;
+WorkGang* SafepointSynchronize::_cleanup_workers = NULL;
 static volatile int PageArmed = 0 ;        // safepoint polling page is RO|RW vs PROT_NONE
 static volatile int TryingToBlock = 0 ;    // proximate value -- for advisory use only
 static bool timeout_error_printed = false;
@@ -187,6 +192,12 @@ void SafepointSynchronize::begin() {
   //     between states, the safepointing code will wait for the thread to
   //     block itself when it attempts transitions to a new state.
   //
+  // Always-on time-to-block instrumentation. One clock read here and one
+  // per thread transition below is cheap relative to the safepoint itself.
+  jlong ttb_start = os::javaTimeNanos();
+  JavaThread* ttb_straggler = NULL;
+  jlong ttb_straggler_time = 0;
+
   _state            = _synchronizing;
   OrderAccess::fence();
 
@@ -219,26 +230,51 @@ void SafepointSynchronize::begin() {
   if (SafepointTimeout)
     safepoint_limit_time = os::javaTimeNanos() + (jlong)SafepointTimeoutDelay * MICROUNITS;
 
+  // Collect the threads into a side list so that the rendezvous loop
+  // below only revisits the threads that are still running, instead of
+  // walking the full thread list (possibly thousands of entries, most
+  // of them already stopped) on every pass. The thread set is stable
+  // here because the Threads_lock is held for the whole safepoint.
+  ResourceMark rm;
+  JavaThread** running_list = NEW_RESOURCE_ARRAY(JavaThread*, nof_threads);
+  {
+    int n = 0;
+    for (JavaThread *cur = Threads::first(); cur != NULL; cur = cur->next()) {
+      assert(!cur->is_ConcurrentGC_thread(), "A concurrent GC thread is unexpectly being suspended");
+      running_list[n++] = cur;
+    }
+    assert(n == nof_threads, "must have visited every thread");
+  }
+
   // Iterate through all threads until it have been determined how to stop them all at a safepoint
   unsigned int iterations = 0;
   int steps = 0 ;
   while(still_running > 0) {
-    for (JavaThread *cur = Threads::first(); cur != NULL; cur = cur->next()) {
-      assert(!cur->is_ConcurrentGC_thread(), "A concurrent GC thread is unexpectly being suspended");
+    int i = 0;
+    while (i < still_running) {
+      JavaThread *cur = running_list[i];
       ThreadSafepointState *cur_state = cur->safepoint_state();
-      if (cur_state->is_running()) {
-        cur_state->examine_state_of_thread();
-        if (!cur_state->is_running()) {
-           still_running--;
-           // consider adjusting steps downward:
-           //   steps = 0
-           //   steps -= NNN
-           //   steps >>= 1
-           //   steps = MIN(steps, 2000-100)
-           //   if (iterations != 0) steps -= NNN
-        }
-        if (TraceSafepoint && Verbose) cur_state->print();
+      assert(cur_state->is_running(), "only running threads are revisited");
+      cur_state->examine_state_of_thread();
+      if (!cur_state->is_running()) {
+         // Swap-remove the thread from the still-running list.
+         running_list[i] = running_list[--still_running];
+         jlong ttb_elapsed = os::javaTimeNanos() - ttb_start;
+         record_time_to_block(ttb_elapsed);
+         if (ttb_elapsed > ttb_straggler_time) {
+           ttb_straggler_time = ttb_elapsed;
+           ttb_straggler = cur;
+         }
+         // consider adjusting steps downward:
+         //   steps = 0
+         //   steps -= NNN
+         //   steps >>= 1
+         //   steps = MIN(steps, 2000-100)
+         //   if (iterations != 0) steps -= NNN
+      } else {
+        i++;
       }
+      if (TraceSafepoint && Verbose) cur_state->print();
     }
 
     if (PrintSafepointStatistics && iterations == 0) {
@@ -372,6 +408,9 @@ void SafepointSynchronize::begin() {
 
   OrderAccess::fence();
 
+  Events::log_vm_event(NULL, VMTraceEvent::SAFEPOINT_BEGIN,
+                       (intptr_t) _safepoint_counter);
+
 #ifdef ASSERT
   for (JavaThread *cur = Threads::first(); cur != NULL; cur = cur->next()) {
     // make sure all the threads were visited
@@ -382,6 +421,30 @@ void SafepointSynchronize::begin() {
   // Update the count of active JNI critical regions
   GC_locker::set_jni_lock_count(_current_jni_active_count);
 
+  // If this safepoint produced the slowest straggler seen so far, record
+  // its identity and top Java frame now that all stacks are stable. The
+  // frame the thread stopped in is usually the code that deferred the
+  // safepoint (counted loop, long runtime stub, etc).
+  if (ttb_straggler != NULL && ttb_straggler_time > _max_time_to_block) {
+    _max_time_to_block = ttb_straggler_time;
+    ResourceMark rm;
+    const char* frame_desc = "<no Java frame>";
+    char frame_buf[192];
+    if (ttb_straggler->has_last_Java_frame()) {
+      RegisterMap reg_map(ttb_straggler, false);
+      javaVFrame* jvf = ttb_straggler->last_java_vframe(&reg_map);
+      if (jvf != NULL) {
+        jio_snprintf(frame_buf, sizeof(frame_buf), "%s @ bci %d",
+                     jvf->method()->name_and_sig_as_C_string(), jvf->bci());
+        frame_desc = frame_buf;
+      }
+    }
+    jio_snprintf(_max_straggler_details, sizeof(_max_straggler_details),
+                 "\"%s\" took " JLONG_FORMAT " us to block at %s",
+                 ttb_straggler->get_thread_name(),
+                 ttb_straggler_time / 1000, frame_desc);
+  }
+
   if (TraceSafepoint) {
     VM_Operation *op = VMThread::vm_operation();
     tty->print_cr("Entering safepoint region: %s", (op != NULL) ? op->name() : "no vm operation");
@@ -407,6 +470,8 @@ void SafepointSynchronize::end() {
 
   assert(Threads_lock->owned_by_self(), "must hold Threads_lock");
   assert((_safepoint_counter & 0x1) == 1, "must be odd");
+  Events::log_vm_event(NULL, VMTraceEvent::SAFEPOINT_END,
+                       (intptr_t) _safepoint_counter);
   _safepoint_counter ++;
   // memory fence isn't required here since an odd _safepoint_counter
   // value can do no harm and a fence is issued below anyway.
@@ -495,6 +560,8 @@ void SafepointSynchronize::end() {
 }
 
 bool SafepointSynchronize::is_cleanup_needed() {
+  // Need a safepoint if the monitor population is mostly in use
+  if (ObjectSynchronizer::is_cleanup_needed()) return true;
   // Need a safepoint if some inline cache buffers is non-empty
   if (!InlineCacheBuffer::is_empty()) return true;
   return false;
@@ -502,37 +569,133 @@ bool SafepointSynchronize::is_cleanup_needed() {
 
 
 
-// Various cleaning tasks that should be done periodically at safepoints
-void SafepointSynchronize::do_cleanup_tasks() {
-  {
-    TraceTime t1("deflating idle monitors", TraceSafepointCleanupTime);
-    ObjectSynchronizer::deflate_idle_monitors();
+// Times one cleanup subtask, prints it with -XX:+TraceSafepointCleanupTime
+// the way the former TraceTime blocks did, and leaves a record in the
+// event log so the cost breakdown of recent safepoints shows up in
+// hs_err files and with jcmd VM.events.
+class TraceCleanupTask : public StackObj {
+ private:
+  const char*  _name;
+  elapsedTimer _timer;
+ public:
+  TraceCleanupTask(const char* name) : _name(name) {
+    _timer.start();
   }
+  ~TraceCleanupTask() {
+    _timer.stop();
+    if (TraceSafepointCleanupTime) {
+      tty->print_cr("[%s, %3.7f secs]", _name, _timer.seconds());
+    }
+    Events::log(Thread::current(), "safepoint cleanup: %s, %3.7f secs",
+                _name, _timer.seconds());
+  }
+};
+
+// The periodic cleanup work is split into subtasks so that it can be
+// spread over a gang of worker threads; each subtask operates on its own
+// data structures and is claimed by exactly one worker. With
+// -XX:ParallelSafepointCleanupThreads=1 (the default) everything runs
+// on the VMThread as before.
+class ParallelSPCleanupTask : public AbstractGangTask {
+ private:
+  SubTasksDone _subtasks;
+ public:
+  enum {
+    SP_CLEANUP_DEFLATE_MONITORS,
+    SP_CLEANUP_UPDATE_INLINE_CACHES,
+    SP_CLEANUP_COMPILATION_POLICY,
+    SP_CLEANUP_MARK_NMETHODS,
+    SP_CLEANUP_SYMBOL_TABLE,
+    SP_CLEANUP_STRING_TABLE,
+    SP_CLEANUP_OOPMAP_CACHE,
+    SP_CLEANUP_NUM_TASKS
+  };
+
+  ParallelSPCleanupTask(uint n_workers) :
+    AbstractGangTask("parallel safepoint cleanup"),
+    _subtasks(SP_CLEANUP_NUM_TASKS) {
+    _subtasks.set_n_threads(n_workers);
+  }
+
+  void work(uint worker_id) {
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_DEFLATE_MONITORS)) {
+      TraceCleanupTask t("deflating idle monitors");
+      ObjectSynchronizer::deflate_idle_monitors();
+    }
 
-  {
-    TraceTime t2("updating inline caches", TraceSafepointCleanupTime);
-    InlineCacheBuffer::update_inline_caches();
-  }
-  {
-    TraceTime t3("compilation policy safepoint handler", TraceSafepointCleanupTime);
-    CompilationPolicy::policy()->do_safepoint_work();
-  }
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_UPDATE_INLINE_CACHES)) {
+      TraceCleanupTask t("updating inline caches");
+      InlineCacheBuffer::update_inline_caches();
+    }
 
-  {
-    TraceTime t4("mark nmethods", TraceSafepointCleanupTime);
-    NMethodSweeper::mark_active_nmethods();
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_COMPILATION_POLICY)) {
+      TraceCleanupTask t("compilation policy safepoint handler");
+      CompilationPolicy::policy()->do_safepoint_work();
+    }
+
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_MARK_NMETHODS)) {
+      TraceCleanupTask t("mark nmethods");
+      NMethodSweeper::mark_active_nmethods();
+    }
+
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_SYMBOL_TABLE)) {
+      if (SymbolTable::needs_rehashing()) {
+        TraceCleanupTask t("rehashing symbol table");
+        SymbolTable::rehash_table();
+      }
+      if (SymbolTable::needs_resizing()) {
+        TraceCleanupTask t("growing symbol table");
+        SymbolTable::grow_table();
+      }
+    }
+
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_STRING_TABLE)) {
+      if (StringTable::needs_rehashing()) {
+        TraceCleanupTask t("rehashing string table");
+        StringTable::rehash_table();
+      }
+      if (StringTable::needs_resizing()) {
+        TraceCleanupTask t("growing string table");
+        StringTable::grow_table();
+      }
+    }
+
+    if (!_subtasks.is_task_claimed(SP_CLEANUP_OOPMAP_CACHE)) {
+      TraceCleanupTask t("freeing displaced oop map cache entries");
+      OopMapCache::cleanup_old_entries();
+    }
+
+    _subtasks.all_tasks_completed();
   }
+};
 
-  if (SymbolTable::needs_rehashing()) {
-    TraceTime t5("rehashing symbol table", TraceSafepointCleanupTime);
-    SymbolTable::rehash_table();
+WorkGang* SafepointSynchronize::cleanup_workers() {
+  if (ParallelSafepointCleanupThreads <= 1) {
+    return NULL;
+  }
+  if (_cleanup_workers == NULL) {
+    _cleanup_workers = new WorkGang("Safepoint Cleanup Thread",
+                                    (uint) ParallelSafepointCleanupThreads,
+                                    false, false);
+    _cleanup_workers->initialize_workers();
   }
+  return _cleanup_workers;
+}
 
-  if (StringTable::needs_rehashing()) {
-    TraceTime t6("rehashing string table", TraceSafepointCleanupTime);
-    StringTable::rehash_table();
+// Various cleaning tasks that should be done periodically at safepoints
+void SafepointSynchronize::do_cleanup_tasks() {
+  WorkGang* workers = cleanup_workers();
+  if (workers != NULL) {
+    ParallelSPCleanupTask cleanup(workers->total_workers());
+    workers->run_task(&cleanup);
+  } else {
+    ParallelSPCleanupTask cleanup(1);
+    cleanup.work(0);
   }
 
+  // These stay on the VMThread: log rotation uses the shared output
+  // streams and NMT synchronization is not prepared for workers.
+
   // rotate log files?
   if (UseGCLogFileRotation) {
     gclog_or_tty->rotate_log();
@@ -1117,6 +1280,40 @@ jlong  SafepointSynchronize::_max_sync_time = 0;
 jlong  SafepointSynchronize::_max_vmop_time = 0;
 float  SafepointSynchronize::_ts_of_current_safepoint = 0.0f;
 
+julong SafepointSynchronize::_ttb_histogram[SafepointSynchronize::_ttb_histogram_size];
+jlong  SafepointSynchronize::_max_time_to_block = 0;
+char   SafepointSynchronize::_max_straggler_details[256] = "<none recorded>";
+
+// Bucket a thread's time-to-block by log2 microseconds. Only the VM
+// thread writes these counters, so plain increments suffice.
+void SafepointSynchronize::record_time_to_block(jlong time_ns) {
+  jlong us = time_ns / 1000;
+  int bucket = 0;
+  while (us > 1 && bucket < _ttb_histogram_size - 1) {
+    us >>= 1;
+    bucket++;
+  }
+  _ttb_histogram[bucket]++;
+}
+
+void SafepointSynchronize::print_time_to_block_histogram(outputStream* st) {
+  st->print_cr("Safepoint time-to-block histogram (per thread, all safepoints):");
+  julong total = 0;
+  for (int i = 0; i < _ttb_histogram_size; i++) {
+    total += _ttb_histogram[i];
+  }
+  for (int i = 0; i < _ttb_histogram_size; i++) {
+    if (i < _ttb_histogram_size - 1) {
+      st->print("  < " UINT64_FORMAT_W(8) " us: ", (julong)1 << (i + 1));
+    } else {
+      st->print(" >= " UINT64_FORMAT_W(8) " us: ", (julong)1 << i);
+    }
+    st->print_cr(JULONG_FORMAT, _ttb_histogram[i]);
+  }
+  st->print_cr("Total samples: " JULONG_FORMAT, total);
+  st->print_cr("Slowest straggler: %s", _max_straggler_details);
+}
+
 static jlong  cleanup_end_time = 0;
 static bool   need_to_track_page_armed_status = false;
 static bool   init_done = false;
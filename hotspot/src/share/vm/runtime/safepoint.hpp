@@ -33,6 +33,8 @@
 #include "runtime/os.hpp"
 #include "utilities/ostream.hpp"
 
+class WorkGang;
+
 //
 // Safepoint synchronization
 ////
@@ -116,6 +118,22 @@ private:
   static jlong            _max_vmop_time;            // maximum vm operation time in nanos
   static float            _ts_of_current_safepoint;  // time stamp of current safepoint in seconds
 
+  // Always-on time-to-block instrumentation, independent of
+  // PrintSafepointStatistics. begin() records how long each thread took
+  // to be observed safe, bucketed by log2 microseconds, and keeps the
+  // top Java frame of the slowest straggler seen so far. Readers (jcmd)
+  // scan the counters racily; the VM thread is the only writer.
+  enum { _ttb_histogram_size = 18 };
+  static julong           _ttb_histogram[_ttb_histogram_size];
+  static jlong            _max_time_to_block;        // slowest straggler in nanos
+  static char             _max_straggler_details[256];
+  static void record_time_to_block(jlong time_ns);
+
+  // Gang used to spread cleanup subtasks over several threads; created
+  // lazily, NULL while ParallelSafepointCleanupThreads is 1
+  static WorkGang*        _cleanup_workers;
+  static WorkGang* cleanup_workers();
+
   static void begin_statistics(int nof_threads, int nof_running);
   static void update_statistics_on_spin_end();
   static void update_statistics_on_sync_end(jlong end_time);
@@ -178,6 +196,7 @@ public:
 
   static void deferred_initialize_stat();
   static void print_stat_on_exit();
+  static void print_time_to_block_histogram(outputStream* st);
   inline static void inc_vmop_coalesced_count() { _coalesced_vmop_count++; }
 
   static void set_is_at_safepoint()                        { _state = _synchronized; }
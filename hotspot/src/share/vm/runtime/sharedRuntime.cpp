@@ -172,6 +172,7 @@ int SharedRuntime::_mon_exit_stub_ctr=0;
 int SharedRuntime::_mon_enter_ctr=0;
 int SharedRuntime::_mon_exit_ctr=0;
 int SharedRuntime::_partial_subtype_ctr=0;
+int SharedRuntime::_jbyte_short_copy_ctr=0;
 int SharedRuntime::_jbyte_array_copy_ctr=0;
 int SharedRuntime::_jshort_array_copy_ctr=0;
 int SharedRuntime::_jint_array_copy_ctr=0;
@@ -1256,7 +1257,7 @@ methodHandle SharedRuntime::resolve_sub_helper(JavaThread *thread,
 
   // grab lock, check for deoptimization and potentially patch caller
   {
-    MutexLocker ml_patch(CompiledIC_lock);
+    MutexLocker ml_patch(CompiledIC::ic_lock(caller_nm));
 
     // Now that we are ready to patch if the Method* was redefined then
     // don't update call site and let the caller retry.
@@ -1282,7 +1283,7 @@ methodHandle SharedRuntime::resolve_sub_helper(JavaThread *thread,
       }
     }
 
-  } // unlock CompiledIC_lock
+  } // unlock IC patching lock
 
   return callee_method;
 }
@@ -1462,67 +1463,70 @@ methodHandle SharedRuntime::handle_ic_miss_helper(JavaThread *thread, TRAPS) {
 
   // Update inline cache to megamorphic. Skip update if caller has been
   // made non-entrant or we are called from interpreted.
-  { MutexLocker ml_patch (CompiledIC_lock);
+  {
     RegisterMap reg_map(thread, false);
     frame caller_frame = thread->last_frame().sender(&reg_map);
     CodeBlob* cb = caller_frame.cb();
-    if (cb->is_nmethod() && ((nmethod*)cb)->is_in_use()) {
-      // Not a non-entrant nmethod, so find inline_cache
-      CompiledIC* inline_cache = CompiledIC_before(((nmethod*)cb), caller_frame.pc());
-      bool should_be_mono = false;
-      if (inline_cache->is_optimized()) {
-        if (TraceCallFixup) {
-          ResourceMark rm(thread);
-          tty->print("OPTIMIZED IC miss (%s) call to", Bytecodes::name(bc));
-          callee_method->print_short_name(tty);
-          tty->print_cr(" code: " INTPTR_FORMAT, callee_method->code());
-        }
-        should_be_mono = true;
-      } else if (inline_cache->is_icholder_call()) {
-        CompiledICHolder* ic_oop = inline_cache->cached_icholder();
-        if ( ic_oop != NULL) {
-
-          if (receiver()->klass() == ic_oop->holder_klass()) {
-            // This isn't a real miss. We must have seen that compiled code
-            // is now available and we want the call site converted to a
-            // monomorphic compiled call site.
-            // We can't assert for callee_method->code() != NULL because it
-            // could have been deoptimized in the meantime
-            if (TraceCallFixup) {
-              ResourceMark rm(thread);
-              tty->print("FALSE IC miss (%s) converting to compiled call to", Bytecodes::name(bc));
-              callee_method->print_short_name(tty);
-              tty->print_cr(" code: " INTPTR_FORMAT, callee_method->code());
+    if (cb->is_nmethod()) {
+      MutexLocker ml_patch(CompiledIC::ic_lock((nmethod*)cb));
+      if (((nmethod*)cb)->is_in_use()) {
+        // Not a non-entrant nmethod, so find inline_cache
+        CompiledIC* inline_cache = CompiledIC_before(((nmethod*)cb), caller_frame.pc());
+        bool should_be_mono = false;
+        if (inline_cache->is_optimized()) {
+          if (TraceCallFixup) {
+            ResourceMark rm(thread);
+            tty->print("OPTIMIZED IC miss (%s) call to", Bytecodes::name(bc));
+            callee_method->print_short_name(tty);
+            tty->print_cr(" code: " INTPTR_FORMAT, callee_method->code());
+          }
+          should_be_mono = true;
+        } else if (inline_cache->is_icholder_call()) {
+          CompiledICHolder* ic_oop = inline_cache->cached_icholder();
+          if ( ic_oop != NULL) {
+
+            if (receiver()->klass() == ic_oop->holder_klass()) {
+              // This isn't a real miss. We must have seen that compiled code
+              // is now available and we want the call site converted to a
+              // monomorphic compiled call site.
+              // We can't assert for callee_method->code() != NULL because it
+              // could have been deoptimized in the meantime
+              if (TraceCallFixup) {
+                ResourceMark rm(thread);
+                tty->print("FALSE IC miss (%s) converting to compiled call to", Bytecodes::name(bc));
+                callee_method->print_short_name(tty);
+                tty->print_cr(" code: " INTPTR_FORMAT, callee_method->code());
+              }
+              should_be_mono = true;
             }
-            should_be_mono = true;
           }
         }
-      }
 
-      if (should_be_mono) {
-
-        // We have a path that was monomorphic but was going interpreted
-        // and now we have (or had) a compiled entry. We correct the IC
-        // by using a new icBuffer.
-        CompiledICInfo info;
-        KlassHandle receiver_klass(THREAD, receiver()->klass());
-        inline_cache->compute_monomorphic_entry(callee_method,
-                                                receiver_klass,
-                                                inline_cache->is_optimized(),
-                                                false,
-                                                info, CHECK_(methodHandle()));
-        inline_cache->set_to_monomorphic(info);
-      } else if (!inline_cache->is_megamorphic() && !inline_cache->is_clean()) {
-        // Potential change to megamorphic
-        bool successful = inline_cache->set_to_megamorphic(&call_info, bc, CHECK_(methodHandle()));
-        if (!successful) {
-          inline_cache->set_to_clean();
+        if (should_be_mono) {
+
+          // We have a path that was monomorphic but was going interpreted
+          // and now we have (or had) a compiled entry. We correct the IC
+          // by using a new icBuffer.
+          CompiledICInfo info;
+          KlassHandle receiver_klass(THREAD, receiver()->klass());
+          inline_cache->compute_monomorphic_entry(callee_method,
+                                                  receiver_klass,
+                                                  inline_cache->is_optimized(),
+                                                  false,
+                                                  info, CHECK_(methodHandle()));
+          inline_cache->set_to_monomorphic(info);
+        } else if (!inline_cache->is_megamorphic() && !inline_cache->is_clean()) {
+          // Potential change to megamorphic
+          bool successful = inline_cache->set_to_megamorphic(&call_info, bc, CHECK_(methodHandle()));
+          if (!successful) {
+            inline_cache->set_to_clean();
+          }
+        } else {
+          // Either clean or megamorphic
         }
-      } else {
-        // Either clean or megamorphic
       }
     }
-  } // Release CompiledIC_lock
+  } // Release IC patching lock
 
   return callee_method;
 }
@@ -1609,7 +1613,7 @@ methodHandle SharedRuntime::reresolve_call_site(JavaThread *thread, TRAPS) {
       // to a wrong method). It should not be performance critical, since the
       // resolve is only done once.
 
-      MutexLocker ml(CompiledIC_lock);
+      MutexLocker ml(CompiledIC::ic_lock(caller_nm));
       //
       // We do not patch the call site if the nmethod has been made non-entrant
       // as it is a waste of time
@@ -1930,6 +1934,7 @@ void SharedRuntime::print_statistics() {
   if( _mon_enter_ctr ) tty->print_cr("%5d monitor enter slow", _mon_enter_ctr );
   if( _mon_exit_ctr ) tty->print_cr("%5d monitor exit slow", _mon_exit_ctr );
   if( _partial_subtype_ctr) tty->print_cr("%5d slow partial subtype", _partial_subtype_ctr );
+  if( _jbyte_short_copy_ctr ) tty->print_cr("%5d short-length byte array copies", _jbyte_short_copy_ctr );
   if( _jbyte_array_copy_ctr ) tty->print_cr("%5d byte array copies", _jbyte_array_copy_ctr );
   if( _jshort_array_copy_ctr ) tty->print_cr("%5d short array copies", _jshort_array_copy_ctr );
   if( _jint_array_copy_ctr ) tty->print_cr("%5d int array copies", _jint_array_copy_ctr );
@@ -2225,6 +2230,12 @@ class AdapterHandlerTable : public BasicHashtable<mtCode> {
   // Insert an entry into the table
   void add(AdapterHandlerEntry* entry) {
     int index = hash_to_index(entry->hash());
+    // The table is probed without the lock by get_adapter.  Entries are
+    // never removed or rehashed, so an unlocked reader walking a bucket
+    // chain either misses a concurrently added entry (and retries under
+    // the lock) or sees it; the barrier makes sure a visible entry is
+    // fully initialized, including its relocated code addresses.
+    OrderAccess::storestore();
     add_entry(index, entry);
   }
 
@@ -2344,7 +2355,10 @@ BufferBlob* AdapterHandlerLibrary::buffer_blob() {
 
 void AdapterHandlerLibrary::initialize() {
   if (_adapters != NULL) return;
-  _adapters = new AdapterHandlerTable();
+  // Publish the table with a release store; get_adapter probes it
+  // without the lock.
+  AdapterHandlerTable* table = new AdapterHandlerTable();
+  OrderAccess::release_store_ptr(&_adapters, table);
 
   // Create a special handler for abstract methods.  Abstract methods
   // are never compiled so an i2c entry is somewhat meaningless, but
@@ -2381,6 +2395,46 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(methodHandle method) {
 
   ResourceMark rm;
 
+  if (method->is_abstract()) {
+    MutexLocker mu(AdapterHandlerLibrary_lock);
+    initialize();
+    return _abstract_method_handler;
+  }
+
+  // Fill in the signature array, for the calling-convention call.
+  int total_args_passed = method->size_of_parameters(); // All args on stack
+
+  BasicType* sig_bt = NEW_RESOURCE_ARRAY(BasicType, total_args_passed);
+  VMRegPair* regs   = NEW_RESOURCE_ARRAY(VMRegPair, total_args_passed);
+  int i = 0;
+  if (!method->is_static())  // Pass in receiver first
+    sig_bt[i++] = T_OBJECT;
+  for (SignatureStream ss(method->signature()); !ss.at_return_type(); ss.next()) {
+    sig_bt[i++] = ss.type();  // Collect remaining bits of signature
+    if (ss.type() == T_LONG || ss.type() == T_DOUBLE)
+      sig_bt[i++] = T_VOID;   // Longs & doubles take 2 Java slots
+  }
+  assert(i == total_args_passed, "");
+
+  // Probe the table without the lock first: after warmup virtually every
+  // call here hits an existing adapter, and entries are never removed or
+  // rehashed, so an unlocked reader either finds the entry fully
+  // initialized (AdapterHandlerTable::add publishes it behind a barrier)
+  // or misses it and retries under the lock below.
+  bool try_lock_free = (OrderAccess::load_ptr_acquire(&_adapters) != NULL);
+#ifdef ASSERT
+  if (VerifyAdapterSharing) {
+    // Force the locked path so sharing verification sees every request.
+    try_lock_free = false;
+  }
+#endif
+  if (try_lock_free) {
+    AdapterHandlerEntry* entry = _adapters->lookup(total_args_passed, sig_bt);
+    if (entry != NULL) {
+      return entry;
+    }
+  }
+
   NOT_PRODUCT(int insts_size);
   AdapterBlob* B = NULL;
   AdapterHandlerEntry* entry = NULL;
@@ -2390,25 +2444,6 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(methodHandle method) {
     // make sure data structure is initialized
     initialize();
 
-    if (method->is_abstract()) {
-      return _abstract_method_handler;
-    }
-
-    // Fill in the signature array, for the calling-convention call.
-    int total_args_passed = method->size_of_parameters(); // All args on stack
-
-    BasicType* sig_bt = NEW_RESOURCE_ARRAY(BasicType, total_args_passed);
-    VMRegPair* regs   = NEW_RESOURCE_ARRAY(VMRegPair, total_args_passed);
-    int i = 0;
-    if (!method->is_static())  // Pass in receiver first
-      sig_bt[i++] = T_OBJECT;
-    for (SignatureStream ss(method->signature()); !ss.at_return_type(); ss.next()) {
-      sig_bt[i++] = ss.type();  // Collect remaining bits of signature
-      if (ss.type() == T_LONG || ss.type() == T_DOUBLE)
-        sig_bt[i++] = T_VOID;   // Longs & doubles take 2 Java slots
-    }
-    assert(i == total_args_passed, "");
-
     // Lookup method signature's fingerprint
     entry = _adapters->lookup(total_args_passed, sig_bt);
 
@@ -512,6 +512,7 @@ class SharedRuntime: AllStatic {
   static int _implicit_null_throws;
   static int _implicit_div0_throws;
 
+  static int _jbyte_short_copy_ctr;        // Byte array copies of at most 32 bytes
   static int _jbyte_array_copy_ctr;        // Slow-path byte array copy
   static int _jshort_array_copy_ctr;       // Slow-path short array copy
   static int _jint_array_copy_ctr;         // Slow-path int array copy
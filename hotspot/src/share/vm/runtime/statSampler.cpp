@@ -355,6 +355,18 @@ class HighResTimeSampler : public PerfSampleHelper {
     jlong take_sample() { return os::elapsed_counter(); }
 };
 
+/*
+ * helper class to provide for sampling of the wall clock. The sampled
+ * value gives monitoring code a coarse System.currentTimeMillis()
+ * equivalent that can be read from the perf data memory with a plain
+ * memory load (e.g. via the direct buffer returned by
+ * sun.misc.Perf.attach()) instead of a system call per read.
+ */
+class WallClockTimeSampler : public PerfSampleHelper {
+  public:
+    jlong take_sample() { return os::javaTimeMillis(); }
+};
+
 /*
  * the create_sampled_perdata() method provides a place to instantiate
  * sampled PerfData instances that would otherwise have no better place
@@ -370,6 +382,13 @@ void StatSampler::create_sampled_perfdata() {
   PerfSampleHelper* psh = new HighResTimeSampler();
   PerfDataManager::create_counter(SUN_OS, "hrt.ticks",
                                   PerfData::U_Ticks, psh, CHECK);
+
+  // setup sampling of the wall clock. The sample is refreshed every
+  // PerfDataSamplingInterval milliseconds, which bounds the
+  // granularity seen by readers of the perf data memory.
+  PerfSampleHelper* wcs = new WallClockTimeSampler();
+  PerfDataManager::create_counter(SUN_OS, "javaTimeMillis",
+                                  PerfData::U_Ticks, wcs, CHECK);
 }
 
 /*
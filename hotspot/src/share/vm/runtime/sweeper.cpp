@@ -35,6 +35,7 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/sweeperThread.hpp"
 #include "runtime/vm_operations.hpp"
 #include "trace/tracing.hpp"
 #include "utilities/events.hpp"
@@ -224,6 +225,41 @@ void NMethodSweeper::mark_active_nmethods() {
 
   OrderAccess::storestore();
 }
+
+/**
+ * Work loop of the dedicated sweeper thread. The thread wakes up
+ * periodically (and whenever it is notified, e.g., when the code cache
+ * runs full) and checks whether there is sweeping to do. The time-based
+ * heuristics inside possibly_sweep() only advance with the stack scans
+ * performed at safepoints, so there is no point in polling more often.
+ */
+void NMethodSweeper::sweeper_loop() {
+  JavaThread* thread = JavaThread::current();
+  assert(thread->is_Code_cache_sweeper_thread(), "must be sweeper thread");
+  while (true) {
+    {
+      // Need state transition ThreadBlockInVM so that this thread
+      // will be handled by safepoint correctly when this thread is
+      // waiting for work.
+      ThreadBlockInVM tbivm(thread);
+      MutexLockerEx waiter(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+      const long wait_time_ms = NmethodSweepCheckInterval * 1000;
+      CodeCache_lock->wait(Mutex::_no_safepoint_check_flag, wait_time_ms);
+    }
+    possibly_sweep();
+  }
+}
+
+/**
+ * Wakes up the sweeper thread to check for work, e.g., because the code
+ * cache ran full. The CodeCache_lock doubles as the monitor the sweeper
+ * thread waits on. Must not be called while holding the CodeCache_lock.
+ */
+void NMethodSweeper::notify() {
+  MutexLockerEx ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  CodeCache_lock->notify();
+}
+
 /**
  * This function invokes the sweeper if at least one of the three conditions is met:
  *    (1) The code cache is getting full
@@ -231,9 +267,12 @@ void NMethodSweeper::mark_active_nmethods() {
  *    (3) We have not been sweeping for 'some time'
  */
 void NMethodSweeper::possibly_sweep() {
-  assert(JavaThread::current()->thread_state() == _thread_in_vm, "must run in vm mode");
-  // Only compiler threads are allowed to sweep
-  if (!MethodFlushing || !sweep_in_progress() || !Thread::current()->is_Compiler_thread()) {
+  JavaThread* thread = JavaThread::current();
+  assert(thread->thread_state() == _thread_in_vm, "must run in vm mode");
+  // Only the dedicated sweeper thread sweeps, so zombie detection and
+  // flushing never steal compiler-thread time.
+  assert(thread->is_Code_cache_sweeper_thread(), "only the sweeper thread sweeps");
+  if (!MethodFlushing || !sweep_in_progress()) {
     return;
   }
 
@@ -316,8 +355,7 @@ void NMethodSweeper::sweep_code_cache() {
 
   if (!CompileBroker::should_compile_new_jobs()) {
     // If we have turned off compilations we might as well do full sweeps
-    // in order to reach the clean state faster. Otherwise the sleeping compiler
-    // threads will slow down sweeping.
+    // in order to reach the clean state faster.
     _sweep_fractions_left = 1;
   }
 
@@ -442,10 +480,12 @@ void NMethodSweeper::possibly_enable_sweeper() {
 
 class NMethodMarker: public StackObj {
  private:
-  CompilerThread* _thread;
+  CodeCacheSweeperThread* _thread;
  public:
   NMethodMarker(nmethod* nm) {
-    _thread = CompilerThread::current();
+    JavaThread* current = JavaThread::current();
+    assert(current->is_Code_cache_sweeper_thread(), "wrong thread");
+    _thread = (CodeCacheSweeperThread*)current;
     if (!nm->is_zombie() && !nm->is_unloaded()) {
       // Only expose live nmethods for scanning
       _thread->set_scanned_nmethod(nm);
@@ -460,7 +500,7 @@ void NMethodSweeper::release_nmethod(nmethod *nm) {
   // Clean up any CompiledICHolders
   {
     ResourceMark rm;
-    MutexLocker ml_patch(CompiledIC_lock);
+    MutexLocker ml_patch(CompiledIC::ic_lock(nm));
     RelocIterator iter(nm);
     while (iter.next()) {
       if (iter.type() == relocInfo::virtual_call_type) {
@@ -487,7 +527,7 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
     // But still remember to clean-up inline caches for alive nmethods
     if (nm->is_alive()) {
       // Clean inline caches that point to zombie/non-entrant methods
-      MutexLocker cl(CompiledIC_lock);
+      MutexLocker cl(CompiledIC::ic_lock(nm));
       nm->cleanup_inline_caches();
       SWEEP(nm);
     }
@@ -529,7 +569,7 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       SWEEP(nm);
     } else {
       // Still alive, clean up its inline caches
-      MutexLocker cl(CompiledIC_lock);
+      MutexLocker cl(CompiledIC::ic_lock(nm));
       nm->cleanup_inline_caches();
       SWEEP(nm);
     }
@@ -559,10 +599,13 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
         // ReservedCodeCacheSize
         int reset_val = hotness_counter_reset_val();
         int time_since_reset = reset_val - nm->hotness_counter();
-        double threshold = -reset_val + (CodeCache::reverse_free_ratio() * NmethodSweepActivity);
-        // The less free space in the code cache we have - the bigger reverse_free_ratio() is.
-        // I.e., 'threshold' increases with lower available space in the code cache and a higher
-        // NmethodSweepActivity. If the current hotness counter - which decreases from its initial
+        int code_blob_type = CodeCache::get_code_blob_type(nm->comp_level());
+        double threshold = -reset_val + (CodeCache::reverse_free_ratio(code_blob_type) * NmethodSweepActivity);
+        // The less free space in the code heap holding the nmethod - the bigger reverse_free_ratio()
+        // is. I.e., 'threshold' increases with lower available space in the code heap and a higher
+        // NmethodSweepActivity. With a segmented code cache this puts more pressure on the profiled
+        // heap, which tiered compilation fills and invalidates at a much higher rate than the
+        // non-profiled heap. If the current hotness counter - which decreases from its initial
         // value until it is reset by stack walking - is smaller than the computed threshold, the
         // corresponding nmethod is considered for removal.
         if ((NmethodSweepActivity > 0) && (nm->hotness_counter() < threshold) && (time_since_reset > 10)) {
@@ -583,7 +626,7 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       }
     }
     // Clean-up all inline caches that point to zombie/non-reentrant methods
-    MutexLocker cl(CompiledIC_lock);
+    MutexLocker cl(CompiledIC::ic_lock(nm));
     nm->cleanup_inline_caches();
     SWEEP(nm);
   }
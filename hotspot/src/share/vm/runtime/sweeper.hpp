@@ -49,9 +49,9 @@
 //     remove the nmethod, all inline caches (IC) that point to the the nmethod must be
 //     cleared. After that, the nmethod can be evicted from the code cache. Each nmethod's
 //     state change happens during separate sweeps. It may take at least 3 sweeps before an
-//     nmethod's space is freed. Sweeping is currently done by compiler threads between
-//     compilations or at least each 5 sec (NmethodSweepCheckInterval) when the code cache
-//     is full.
+//     nmethod's space is freed. Sweeping is done by the dedicated sweeper thread, which
+//     wakes up every NmethodSweepCheckInterval seconds (or when notified because the code
+//     cache is getting full) and checks if a sweep is due.
 
 class NMethodSweeper : public AllStatic {
   static long      _traversals;                   // Stack scan count, also sweep ID.
@@ -103,7 +103,9 @@ class NMethodSweeper : public AllStatic {
 #endif
 
   static void mark_active_nmethods();      // Invoked at the end of each safepoint
-  static void possibly_sweep();            // Compiler threads call this to sweep
+  static void sweeper_loop();              // Work loop of the dedicated sweeper thread
+  static void notify();                    // Wake up the sweeper thread
+  static void possibly_sweep();            // Sweeper thread calls this to sweep
 
   static int sort_nmethods_by_hotness(nmethod** nm1, nmethod** nm2);
   static int hotness_counter_reset_val();
@@ -637,7 +637,7 @@ intptr_t ObjectSynchronizer::FastHashCode (Thread * Self, oop obj) {
   // object should remain ineligible for biased locking
   assert (!mark->has_bias_pattern(), "invariant") ;
 
-  if (mark->is_neutral()) {
+  while (mark->is_neutral()) {
     hash = mark->hash();              // this is a normal header
     if (hash) {                       // if it has hash, just return it
       return hash;
@@ -649,10 +649,15 @@ intptr_t ObjectSynchronizer::FastHashCode (Thread * Self, oop obj) {
     if (test == mark) {
       return hash;
     }
-    // If atomic operation failed, we must inflate the header
-    // into heavy weight monitor. We could add more code here
-    // for fast path, but it does not worth the complexity.
-  } else if (mark->has_monitor()) {
+    // The CAS can fail because another thread installed a hash first --
+    // the retry will find and return it -- or because the object was
+    // locked or is being inflated.  Re-read the mark and retry the
+    // neutral path rather than inflating: racing hash installs on
+    // otherwise unlocked objects (e.g. IdentityHashMap churn) used to
+    // manufacture monitors here for no locking-related reason.
+    mark = ReadStableMark (obj);
+  }
+  if (mark->has_monitor()) {
     monitor = mark->monitor();
     temp = monitor->header();
     assert (temp->is_neutral(), "invariant") ;
@@ -1034,33 +1039,42 @@ ObjectMonitor * ATTR ObjectSynchronizer::omAlloc (Thread * Self) {
            temp[i].FreeNext = &temp[i+1];
         }
 
-        // terminate the last monitor as the end of list
-        temp[_BLOCKSIZE - 1].FreeNext = NULL ;
-
         // Element [0] is reserved for global list linkage
         temp[0].set_object(CHAINMARKER);
 
-        // Consider carving out this thread's current request from the
-        // block in hand.  This avoids some lock traffic and redundant
-        // list activity.
-
-        // Acquire the ListLock to manipulate BlockList and FreeList.
+        // Carve the whole block out for the requesting thread: splice the
+        // new monitors directly onto its private omFreeList instead of
+        // publishing them on gFreeList only to reprovision them back out
+        // under the lock on the next loop iteration.  During an inflation
+        // storm (e.g. after bulk biased-locking revocation) this makes
+        // block allocation the only path that still touches the ListLock,
+        // and then only for the gBlockList linkage and population count.
+        // Monitors on a private free list are not part of MonitorFreeCount,
+        // matching the accounting omFlush() and reprovisioning use.
+        temp[_BLOCKSIZE - 1].FreeNext = Self->omFreeList ;
+        Self->omFreeList = temp + 1 ;
+        Self->omFreeCount += _BLOCKSIZE - 1 ;
+
+        // Acquire the ListLock to manipulate BlockList.
         // An Oyama-Taura-Yonezawa scheme might be more efficient.
         Thread::muxAcquire (&ListLock, "omAlloc [2]") ;
         MonitorPopulation += _BLOCKSIZE-1;
-        MonitorFreeCount += _BLOCKSIZE-1;
 
         // Add the new block to the list of extant blocks (gBlockList).
         // The very first objectMonitor in a block is reserved and dedicated.
         // It serves as blocklist "next" linkage.
         temp[0].FreeNext = gBlockList;
         gBlockList = temp;
-
-        // Add the new string of objectMonitors to the global free list
-        temp[_BLOCKSIZE - 1].FreeNext = gFreeList ;
-        gFreeList = temp + 1;
         Thread::muxRelease (&ListLock) ;
         TEVENT (Allocate block of monitors) ;
+
+        // The MonitorBound check normally runs on the reprovisioning path;
+        // since carved blocks bypass gFreeList, repeat it here so a pure
+        // growth storm still induces a scavenge.
+        const int mx = MonitorBound ;
+        if (mx > 0 && (MonitorPopulation-MonitorFreeCount) > mx) {
+          InduceScavenge (Self, "omAlloc [2]") ;
+        }
     }
 }
 
@@ -1417,6 +1431,22 @@ enum ManifestConstants {
     MaximumRecheckInterval  = 1000
 } ;
 
+// Estimate of the in-use fraction of the monitor population.  Beware that
+// MonitorFreeCount does not include monitors parked on per-thread private
+// free lists, so the estimate errs on the side of deflating too often.
+static bool MonitorsUsedAboveThreshold () {
+  if (MonitorPopulation == 0) return false ;
+  int used = MonitorPopulation - MonitorFreeCount ;
+  return (used * 100) > (MonitorUsedDeflationThreshold * MonitorPopulation) ;
+}
+
+bool ObjectSynchronizer::is_cleanup_needed() {
+  if (MonitorUsedDeflationThreshold > 0) {
+    return MonitorsUsedAboveThreshold() ;
+  }
+  return false ;
+}
+
 // Deflate a single monitor if not in use
 // Return true if deflated, false if in use
 bool ObjectSynchronizer::deflate_monitor(ObjectMonitor* mid, oop obj,
@@ -1497,6 +1527,19 @@ int ObjectSynchronizer::walk_monitor_list(ObjectMonitor** listheadp,
 
 void ObjectSynchronizer::deflate_idle_monitors() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+
+  // With a non-zero MonitorUsedDeflationThreshold most safepoints take a
+  // trivial exit here.  The population is only walked at the cleanup
+  // safepoints the VM thread forces once is_cleanup_needed() reports the
+  // threshold crossed, or when a scavenge was induced via InduceScavenge()
+  // because MonitorBound was exceeded.
+  if (MonitorUsedDeflationThreshold > 0 &&
+      !MonitorsUsedAboveThreshold() &&
+      ForceMonitorScavenge == 0) {
+     TEVENT (deflate_idle_monitors - skipped) ;
+     return ;
+  }
+
   int nInuse = 0 ;              // currently associated with objects
   int nInCirculation = 0 ;      // extant
   int nScavenged = 0 ;          // reclaimed
@@ -1558,6 +1601,36 @@ void ObjectSynchronizer::deflate_idle_monitors() {
     }
   }
 
+  // Return surplus monitors stranded on per-thread free lists to the
+  // global free list.  A thread that inflated heavily once - typically
+  // during a bulk biased-locking revocation - would otherwise retain up
+  // to MAXPRIVATE private monitors forever while other threads grow the
+  // population instead of reusing them.  We are at a safepoint and hold
+  // the ListLock, so the private lists are stable.  Each thread keeps
+  // its current omFreeProvision worth of monitors so the hot inflation
+  // path is not re-provisioned away.
+  for (JavaThread* cur = Threads::first(); cur != NULL; cur = cur->next()) {
+    int keep = cur->omFreeProvision;
+    if (keep < 1) keep = 1;
+    if (cur->omFreeCount <= keep) continue;
+    ObjectMonitor* tail = cur->omFreeList;
+    for (int i = 1; i < keep; i++) {
+      tail = tail->FreeNext;
+    }
+    ObjectMonitor* surplus = tail->FreeNext;
+    tail->FreeNext = NULL;
+    int excess = cur->omFreeCount - keep;
+    cur->omFreeCount = keep;
+    ObjectMonitor* stail = surplus;
+    while (stail->FreeNext != NULL) {
+      stail = stail->FreeNext;
+    }
+    stail->FreeNext = gFreeList;
+    gFreeList = surplus;
+    MonitorFreeCount += excess;
+    TEVENT (deflate_idle_monitors - trim thread free list) ;
+  }
+
   MonitorFreeCount += nScavenged;
 
   // Consider: audit gFreeList to ensure that MonitorFreeCount and list agree.
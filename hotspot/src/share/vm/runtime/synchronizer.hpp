@@ -113,6 +113,10 @@ class ObjectSynchronizer : AllStatic {
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
   static void deflate_idle_monitors();
+  // True when the in-use fraction of the monitor population has crossed
+  // MonitorUsedDeflationThreshold; the VM thread then forces a cleanup
+  // safepoint instead of every safepoint paying for the deflation walk.
+  static bool is_cleanup_needed();
   static int walk_monitor_list(ObjectMonitor** listheadp,
                                ObjectMonitor** FreeHeadp,
                                ObjectMonitor** FreeTailp);
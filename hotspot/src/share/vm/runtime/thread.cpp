@@ -27,6 +27,8 @@
 #include "classfile/javaClasses.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "code/nmethod.hpp"
+#include "code/pcDesc.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compileBroker.hpp"
 #include "interpreter/interpreter.hpp"
@@ -56,6 +58,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniPeriodicChecker.hpp"
 #include "runtime/memprofiler.hpp"
+#include "runtime/pcSampler.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/osThread.hpp"
@@ -63,6 +66,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/sweeperThread.hpp"
 #include "runtime/task.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadCritical.hpp"
@@ -239,6 +243,7 @@ Thread::Thread() {
   CHECK_UNHANDLED_OOPS_ONLY(_gc_locked_out_count = 0;)
   _jvmti_env_iteration_count = 0;
   set_allocated_bytes(0);
+  set_allocation_sample_bytes(0);
   _vm_operation_started_count = 0;
   _vm_operation_completed_count = 0;
   _current_pending_monitor = NULL;
@@ -1457,9 +1462,14 @@ void JavaThread::initialize() {
   _thread_stat = NULL;
   _thread_stat = new ThreadStatistics();
   _blocked_on_compilation = false;
+  _compile_request_buffer = NULL;
   _jni_active_critical = 0;
   _do_not_unlock_if_synchronized = false;
   _cached_monitor_info = NULL;
+  _handshake_pinned = false;
+  _last_walk_nm = NULL;
+  _last_walk_pc = NULL;
+  _last_walk_pc_desc = NULL;
   _parker = Parker::Allocate(this) ;
 
 #ifndef PRODUCT
@@ -1603,6 +1613,13 @@ JavaThread::~JavaThread() {
   Parker::Release(_parker);
   _parker = NULL ;
 
+  // Drop any compilation requests still buffered; the destructor
+  // releases the method holder handles.
+  if (_compile_request_buffer != NULL) {
+    delete _compile_request_buffer;
+    _compile_request_buffer = NULL;
+  }
+
   // Free any remaining  previous UnrollBlock
   vframeArray* old_array = vframe_array_last();
 
@@ -1702,7 +1719,7 @@ void JavaThread::thread_main_inner() {
   DTRACE_THREAD_PROBE(stop, this);
 
   this->exit(false);
-  delete this;
+  Threads::smr_delete(this);
 }
 
 
@@ -1992,7 +2009,7 @@ void JavaThread::cleanup_failed_attach_current_thread() {
 #endif // INCLUDE_ALL_GCS
 
   Threads::remove(this);
-  delete this;
+  Threads::smr_delete(this);
 }
 
 
@@ -2670,6 +2687,21 @@ void JavaThread::make_zombies() {
 
 void JavaThread::deoptimized_wrt_marked_nmethods() {
   if (!has_last_Java_frame()) return;
+  // Most threads have no activations of marked nmethods, but the walk
+  // below has to maintain an updated RegisterMap for BiasedLocking's
+  // revoke monitors pass, which makes it expensive across many threads
+  // with deep stacks. Find out with a cheap walk (no register map
+  // updating) whether this thread is affected at all first; we are at a
+  // safepoint, so the answer cannot change under us.
+  bool has_marked_activations = false;
+  for (StackFrameStream cfst(this, false); !cfst.is_done(); cfst.next()) {
+    if (cfst.current()->should_be_deoptimized()) {
+      has_marked_activations = true;
+      break;
+    }
+  }
+  if (!has_marked_activations) return;
+
   // BiasedLocking needs an updated RegisterMap for the revoke monitors pass
   StackFrameStream fst(this, UseBiasedLocking);
   for(; !fst.is_done(); fst.next()) {
@@ -2789,6 +2821,29 @@ void JavaThread::oops_do(OopClosure* f, CLDToOopClosure* cld_f, CodeBlobClosure*
   }
 }
 
+PcDesc* JavaThread::pc_desc_at_with_memo(nmethod* nm, address pc) {
+  // The memo may be stale: the nmethod that produced it can have been
+  // flushed and its memory handed to a different method since the last
+  // walk, and when this thread is walked by another thread the fields can
+  // even be written concurrently.  A hit is therefore trusted only if it
+  // still denotes a properly aligned PcDesc inside nm whose offset exactly
+  // matches pc - which is precisely what pc_desc_at would return, no
+  // matter where the memo came from.
+  PcDesc* pd = _last_walk_pc_desc;
+  if (nm == _last_walk_nm && pc == _last_walk_pc &&
+      pd != NULL &&
+      pd >= nm->scopes_pcs_begin() && pd < nm->scopes_pcs_end() &&
+      ((address)pd - (address)nm->scopes_pcs_begin()) % sizeof(PcDesc) == 0 &&
+      pd->pc_offset() == pc - nm->code_begin()) {
+    return pd;
+  }
+  pd = nm->pc_desc_at(pc);
+  _last_walk_nm      = nm;
+  _last_walk_pc      = pc;
+  _last_walk_pc_desc = pd;
+  return pd;
+}
+
 void JavaThread::nmethods_do(CodeBlobClosure* cf) {
   Thread::nmethods_do(cf);  // (super method is a no-op)
 
@@ -3237,24 +3292,14 @@ CompilerThread::CompilerThread(CompileQueue* queue, CompilerCounters* counters)
   _queue = queue;
   _counters = counters;
   _buffer_blob = NULL;
-  _scanned_nmethod = NULL;
   _compiler = NULL;
+  chunk_cache()->set_max_per_class(ChunkCache::compiler_cached_per_class);
 
 #ifndef PRODUCT
   _ideal_graph_printer = NULL;
 #endif
 }
 
-void CompilerThread::oops_do(OopClosure* f, CLDToOopClosure* cld_f, CodeBlobClosure* cf) {
-  JavaThread::oops_do(f, cld_f, cf);
-  if (_scanned_nmethod != NULL && cf != NULL) {
-    // Safepoints can occur when the sweeper is scanning an nmethod so
-    // process it here to make sure it isn't unloaded in the middle of
-    // a scan.
-    cf->do_code_blob(_scanned_nmethod);
-  }
-}
-
 
 // ======= Threads ========
 
@@ -3272,10 +3317,109 @@ size_t      JavaThread::_stack_size_at_create = 0;
 #ifdef ASSERT
 bool        Threads::_vm_complete = false;
 #endif
+ThreadsList* volatile Threads::_smr_list          = NULL;
+volatile jint         Threads::_smr_readers       = 0;
+ThreadsList*          Threads::_smr_retired_lists = NULL;
+volatile intptr_t     Threads::_smr_lock          = 0;
 
 // All JavaThreads
 #define ALL_JAVA_THREADS(X) for (JavaThread* X = _thread_list; X; X = X->next())
 
+
+ThreadsList::ThreadsList(int length) : _length(length), _next_retired(NULL) {
+  _threads = NEW_C_HEAP_ARRAY(JavaThread*, length == 0 ? 1 : length, mtThread);
+}
+
+ThreadsList::~ThreadsList() {
+  FREE_C_HEAP_ARRAY(JavaThread*, _threads, mtThread);
+}
+
+bool ThreadsList::includes(const JavaThread* p) const {
+  for (int i = 0; i < _length; i++) {
+    if (_threads[i] == p) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// Rebuilds the published snapshot from the linked thread list. The caller
+// must own the Threads_lock so that the list and the snapshot stay in sync.
+// The replaced snapshot may still be referenced by concurrent readers, so
+// it is retired rather than freed.
+void Threads::smr_publish_list() {
+  assert_locked_or_safepoint(Threads_lock);
+  ThreadsList* new_list = new ThreadsList(_number_of_threads);
+  int i = 0;
+  ALL_JAVA_THREADS(p) {
+    new_list->_threads[i++] = p;
+  }
+  assert(i == _number_of_threads, "thread count does not match list");
+  ThreadsList* old_list = _smr_list;
+  OrderAccess::release_store_ptr(&_smr_list, new_list);
+  if (old_list != NULL) {
+    Thread::muxAcquire(&_smr_lock, "smr_publish_list");
+    old_list->_next_retired = _smr_retired_lists;
+    _smr_retired_lists = old_list;
+    // Order the retirement before the reader count check; together with
+    // the fence in smr_acquire_list this ensures that a zero count means
+    // no reader can still reference a retired snapshot.
+    OrderAccess::fence();
+    if (_smr_readers == 0) {
+      smr_free_retired_lists();
+    }
+    Thread::muxRelease(&_smr_lock);
+  }
+}
+
+// Frees all replaced snapshots. The caller must hold _smr_lock and must
+// have checked that no readers exist.
+void Threads::smr_free_retired_lists() {
+  while (_smr_retired_lists != NULL) {
+    ThreadsList* list = _smr_retired_lists;
+    _smr_retired_lists = list->_next_retired;
+    delete list;
+  }
+}
+
+ThreadsList* Threads::smr_acquire_list() {
+  Atomic::inc(&_smr_readers);
+  // Order the increment before the load of the list so that a publisher
+  // observing no readers knows the retired snapshots are unreferenced.
+  OrderAccess::fence();
+  ThreadsList* list = (ThreadsList*)OrderAccess::load_ptr_acquire((volatile void*)&_smr_list);
+  assert(list != NULL, "thread list snapshot not initialized");
+  return list;
+}
+
+void Threads::smr_release_list() {
+  assert(_smr_readers > 0, "unbalanced smr_release_list");
+  Atomic::dec(&_smr_readers);
+}
+
+// Called instead of 'delete thread' once an exiting JavaThread has been
+// removed from the thread list. Readers iterating a snapshot taken before
+// the removal may still reference the thread, so wait until all
+// ThreadsListHandles have been released before freeing it. The destructor
+// still runs on the exiting thread itself, as it always has.
+void Threads::smr_delete(JavaThread* thread) {
+  while (true) {
+    Thread::muxAcquire(&_smr_lock, "smr_delete");
+    OrderAccess::fence();
+    if (_smr_readers == 0) {
+      // New readers can only see the current snapshot, which no longer
+      // contains the exiting thread.
+      smr_free_retired_lists();
+      Thread::muxRelease(&_smr_lock);
+      break;
+    }
+    Thread::muxRelease(&_smr_lock);
+    os::yield();
+  }
+  delete thread;
+}
+
 // All JavaThreads + all non-JavaThreads (i.e., every thread in the system)
 void Threads::threads_do(ThreadClosure* tc) {
   assert_locked_or_safepoint(Threads_lock);
@@ -3385,6 +3529,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   _thread_list = NULL;
   _number_of_threads = 0;
   _number_of_non_daemon_threads = 0;
+  _smr_list = new ThreadsList(0);
 
   // Initialize global data structures and create system classes in heap
   vm_init_globals();
@@ -3640,6 +3785,12 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // initialize compiler(s)
 #if defined(COMPILER1) || defined(COMPILER2) || defined(SHARK)
   CompileBroker::compilation_init();
+
+  // Start the dedicated code cache sweeper thread. Without method
+  // flushing nothing is ever swept, so the thread is not needed.
+  if (MethodFlushing) {
+    CodeCacheSweeperThread::initialize();
+  }
 #endif
 
   if (EnableInvokeDynamic) {
@@ -3665,6 +3816,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   if (Arguments::has_profile())       FlatProfiler::engage(main_thread, true);
   if (MemProfiling)                   MemProfiler::engage();
+  if (PCSampling)                     PCSampler::engage();
   StatSampler::engage();
   if (CheckJNICalls)                  JniPeriodicChecker::engage();
 
@@ -4083,6 +4235,8 @@ void Threads::add(JavaThread* p, bool force_daemon) {
 
   p->set_safepoint_visible(true);
 
+  smr_publish_list();
+
   ThreadService::add_thread(p, daemon);
 
   // Possible GC point.
@@ -4110,6 +4264,12 @@ void Threads::remove(JavaThread* p) {
       _thread_list = p->next();
     }
     _number_of_threads--;
+
+    // Publish a snapshot without p; a reader can still hold an older
+    // snapshot that includes p, which is why the caller must dispose of
+    // p with smr_delete() rather than plain delete.
+    smr_publish_list();
+
     oop threadObj = p->threadObj();
     bool daemon = true;
     if (threadObj == NULL || !java_lang_Thread::is_daemon(threadObj)) {
@@ -76,8 +76,10 @@ class CompileThread;
 class CompileLog;
 class CompileTask;
 class CompileQueue;
+class CompileRequestBuffer;
 class CompilerCounters;
 class vframeArray;
+class PcDesc;
 
 class DeoptResourceMark;
 class jvmtiDeferredLocalVariableSet;
@@ -261,6 +263,8 @@ class Thread: public ThreadShadow {
   ThreadLocalAllocBuffer _tlab;                 // Thread-local eden
   jlong _allocated_bytes;                       // Cumulative number of bytes allocated on
                                                 // the Java heap
+  size_t _allocation_sample_bytes;              // Bytes allocated since the last
+                                                // allocation sample (see AllocationSampler)
 
   TRACE_DATA _trace_data;                       // Thread-local data for tracing
 
@@ -310,6 +314,7 @@ class Thread: public ThreadShadow {
   virtual bool is_VM_thread()       const            { return false; }
   virtual bool is_Java_thread()     const            { return false; }
   virtual bool is_Compiler_thread() const            { return false; }
+  virtual bool is_Code_cache_sweeper_thread() const  { return false; }
   virtual bool is_hidden_from_external_view() const  { return false; }
   virtual bool is_jvmti_agent_thread() const         { return false; }
   // True iff the thread can perform GC operations at a safepoint.
@@ -426,6 +431,8 @@ class Thread: public ThreadShadow {
   HandleArea* handle_area() const                { return _handle_area; }
   void set_handle_area(HandleArea* area)         { _handle_area = area; }
 
+  ChunkCache* chunk_cache()                      { return &_chunk_cache; }
+
   GrowableArray<Metadata*>* metadata_handles() const          { return _metadata_handles; }
   void set_metadata_handles(GrowableArray<Metadata*>* handles){ _metadata_handles = handles; }
 
@@ -439,6 +446,8 @@ class Thread: public ThreadShadow {
 
   jlong allocated_bytes()               { return _allocated_bytes; }
   void set_allocated_bytes(jlong value) { _allocated_bytes = value; }
+  size_t allocation_sample_bytes()               { return _allocation_sample_bytes; }
+  void set_allocation_sample_bytes(size_t value) { _allocation_sample_bytes = value; }
   void incr_allocated_bytes(jlong size) { _allocated_bytes += size; }
   jlong cooked_allocated_bytes() {
     jlong allocated_bytes = OrderAccess::load_acquire(&_allocated_bytes);
@@ -543,6 +552,12 @@ public:
   HandleArea* _handle_area;
   GrowableArray<Metadata*>* _metadata_handles;
 
+  // Per-thread cache of recycled arena chunks, see Chunk::operator new.
+  // Every thread keeps a few chunks so handle area and resource area
+  // churn stays off the global chunk pool; compiler threads raise the
+  // cap in their constructor to cover per-compilation arena traffic.
+  ChunkCache _chunk_cache;
+
   // Support for stack overflow handling, get_thread, etc.
   address          _stack_base;
   size_t           _stack_size;
@@ -1735,6 +1750,12 @@ public:
  protected:
   bool         _blocked_on_compilation;
 
+  // Deferred compilation requests (BatchCompileRequests), lazily created
+ private:
+  CompileRequestBuffer* _compile_request_buffer;
+ public:
+  CompileRequestBuffer* compile_request_buffer() const { return _compile_request_buffer; }
+  void set_compile_request_buffer(CompileRequestBuffer* buffer) { _compile_request_buffer = buffer; }
 
   // JSR166 per-thread parker
 private:
@@ -1749,6 +1770,26 @@ public:
   GrowableArray<MonitorInfo*>* cached_monitor_info() { return _cached_monitor_info; }
   void set_cached_monitor_info(GrowableArray<MonitorInfo*>* info) { _cached_monitor_info = info; }
 
+  // Handshake support: true while a requesting thread executes a
+  // handshake closure with this thread pinned - see Handshake::try_execute
+private:
+  volatile bool _handshake_pinned;
+public:
+  bool is_handshake_pinned() const          { return _handshake_pinned; }
+  void set_handshake_pinned(bool pinned)    { _handshake_pinned = pinned; }
+
+  // One-entry memo of the last PcDesc this thread resolved during a stack
+  // walk.  The per-nmethod PcDescCache is shared by all threads, so its
+  // cache lines bounce between processors when several threads repeatedly
+  // throw from the same hot site; this private slot absorbs such repeats.
+private:
+  nmethod* _last_walk_nm;
+  address  _last_walk_pc;
+  PcDesc*  _last_walk_pc_desc;
+public:
+  // Exact-match equivalent of nm->pc_desc_at(pc), memoizing the result.
+  PcDesc* pc_desc_at_with_memo(nmethod* nm, address pc);
+
   // clearing/querying jni attach status
   bool is_attaching_via_jni() const { return _jni_attach_state == _attaching_via_jni; }
   bool has_attached_via_jni() const { return is_attaching_via_jni() || _jni_attach_state == _attached_via_jni; }
@@ -1815,7 +1856,6 @@ class CompilerThread : public JavaThread {
   CompileQueue*     _queue;
   BufferBlob*       _buffer_blob;
 
-  nmethod*          _scanned_nmethod;  // nmethod being scanned by the sweeper
   AbstractCompiler* _compiler;
 
  public:
@@ -1849,11 +1889,6 @@ class CompilerThread : public JavaThread {
     _log = log;
   }
 
-  // GC support
-  // Apply "f->do_oop" to all root oops in "this".
-  // Apply "cf->do_code_blob" (if !NULL) to all code blobs active in frames
-  void oops_do(OopClosure* f, CLDToOopClosure* cld_f, CodeBlobClosure* cf);
-
 #ifndef PRODUCT
 private:
   IdealGraphPrinter *_ideal_graph_printer;
@@ -1865,12 +1900,6 @@ public:
   // Get/set the thread's current task
   CompileTask*  task()                           { return _task; }
   void          set_task(CompileTask* task)      { _task = task; }
-
-  // Track the nmethod currently being scanned by the sweeper
-  void          set_scanned_nmethod(nmethod* nm) {
-    assert(_scanned_nmethod == NULL || nm == NULL, "should reset to NULL before writing a new value");
-    _scanned_nmethod = nm;
-  }
 };
 
 inline CompilerThread* CompilerThread::current() {
@@ -1880,6 +1909,29 @@ inline CompilerThread* CompilerThread::current() {
 
 // The active thread queue. It also keeps track of the current used
 // thread priorities.
+// An immutable snapshot of the JavaThread list, published by Threads::add and
+// Threads::remove and readable without holding the Threads_lock. Replaced
+// snapshots stay allocated until every reader has released its handle - see
+// ThreadsListHandle below.
+class ThreadsList : public CHeapObj<mtThread> {
+  friend class Threads;
+ private:
+  int          _length;
+  ThreadsList* _next_retired;     // Link in the list of replaced snapshots
+  JavaThread** _threads;
+
+  ThreadsList(int length);
+  ~ThreadsList();
+
+ public:
+  int length() const                  { return _length; }
+  JavaThread* thread_at(int i) const  {
+    assert(i >= 0 && i < _length, "index out of bounds");
+    return _threads[i];
+  }
+  bool includes(const JavaThread* p) const;
+};
+
 class Threads: AllStatic {
   friend class VMStructs;
  private:
@@ -1891,6 +1943,19 @@ class Threads: AllStatic {
   static bool        _vm_complete;
 #endif
 
+  // Safe-memory-reclamation support for iterating the thread list without
+  // the Threads_lock. _smr_list is the currently published snapshot;
+  // replaced snapshots are kept on _smr_retired_lists until _smr_readers
+  // drops to zero. _smr_lock is a low-level spin lock (Thread::muxAcquire)
+  // guarding the retired list.
+  static ThreadsList* volatile _smr_list;
+  static volatile jint         _smr_readers;
+  static ThreadsList*          _smr_retired_lists;
+  static volatile intptr_t     _smr_lock;
+
+  static void smr_publish_list();       // Rebuild snapshot; Threads_lock must be held
+  static void smr_free_retired_lists(); // _smr_lock must be held and no readers exist
+
  public:
   // Thread management
   // force_daemon is a concession to JNI, where we may need to add a
@@ -1901,6 +1966,15 @@ class Threads: AllStatic {
   static JavaThread* first()                     { return _thread_list; }
   static void threads_do(ThreadClosure* tc);
 
+  // Lock-free iteration support; use through ThreadsListHandle rather
+  // than calling these directly.
+  static ThreadsList* smr_acquire_list();
+  static void smr_release_list();
+  // Replaces 'delete thread' for a JavaThread that has been removed from
+  // the thread list: waits until no ThreadsListHandle can reference the
+  // thread anymore, then deletes it.
+  static void smr_delete(JavaThread* thread);
+
   // Initializes the vm and creates the vm thread
   static jint create_vm(JavaVMInitArgs* args, bool* canTryAgain);
   static void convert_vm_init_libraries_to_agents();
@@ -1978,6 +2052,26 @@ class Threads: AllStatic {
 };
 
 
+// Gives its owner access to a consistent snapshot of the JavaThread list
+// without holding the Threads_lock. JavaThreads that exit while the handle
+// is held stay allocated (Threads::smr_delete waits for all handles to be
+// released first), so their fields may be examined safely; oop fields of
+// threads that have started exiting must not be trusted, though. Handles
+// should be short-lived and must not be held across blocking operations:
+// every exiting thread waits for all of them to be released.
+class ThreadsListHandle : public StackObj {
+ private:
+  ThreadsList* _list;
+ public:
+  ThreadsListHandle()  { _list = Threads::smr_acquire_list(); }
+  ~ThreadsListHandle() { Threads::smr_release_list(); }
+
+  ThreadsList* list() const                 { return _list; }
+  int length() const                        { return _list->length(); }
+  JavaThread* thread_at(int i) const        { return _list->thread_at(i); }
+  bool includes(const JavaThread* p) const  { return _list->includes(p); }
+};
+
 // Thread iterator
 class ThreadClosure: public StackObj {
  public:
@@ -444,7 +444,7 @@ inline bool vframeStreamCommon::fill_from_frame() {
       // Do not rely on scopeDesc since the pc might be unprecise due to the _last_native_pc trick.
       fill_from_compiled_native_frame();
     } else {
-      PcDesc* pc_desc = nm()->pc_desc_at(_frame.pc());
+      PcDesc* pc_desc = _thread->pc_desc_at_with_memo(nm(), _frame.pc());
       int decode_offset;
       if (pc_desc == NULL) {
         // Should not happen, but let fill_from_compiled_frame handle it.
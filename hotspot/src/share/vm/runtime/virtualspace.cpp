@@ -364,6 +364,7 @@ VirtualSpace::VirtualSpace() {
   _upper_alignment        = 0;
   _special                = false;
   _executable             = false;
+  _pretouch_by_caller     = false;
 }
 
 
@@ -443,6 +444,7 @@ void VirtualSpace::release() {
   _upper_alignment        = 0;
   _special                = false;
   _executable             = false;
+  _pretouch_by_caller     = false;
 }
 
 
@@ -625,20 +627,8 @@ bool VirtualSpace::expand_by(size_t bytes, bool pre_touch) {
     }
   }
 
-  if (pre_touch || AlwaysPreTouch) {
-    int vm_ps = os::vm_page_size();
-    for (char* curr = previous_high;
-         curr < unaligned_new_high;
-         curr += vm_ps) {
-      // Note the use of a write here; originally we tried just a read, but
-      // since the value read was unused, the optimizer removed the read.
-      // If we ever have a concurrent touchahead thread, we'll want to use
-      // a read, to avoid the potential of overwriting data (if a mutator
-      // thread beats the touchahead thread to a page).  There are various
-      // ways of making sure this read is not optimized away: for example,
-      // generating the code for a read procedure at runtime.
-      *curr = 0;
-    }
+  if ((pre_touch || AlwaysPreTouch) && !_pretouch_by_caller) {
+    os::pretouch_memory(previous_high, unaligned_new_high);
   }
 
   _high += bytes;
@@ -133,6 +133,11 @@ class VirtualSpace VALUE_OBJ_CLASS_SPEC {
   // Need to know if commit should be executable.
   bool   _executable;
 
+  // If true, expand_by() does not pre-touch newly committed memory
+  // even with AlwaysPreTouch; the owner of the space has taken on that
+  // responsibility, e.g. to spread the touching over a worker gang.
+  bool   _pretouch_by_caller;
+
   // MPSS Support
   // Each virtualspace region has a lower, middle, and upper region.
   // Each region has an end boundary and a high pointer which is the
@@ -175,6 +180,8 @@ class VirtualSpace VALUE_OBJ_CLASS_SPEC {
 
   bool special() const { return _special; }
 
+  void set_pretouch_by_caller(bool value) { _pretouch_by_caller = value; }
+
  public:
   // Initialization
   VirtualSpace();
@@ -133,6 +133,14 @@ VM_Operation* VMOperationQueue::queue_drain(int prio) {
   return r;
 }
 
+// Returns how long the oldest operation on the queue has been waiting,
+// in milliseconds, or 0 for an empty queue. Must hold the queue lock.
+long VMOperationQueue::queue_head_age(int prio) {
+  if (queue_empty(prio)) return 0;
+  long age = os::javaTimeMillis() - _queue[prio]->next()->timestamp();
+  return age < 0 ? 0 : age;
+}
+
 void VMOperationQueue::queue_oops_do(int queue, OopClosure* f) {
   VM_Operation* cur = _queue[queue];
   cur = cur->next();
@@ -181,9 +189,12 @@ VM_Operation* VMOperationQueue::remove_next() {
          "current algorithm does not work");
 
   // simple counter based scheduling to prevent starvation of lower priority
-  // queue. -- see 4390175
+  // queue. -- see 4390175. In addition, an operation that has aged past a
+  // full GuaranteedSafepointInterval is promoted regardless of the counter,
+  // so a steady stream of safepoint work cannot keep deferring it.
   int high_prio, low_prio;
-  if (_queue_counter++ < 10) {
+  if (_queue_counter++ < 10 &&
+      queue_head_age(MediumPriority) < (long) GuaranteedSafepointInterval) {
       high_prio = SafepointPriority;
       low_prio  = MediumPriority;
   } else {
@@ -408,6 +419,49 @@ void VMThread::evaluate_operation(VM_Operation* op) {
 }
 
 
+// Evaluates a list of drained safepoint operations, iteratively draining
+// the queue until there are none left, so that everything queued while a
+// safepoint is in progress runs inside it. Must be called inside a
+// safepoint; clears the drain list and _cur_vm_operation when done.
+void VMThread::evaluate_safepoint_ops(VM_Operation* safepoint_ops) {
+  do {
+    _cur_vm_operation = safepoint_ops;
+    if (_cur_vm_operation != NULL) {
+      do {
+        // evaluate_operation deletes the op object so we have
+        // to grab the next op now
+        VM_Operation* next = _cur_vm_operation->next();
+        _vm_queue->set_drain_list(next);
+        evaluate_operation(_cur_vm_operation);
+        _cur_vm_operation = next;
+        if (PrintSafepointStatistics) {
+          SafepointSynchronize::inc_vmop_coalesced_count();
+        }
+      } while (_cur_vm_operation != NULL);
+    }
+    // There is a chance that a thread enqueued a safepoint op
+    // since we released the op-queue lock and initiated the safepoint.
+    // So we drain the queue again if there is anything there, as an
+    // optimization to try and reduce the number of safepoints.
+    // As the safepoint synchronizes us with JavaThreads we will see
+    // any enqueue made by a JavaThread, but the peek will not
+    // necessarily detect a concurrent enqueue by a GC thread, but
+    // that simply means the op will wait for the next major cycle of the
+    // VMThread - just as it would if the GC thread lost the race for
+    // the lock.
+    if (_vm_queue->peek_at_safepoint_priority()) {
+      // must hold lock while draining queue
+      MutexLockerEx mu_queue(VMOperationQueue_lock,
+                             Mutex::_no_safepoint_check_flag);
+      safepoint_ops = _vm_queue->drain_at_safepoint_priority();
+    } else {
+      safepoint_ops = NULL;
+    }
+  } while (safepoint_ops != NULL);
+
+  _vm_queue->set_drain_list(NULL);
+}
+
 void VMThread::loop() {
   assert(_cur_vm_operation == NULL, "no current one should be executing");
 
@@ -457,6 +511,19 @@ void VMThread::loop() {
           #ifdef ASSERT
             if (GCALotAtAllSafepoints) InterfaceSupport::check_gc_alot();
           #endif
+          // Safepoint operations queued up while this safepoint was being
+          // initiated can run inside it instead of forcing a stop of
+          // their own right after we resume.
+          if (_vm_queue->peek_at_safepoint_priority()) {
+            VM_Operation* sp_ops;
+            {
+              MutexLockerEx mu_queue(VMOperationQueue_lock,
+                                     Mutex::_no_safepoint_check_flag);
+              sp_ops = _vm_queue->drain_at_safepoint_priority();
+            }
+            _vm_queue->set_drain_list(sp_ops);
+            evaluate_safepoint_ops(sp_ops);
+          }
           SafepointSynchronize::end();
         }
         _cur_vm_operation = _vm_queue->remove_next();
@@ -495,44 +562,8 @@ void VMThread::loop() {
 
         SafepointSynchronize::begin();
         evaluate_operation(_cur_vm_operation);
-        // now process all queued safepoint ops, iteratively draining
-        // the queue until there are none left
-        do {
-          _cur_vm_operation = safepoint_ops;
-          if (_cur_vm_operation != NULL) {
-            do {
-              // evaluate_operation deletes the op object so we have
-              // to grab the next op now
-              VM_Operation* next = _cur_vm_operation->next();
-              _vm_queue->set_drain_list(next);
-              evaluate_operation(_cur_vm_operation);
-              _cur_vm_operation = next;
-              if (PrintSafepointStatistics) {
-                SafepointSynchronize::inc_vmop_coalesced_count();
-              }
-            } while (_cur_vm_operation != NULL);
-          }
-          // There is a chance that a thread enqueued a safepoint op
-          // since we released the op-queue lock and initiated the safepoint.
-          // So we drain the queue again if there is anything there, as an
-          // optimization to try and reduce the number of safepoints.
-          // As the safepoint synchronizes us with JavaThreads we will see
-          // any enqueue made by a JavaThread, but the peek will not
-          // necessarily detect a concurrent enqueue by a GC thread, but
-          // that simply means the op will wait for the next major cycle of the
-          // VMThread - just as it would if the GC thread lost the race for
-          // the lock.
-          if (_vm_queue->peek_at_safepoint_priority()) {
-            // must hold lock while draining queue
-            MutexLockerEx mu_queue(VMOperationQueue_lock,
-                                     Mutex::_no_safepoint_check_flag);
-            safepoint_ops = _vm_queue->drain_at_safepoint_priority();
-          } else {
-            safepoint_ops = NULL;
-          }
-        } while(safepoint_ops != NULL);
-
-        _vm_queue->set_drain_list(NULL);
+        // now process all queued safepoint ops within the same safepoint
+        evaluate_safepoint_ops(safepoint_ops);
 
         // Complete safepoint synchronization
         SafepointSynchronize::end();
@@ -63,6 +63,7 @@ class VMOperationQueue : public CHeapObj<mtInternal> {
   void queue_oops_do(int queue, OopClosure* f);
   void drain_list_oops_do(OopClosure* f);
   VM_Operation* queue_drain(int prio);
+  long queue_head_age(int prio);
   // lock-free query: may return the wrong answer but must not break
   bool queue_peek(int prio) { return _queue_length[prio] > 0; }
 
@@ -100,6 +101,7 @@ class VMThread: public NamedThread {
   static PerfCounter* _perf_accumulated_vm_operation_time;
 
   void evaluate_operation(VM_Operation* op);
+  void evaluate_safepoint_ops(VM_Operation* safepoint_ops);
  public:
   // Constructor
   VMThread();
@@ -37,6 +37,7 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/vm_operations.hpp"
 #include "services/threadService.hpp"
+#include "trace/traceBinaryBackend.hpp"
 #include "trace/tracing.hpp"
 
 #define VM_OP_NAME_INITIALIZE(name) #name,
@@ -96,6 +97,12 @@ void VM_ThreadStop::doit() {
   }
 }
 
+void VM_FlushTraceBuffers::doit() {
+#if INCLUDE_TRACE
+  TraceBinaryBackend::flush_all_java_threads();
+#endif
+}
+
 void VM_Deoptimize::doit() {
   // We do not want any GCs to happen while we are in the middle of this VM operation
   ResourceMark rm;
@@ -46,6 +46,7 @@
   template(FindDeadlocks)                         \
   template(ForceSafepoint)                        \
   template(ForceAsyncSafepoint)                   \
+  template(FlushTraceBuffers)                     \
   template(Deoptimize)                            \
   template(DeoptimizeFrame)                       \
   template(DeoptimizeAll)                         \
@@ -225,6 +226,14 @@ class VM_ForceSafepoint: public VM_Operation {
   VMOp_Type type() const { return VMOp_ForceSafepoint; }
 };
 
+// flushes the per-thread binary trace buffers to the trace file
+class VM_FlushTraceBuffers: public VM_Operation {
+ public:
+  VM_FlushTraceBuffers() {}
+  void doit();
+  VMOp_Type type() const { return VMOp_FlushTraceBuffers; }
+};
+
 // dummy vm op, evaluated just to force a safepoint
 class VM_ForceAsyncSafepoint: public VM_Operation {
  public:
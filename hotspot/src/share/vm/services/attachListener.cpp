@@ -32,6 +32,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "services/attachListener.hpp"
 #include "services/diagnosticCommand.hpp"
@@ -393,6 +394,173 @@ static AttachOperationFunctionInfo funcs[] = {
 
 
 
+// Examines the operation name (command), dispatches to the function that
+// implements it, and completes the operation by sending the result code
+// and any output back to the client.
+static void dispatch_operation(AttachOperation* op) {
+  ResourceMark rm;
+  bufferedStream st;
+  jint res = JNI_OK;
+
+  // find the function to dispatch too
+  AttachOperationFunctionInfo* info = NULL;
+  for (int i=0; funcs[i].name != NULL; i++) {
+    const char* name = funcs[i].name;
+    assert(strlen(name) <= AttachOperation::name_length_max, "operation <= name_length_max");
+    if (strcmp(op->name(), name) == 0) {
+      info = &(funcs[i]);
+      break;
+    }
+  }
+
+  // check for platform dependent attach operation
+  if (info == NULL) {
+    info = AttachListener::pd_find_operation(op->name());
+  }
+
+  if (info != NULL) {
+    // dispatch to the function that implements this operation
+    res = (info->func)(op, &st);
+  } else {
+    st.print("Operation %s not recognized!", op->name());
+    res = JNI_ERR;
+  }
+
+  // operation complete - send result and output to client
+  op->complete(res, &st);
+}
+
+// Asynchronous execution support (-XX:+AsyncAttachOperations).
+// Long-running operations such as heap dumps are handed to a dedicated
+// handler thread so that the listener loop stays responsive to further
+// attach requests; the result still goes back on the requesting client's
+// connection, just from the handler thread once the operation finishes.
+
+class AsyncAttachNode : public CHeapObj<mtInternal> {
+ public:
+  AttachOperation* _op;
+  AsyncAttachNode* _next;
+  AsyncAttachNode(AttachOperation* op) : _op(op), _next(NULL) {}
+};
+
+static Monitor*         _async_lock = NULL;
+static AsyncAttachNode* _async_queue_head = NULL;
+static AsyncAttachNode* _async_queue_tail = NULL;
+static bool             _async_handler_started = false;
+
+// Operations that can take long enough to starve the listener queue
+static bool is_async_operation(const char* name) {
+  return strcmp(name, "dumpheap") == 0 ||
+         strcmp(name, "inspectheap") == 0 ||
+         strcmp(name, "jcmd") == 0;
+}
+
+static void attach_handler_thread_entry(JavaThread* thread, TRAPS) {
+  os::set_priority(thread, NearMaxPriority);
+
+  thread->record_stack_base_and_size();
+
+  for (;;) {
+    AttachOperation* op = NULL;
+    {
+      MonitorLockerEx ml(_async_lock);
+      while (_async_queue_head == NULL) {
+        ml.wait();
+      }
+      AsyncAttachNode* node = _async_queue_head;
+      _async_queue_head = node->_next;
+      if (_async_queue_head == NULL) {
+        _async_queue_tail = NULL;
+      }
+      op = node->_op;
+      delete node;
+    }
+    dispatch_operation(op);
+  }
+}
+
+// Starts the handler thread on first use. Creation failure is soft - the
+// caller simply runs the operation inline as before.
+static bool start_attach_handler_thread(TRAPS) {
+  Klass* k = SystemDictionary::resolve_or_fail(vmSymbols::java_lang_Thread(), true, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+  instanceKlassHandle klass (THREAD, k);
+  instanceHandle thread_oop = klass->allocate_instance_handle(THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+
+  const char thread_name[] = "Attach Handler";
+  Handle string = java_lang_String::create_from_str(thread_name, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+
+  // Initialize thread_oop to put it into the system threadGroup
+  Handle thread_group (THREAD, Universe::system_thread_group());
+  JavaValue result(T_VOID);
+  JavaCalls::call_special(&result, thread_oop,
+                       klass,
+                       vmSymbols::object_initializer_name(),
+                       vmSymbols::threadgroup_string_void_signature(),
+                       thread_group,
+                       string,
+                       THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+
+  _async_lock = new Monitor(Mutex::nonleaf, "AttachAsyncOperations", true);
+
+  { MutexLocker mu(Threads_lock);
+    JavaThread* handler_thread = new JavaThread(&attach_handler_thread_entry);
+
+    // Check that thread and osthread were created
+    if (handler_thread == NULL || handler_thread->osthread() == NULL) {
+      // No one should hold a reference to the 'handler_thread'
+      delete handler_thread;
+      return false;
+    }
+
+    java_lang_Thread::set_thread(thread_oop(), handler_thread);
+    java_lang_Thread::set_daemon(thread_oop());
+
+    handler_thread->set_threadObj(thread_oop());
+    Threads::add(handler_thread);
+    Thread::start(handler_thread);
+  }
+  return true;
+}
+
+// Hands an operation to the handler thread. Returns false if the handler
+// thread could not be started, in which case the operation has not been
+// queued.
+static bool enqueue_async_operation(AttachOperation* op, TRAPS) {
+  if (!_async_handler_started) {
+    if (!start_attach_handler_thread(THREAD)) {
+      return false;
+    }
+    _async_handler_started = true;
+  }
+
+  AsyncAttachNode* node = new AsyncAttachNode(op);
+  MonitorLockerEx ml(_async_lock);
+  if (_async_queue_tail == NULL) {
+    _async_queue_head = node;
+  } else {
+    _async_queue_tail->_next = node;
+  }
+  _async_queue_tail = node;
+  ml.notify();
+  return true;
+}
+
 // The Attach Listener threads services a queue. It dequeues an operation
 // from the queue, examines the operation name (command), and dispatches
 // to the corresponding function to perform the operation.
@@ -413,41 +581,25 @@ static void attach_listener_thread_entry(JavaThread* thread, TRAPS) {
       return;   // dequeue failed or shutdown
     }
 
-    ResourceMark rm;
-    bufferedStream st;
-    jint res = JNI_OK;
-
     // handle special detachall operation
     if (strcmp(op->name(), AttachOperation::detachall_operation_name()) == 0) {
       AttachListener::detachall();
-    } else {
-      // find the function to dispatch too
-      AttachOperationFunctionInfo* info = NULL;
-      for (int i=0; funcs[i].name != NULL; i++) {
-        const char* name = funcs[i].name;
-        assert(strlen(name) <= AttachOperation::name_length_max, "operation <= name_length_max");
-        if (strcmp(op->name(), name) == 0) {
-          info = &(funcs[i]);
-          break;
-        }
-      }
-
-      // check for platform dependent attach operation
-      if (info == NULL) {
-        info = AttachListener::pd_find_operation(op->name());
-      }
+      ResourceMark rm;
+      bufferedStream st;
+      op->complete(JNI_OK, &st);
+      continue;
+    }
 
-      if (info != NULL) {
-        // dispatch to the function that implements this operation
-        res = (info->func)(op, &st);
-      } else {
-        st.print("Operation %s not recognized!", op->name());
-        res = JNI_ERR;
+    // hand long-running operations to the handler thread so a slow heap
+    // dump doesn't block subsequent attaches
+    if (AsyncAttachOperations && is_async_operation(op->name())) {
+      if (enqueue_async_operation(op, THREAD)) {
+        continue;
       }
+      // handler thread unavailable - run the operation inline
     }
 
-    // operation complete - send result and output to client
-    op->complete(res, &st);
+    dispatch_operation(op);
   }
 }
 
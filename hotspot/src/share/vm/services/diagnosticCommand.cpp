@@ -23,13 +23,25 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "code/codeCache.hpp"
+#include "code/nmethod.hpp"
 #include "gc_implementation/shared/vmGCOperations.hpp"
+#include "memory/threadLocalAllocBuffer.hpp"
+#include "oops/method.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/objectMonitor.hpp"
+#include "runtime/allocationSampler.hpp"
+#include "runtime/pcSampler.hpp"
+#include "runtime/safepoint.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
 #include "services/heapDumper.hpp"
 #include "services/management.hpp"
+#include "trace/traceBinaryBackend.hpp"
+#include "utilities/events.hpp"
 #include "utilities/macros.hpp"
 
 void DCmdRegistrant::register_dcmds(){
@@ -47,6 +59,16 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TLABStatsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerMethodStatsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SymboltableDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<StringtableDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SafepointHistogramDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ContendedLocksDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PCSamplesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AllocationSamplesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EventLogsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TraceDumpDCmd>(full_export, true, false));
 #if INCLUDE_SERVICES // Heap dumping/inspection supported
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export, true, false));
@@ -270,6 +292,108 @@ void RunFinalizationDCmd::execute(DCmdSource source, TRAPS) {
                          vmSymbols::void_method_signature(), CHECK);
 }
 
+void TLABStatsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseTLAB) {
+    output()->print_cr("TLABs are not in use.");
+    return;
+  }
+  ThreadLocalAllocBuffer::print_waste_report(output());
+}
+
+// Helpers for CompilerMethodStatsDCmd: snapshot of one nmethod, taken
+// under the CodeCache_lock and printed after the lock is released.
+struct MethodCodeStat {
+  const char* name;           // resource allocated
+  int  total_size;
+  int  insts_size;
+  int  stub_size;
+  int  oops_size;
+  int  metadata_size;
+  int  comp_level;
+  jint compile_time_ms;
+  int  invocation_count;
+};
+
+static int method_code_stat_cmp(MethodCodeStat* a, MethodCodeStat* b) {
+  // Sort descending by total size
+  return b->total_size - a->total_size;
+}
+
+void CompilerMethodStatsDCmd::execute(DCmdSource source, TRAPS) {
+  ResourceMark rm;
+  GrowableArray<MethodCodeStat>* stats = new GrowableArray<MethodCodeStat>(1024);
+  {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    for (nmethod* nm = CodeCache::alive_nmethod(CodeCache::first()); nm != NULL;
+         nm = CodeCache::alive_nmethod(CodeCache::next(nm))) {
+      Method* m = nm->method();
+      if (m == NULL) continue;
+      MethodCodeStat s;
+      s.name             = m->name_and_sig_as_C_string();
+      s.total_size       = nm->size();
+      s.insts_size       = nm->insts_size();
+      s.stub_size        = nm->stub_size();
+      s.oops_size        = nm->oops_size();
+      s.metadata_size    = nm->metadata_size();
+      s.comp_level       = nm->comp_level();
+      s.compile_time_ms  = nm->compile_time_ms();
+      s.invocation_count = m->invocation_count();
+      stats->append(s);
+    }
+  }
+  stats->sort(method_code_stat_cmp);
+  output()->print_cr("total insts stubs oops metadata level compile_ms invocations name");
+  for (int i = 0; i < stats->length(); i++) {
+    MethodCodeStat* s = stats->adr_at(i);
+    output()->print_cr("%d %d %d %d %d %d %d %d %s",
+                       s->total_size, s->insts_size, s->stub_size,
+                       s->oops_size, s->metadata_size, s->comp_level,
+                       s->compile_time_ms, s->invocation_count, s->name);
+  }
+}
+
+void SymboltableDCmd::execute(DCmdSource source, TRAPS) {
+  SymbolTable::dump(output());
+}
+
+void StringtableDCmd::execute(DCmdSource source, TRAPS) {
+  StringTable::dump(output());
+}
+
+void SafepointHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  SafepointSynchronize::print_time_to_block_histogram(output());
+}
+
+void ContendedLocksDCmd::execute(DCmdSource source, TRAPS) {
+  ContendedLockTable::print_on(output());
+}
+
+void PCSamplesDCmd::execute(DCmdSource source, TRAPS) {
+  PCSampler::print_on(output());
+}
+
+void AllocationSamplesDCmd::execute(DCmdSource source, TRAPS) {
+  AllocationSampler::print_on(output());
+}
+
+void EventLogsDCmd::execute(DCmdSource source, TRAPS) {
+  Events::print_all(output());
+}
+
+void TraceDumpDCmd::execute(DCmdSource source, TRAPS) {
+#if INCLUDE_TRACE
+  if (!TraceBinaryBackend::is_active()) {
+    TraceBinaryBackend::print_info(output());
+    return;
+  }
+  VM_FlushTraceBuffers op;
+  VMThread::execute(&op);
+  TraceBinaryBackend::print_info(output());
+#else
+  output()->print_cr("Tracing is not supported in this VM.");
+#endif
+}
+
 #if INCLUDE_SERVICES // Heap dumping/inspection supported
 HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
                            DCmdWithParser(output, heap),
@@ -176,6 +176,198 @@ public:
     virtual void execute(DCmdSource source, TRAPS);
 };
 
+class TLABStatsDCmd : public DCmd {
+public:
+  TLABStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+    static const char* name() { return "GC.tlab_stats"; }
+    static const char* description() {
+      return "Print per-thread TLAB sizing and waste statistics "
+             "accumulated since the last GC.";
+    }
+    static const char* impact() {
+      return "Low";
+    }
+    static int num_arguments() { return 0; }
+    virtual void execute(DCmdSource source, TRAPS);
+};
+
+class CompilerMethodStatsDCmd : public DCmd {
+public:
+  CompilerMethodStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "Compiler.method_stats"; }
+  static const char* description() {
+    return "Print per-method code cache occupancy broken down by nmethod "
+           "sections, compile time and invocation counts, sorted by total "
+           "size.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on code cache size and content.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class SymboltableDCmd : public DCmd {
+public:
+  SymboltableDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.symboltable"; }
+  static const char* description() {
+    return "Print symbol table load factor and bucket length statistics.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the symbol table size.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class StringtableDCmd : public DCmd {
+public:
+  StringtableDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.stringtable"; }
+  static const char* description() {
+    return "Print string table load factor and bucket length statistics.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the string table size.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class SafepointHistogramDCmd : public DCmd {
+public:
+  SafepointHistogramDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.safepointHistogram"; }
+  static const char* description() {
+    return "Print the per-thread safepoint time-to-block histogram and "
+           "the slowest straggler's last Java frame.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class ContendedLocksDCmd : public DCmd {
+public:
+  ContendedLocksDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.contendedLocks"; }
+  static const char* description() {
+    return "Print per-class totals of contended monitor enters and time "
+           "spent parked (requires -XX:+ProfileContendedLocks).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class PCSamplesDCmd : public DCmd {
+public:
+  PCSamplesDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.pcSamples"; }
+  static const char* description() {
+    return "Print aggregated PC samples by code location "
+           "(requires -XX:+PCSampling).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class AllocationSamplesDCmd : public DCmd {
+public:
+  AllocationSamplesDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.allocationSamples"; }
+  static const char* description() {
+    return "Print aggregated allocation samples by stack "
+           "(requires -XX:AllocationSampleInterval=<bytes>).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class EventLogsDCmd : public DCmd {
+public:
+  EventLogsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.events"; }
+  static const char* description() {
+    return "Print the contents of the VM event ring buffers.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class TraceDumpDCmd : public DCmd {
+public:
+  TraceDumpDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "Trace.dump"; }
+  static const char* description() {
+    return "Flush all buffered trace events to the binary trace file.";
+  }
+  static const char* impact() {
+    return "Medium: Requires a safepoint to flush the Java thread buffers.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #if INCLUDE_SERVICES   // Heap dumping supported
 // See also: dump_heap in attachListener.cpp
 class HeapDumpDCmd : public DCmdWithParser {
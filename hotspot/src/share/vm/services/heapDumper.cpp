@@ -41,6 +41,10 @@
 #include "services/threadService.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/macros.hpp"
+#ifndef _WINDOWS
+#include <unistd.h>
+#include <errno.h>
+#endif
 #if INCLUDE_ALL_GCS
 #include "gc_implementation/parallelScavenge/parallelScavengeHeap.hpp"
 #endif // INCLUDE_ALL_GCS
@@ -1698,6 +1702,27 @@ void VM_HeapDumper::doit() {
     }
   }
 
+#ifndef _WINDOWS
+  // With +HeapDumpViaFork the frozen heap is snapshotted into a child
+  // process which writes the dump on its own, so the safepoint only lasts
+  // for the fork itself.  The child is single-threaded and touches little
+  // beyond the heap image and the dump file descriptor, but a thread
+  // stopped inside the C library at fork time can in principle leave a
+  // lock held in the snapshot, which is why this is opt-in.
+  bool forked_child = false;
+  if (HeapDumpViaFork) {
+    pid_t pid = ::fork();
+    if (pid > 0) {
+      // Parent: the child owns the dump from here on; resume mutators.
+      return;
+    } else if (pid == 0) {
+      forked_child = true;
+    } else {
+      warning("fork for heap dump failed (errno = %d); dumping in-process", errno);
+    }
+  }
+#endif
+
   // At this point we should be the only dumper active, so
   // the following should be safe.
   set_global_dumper();
@@ -1773,6 +1798,15 @@ void VM_HeapDumper::doit() {
   // Now we clear the global variables, so that a future dumper might run.
   clear_global_dumper();
   clear_global_writer();
+
+#ifndef _WINDOWS
+  if (forked_child) {
+    // Push out the tail of the dump and leave without running any of the
+    // parent's shutdown machinery.
+    writer()->flush();
+    ::_exit(0);
+  }
+#endif
 }
 
 void VM_HeapDumper::dump_stack_traces() {
@@ -1867,10 +1901,17 @@ int HeapDumper::dump(const char* path) {
   if (print_to_tty()) {
     timer()->stop();
     if (error() == NULL) {
-      char msg[256];
-      sprintf(msg, "Heap dump file created [%s bytes in %3.3f secs]",
-        JLONG_FORMAT, timer()->seconds());
-      tty->print_cr(msg, writer.bytes_written());
+#ifndef _WINDOWS
+      if (HeapDumpViaFork) {
+        tty->print_cr("Heap dump continuing in forked child process");
+      } else
+#endif
+      {
+        char msg[256];
+        sprintf(msg, "Heap dump file created [%s bytes in %3.3f secs]",
+          JLONG_FORMAT, timer()->seconds());
+        tty->print_cr(msg, writer.bytes_written());
+      }
     } else {
       tty->print_cr("Dump file is incomplete: %s", writer.error());
     }
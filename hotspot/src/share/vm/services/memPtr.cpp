@@ -26,12 +26,12 @@
 #include "services/memPtr.hpp"
 #include "services/memTracker.hpp"
 
-volatile jint SequenceGenerator::_seq_number = 1;
+SequenceGenerator::SeqNumber SequenceGenerator::_seq_number = { {0}, 1, {0} };
 volatile unsigned long SequenceGenerator::_generation = 1;
 NOT_PRODUCT(jint SequenceGenerator::_max_seq_number = 1;)
 
 jint SequenceGenerator::next() {
-  jint seq = Atomic::add(1, &_seq_number);
+  jint seq = Atomic::add(1, &_seq_number._value);
   if (seq < 0) {
     MemTracker::shutdown(MemTracker::NMT_sequence_overflow);
   } else {
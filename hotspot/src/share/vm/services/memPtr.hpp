@@ -40,13 +40,13 @@ class SequenceGenerator : AllStatic {
 
   // peek last sequence number
   static jint peek() {
-    return _seq_number;
+    return _seq_number._value;
   }
 
   // reset sequence number
   static void reset() {
     assert(SafepointSynchronize::is_at_safepoint(), "Safepoint required");
-    _seq_number = 1;
+    _seq_number._value = 1;
     _generation ++;
   };
 
@@ -54,7 +54,15 @@ class SequenceGenerator : AllStatic {
   NOT_PRODUCT(static jint max_seq_num() { return _max_seq_number; })
 
  private:
-  static volatile jint             _seq_number;
+  // The counter is bumped by every tracked memory operation on every
+  // thread; keep it on a cache line of its own so those atomics do not
+  // also pull in whatever shared state the linker places next to it.
+  struct SeqNumber {
+    char          _pad_prev[DEFAULT_CACHE_LINE_SIZE];
+    volatile jint _value;
+    char          _pad_next[DEFAULT_CACHE_LINE_SIZE - sizeof(jint)];
+  };
+  static SeqNumber                 _seq_number;
   static volatile unsigned long    _generation;
   NOT_PRODUCT(static jint          _max_seq_number; )
 };
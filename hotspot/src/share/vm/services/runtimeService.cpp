@@ -46,6 +46,7 @@ PerfCounter*  RuntimeService::_application_time_ticks = NULL;
 PerfCounter*  RuntimeService::_thread_interrupt_signaled_count = NULL;
 PerfCounter*  RuntimeService::_interrupted_before_count = NULL;
 PerfCounter*  RuntimeService::_interrupted_during_count = NULL;
+PerfLongHistogram* RuntimeService::_safepoint_time_histogram = NULL;
 
 void RuntimeService::init() {
   // Make sure the VM version is initialized
@@ -70,6 +71,14 @@ void RuntimeService::init() {
               PerfDataManager::create_counter(SUN_RT, "applicationTime",
                                               PerfData::U_Ticks, CHECK);
 
+    // Distribution of individual safepoint durations in microseconds,
+    // log-linear bucketed. 96 buckets cover up to ~30 seconds; longer
+    // pauses land in the last bucket.
+    _safepoint_time_histogram =
+              PerfDataManager::create_long_histogram(SUN_RT,
+                                              "safepointTimeMicrosDistribution",
+                                              PerfData::U_Events, 96, CHECK);
+
 
     // create performance counters for jvm_version and its capabilities
     PerfDataManager::create_constant(SUN_RT, "jvmVersion", PerfData::U_None,
@@ -162,7 +171,10 @@ void RuntimeService::record_safepoint_end() {
   // update the time stamp to begin recording app time
   _app_timer.update();
   if (UsePerfData) {
-    _safepoint_time_ticks->inc(_safepoint_timer.ticks_since_update());
+    jlong ticks = _safepoint_timer.ticks_since_update();
+    _safepoint_time_ticks->inc(ticks);
+    jlong micros = (jlong) (TimeHelper::counter_to_seconds(ticks) * 1000000.0);
+    _safepoint_time_histogram->record(micros);
   }
 }
 
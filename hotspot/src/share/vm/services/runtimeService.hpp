@@ -37,6 +37,7 @@ private:
   static PerfCounter* _thread_interrupt_signaled_count;// os:interrupt thr_kill
   static PerfCounter* _interrupted_before_count;  // _INTERRUPTIBLE OS_INTRPT
   static PerfCounter* _interrupted_during_count;  // _INTERRUPTIBLE OS_INTRPT
+  static PerfLongHistogram* _safepoint_time_histogram; // Distribution of safepoint durations
 
   static TimeStamp _safepoint_timer;
   static TimeStamp _app_timer;
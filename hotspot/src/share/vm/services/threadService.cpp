@@ -235,6 +235,107 @@ void ThreadService::remove_thread_dump(ThreadDumpResult* dump) {
   assert(found, "The threaddump result to be removed must exist.");
 }
 
+// Suspension-based fast path for dump_stack_traces. Each target thread is
+// individually held with the same external suspend protocol that
+// JVM_SuspendThread uses and its stack is walked while only that thread is
+// stopped; threads executing Java or VM code do not reach a suspend
+// completed state without a safepoint, so if any target fails to stop
+// promptly the whole attempt is abandoned and the caller falls back to
+// VM_ThreadDump. dump_result is registered with the thread dump list
+// (see ThreadDumpResult constructor) so the snapshots it holds are kept
+// alive by oops_do across any safepoint that happens after the walk.
+bool ThreadService::dump_stack_traces_by_suspension(ThreadDumpResult* dump_result,
+                                                    GrowableArray<instanceHandle>* threads,
+                                                    int num_threads) {
+  JavaThread* self = JavaThread::current();
+  ResourceMark rm;
+
+  // Threads to be snapshotted, in result order; a NULL entry gets a dummy
+  // snapshot just as in VM_ThreadDump::doit().
+  GrowableArray<JavaThread*>* targets   = new GrowableArray<JavaThread*>(num_threads);
+  // Threads we actually suspended and therefore must resume.
+  GrowableArray<JavaThread*>* suspended = new GrowableArray<JavaThread*>(num_threads);
+
+  bool complete = true;
+  for (int i = 0; i < num_threads; i++) {
+    instanceHandle th = threads->at(i);
+    JavaThread* jt = (th() == NULL) ? NULL : java_lang_Thread::thread(th());
+    if (jt == NULL ||           /* thread not alive */
+        jt->is_exiting() ||
+        jt->is_hidden_from_external_view()) {
+      targets->append((JavaThread*) NULL);
+      continue;
+    }
+    if (jt == self) {
+      // The current thread can walk its own stack without being suspended.
+      targets->append(jt);
+      continue;
+    }
+
+    // Same protocol as JVM_SuspendThread
+    {
+      MutexLockerEx ml(jt->SR_lock(), Mutex::_no_safepoint_check_flag);
+      if (jt->is_external_suspend()) {
+        // Somebody else (e.g. a debugger) owns the suspend state of this
+        // thread; don't interfere with it, take the safepoint path instead.
+        complete = false;
+        break;
+      }
+      if (jt->is_exiting()) { // thread is in the process of exiting
+        targets->append((JavaThread*) NULL);
+        continue;
+      }
+      jt->set_external_suspend();
+    }
+
+    uint32_t debug_bits = 0;
+    if (jt->is_ext_suspend_completed_with_lock(&debug_bits)) {
+      // Once suspended the thread cannot exit, so the JavaThread stays
+      // valid until we resume it below.
+      suspended->append(jt);
+      targets->append(jt);
+    } else {
+      // The thread is executing Java or VM code and would only stop at a
+      // safepoint; cancel the request and fall back.
+      {
+        MutexLocker ml(Threads_lock);
+        jt->java_resume();
+      }
+      complete = false;
+      break;
+    }
+  }
+
+  if (complete) {
+    // Grab the Threads_lock for the stack walks: it keeps the snapshot
+    // code (e.g. get_current_contended_monitor) happy and no safepoint can
+    // be in progress while we hold it, so the suspended threads' stacks
+    // and the oops we collect from them stay stable.
+    MutexLocker ml(Threads_lock);
+    for (int i = 0; i < targets->length(); i++) {
+      JavaThread* jt = targets->at(i);
+      if (jt == NULL) {
+        // Add a dummy snapshot
+        dump_result->add_thread_snapshot(new ThreadSnapshot());
+      } else {
+        ThreadSnapshot* ts = new ThreadSnapshot(jt);
+        ts->dump_stack_at_safepoint(-1 /* entire stack */,
+                                    false /* with locked monitors */);
+        dump_result->add_thread_snapshot(ts);
+      }
+    }
+    for (int i = 0; i < suspended->length(); i++) {
+      suspended->at(i)->java_resume();
+    }
+  } else {
+    MutexLocker ml(Threads_lock);
+    for (int i = 0; i < suspended->length(); i++) {
+      suspended->at(i)->java_resume();
+    }
+  }
+  return complete;
+}
+
 // Dump stack trace of threads specified in the given threads array.
 // Returns StackTraceElement[][] each element is the stack trace of a thread in
 // the corresponding entry in the given threads array
@@ -243,14 +344,26 @@ Handle ThreadService::dump_stack_traces(GrowableArray<instanceHandle>* threads,
                                         TRAPS) {
   assert(num_threads > 0, "just checking");
 
-  ThreadDumpResult dump_result;
-  VM_ThreadDump op(&dump_result,
-                   threads,
-                   num_threads,
-                   -1,    /* entire stack */
-                   false, /* with locked monitors */
-                   false  /* with locked synchronizers */);
-  VMThread::execute(&op);
+  // An abandoned fast path attempt may leave a partial set of snapshots
+  // behind, so it gets a result object of its own; whichever result goes
+  // unused is cleaned up by its destructor.
+  ThreadDumpResult fast_result;
+  ThreadDumpResult safepoint_result;
+  ThreadDumpResult* dump_result;
+
+  if (ThreadDumpViaSuspend &&
+      dump_stack_traces_by_suspension(&fast_result, threads, num_threads)) {
+    dump_result = &fast_result;
+  } else {
+    VM_ThreadDump op(&safepoint_result,
+                     threads,
+                     num_threads,
+                     -1,    /* entire stack */
+                     false, /* with locked monitors */
+                     false  /* with locked synchronizers */);
+    VMThread::execute(&op);
+    dump_result = &safepoint_result;
+  }
 
   // Allocate the resulting StackTraceElement[][] object
 
@@ -260,10 +373,10 @@ Handle ThreadService::dump_stack_traces(GrowableArray<instanceHandle>* threads,
   objArrayOop r = oopFactory::new_objArray(ik, num_threads, CHECK_NH);
   objArrayHandle result_obj(THREAD, r);
 
-  int num_snapshots = dump_result.num_snapshots();
+  int num_snapshots = dump_result->num_snapshots();
   assert(num_snapshots == num_threads, "Must have num_threads thread snapshots");
   int i = 0;
-  for (ThreadSnapshot* ts = dump_result.snapshots(); ts != NULL; i++, ts = ts->next()) {
+  for (ThreadSnapshot* ts = dump_result->snapshots(); ts != NULL; i++, ts = ts->next()) {
     ThreadStackTrace* stacktrace = ts->get_stack_trace();
     if (stacktrace == NULL) {
       // No stack trace
@@ -552,7 +665,14 @@ ThreadStackTrace::~ThreadStackTrace() {
 }
 
 void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
-  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  // The thread being walked is either stopped at a safepoint with
+  // everybody else, or it is the current thread, or it has been held
+  // still with an external suspend request (see
+  // ThreadService::dump_stack_traces_by_suspension).
+  assert(SafepointSynchronize::is_at_safepoint() ||
+         _thread == JavaThread::current() ||
+         _thread->is_being_ext_suspended(),
+         "the target thread must not be running");
 
   if (_thread->has_last_Java_frame()) {
     RegisterMap reg_map(_thread);
@@ -944,9 +1064,14 @@ ThreadsListEnumerator::ThreadsListEnumerator(Thread* cur_thread,
   int init_size = ThreadService::get_live_thread_count();
   _threads_array = new GrowableArray<instanceHandle>(init_size);
 
-  MutexLockerEx ml(Threads_lock);
+  // Iterate a lock-free snapshot of the thread list instead of holding the
+  // Threads_lock, so that heavy thread creation/teardown does not stall
+  // thread enumeration. Threads that exit concurrently stay allocated
+  // until the handle is released and are filtered by is_exiting() below.
+  ThreadsListHandle tlh;
 
-  for (JavaThread* jt = Threads::first(); jt != NULL; jt = jt->next()) {
+  for (int i = 0; i < tlh.length(); i++) {
+    JavaThread* jt = tlh.thread_at(i);
     // skips JavaThreads in the process of exiting
     // and also skips VM internal JavaThreads
     // Threads in _thread_new or _thread_new_trans state are included.
@@ -72,6 +72,15 @@ private:
   // requested by multiple threads concurrently.
   static ThreadDumpResult* _threaddump_list;
 
+  // Fast path for dump_stack_traces: suspends each target thread
+  // individually and walks its stack without a global safepoint.
+  // Returns false if any target could not be held, in which case
+  // dump_result may contain a partial set of snapshots and the caller
+  // must retry with VM_ThreadDump.
+  static bool dump_stack_traces_by_suspension(ThreadDumpResult* dump_result,
+                                              GrowableArray<instanceHandle>* threads,
+                                              int num_threads);
+
 public:
   static void init();
   static void add_thread(JavaThread* thread, bool daemon);
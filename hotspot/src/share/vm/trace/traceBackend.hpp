@@ -51,9 +51,18 @@ public:
   }
 };
 
+// Per-thread state for the binary backend: a lazily allocated buffer that
+// the owning thread appends serialized event records to.  See
+// traceBinaryBackend.hpp for the buffer and file formats.
 class TraceThreadData {
+  friend class TraceBinaryBackend;
+private:
+    u1*    _buffer;    // NULL until the thread commits its first event
+    size_t _pos;       // append position within _buffer
+    jlong  _tid;       // os thread id, recorded in flushed segments
 public:
-    TraceThreadData() {}
+    TraceThreadData() : _buffer(NULL), _pos(0), _tid(0) {}
+    ~TraceThreadData();
 };
 
 typedef TraceBackend Tracing;
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "trace/traceBinaryBackend.hpp"
+
+#if INCLUDE_TRACE
+
+#include "runtime/atomic.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.inline.hpp"
+#include "utilities/ostream.hpp"
+
+// Guards the trace file and the backend statistics.  Not exported through
+// mutexLocker.hpp since this is the only file that uses it (same pattern
+// as tty_lock).
+extern Mutex* BinaryTrace_lock;
+
+volatile bool TraceBinaryBackend::_active           = false;
+bool          TraceBinaryBackend::_failed           = false;
+FILE*         TraceBinaryBackend::_file             = NULL;
+jlong         TraceBinaryBackend::_file_pos         = 0;
+julong        TraceBinaryBackend::_segments_written = 0;
+julong        TraceBinaryBackend::_bytes_written    = 0;
+volatile jlong TraceBinaryBackend::_events_dropped  = 0;
+
+// File and segment framing; see the format comment in the header.
+static const u4 trace_segment_magic   = 0x53435254; // "TRCS" little-endian
+static const u4 trace_format_version  = 1;
+static const char trace_file_magic[8] = { 'H','S','T','R','A','C','E','\0' };
+
+// A record is [u2 event id][u4 record length][payload].
+static const size_t record_header_size = sizeof(u2) + sizeof(u4);
+
+bool TraceBinaryBackend::activate() {
+  assert_lock_strong(BinaryTrace_lock);
+  if (_active) {
+    return true;
+  }
+  if (_failed) {
+    return false;
+  }
+  _file = fopen(BinaryTraceFile, "wb");
+  if (_file == NULL) {
+    warning("Cannot open binary trace file: %s", BinaryTraceFile);
+    _failed = true;
+    return false;
+  }
+  // The header carries everything a reader needs to decode timestamps.
+  jlong freq = os::elapsed_frequency();
+  fwrite(trace_file_magic, sizeof(trace_file_magic), 1, _file);
+  fwrite(&trace_format_version, sizeof(trace_format_version), 1, _file);
+  fwrite(&freq, sizeof(freq), 1, _file);
+  _file_pos = sizeof(trace_file_magic) + sizeof(trace_format_version) + sizeof(freq);
+  _active = true;
+  return true;
+}
+
+void TraceBinaryBackend::write_segment(jlong tid, const u1* data, size_t len) {
+  assert_lock_strong(BinaryTrace_lock);
+  const jlong header_end = sizeof(trace_file_magic) + sizeof(trace_format_version) + sizeof(jlong);
+  const jlong seg_size = sizeof(trace_segment_magic) + sizeof(tid) + sizeof(u4) + (jlong)len;
+  if (_file_pos > header_end && _file_pos + seg_size > (jlong)BinaryTraceFileSize) {
+    // Wrap: continue overwriting the oldest data just after the file
+    // header.  The partially overwritten segment there becomes garbage;
+    // readers skip it by scanning for the next segment magic.
+    fseek(_file, (long)header_end, SEEK_SET);
+    _file_pos = header_end;
+  }
+  u4 len32 = (u4)len;
+  fwrite(&trace_segment_magic, sizeof(trace_segment_magic), 1, _file);
+  fwrite(&tid, sizeof(tid), 1, _file);
+  fwrite(&len32, sizeof(len32), 1, _file);
+  fwrite(data, len, 1, _file);
+  fflush(_file);
+  _file_pos += seg_size;
+  _segments_written++;
+  _bytes_written += (julong)seg_size;
+}
+
+void TraceBinaryBackend::flush(TraceThreadData* td) {
+  if (td->_buffer == NULL || td->_pos == 0) {
+    return;
+  }
+  if (BinaryTrace_lock == NULL) {
+    // Too early (or too late) in the VM lifecycle to do file I/O safely;
+    // discard rather than block VM initialization.
+    Atomic::add((jlong)1, &_events_dropped);
+    td->_pos = 0;
+    return;
+  }
+  MutexLockerEx ml(BinaryTrace_lock, Mutex::_no_safepoint_check_flag);
+  if (_active) {
+    write_segment(td->_tid, td->_buffer, td->_pos);
+  }
+  td->_pos = 0;
+}
+
+void TraceBinaryBackend::write_event(u2 event_id, const u1* payload, size_t len) {
+  Thread* thread = ThreadLocalStorage::thread();
+  if (thread == NULL) {
+    // Unattached thread; there is no buffer to write to.
+    Atomic::add((jlong)1, &_events_dropped);
+    return;
+  }
+  if (!_active) {
+    if (BinaryTrace_lock == NULL) {
+      Atomic::add((jlong)1, &_events_dropped);
+      return;
+    }
+    MutexLockerEx ml(BinaryTrace_lock, Mutex::_no_safepoint_check_flag);
+    if (!activate()) {
+      return;
+    }
+  }
+  TraceThreadData* td = thread->trace_data();
+  if (td->_buffer == NULL) {
+    td->_buffer = NEW_C_HEAP_ARRAY(u1, BinaryTraceBufferSize, mtTracing);
+    td->_tid = (jlong)os::current_thread_id();
+  }
+  size_t record_size = record_header_size + len;
+  assert(record_size <= BinaryTraceBufferSize, "event larger than thread buffer");
+  if (td->_pos + record_size > BinaryTraceBufferSize) {
+    flush(td);
+  }
+  u1* p = td->_buffer + td->_pos;
+  u4 len32 = (u4)len;
+  memcpy(p, &event_id, sizeof(event_id));
+  memcpy(p + sizeof(event_id), &len32, sizeof(len32));
+  memcpy(p + record_header_size, payload, len);
+  td->_pos += record_size;
+}
+
+void TraceBinaryBackend::flush_all_java_threads() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // Only Java threads are known to be stopped at a safepoint; non-Java
+  // threads keep running and flush their own buffers when they fill up
+  // or when the thread exits.
+  for (JavaThread* t = Threads::first(); t != NULL; t = t->next()) {
+    flush(t->trace_data());
+  }
+  // The VM thread is executing this operation, so its buffer is safe too.
+  flush(Thread::current()->trace_data());
+}
+
+void TraceBinaryBackend::print_info(outputStream* st) {
+  if (!_active) {
+    st->print_cr("Binary tracing is not active "
+                 "(requires -XX:+EnableTracing -XX:+UseBinaryTracing).");
+    return;
+  }
+  MutexLockerEx ml(BinaryTrace_lock, Mutex::_no_safepoint_check_flag);
+  st->print_cr("Binary trace file: %s", BinaryTraceFile);
+  st->print_cr("  segments written: " JULONG_FORMAT ", bytes written: " JULONG_FORMAT
+               ", events dropped: " JLONG_FORMAT,
+               _segments_written, _bytes_written, (jlong)_events_dropped);
+}
+
+TraceThreadData::~TraceThreadData() {
+  if (_buffer != NULL) {
+    TraceBinaryBackend::flush(this);
+    FREE_C_HEAP_ARRAY(u1, _buffer, mtTracing);
+    _buffer = NULL;
+  }
+}
+
+#endif // INCLUDE_TRACE
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_VM_TRACE_TRACEBINARYBACKEND_HPP
+#define SHARE_VM_TRACE_TRACEBINARYBACKEND_HPP
+
+#include "utilities/macros.hpp"
+
+#if INCLUDE_TRACE
+
+#include "memory/allocation.hpp"
+#include "oops/klass.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "trace/traceBackend.hpp"
+
+// Binary flight-recorder style backend for the trace framework.
+//
+// When UseBinaryTracing is enabled (together with EnableTracing), committed
+// events are serialized into fixed-width native-endian records instead of
+// being printed to tty.  Each attached thread appends records to a private
+// buffer hung off its TraceThreadData, so the hot path is a few stores with
+// no locking; a full buffer is flushed by its owner as one segment to a
+// single trace file that wraps around at BinaryTraceFileSize (circular,
+// newest data wins).  Trace.dump (jcmd) flushes the Java thread buffers at
+// a safepoint and reports where the data is.
+//
+// On-disk layout: a file header (magic "HSTRACE\0", format version and the
+// tick frequency needed to decode timestamps) followed by segments.  Each
+// segment is [magic, writer thread id, payload length, payload]; a payload
+// is a sequence of event records [event id (u2), record length (u4),
+// start/end ticks (s8 each), the event fields in declaration order].
+// After the file wraps, the segment that straddles the wrap point is
+// partially overwritten; readers resynchronize on the segment magic.
+
+// Serializes event fields into a caller-supplied buffer.  The overloads
+// mirror TraceStream::print_val so the generated writeBinaryContent methods
+// can be produced by the same stylesheet pass.  On overflow the writer goes
+// inert and the caller drops the event.
+class TraceBufferWriter : public StackObj {
+ private:
+  u1*    _buf;
+  size_t _capacity;
+  size_t _pos;
+  bool   _overflowed;
+
+  void write_bytes(const void* data, size_t len) {
+    if (_pos + len > _capacity) {
+      _overflowed = true;
+      return;
+    }
+    memcpy(_buf + _pos, data, len);
+    _pos += len;
+  }
+
+ public:
+  TraceBufferWriter(u1* buf, size_t capacity) :
+    _buf(buf), _capacity(capacity), _pos(0), _overflowed(false) {}
+
+  size_t position() const  { return _pos; }
+  bool overflowed() const  { return _overflowed; }
+
+  void write(u1 val)     { write_bytes(&val, sizeof(val)); }
+  void write(u2 val)     { write_bytes(&val, sizeof(val)); }
+  void write(s2 val)     { write_bytes(&val, sizeof(val)); }
+  void write(u4 val)     { write_bytes(&val, sizeof(val)); }
+  void write(s4 val)     { write_bytes(&val, sizeof(val)); }
+  void write(u8 val)     { write_bytes(&val, sizeof(val)); }
+  void write(s8 val)     { write_bytes(&val, sizeof(val)); }
+  void write(bool val)   { u1 b = val ? 1 : 0; write_bytes(&b, sizeof(b)); }
+  void write(float val)  { write_bytes(&val, sizeof(val)); }
+  void write(double val) { write_bytes(&val, sizeof(val)); }
+
+  // Strings are written as a u2 length followed by the bytes (no
+  // terminator) and truncated to keep event records bounded.
+  void write(const char* val) {
+    size_t len = (val == NULL) ? 0 : strlen(val);
+    if (len > 256) {
+      len = 256;
+    }
+    write((u2)len);
+    if (len > 0) {
+      write_bytes(val, len);
+    }
+  }
+
+  // Caller is machine generated code located in traceEventClasses.hpp;
+  // the ResourceMark needed for the name conversions below is provided
+  // by the generated writeEvent().
+  void write(const Klass* const val) {
+    const char* description = NULL;
+    if (val != NULL) {
+      Symbol* name = val->name();
+      if (name != NULL) {
+        description = name->as_C_string();
+      }
+    }
+    write(description);
+  }
+
+  void write(const Method* const val) {
+    write(val == NULL ? NULL : val->name_and_sig_as_C_string());
+  }
+};
+
+class outputStream;
+
+class TraceBinaryBackend : AllStatic {
+ private:
+  static volatile bool _active;
+  static bool          _failed;       // open failed; stop retrying
+  static FILE*         _file;
+  static jlong         _file_pos;
+  static julong        _segments_written;
+  static julong        _bytes_written;
+  static volatile jlong _events_dropped;
+
+  static bool  activate();            // open the file, write the header
+  static void  write_segment(jlong tid, const u1* data, size_t len);
+
+ public:
+  static bool is_active() { return _active; }
+
+  // Appends one serialized event to the current thread's buffer, flushing
+  // the buffer as a segment first if the record does not fit.  Activates
+  // the backend on the first event once the VM is far enough along.
+  static void write_event(u2 event_id, const u1* payload, size_t len);
+
+  // Writes the given thread data's buffered records to the file.  Called
+  // by the owning thread, by the thread data destructor, and (for stopped
+  // Java threads only) from a safepoint by the VM thread.
+  static void flush(TraceThreadData* td);
+
+  // Flushes all Java thread buffers; must be called at a safepoint.
+  static void flush_all_java_threads();
+
+  static void print_info(outputStream* st);
+};
+
+#endif // INCLUDE_TRACE
+
+#endif // SHARE_VM_TRACE_TRACEBINARYBACKEND_HPP
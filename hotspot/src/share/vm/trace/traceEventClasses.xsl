@@ -45,6 +45,7 @@
 #if INCLUDE_TRACE
 
 
+#include "trace/traceBinaryBackend.hpp"
 #include "trace/traceStream.hpp"
 #include "utilities/ostream.hpp"
 
@@ -81,6 +82,10 @@ public:
   void writeStruct(TraceStream&amp; ts) {
 <xsl:apply-templates select="value" mode="write-data"/>
   }
+
+  void writeBinaryStruct(TraceBufferWriter&amp; w) {
+<xsl:apply-templates select="value" mode="write-binary"/>
+  }
 };
 
 </xsl:template>
@@ -128,6 +133,12 @@ public:
     ts.print("]\n");
   }
 
+  void writeBinaryContent(TraceBufferWriter&amp; w) {
+    w.write((s8)_startTime);
+    w.write((s8)_endTime);
+<xsl:apply-templates select="value|structvalue" mode="write-binary"/>
+  }
+
  public:
 <xsl:apply-templates select="value|structvalue|transition_value|relation" mode="write-setters"/>
 
@@ -140,6 +151,15 @@ public:
   <xsl:value-of select="concat('  Event', @id, '(EventStartTime timing=TIMED) : TraceEvent&lt;Event', @id, '&gt;(timing) {}', $newline)"/>
   void writeEvent(void) {
     ResourceMark rm;
+    if (UseBinaryTracing) {
+      u1 payload[512];
+      TraceBufferWriter w(payload, sizeof(payload));
+      writeBinaryContent(w);
+      if (!w.overflowed()) {
+        TraceBinaryBackend::write_event((u2)eventId, payload, w.position());
+      }
+      return;
+    }
     if (UseLockedTracing) {
       ttyLocker lock;
       writeEventContent();
@@ -254,4 +274,23 @@ public:
   </xsl:if>
 </xsl:template>
 
+<xsl:template match="value" mode="write-binary">
+  <xsl:choose>
+    <xsl:when test="@type='TICKSPAN' or @type='TICKS'">
+      <xsl:value-of select="concat('    w.write((s8)_', @field, '.value());')"/>
+    </xsl:when>
+    <xsl:otherwise>
+      <xsl:value-of select="concat('    w.write(_', @field, ');')"/>
+    </xsl:otherwise>
+  </xsl:choose>
+  <xsl:text>
+</xsl:text>
+</xsl:template>
+
+<xsl:template match="structvalue" mode="write-binary">
+  <xsl:value-of select="concat('    _', @field, '.writeBinaryStruct(w);')"/>
+  <xsl:text>
+</xsl:text>
+</xsl:template>
+
 </xsl:stylesheet>
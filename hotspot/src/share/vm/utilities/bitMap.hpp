@@ -106,10 +106,10 @@ class BitMap VALUE_OBJ_CLASS_SPEC {
     NOT_DEBUG_RETURN;
 
   // Statistics.
-  static idx_t* _pop_count_table;
-  static void init_pop_count_table();
   static idx_t num_set_bits(bm_word_t w);
-  static idx_t num_set_bits_from_table(unsigned char c);
+
+  // Position of the least-significant set bit in w, which must be nonzero.
+  static inline idx_t find_first_set_bit(bm_word_t w);
 
  public:
 
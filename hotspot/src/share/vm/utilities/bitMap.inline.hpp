@@ -28,6 +28,23 @@
 #include "runtime/atomic.hpp"
 #include "utilities/bitMap.hpp"
 
+inline BitMap::idx_t BitMap::find_first_set_bit(bm_word_t w) {
+  assert(w != 0, "must have a set bit");
+  // Binary search: halve the word each step instead of testing one bit
+  // per step, so locating a bit costs O(log BitsPerWord) regardless of
+  // its position.
+  idx_t pos = 0;
+#ifdef _LP64
+  if ((w & 0xffffffff) == 0) { pos += 32; w >>= 32; }
+#endif
+  if ((w & 0xffff) == 0) { pos += 16; w >>= 16; }
+  if ((w & 0xff)   == 0) { pos +=  8; w >>=  8; }
+  if ((w & 0xf)    == 0) { pos +=  4; w >>=  4; }
+  if ((w & 0x3)    == 0) { pos +=  2; w >>=  2; }
+  if ((w & 0x1)    == 0) { pos +=  1; }
+  return pos;
+}
+
 #ifdef ASSERT
 inline void BitMap::verify_index(idx_t index) const {
   assert(index < _size, "BitMap index out of bounds");
@@ -175,9 +192,7 @@ BitMap::get_next_one_offset_inline(idx_t l_offset, idx_t r_offset) const {
   idx_t res = map(index) >> pos;
   if (res != (uintptr_t)NoBits) {
     // find the position of the 1-bit
-    for (; !(res & 1); res_offset++) {
-      res = res >> 1;
-    }
+    res_offset += find_first_set_bit(res);
 
 #ifdef ASSERT
     // In the following assert, if r_offset is not bitamp word aligned,
@@ -209,10 +224,7 @@ BitMap::get_next_one_offset_inline(idx_t l_offset, idx_t r_offset) const {
     res = map(index);
     if (res != (uintptr_t)NoBits) {
       // found a 1, return the offset
-      for (res_offset = bit_index(index); !(res & 1); res_offset++) {
-        res = res >> 1;
-      }
-      assert(res & 1, "tautology; see loop condition");
+      res_offset = bit_index(index) + find_first_set_bit(res);
       assert(res_offset >= l_offset, "just checking");
       return MIN2(res_offset, r_offset);
     }
@@ -239,9 +251,7 @@ BitMap::get_next_zero_offset_inline(idx_t l_offset, idx_t r_offset) const {
 
   if (res != (uintptr_t)AllBits) {
     // find the position of the 0-bit
-    for (; res & 1; res_offset++) {
-      res = res >> 1;
-    }
+    res_offset += find_first_set_bit(~res);
     assert(res_offset >= l_offset, "just checking");
     return MIN2(res_offset, r_offset);
   }
@@ -250,11 +260,7 @@ BitMap::get_next_zero_offset_inline(idx_t l_offset, idx_t r_offset) const {
     res = map(index);
     if (res != (uintptr_t)AllBits) {
       // found a 0, return the offset
-      for (res_offset = index << LogBitsPerWord; res & 1;
-           res_offset++) {
-        res = res >> 1;
-      }
-      assert(!(res & 1), "tautology; see loop condition");
+      res_offset = bit_index(index) + find_first_set_bit(~res);
       assert(res_offset >= l_offset, "just checking");
       return MIN2(res_offset, r_offset);
     }
@@ -280,9 +286,7 @@ BitMap::get_next_one_offset_inline_aligned_right(idx_t l_offset,
   idx_t res = map(index) >> bit_in_word(res_offset);
   if (res != (uintptr_t)NoBits) {
     // find the position of the 1-bit
-    for (; !(res & 1); res_offset++) {
-      res = res >> 1;
-    }
+    res_offset += find_first_set_bit(res);
     assert(res_offset >= l_offset &&
            res_offset < r_offset, "just checking");
     return res_offset;
@@ -292,10 +296,7 @@ BitMap::get_next_one_offset_inline_aligned_right(idx_t l_offset,
     res = map(index);
     if (res != (uintptr_t)NoBits) {
       // found a 1, return the offset
-      for (res_offset = bit_index(index); !(res & 1); res_offset++) {
-        res = res >> 1;
-      }
-      assert(res & 1, "tautology; see loop condition");
+      res_offset = bit_index(index) + find_first_set_bit(res);
       assert(res_offset >= l_offset && res_offset < r_offset, "just checking");
       return res_offset;
     }
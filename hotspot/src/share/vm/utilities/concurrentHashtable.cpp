@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "oops/oop.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/concurrentHashtable.hpp"
+
+template <class T, MEMFLAGS F>
+ConcurrentHashtable<T, F>::ConcurrentHashtable(const char* name, int table_size) {
+  _table_size        = table_size;
+  _buckets           = (Entry* volatile*)NEW_C_HEAP_ARRAY(Entry*, table_size, F);
+  for (int i = 0; i < table_size; i++) {
+    _buckets[i] = NULL;
+  }
+  _arena             = new (F) Arena();
+  _free_list         = NULL;
+  _deferred          = new (ResourceObj::C_HEAP, F) GrowableArray<Entry*>(16, true, F);
+  _free_list_lock    = new Mutex(Mutex::leaf, name, true);
+  for (int i = 0; i < lock_stripes; i++) {
+    _stripe_locks[i] = new Mutex(Mutex::leaf, name, true);
+  }
+  _number_of_entries = 0;
+}
+
+template <class T, MEMFLAGS F>
+ConcurrentHashtable<T, F>::~ConcurrentHashtable() {
+  for (int i = 0; i < lock_stripes; i++) {
+    delete _stripe_locks[i];
+  }
+  delete _free_list_lock;
+  delete _deferred;
+  delete _arena;
+  FREE_C_HEAP_ARRAY(Entry*, (Entry**)_buckets, F);
+}
+
+template <class T, MEMFLAGS F>
+ConcurrentHashtableEntry<T, F>* ConcurrentHashtable<T, F>::new_entry(unsigned int hash, T literal) {
+  Entry* entry = NULL;
+  {
+    MutexLockerEx ml(_free_list_lock, Mutex::_no_safepoint_check_flag);
+    if (_free_list != NULL) {
+      entry = _free_list;
+      _free_list = entry->next();
+    }
+  }
+  if (entry == NULL) {
+    entry = (Entry*)_arena->Amalloc(sizeof(Entry));
+  }
+  entry->set_hash(hash);
+  entry->set_literal(literal);
+  entry->set_next(NULL);
+  return entry;
+}
+
+template <class T, MEMFLAGS F>
+void ConcurrentHashtable<T, F>::add_entry(unsigned int hash, Entry* entry) {
+  assert(bucket_lock(hash)->owned_by_self() ||
+         SafepointSynchronize::is_at_safepoint(), "must hold the bucket lock");
+  Entry* volatile* head = bucket_addr(hash_to_index(hash));
+  entry->set_next(*head);
+  // Publish after the entry is fully initialized so lock-free readers
+  // never see a partial entry.
+  OrderAccess::release_store_ptr((volatile void*)head, (void*)entry);
+  Atomic::inc(&_number_of_entries);
+}
+
+template <class T, MEMFLAGS F>
+void ConcurrentHashtable<T, F>::remove_entry(unsigned int hash, Entry* entry) {
+  assert(bucket_lock(hash)->owned_by_self() ||
+         SafepointSynchronize::is_at_safepoint(), "must hold the bucket lock");
+  Entry* volatile* head = bucket_addr(hash_to_index(hash));
+  if (*head == entry) {
+    *head = entry->next();
+  } else {
+    Entry* prev = *head;
+    while (prev != NULL && prev->next() != entry) {
+      prev = prev->next();
+    }
+    assert(prev != NULL, "entry not in its bucket");
+    prev->set_next(entry->next());
+  }
+  // The entry's own next link stays intact: a reader positioned on the
+  // entry must be able to finish its chain walk.  Recycling waits for
+  // purge_deferred_entries() at a safepoint.
+  {
+    MutexLockerEx ml(_free_list_lock, Mutex::_no_safepoint_check_flag);
+    _deferred->append(entry);
+  }
+  Atomic::dec(&_number_of_entries);
+}
+
+template <class T, MEMFLAGS F>
+void ConcurrentHashtable<T, F>::purge_deferred_entries() {
+  assert(SafepointSynchronize::is_at_safepoint(), "purge outside safepoint");
+  for (int i = 0; i < _deferred->length(); i++) {
+    Entry* entry = _deferred->at(i);
+    entry->set_next(_free_list);
+    _free_list = entry;
+  }
+  _deferred->clear();
+}
+
+template <class T, MEMFLAGS F>
+void ConcurrentHashtable<T, F>::resize(int new_table_size) {
+  assert(SafepointSynchronize::is_at_safepoint(), "resize outside safepoint");
+  Entry* volatile* new_buckets = (Entry* volatile*)NEW_C_HEAP_ARRAY(Entry*, new_table_size, F);
+  for (int i = 0; i < new_table_size; i++) {
+    new_buckets[i] = NULL;
+  }
+  int old_table_size = _table_size;
+  for (int i = 0; i < old_table_size; i++) {
+    Entry* entry = _buckets[i];
+    while (entry != NULL) {
+      Entry* next = entry->next();
+      int index = (int)(entry->hash() % (unsigned int)new_table_size);
+      entry->set_next(new_buckets[index]);
+      new_buckets[index] = entry;
+      entry = next;
+    }
+  }
+  Entry* volatile* old_buckets = _buckets;
+  _buckets    = new_buckets;
+  _table_size = new_table_size;
+  FREE_C_HEAP_ARRAY(Entry*, (Entry**)old_buckets, F);
+}
+
+// Explicitly instantiate these types for the tables expected to migrate
+// first (symbol, string and dictionary literals).
+template class ConcurrentHashtableEntry<Symbol*, mtSymbol>;
+template class ConcurrentHashtableEntry<oop, mtSymbol>;
+template class ConcurrentHashtableEntry<Klass*, mtClass>;
+template class ConcurrentHashtable<Symbol*, mtSymbol>;
+template class ConcurrentHashtable<oop, mtSymbol>;
+template class ConcurrentHashtable<Klass*, mtClass>;
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_CONCURRENTHASHTABLE_HPP
+#define SHARE_VM_UTILITIES_CONCURRENTHASHTABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/orderAccess.hpp"
+#include "utilities/growableArray.hpp"
+
+// A hash table supporting lock-free readers concurrent with fine-grained
+// writers, intended as a migration target for the VM's global tables
+// (SymbolTable, StringTable, Dictionary, LoaderConstraints), whose
+// BasicHashtable base serializes every access behind a single mutex.
+//
+// Like Hashtable, this class only manages the bucket chains; hashing and
+// literal comparison belong to the subsystem using the table, which walks
+// chains via first_entry()/next() itself.
+//
+// Concurrency contract:
+//
+//  - Chain walks starting at first_entry() need no lock, from any thread.
+//  - add_entry() and remove_entry() must hold bucket_lock(hash) for the
+//    entry's bucket.  The locks are striped, so writers to buckets under
+//    different stripes proceed in parallel.
+//  - A removed entry may still be visible to a concurrent reader, so it is
+//    parked on a deferred list instead of being recycled; its next link
+//    stays intact so readers walk through it.  purge_deferred_entries()
+//    moves the deferred list to the free list and must be called at a
+//    safepoint, as must resize().  Every intended user already purges and
+//    resizes its table at safepoints, so a concurrent resize would buy
+//    nothing here at a large cost in complexity.
+//
+// Entry memory is drawn from an arena owned by the table and recycled
+// through a free list (arenas never give individual allocations back).
+
+template <class T, MEMFLAGS F> class ConcurrentHashtableEntry {
+  friend class VMStructs;
+ private:
+  unsigned int                    _hash;
+  ConcurrentHashtableEntry<T, F>* _next;
+  T                               _literal;
+
+ public:
+  unsigned int hash() const            { return _hash; }
+  void set_hash(unsigned int hash)     { _hash = hash; }
+
+  T literal() const                    { return _literal; }
+  T* literal_addr()                    { return &_literal; }
+  void set_literal(T l)                { _literal = l; }
+
+  ConcurrentHashtableEntry<T, F>* next() const {
+    return _next;
+  }
+  void set_next(ConcurrentHashtableEntry<T, F>* next) {
+    _next = next;
+  }
+  ConcurrentHashtableEntry<T, F>** next_addr() {
+    return &_next;
+  }
+};
+
+template <class T, MEMFLAGS F> class ConcurrentHashtable : public CHeapObj<F> {
+  friend class VMStructs;
+ public:
+  typedef ConcurrentHashtableEntry<T, F> Entry;
+
+ private:
+  enum {
+    lock_stripes = 64            // must be a power of two
+  };
+
+  int             _table_size;
+  Entry* volatile* _buckets;
+  Arena*          _arena;        // entry memory, never shrinks
+  Entry*          _free_list;    // recycled entries, guarded by the free list lock
+  // Unlinked entries awaiting a safepoint.  A side array rather than a
+  // list: the entries' next links must stay intact for readers that are
+  // still walking through them.
+  GrowableArray<Entry*>* _deferred;
+  Mutex*          _free_list_lock;
+  Mutex*          _stripe_locks[lock_stripes];
+  volatile int    _number_of_entries;
+
+  Entry* volatile* bucket_addr(int index) const {
+    assert(0 <= index && index < _table_size, "index out of bounds");
+    return &_buckets[index];
+  }
+
+ public:
+  ConcurrentHashtable(const char* name, int table_size);
+  ~ConcurrentHashtable();
+
+  int table_size() const               { return _table_size; }
+  int number_of_entries() const        { return _number_of_entries; }
+
+  int hash_to_index(unsigned int hash) const {
+    return hash % _table_size;
+  }
+
+  // The lock covering the bucket for this hash; hold it across new_entry,
+  // add_entry and remove_entry for the same hash.
+  Mutex* bucket_lock(unsigned int hash) const {
+    return _stripe_locks[hash_to_index(hash) & (lock_stripes - 1)];
+  }
+
+  // Head of the bucket chain for this hash; safe without any lock.
+  Entry* first_entry(unsigned int hash) const {
+    return (Entry*)OrderAccess::load_ptr_acquire((volatile void*)bucket_addr(hash_to_index(hash)));
+  }
+
+  // Take an entry from the free list or carve one from the arena.
+  Entry* new_entry(unsigned int hash, T literal);
+
+  // Link an initialized entry into its bucket, visible to lock-free
+  // readers from that point on.
+  void add_entry(unsigned int hash, Entry* entry);
+
+  // Unlink an entry from its bucket and park it for recycling at the
+  // next purge_deferred_entries().
+  void remove_entry(unsigned int hash, Entry* entry);
+
+  // Move unlinked entries to the free list.  Safepoint only: afterwards
+  // no reader can still be walking through them.
+  void purge_deferred_entries();
+
+  // Rebuild the bucket array with a new size.  Safepoint only.
+  void resize(int new_table_size);
+
+  // Iteration for unlinking passes and verification.  Safepoint only,
+  // or with all stripe locks held by the caller's protocol.
+  Entry* bucket(int index) const       { return _buckets[index]; }
+};
+
+#endif // SHARE_VM_UTILITIES_CONCURRENTHASHTABLE_HPP
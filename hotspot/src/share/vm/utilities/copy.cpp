@@ -53,6 +53,166 @@ void Copy::conjoint_memory_atomic(void* from, void* to, size_t size) {
   }
 }
 
+class CopySwap : AllStatic {
+public:
+  // Copy and byte swap elements
+  //
+  // <src> - source address
+  // <dst> - destination address
+  // <byte_count> - number of bytes to copy
+  // <elem_size> - size of the elements to copy-swap
+  static void conjoint_swap(address src, address dst, size_t byte_count, size_t elem_size) {
+    assert(src != NULL, "address must not be NULL");
+    assert(dst != NULL, "address must not be NULL");
+    assert(elem_size == 2 || elem_size == 4 || elem_size == 8,
+           err_msg("incorrect element size: " SIZE_FORMAT, elem_size));
+    assert(is_size_aligned(byte_count, elem_size),
+           err_msg("byte_count " SIZE_FORMAT " must be multiple of element size " SIZE_FORMAT, byte_count, elem_size));
+
+    address src_end = src + byte_count;
+
+    if (dst <= src || dst >= src_end) {
+      do_conjoint_swap<RIGHT>(src, dst, byte_count, elem_size);
+    } else {
+      do_conjoint_swap<LEFT>(src, dst, byte_count, elem_size);
+    }
+  }
+
+private:
+  enum CopyDirection {
+    RIGHT, // lower -> higher address
+    LEFT   // higher -> lower address
+  };
+
+  // Byte swap a 16-bit value
+  static jshort byte_swap(jshort x) {
+    jushort ux = (jushort) x;
+    return (jshort) (((ux & 0x00ff) << 8) |
+                     ((ux & 0xff00) >> 8));
+  }
+
+  // Byte swap a 32-bit value
+  static jint byte_swap(jint x) {
+    juint ux = (juint) x;
+    return (jint) (((ux & 0x000000ff) << 24) |
+                   ((ux & 0x0000ff00) <<  8) |
+                   ((ux & 0x00ff0000) >>  8) |
+                   ((ux & 0xff000000) >> 24));
+  }
+
+  // Byte swap a 64-bit value
+  static jlong byte_swap(jlong x) {
+    juint lo = (juint) ((julong) x);
+    juint hi = (juint) (((julong) x) >> 32);
+    julong swapped_lo = (julong) ((juint) byte_swap((jint) lo));
+    julong swapped_hi = (julong) ((juint) byte_swap((jint) hi));
+    return (jlong) ((swapped_lo << 32) | swapped_hi);
+  }
+
+  // Copy and byte swap elements
+  //
+  // <T> - type of element to copy
+  // <D> - copy direction
+  // <is_src_aligned> - true if src argument is aligned to element size
+  // <is_dst_aligned> - true if dst argument is aligned to element size
+  //
+  // <src> - source address
+  // <dst> - destination address
+  // <byte_count> - number of bytes to copy
+  template <typename T, CopyDirection D, bool is_src_aligned, bool is_dst_aligned>
+  static void do_conjoint_swap(address src, address dst, size_t byte_count) {
+    address cur_src, cur_dst;
+
+    switch (D) {
+    case RIGHT:
+      cur_src = src;
+      cur_dst = dst;
+      break;
+    case LEFT:
+      cur_src = src + byte_count - sizeof(T);
+      cur_dst = dst + byte_count - sizeof(T);
+      break;
+    }
+
+    for (size_t i = 0; i < byte_count / sizeof(T); i++) {
+      T tmp;
+
+      if (is_src_aligned) {
+        tmp = *(T*) cur_src;
+      } else {
+        memcpy(&tmp, cur_src, sizeof(T));
+      }
+
+      tmp = byte_swap(tmp);
+
+      if (is_dst_aligned) {
+        *(T*) cur_dst = tmp;
+      } else {
+        memcpy(cur_dst, &tmp, sizeof(T));
+      }
+
+      switch (D) {
+      case RIGHT:
+        cur_src += sizeof(T);
+        cur_dst += sizeof(T);
+        break;
+      case LEFT:
+        cur_src -= sizeof(T);
+        cur_dst -= sizeof(T);
+        break;
+      }
+    }
+  }
+
+  // Copy and byte swap elements
+  //
+  // <T> - type of element to copy
+  // <D> - copy direction
+  //
+  // <src> - source address
+  // <dst> - destination address
+  // <byte_count> - number of bytes to copy
+  template <typename T, CopyDirection D>
+  static void do_conjoint_swap(address src, address dst, size_t byte_count) {
+    if (is_ptr_aligned(src, sizeof(T))) {
+      if (is_ptr_aligned(dst, sizeof(T))) {
+        do_conjoint_swap<T,D,true,true>(src, dst, byte_count);
+      } else {
+        do_conjoint_swap<T,D,true,false>(src, dst, byte_count);
+      }
+    } else {
+      if (is_ptr_aligned(dst, sizeof(T))) {
+        do_conjoint_swap<T,D,false,true>(src, dst, byte_count);
+      } else {
+        do_conjoint_swap<T,D,false,false>(src, dst, byte_count);
+      }
+    }
+  }
+
+  // Copy and byte swap elements
+  //
+  // <D> - copy direction
+  //
+  // <src> - source address
+  // <dst> - destination address
+  // <byte_count> - number of bytes to copy
+  // <elem_size> - size of the elements to copy-swap
+  template <CopyDirection D>
+  static void do_conjoint_swap(address src, address dst, size_t byte_count, size_t elem_size) {
+    switch (elem_size) {
+    case 2: do_conjoint_swap<jshort,D>(src, dst, byte_count); break;
+    case 4: do_conjoint_swap<jint,D>(src, dst, byte_count); break;
+    case 8: do_conjoint_swap<jlong,D>(src, dst, byte_count); break;
+    default:
+      guarantee(false, err_msg("do_conjoint_swap: Invalid elem_size " SIZE_FORMAT "\n", elem_size));
+    }
+  }
+};
+
+void Copy::conjoint_swap(address src, address dst, size_t byte_count, size_t elem_size) {
+  CopySwap::conjoint_swap(src, dst, byte_count, elem_size);
+}
+
 
 // Fill bytes; larger units are filled atomically if everything is aligned.
 void Copy::fill_to_memory_atomic(void* to, size_t size, jubyte value) {
@@ -166,6 +166,12 @@ class Copy : AllStatic {
   // of two which divides all of from, to, and size, whichever is smaller.
   static void conjoint_memory_atomic(void* from, void* to, size_t size);
 
+  // Copy a span of memory, byte swapping each element on the fly.
+  // byte_count must be a multiple of elem_size, which must be 2, 4 or 8.
+  // Elements are transferred atomically when src and dst are both
+  // aligned to elem_size.
+  static void conjoint_swap(address src, address dst, size_t byte_count, size_t elem_size);
+
   // bytes,                 conjoint array, atomic on each byte (not that it matters)
   static void arrayof_conjoint_jbytes(HeapWord* from, HeapWord* to, size_t count) {
     pd_arrayof_conjoint_bytes(from, to, count);
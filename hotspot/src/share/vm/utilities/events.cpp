@@ -37,6 +37,47 @@ EventLog* Events::_logs = NULL;
 StringEventLog* Events::_messages = NULL;
 StringEventLog* Events::_exceptions = NULL;
 StringEventLog* Events::_deopt_messages = NULL;
+StringEventLog* Events::_lock_contention = NULL;
+VMEventLog* Events::_vm_events = NULL;
+
+const char* VMTraceEvent::kind_name() const {
+  switch (_kind) {
+    case SAFEPOINT_BEGIN: return "safepoint begin";
+    case SAFEPOINT_END:   return "safepoint end";
+    case COMPILE_BEGIN:   return "compile begin";
+    case COMPILE_END:     return "compile end";
+    case DEOPT:           return "deopt";
+    case GC_PHASE_BEGIN:  return "gc phase begin";
+    case GC_PHASE_END:    return "gc phase end";
+    default:              return "unknown";
+  }
+}
+
+void VMTraceEvent::print_payload_on(outputStream* out) const {
+  switch (_kind) {
+    case SAFEPOINT_BEGIN:
+    case SAFEPOINT_END:
+      out->print("safepoint_id=" INTPTR_FORMAT, _arg1);
+      break;
+    case COMPILE_BEGIN:
+    case COMPILE_END:
+      out->print("compile_id=" INTPTR_FORMAT " level=" INTPTR_FORMAT,
+                 _arg1, _arg2);
+      break;
+    case DEOPT:
+      out->print("trap_request=" INTPTR_FORMAT " pc=" INTPTR_FORMAT,
+                 _arg1, _arg2);
+      break;
+    case GC_PHASE_BEGIN:
+    case GC_PHASE_END:
+      // GC phase titles are string literals (see GCTraceTime call sites),
+      // so the pointer logged at event time is still valid here.
+      out->print("%s", (const char*) _arg1);
+      break;
+    default:
+      break;
+  }
+}
 
 EventLog::EventLog() {
   // This normally done during bootstrap when we're only single
@@ -66,6 +107,10 @@ void Events::init() {
     _messages = new StringEventLog("Events");
     _exceptions = new StringEventLog("Internal exceptions");
     _deopt_messages = new StringEventLog("Deoptimization events");
+    if (ProfileContendedLocks) {
+      _lock_contention = new StringEventLog("Contended lock events");
+    }
+    _vm_events = new VMEventLog("VM trace events");
   }
 }
 
@@ -28,6 +28,7 @@
 #include "memory/allocation.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.hpp"
+#include "utilities/ticks.hpp"
 #include "utilities/top.hpp"
 #include "utilities/vmError.hpp"
 
@@ -168,6 +169,54 @@ class StringEventLog : public EventLogBase<StringLogMessage> {
 
 };
 
+// A compact, typed event record. Unlike StringLogMessage nothing is
+// formatted when the event is logged; the few raw words below are stored
+// as-is and only rendered when the log is printed, which keeps logging
+// cheap enough for hot paths like safepoint begin/end. The Ticks stamp
+// gives high-resolution timing on top of the coarse per-record timestamp.
+class VMTraceEvent VALUE_OBJ_CLASS_SPEC {
+ public:
+  enum Kind {
+    NO_EVENT = 0,
+    SAFEPOINT_BEGIN,
+    SAFEPOINT_END,
+    COMPILE_BEGIN,
+    COMPILE_END,
+    DEOPT,
+    GC_PHASE_BEGIN,
+    GC_PHASE_END
+  };
+
+  jlong    _ticks;        // Ticks::now() at logging time
+  intptr_t _arg1;         // payload, interpretation depends on _kind
+  intptr_t _arg2;
+  u1       _kind;
+
+  const char* kind_name() const;
+  void print_payload_on(outputStream* out) const;
+};
+
+// A ring of fixed size typed records.
+class VMEventLog : public EventLogBase<VMTraceEvent> {
+ public:
+  VMEventLog(const char* name, int count = LogEventsBufferEntries) :
+    EventLogBase<VMTraceEvent>(name, count) {}
+
+  void log(Thread* thread, VMTraceEvent::Kind kind, intptr_t arg1, intptr_t arg2) {
+    if (!should_log()) return;
+
+    double timestamp = fetch_timestamp();
+    jlong ticks = Ticks::now().value();
+    MutexLockerEx ml(&_mutex, Mutex::_no_safepoint_check_flag);
+    int index = compute_log_index();
+    _records[index].thread = thread;
+    _records[index].timestamp = timestamp;
+    _records[index].data._kind = (u1) kind;
+    _records[index].data._ticks = ticks;
+    _records[index].data._arg1 = arg1;
+    _records[index].data._arg2 = arg2;
+  }
+};
 
 
 class Events : AllStatic {
@@ -186,6 +235,12 @@ class Events : AllStatic {
   // Deoptization related messages
   static StringEventLog* _deopt_messages;
 
+  // Contended monitor enter records (-XX:+ProfileContendedLocks)
+  static StringEventLog* _lock_contention;
+
+  // Typed records for safepoints, compiles, deopts and GC phases
+  static VMEventLog* _vm_events;
+
  public:
   static void print_all(outputStream* out);
 
@@ -200,6 +255,13 @@ class Events : AllStatic {
 
   static void log_deopt_message(Thread* thread, const char* format, ...);
 
+  // Log a contended monitor enter
+  static void log_lock_contention(Thread* thread, const char* format, ...);
+
+  // Log a typed VM event; no formatting happens at logging time
+  static void log_vm_event(Thread* thread, VMTraceEvent::Kind kind,
+                           intptr_t arg1 = 0, intptr_t arg2 = 0);
+
   // Register default loggers
   static void init();
 };
@@ -232,6 +294,22 @@ inline void Events::log_deopt_message(Thread* thread, const char* format, ...) {
   }
 }
 
+inline void Events::log_lock_contention(Thread* thread, const char* format, ...) {
+  if (LogEvents && _lock_contention != NULL) {
+    va_list ap;
+    va_start(ap, format);
+    _lock_contention->logv(thread, format, ap);
+    va_end(ap);
+  }
+}
+
+inline void Events::log_vm_event(Thread* thread, VMTraceEvent::Kind kind,
+                                 intptr_t arg1, intptr_t arg2) {
+  if (LogEvents && _vm_events != NULL) {
+    _vm_events->log(thread, kind, arg1, arg2);
+  }
+}
+
 
 template <class T>
 inline void EventLogBase<T>::print_log_on(outputStream* out) {
@@ -276,6 +354,14 @@ inline void EventLogBase<StringLogMessage>::print(outputStream* out, StringLogMe
   out->cr();
 }
 
+// Implement a printing routine for the VMTraceEvent
+template <>
+inline void EventLogBase<VMTraceEvent>::print(outputStream* out, VMTraceEvent& e) {
+  out->print("%-15s ticks=" JLONG_FORMAT " ", e.kind_name(), e._ticks);
+  e.print_payload_on(out);
+  out->cr();
+}
+
 // Place markers for the beginning and end up of a set of events.
 // These end up in the default log.
 class EventMark : public StackObj {
@@ -88,6 +88,8 @@ class GenericGrowableArray : public ResourceObj {
                         //   otherwise, allocate in _arena
 
   MEMFLAGS   _memflags;   // memory type if allocation in C heap
+  bool   _inline_storage; // initial element storage is embedded in a
+                          // subclass object and must never be freed
 
 #ifdef ASSERT
   int    _nesting;      // resource area nesting at creation
@@ -109,6 +111,7 @@ class GenericGrowableArray : public ResourceObj {
     _len = initial_len;
     _max = initial_size;
     _memflags = flags;
+    _inline_storage = false;
 
     // memory type has to be specified for C heap allocation
     assert(!(c_heap && flags == mtNone), "memory type not specified for C heap object");
@@ -130,6 +133,7 @@ class GenericGrowableArray : public ResourceObj {
     assert(_len >= 0 && _len <= _max, "initial_len too big");
     _arena = arena;
     _memflags = mtNone;
+    _inline_storage = false;
 
     assert(on_arena(), "arena has taken on reserved value 0 or 1");
     // Relax next assert to allow object allocation on resource area,
@@ -147,6 +151,18 @@ class GenericGrowableArray : public ResourceObj {
   }
 };
 
+// Element moving for GrowableArray growth.  Pointer elements are
+// bitwise copyable and move with a single memcpy; other element types
+// go through their copy constructors one at a time.
+template<class E> inline void growable_array_move(E* dst, E* src, int length) {
+  for (int i = 0; i < length; i++) ::new ((void*)&dst[i]) E(src[i]);
+}
+template<class E> inline void growable_array_move(E** dst, E** src, int length) {
+  if (length > 0) {
+    memcpy(dst, src, length * sizeof(E*));
+  }
+}
+
 template<class E> class GrowableArray : public GenericGrowableArray {
   friend class VMStructs;
 
@@ -156,6 +172,17 @@ template<class E> class GrowableArray : public GenericGrowableArray {
   void grow(int j);
   void raw_at_put_grow(int i, const E& p, const E& fill);
   void  clear_and_deallocate();
+
+ protected:
+  // For SmallGrowableArray: the first initial_size elements live in
+  // caller-supplied storage instead of being allocated.
+  GrowableArray(E* data, int initial_size, bool C_heap, MEMFLAGS F)
+    : GenericGrowableArray(initial_size, 0, C_heap, F) {
+    _data = data;
+    _inline_storage = true;
+    for (int i = 0; i < _max; i++) ::new ((void*)&_data[i]) E();
+  }
+
  public:
   GrowableArray(Thread* thread, int initial_size) : GenericGrowableArray(initial_size, 0, false) {
     _data = (E*)raw_allocate(thread, sizeof(E));
@@ -371,13 +398,13 @@ template<class E> void GrowableArray<E>::grow(int j) {
     while (j >= _max) _max = _max*2;
     // j < _max
     E* newData = (E*)raw_allocate(sizeof(E));
-    int i = 0;
-    for (     ; i < _len; i++) ::new ((void*)&newData[i]) E(_data[i]);
-    for (     ; i < _max; i++) ::new ((void*)&newData[i]) E();
-    for (i = 0; i < old_max; i++) _data[i].~E();
-    if (on_C_heap() && _data != NULL) {
+    growable_array_move(newData, _data, _len);
+    for (int i = _len; i < _max; i++) ::new ((void*)&newData[i]) E();
+    for (int i = 0; i < old_max; i++) _data[i].~E();
+    if (on_C_heap() && _data != NULL && !_inline_storage) {
       FreeHeap(_data);
     }
+    _inline_storage = false;
     _data = newData;
 }
 
@@ -400,11 +427,29 @@ template<class E> void GrowableArray<E>::clear_and_deallocate() {
     clear();
     if (_data != NULL) {
       for (int i = 0; i < _max; i++) _data[i].~E();
-      FreeHeap(_data);
+      if (!_inline_storage) {
+        FreeHeap(_data);
+      }
       _data = NULL;
     }
 }
 
+// A GrowableArray whose first N elements are stored inside the object
+// itself, so arrays that never exceed N elements do no allocation at
+// all, and arrays that do exceed N skip the early doubling steps.  On
+// the first growth past N the elements move into ordinary
+// GrowableArray storage, the embedded buffer lies fallow, and the
+// array behaves like a plain GrowableArray from then on.  The buffer
+// is word aligned, which suits pointer and word-sized elements; do not
+// use this class for element types with stricter alignment.
+template<class E, int N> class SmallGrowableArray : public GrowableArray<E> {
+ private:
+  intptr_t _inline_data[(N * sizeof(E) + sizeof(intptr_t) - 1) / sizeof(intptr_t)];
+ public:
+  SmallGrowableArray(bool C_heap = false, MEMFLAGS F = mtInternal)
+    : GrowableArray<E>((E*)_inline_data, N, C_heap, F) { }
+};
+
 template<class E> void GrowableArray<E>::print() {
     tty->print("Growable Array " INTPTR_FORMAT, this);
     tty->print(": length %ld (_max %ld) { ", _len, _max);
@@ -93,6 +93,17 @@ template <MEMFLAGS F> bool BasicHashtable<F>::check_rehash_table(int count) {
   return false;
 }
 
+// Check if the average bucket length has passed the growth trigger.  The
+// caller sets a flag so the table is grown at the next safepoint.  The
+// trigger is deliberately high: these tables are expected to run dense and
+// growth copies every bucket pointer, so it should only fire when a
+// mis-sized table is really hurting lookups.
+
+template <MEMFLAGS F> bool BasicHashtable<F>::check_resize_table() {
+  return table_size() < (int)resize_max_size &&
+         number_of_entries() > table_size() * (int)resize_load_trigger;
+}
+
 template <class T, MEMFLAGS F> jint Hashtable<T, F>::_seed = 0;
 
 // Create a new table and using alternate hash code, populate the new table
@@ -141,6 +152,41 @@ template <class T, MEMFLAGS F> void Hashtable<T, F>::move_to(Hashtable<T, F>* ne
   BasicHashtable<F>::free_buckets();
 }
 
+// Move the elements into a table with a different number of buckets.
+// Unlike move_to() this keeps the existing hash values, so it does not
+// depend on the literals being rehashable; only the bucket indices are
+// recomputed. Called at a safepoint.
+
+template <class T, MEMFLAGS F> void Hashtable<T, F>::resize_to(Hashtable<T, F>* new_table) {
+  int saved_entry_count = this->number_of_entries();
+
+  for (int i = 0; i < this->table_size(); ++i) {
+    for (HashtableEntry<T, F>* p = bucket(i); p != NULL; ) {
+      HashtableEntry<T, F>* next = p->next();
+      int index = new_table->hash_to_index(p->hash());
+      // Keep the shared bit in the Hashtable entry to indicate that this entry
+      // can't be deleted.   The shared bit is the LSB in the _next field so
+      // walking the hashtable past these entries requires
+      // BasicHashtableEntry::make_ptr() call.
+      bool keep_shared = p->is_shared();
+      this->unlink_entry(p);
+      new_table->add_entry(index, p);
+      if (keep_shared) {
+        p->set_shared();
+      }
+      p = next;
+    }
+  }
+  // give the new table the free list as well
+  new_table->copy_freelist(this);
+  assert(new_table->number_of_entries() == saved_entry_count, "lost entry on table resize?");
+
+  // Destroy memory used by the buckets in the hashtable.  The memory
+  // for the elements has been used in a new table and is not
+  // destroyed.
+  BasicHashtable<F>::free_buckets();
+}
+
 template <MEMFLAGS F> void BasicHashtable<F>::free_buckets() {
   if (NULL != _buckets) {
     // Don't delete the buckets in the shared space.  They aren't
@@ -258,6 +304,8 @@ template <class T, MEMFLAGS F> int Hashtable<T, F>::literal_size(oop oop) {
 template <class T, MEMFLAGS F> void Hashtable<T, F>::dump_table(outputStream* st, const char *table_name) {
   NumberSeq summary;
   int literal_bytes = 0;
+  const int histogram_size = 16;  // last slot counts all longer chains
+  int chain_histogram[histogram_size] = {0};
   for (int i = 0; i < this->table_size(); ++i) {
     int count = 0;
     for (HashtableEntry<T, F>* e = bucket(i);
@@ -266,6 +314,7 @@ template <class T, MEMFLAGS F> void Hashtable<T, F>::dump_table(outputStream* st
       literal_bytes += literal_size(e->literal());
     }
     summary.add((double)count);
+    chain_histogram[MIN2(count, histogram_size - 1)]++;
   }
   double num_buckets = summary.num();
   double num_entries = summary.sum();
@@ -287,6 +336,13 @@ template <class T, MEMFLAGS F> void Hashtable<T, F>::dump_table(outputStream* st
   st->print_cr("Variance of bucket size : %9.3f", summary.variance());
   st->print_cr("Std. dev. of bucket size: %9.3f", summary.sd());
   st->print_cr("Maximum bucket size     : %9d", (int)summary.maximum());
+  st->print_cr("Bucket size histogram   :");
+  for (int len = 0; len < histogram_size; len++) {
+    if (chain_histogram[len] > 0) {
+      st->print_cr("  size %2d%s             : %9d buckets",
+                   len, (len == histogram_size - 1) ? "+" : " ", chain_histogram[len]);
+    }
+  }
 }
 
 
@@ -180,7 +180,9 @@ protected:
 
   enum {
     rehash_count = 100,
-    rehash_multiple = 60
+    rehash_multiple = 60,
+    resize_load_trigger = 8,          // average bucket length that triggers growth
+    resize_max_size = 16*1024*1024    // don't grow past this many buckets
   };
 
   void initialize(int table_size, int entry_size, int number_of_entries);
@@ -200,6 +202,9 @@ protected:
   // Check that the table is unbalanced
   bool check_rehash_table(int count);
 
+  // Check that the table is overloaded and should grow at the next safepoint
+  bool check_resize_table();
+
   // Used when moving the entry to another table
   // Clean up links, but do not add to free_list
   void unlink_entry(BasicHashtableEntry<F>* entry) {
@@ -279,6 +284,10 @@ protected:
 
   // Function to move these elements into the new table.
   void move_to(Hashtable<T, F>* new_table);
+
+  // Function to move these elements into a table with a different number
+  // of buckets, keeping the existing hash values.
+  void resize_to(Hashtable<T, F>* new_table);
   static bool use_alternate_hashcode()  { return _seed != 0; }
   static jint seed()                    { return _seed; }
 
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_MPMCBOUNDEDQUEUE_HPP
+#define SHARE_VM_UTILITIES_MPMCBOUNDEDQUEUE_HPP
+
+#include "memory/allocation.hpp"
+#include "memory/padded.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
+
+// A bounded multi-producer, multi-consumer queue that takes no lock on
+// either side.  Every slot carries a sequence number: a producer claims
+// the slot at the enqueue position with a CAS on that position and then
+// publishes the element by bumping the slot's sequence, and consumers
+// mirror this on the dequeue side.  Threads therefore contend only on
+// the two position counters, which are kept a cache line apart so that
+// producers and consumers do not invalidate each other's lines.
+//
+// push() and pop() never block and never wait for a full or empty
+// queue: they return false instead and the caller falls back to its
+// slower, locked path.  This keeps the queue usable as a fast front end
+// in front of an existing lock-protected structure.  The capacity is
+// fixed at construction and must be a power of two.  Elements are
+// stored by value; E is expected to be a pointer or similarly small
+// type.
+
+template <class E, MEMFLAGS F>
+class MPMCBoundedQueue : public CHeapObj<F> {
+ private:
+  struct Slot {
+    volatile intptr_t _sequence;
+    E                 _element;
+  };
+
+  Slot*             _slots;
+  intptr_t          _mask;
+  char              _pad0[DEFAULT_CACHE_LINE_SIZE];
+  volatile intptr_t _enqueue_pos;
+  char              _pad1[DEFAULT_CACHE_LINE_SIZE];
+  volatile intptr_t _dequeue_pos;
+  char              _pad2[DEFAULT_CACHE_LINE_SIZE];
+
+ public:
+  MPMCBoundedQueue(int capacity) {
+    assert(capacity >= 2 && is_power_of_2(capacity),
+           "capacity must be a power of two");
+    _slots = NEW_C_HEAP_ARRAY(Slot, capacity, F);
+    for (int i = 0; i < capacity; i++) {
+      _slots[i]._sequence = (intptr_t)i;
+    }
+    _mask        = capacity - 1;
+    _enqueue_pos = 0;
+    _dequeue_pos = 0;
+  }
+
+  ~MPMCBoundedQueue() {
+    FREE_C_HEAP_ARRAY(Slot, _slots, F);
+  }
+
+  int capacity() const { return (int)(_mask + 1); }
+
+  // Append an element; returns false if the queue is full.
+  bool push(E element) {
+    intptr_t pos = _enqueue_pos;
+    while (true) {
+      Slot* slot = &_slots[pos & _mask];
+      intptr_t seq = OrderAccess::load_ptr_acquire(&slot->_sequence);
+      intptr_t dif = seq - pos;
+      if (dif == 0) {
+        // The slot is free for this lap; try to claim it.
+        if (Atomic::cmpxchg_ptr(pos + 1, &_enqueue_pos, pos) == pos) {
+          slot->_element = element;
+          // Publish: from here on a consumer may pop the slot.
+          OrderAccess::release_store_ptr(&slot->_sequence, pos + 1);
+          return true;
+        }
+        pos = _enqueue_pos;  // lost the claiming race; reread and retry
+      } else if (dif < 0) {
+        return false;        // the slot is a full lap behind: queue is full
+      } else {
+        pos = _enqueue_pos;  // another producer advanced past this slot
+      }
+    }
+  }
+
+  // Remove the oldest element; returns false if the queue is empty.
+  bool pop(E* element) {
+    intptr_t pos = _dequeue_pos;
+    while (true) {
+      Slot* slot = &_slots[pos & _mask];
+      intptr_t seq = OrderAccess::load_ptr_acquire(&slot->_sequence);
+      intptr_t dif = seq - (pos + 1);
+      if (dif == 0) {
+        if (Atomic::cmpxchg_ptr(pos + 1, &_dequeue_pos, pos) == pos) {
+          *element = slot->_element;
+          // Recycle: a producer may reuse the slot on the next lap.
+          OrderAccess::release_store_ptr(&slot->_sequence, pos + _mask + 1);
+          return true;
+        }
+        pos = _dequeue_pos;  // lost the claiming race; reread and retry
+      } else if (dif < 0) {
+        return false;        // the slot is not yet published: queue is empty
+      } else {
+        pos = _dequeue_pos;  // another consumer advanced past this slot
+      }
+    }
+  }
+
+  // A momentary snapshot; only advisory under concurrent access.
+  bool is_empty() const {
+    return _dequeue_pos == _enqueue_pos;
+  }
+};
+
+#endif // SHARE_VM_UTILITIES_MPMCBOUNDEDQUEUE_HPP
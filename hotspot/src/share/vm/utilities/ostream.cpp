@@ -26,6 +26,8 @@
 #include "compiler/compileLog.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/task.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/top.hpp"
@@ -350,6 +352,70 @@ char* stringStream::as_string() {
 
 stringStream::~stringStream() {}
 
+segmentedStream::segmentedStream(size_t initial_segment_size) : outputStream() {
+  _first = NULL;
+  _current = NULL;
+  _size = 0;
+  _next_segment_size = initial_segment_size;
+  DEBUG_ONLY(rm = Thread::current()->current_resource_mark();)
+}
+
+segmentedStream::Segment* segmentedStream::new_segment(size_t min_size) {
+  assert(rm == NULL || Thread::current()->current_resource_mark() == rm,
+         "segmentedStream is grown with a different ResourceMark");
+  size_t data_size = MAX2(_next_segment_size, min_size);
+  // Segment sizes double up to a cap, so long output needs few segments
+  // while short output stays small.
+  if (_next_segment_size < 64*K) {
+    _next_segment_size *= 2;
+  }
+  char* mem = NEW_RESOURCE_ARRAY(char, sizeof(Segment) + data_size);
+  Segment* seg = (Segment*)mem;
+  seg->_next   = NULL;
+  seg->_length = data_size;
+  seg->_used   = 0;
+  seg->_data   = mem + sizeof(Segment);
+  return seg;
+}
+
+void segmentedStream::write(const char* s, size_t len) {
+  size_t written = 0;
+  while (written < len) {
+    if (_current == NULL || _current->_used == _current->_length) {
+      Segment* seg = new_segment(len - written);
+      if (_current != NULL) {
+        _current->_next = seg;
+      } else {
+        _first = seg;
+      }
+      _current = seg;
+    }
+    size_t n = MIN2(len - written, _current->_length - _current->_used);
+    memcpy(_current->_data + _current->_used, s + written, n);
+    _current->_used += n;
+    written += n;
+  }
+  _size += len;
+  update_position(s, len);
+}
+
+void segmentedStream::copy_to(outputStream* st) const {
+  for (Segment* seg = _first; seg != NULL; seg = seg->_next) {
+    st->write(seg->_data, seg->_used);
+  }
+}
+
+char* segmentedStream::as_string() const {
+  char* copy = NEW_RESOURCE_ARRAY(char, _size + 1);
+  size_t pos = 0;
+  for (Segment* seg = _first; seg != NULL; seg = seg->_next) {
+    memcpy(copy + pos, seg->_data, seg->_used);
+    pos += seg->_used;
+  }
+  copy[pos] = 0;  // terminating null
+  return copy;
+}
+
 xmlStream*   xtty;
 outputStream* tty;
 outputStream* gclog_or_tty;
@@ -599,6 +665,91 @@ void fdStream::write(const char* s, size_t len) {
   update_position(s, len);
 }
 
+// Asynchronous backend for the gc log.  The gc log is written by the
+// VMThread, mostly inside safepoints, so a slow or syncing disk extends
+// the pause by the write time.  With -XX:+UseAsyncGCLog the VMThread only
+// copies the bytes into a staging buffer under a brief lock and the
+// WatcherThread drains the buffer to disk from a periodic task.  When
+// the buffer is full the bytes are dropped and accounted rather than
+// blocking the pause; the drop count is reported in the log as soon as
+// the drain catches up.
+
+extern Mutex* AsyncGCLog_lock;
+
+class AsyncGCLogDrainTask : public PeriodicTask {
+ private:
+  gcLogFileStream* _stream;
+ public:
+  AsyncGCLogDrainTask(gcLogFileStream* stream)
+    : PeriodicTask(50), _stream(stream) {}
+  virtual void task() { _stream->drain_staged_bytes(); }
+};
+
+void gcLogFileStream::stage(const char* s, size_t len) {
+  MutexLockerEx ml(AsyncGCLog_lock, Mutex::_no_safepoint_check_flag);
+  if (_staging_pos + len > (size_t)AsyncGCLogBufferSize) {
+    _staging_dropped += len;
+    return;
+  }
+  memcpy(_staging_buf[_staging_cur] + _staging_pos, s, len);
+  _staging_pos += len;
+  _bytes_written += len;
+}
+
+void gcLogFileStream::drain_staged_bytes() {
+  char*  buf;
+  size_t len;
+  size_t dropped;
+  {
+    MutexLockerEx ml(AsyncGCLog_lock, Mutex::_no_safepoint_check_flag);
+    if (_io_in_progress) {
+      return;                 // a previous drain is still writing
+    }
+    len     = _staging_pos;
+    dropped = _staging_dropped;
+    if (len == 0 && dropped == 0) {
+      return;
+    }
+    buf = _staging_buf[_staging_cur];
+    _staging_cur     = 1 - _staging_cur;
+    _staging_pos     = 0;
+    _staging_dropped = 0;
+    _io_in_progress  = true;
+  }
+  // Write outside the lock so a stalled disk never blocks staging.
+  if (len > 0) {
+    size_t count = fwrite(buf, 1, len, _file);
+  }
+  if (dropped > 0) {
+    char msg[128];
+    jio_snprintf(msg, sizeof(msg),
+                 "[" SIZE_FORMAT " bytes of gc log dropped: staging buffer full]\n",
+                 dropped);
+    size_t count = fwrite(msg, 1, strlen(msg), _file);
+  }
+  fflush(_file);
+  _io_in_progress = false;
+}
+
+// Wait until every staged byte has reached the file.  Called before log
+// rotation and from the destructor; new output is not staged concurrently
+// since all gc log writers run on the calling thread by then.
+void gcLogFileStream::sync_staged_bytes() {
+  if (!_staging_active) {
+    return;
+  }
+  while (true) {
+    drain_staged_bytes();
+    {
+      MutexLockerEx ml(AsyncGCLog_lock, Mutex::_no_safepoint_check_flag);
+      if (!_io_in_progress && _staging_pos == 0 && _staging_dropped == 0) {
+        return;
+      }
+    }
+    os::yield();              // the WatcherThread is mid-write; let it finish
+  }
+}
+
 // dump vm version, os version, platform info, build id,
 // memory usage and command line flags into header
 void gcLogFileStream::dump_loggc_header() {
@@ -611,6 +762,18 @@ void gcLogFileStream::dump_loggc_header() {
 }
 
 gcLogFileStream::~gcLogFileStream() {
+  if (_staging_active) {
+    sync_staged_bytes();
+    _staging_active = false;
+    _drain_task->disenroll();
+    delete _drain_task;
+    _drain_task = NULL;
+  }
+  if (_staging_buf[0] != NULL) {
+    FREE_C_HEAP_ARRAY(char, _staging_buf[0], mtInternal);
+    FREE_C_HEAP_ARRAY(char, _staging_buf[1], mtInternal);
+    _staging_buf[0] = _staging_buf[1] = NULL;
+  }
   if (_file != NULL) {
     if (_need_close) fclose(_file);
     _file = NULL;
@@ -624,6 +787,13 @@ gcLogFileStream::~gcLogFileStream() {
 gcLogFileStream::gcLogFileStream(const char* file_name) {
   _cur_file_num = 0;
   _bytes_written = 0L;
+  _staging_buf[0] = _staging_buf[1] = NULL;
+  _staging_pos = 0;
+  _staging_dropped = 0;
+  _staging_cur = 0;
+  _staging_active = false;
+  _io_in_progress = false;
+  _drain_task = NULL;
   _file_name = make_log_name(file_name, NULL);
 
   // gc log file rotation
@@ -637,6 +807,13 @@ gcLogFileStream::gcLogFileStream(const char* file_name) {
   if (_file != NULL) {
     _need_close = true;
     dump_loggc_header();
+    if (UseAsyncGCLog) {
+      // Staging starts on the first write after VM initialization; the
+      // stream is created before the mutexes and the WatcherThread
+      // machinery exist, so the drain task cannot be enrolled yet.
+      _staging_buf[0] = NEW_C_HEAP_ARRAY(char, AsyncGCLogBufferSize, mtInternal);
+      _staging_buf[1] = NEW_C_HEAP_ARRAY(char, AsyncGCLogBufferSize, mtInternal);
+    }
   } else {
     warning("Cannot open file %s due to %s\n", _file_name, strerror(errno));
     _need_close = false;
@@ -645,8 +822,21 @@ gcLogFileStream::gcLogFileStream(const char* file_name) {
 
 void gcLogFileStream::write(const char* s, size_t len) {
   if (_file != NULL) {
-    size_t count = fwrite(s, 1, len, _file);
-    _bytes_written += count;
+    if (!_staging_active && _staging_buf[0] != NULL &&
+        PeriodicTask_lock != NULL && AsyncGCLog_lock != NULL) {
+      // First write with the VM far enough along to run the drain task.
+      // All gc log output comes from the thread initializing the VM and
+      // later the VMThread, so this activation does not race.
+      _drain_task = new AsyncGCLogDrainTask(this);
+      _drain_task->enroll();
+      _staging_active = true;
+    }
+    if (_staging_active) {
+      stage(s, len);
+    } else {
+      size_t count = fwrite(s, 1, len, _file);
+      _bytes_written += count;
+    }
   }
   update_position(s, len);
 }
@@ -675,6 +865,16 @@ void gcLogFileStream::rotate_log() {
          (thread->is_VM_thread() && SafepointSynchronize::is_at_safepoint()),
          "Must be VMThread at safepoint");
 #endif
+
+  // Flush the staged bytes and write directly for the duration of the
+  // rotation so the rewind/rename/reopen below never races with the
+  // drain task.
+  bool was_staging = _staging_active;
+  if (was_staging) {
+    sync_staged_bytes();
+    _staging_active = false;
+  }
+
   if (NumberOfGCLogFiles == 1) {
     // rotate in same file
     rewind();
@@ -683,6 +883,7 @@ void gcLogFileStream::rotate_log() {
                  _file_name, os::local_time_string((char *)time_str, sizeof(time_str)));
     write(time_msg, strlen(time_msg));
     dump_loggc_header();
+    _staging_active = was_staging;
     return;
   }
 
@@ -763,6 +964,7 @@ void gcLogFileStream::rotate_log() {
     _need_close = false;
     FLAG_SET_DEFAULT(UseGCLogFileRotation, false);
   }
+  _staging_active = was_staging && _file != NULL;
 }
 
 defaultStream* defaultStream::instance = NULL;
@@ -191,6 +191,36 @@ class stringStream : public outputStream {
   char* as_string();
 };
 
+// A stream that accumulates output in a chain of resource-allocated
+// segments.  Unlike stringStream it never reallocates and copies what
+// has already been written: on overflow it just links a new, larger
+// segment.  Use it to build up sizable output under a lock or in a
+// timed phase and hand it on with copy_to() or as_string().
+class segmentedStream : public outputStream {
+ private:
+  struct Segment {
+    Segment* _next;
+    size_t   _length;           // capacity of _data
+    size_t   _used;             // bytes written so far
+    char*    _data;             // points just past this header
+  };
+  Segment* _first;
+  Segment* _current;
+  size_t   _size;               // total bytes written
+  size_t   _next_segment_size;
+  DEBUG_ONLY(ResourceMark* rm;)
+
+  Segment* new_segment(size_t min_size);
+ public:
+  segmentedStream(size_t initial_segment_size = 1*K);
+  virtual void write(const char* c, size_t len);
+  size_t size() const { return _size; }
+  // Write everything accumulated to another stream, segment by segment.
+  void copy_to(outputStream* st) const;
+  // Join the segments into one resource-allocated, null-terminated string.
+  char* as_string() const;
+};
+
 class fileStream : public outputStream {
  protected:
   FILE* _file;
@@ -231,17 +261,31 @@ class fdStream : public outputStream {
   void flush() {};
 };
 
+class PeriodicTask;
+
 class gcLogFileStream : public fileStream {
  protected:
   const char*  _file_name;
   jlong  _bytes_written;
   uintx  _cur_file_num;             // current logfile rotation number, from 0 to NumberOfGCLogFiles-1
+  // Asynchronous staging state, used with -XX:+UseAsyncGCLog
+  char*  _staging_buf[2];           // double buffer; the filling side swaps at each drain
+  size_t _staging_pos;              // bytes staged in the filling buffer
+  size_t _staging_dropped;          // bytes dropped while the buffer was full
+  int    _staging_cur;              // index of the buffer being filled
+  bool   _staging_active;           // stage writes instead of writing directly
+  volatile bool _io_in_progress;    // a drain is writing outside the lock
+  PeriodicTask* _drain_task;
+
+  void stage(const char* s, size_t len);
  public:
   gcLogFileStream(const char* file_name);
   ~gcLogFileStream();
   virtual void write(const char* c, size_t len);
   virtual void rotate_log();
   void dump_loggc_header();
+  void drain_staged_bytes();        // called from the WatcherThread task
+  void sync_staged_bytes();         // wait until the file is up to date
 };
 
 #ifndef PRODUCT
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_PARALLELSORT_HPP
+#define SHARE_VM_UTILITIES_PARALLELSORT_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/quickSort.hpp"
+#include "utilities/workgroup.hpp"
+
+// Parallel merge sort on a work gang, for large sorts performed inside
+// GC pauses.  The array is split into one run per active worker; the
+// workers quicksort their runs in parallel, then merge pairs of runs in
+// parallel rounds, doubling the run width each round, until one sorted
+// run remains.  Workers claim runs and merge pairs from an atomic
+// counter, so uneven run costs balance out.
+//
+// The comparator has the QuickSort contract: a function taking two
+// elements and returning -1, 0 or 1.  The merge takes the left element
+// on ties, so the merge rounds preserve relative order (the initial
+// quicksort of each run is not stable).
+//
+// Sorting needs a scratch array of the same length, taken from the C
+// heap for the duration of the sort.  Callers with small arrays or no
+// gang fall back to the serial quicksort automatically.
+
+template<class T, class C>
+class ParallelSortTask : public AbstractGangTask {
+ private:
+  T*            _src;
+  T*            _dst;
+  size_t        _length;
+  size_t        _width;       // current run width
+  C             _comparator;
+  bool          _idempotent;
+  bool          _merging;     // false: quicksort runs; true: merge pairs of runs
+  volatile jint _claim;       // next run (or pair of runs) to claim
+
+  // Merge the sorted runs [lo, mid) and [mid, hi) of _src into _dst.
+  void merge(size_t lo, size_t mid, size_t hi) {
+    size_t i = lo;
+    size_t j = mid;
+    for (size_t k = lo; k < hi; k++) {
+      if (i < mid && (j >= hi || _comparator(_src[i], _src[j]) != 1)) {
+        _dst[k] = _src[i++];
+      } else {
+        _dst[k] = _src[j++];
+      }
+    }
+  }
+
+ public:
+  ParallelSortTask(T* array, T* scratch, size_t length, size_t run_width,
+                   C comparator, bool idempotent) :
+    AbstractGangTask("ParallelSortTask"),
+    _src(array), _dst(scratch), _length(length), _width(run_width),
+    _comparator(comparator), _idempotent(idempotent),
+    _merging(false), _claim(0) { }
+
+  // The array holding the result once all rounds have run.  Each merge
+  // round writes into _dst and the arrays only swap at the start of the
+  // following round, so after the last round the result is in _dst.
+  T* result() const { return _merging ? _dst : _src; }
+
+  // Advance to the next merge round.  The first call switches from run
+  // sorting to merging; later calls double the run width and swap the
+  // source and destination arrays, since each round's output is the
+  // next round's input.  Called between run_task invocations only,
+  // never concurrently with workers.
+  void next_round() {
+    if (!_merging) {
+      _merging = true;
+    } else {
+      _width *= 2;
+      T* tmp = _src;
+      _src = _dst;
+      _dst = tmp;
+    }
+    _claim = 0;
+  }
+
+  virtual void work(uint worker_id) {
+    while (true) {
+      size_t n = (size_t)(Atomic::add(1, &_claim) - 1);
+      if (!_merging) {
+        size_t lo = n * _width;
+        if (lo >= _length) {
+          return;
+        }
+        size_t hi = MIN2(lo + _width, _length);
+        QuickSort::sort(&_src[lo], (int)(hi - lo), _comparator, _idempotent);
+      } else {
+        size_t lo = n * 2 * _width;
+        if (lo >= _length) {
+          return;
+        }
+        size_t mid = MIN2(lo + _width, _length);
+        size_t hi  = MIN2(lo + 2 * _width, _length);
+        merge(lo, mid, hi);
+      }
+    }
+  }
+};
+
+class ParallelSort : AllStatic {
+ private:
+  enum {
+    // Below this length the fork/join overhead outweighs the
+    // parallelism and the serial quicksort is used instead.
+    min_parallel_length = 2048
+  };
+
+ public:
+  template<class T, class C>
+  static void sort(FlexibleWorkGang* gang, T* array, size_t length,
+                   C comparator, bool idempotent) {
+    if (gang == NULL || gang->active_workers() < 2 ||
+        length < (size_t)min_parallel_length) {
+      QuickSort::sort(array, (int)length, comparator, idempotent);
+      return;
+    }
+    size_t n_runs = (size_t)gang->active_workers();
+    size_t run_width = (length + n_runs - 1) / n_runs;
+    T* scratch = NEW_C_HEAP_ARRAY(T, length, mtInternal);
+    ParallelSortTask<T, C> task(array, scratch, length, run_width,
+                                comparator, idempotent);
+    gang->run_task(&task);      // sort the runs in parallel
+    for (size_t width = run_width; width < length; width *= 2) {
+      task.next_round();
+      gang->run_task(&task);    // merge pairs of runs in parallel
+    }
+    if (task.result() != array) {
+      // The last merge round landed in the scratch array.
+      for (size_t i = 0; i < length; i++) {
+        array[i] = task.result()[i];
+      }
+    }
+    FREE_C_HEAP_ARRAY(T, scratch, mtInternal);
+  }
+};
+
+#endif // SHARE_VM_UTILITIES_PARALLELSORT_HPP
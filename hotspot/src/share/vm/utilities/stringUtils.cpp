@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "utilities/stringUtils.hpp"
+
+#ifdef _LP64
+static const uintptr_t byte_ones  = UCONST64(0x0101010101010101);
+static const uintptr_t byte_highs = UCONST64(0x8080808080808080);
+#else
+static const uintptr_t byte_ones  = 0x01010101;
+static const uintptr_t byte_highs = 0x80808080;
+#endif
+
+// The high bit of each byte of the result is set iff the corresponding
+// byte of w is zero (the usual word-wide zero-byte test).
+static inline uintptr_t has_zero_byte(uintptr_t w) {
+  return (w - byte_ones) & ~w & byte_highs;
+}
+
+static inline char fold_ascii_case(char c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c + ('a' - 'A');
+  }
+  return c;
+}
+
+bool StringUtils::equals_ignore_case_ascii(const char* a, const char* b, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (fold_ascii_case(a[i]) != fold_ascii_case(b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static inline bool in_set(char c, const char* chars, int nchars) {
+  for (int i = 0; i < nchars; i++) {
+    if (c == chars[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* StringUtils::find_first_of(const char* s, size_t len, const char* chars, int nchars) {
+  assert(nchars > 0 && nchars <= 8, "set must be small");
+  const char* p = s;
+  const char* end = s + len;
+
+  // Scan byte by byte up to the first word boundary.
+  while (p < end && ((uintptr_t)p & (BytesPerWord - 1)) != 0) {
+    if (in_set(*p, chars, nchars)) {
+      return p;
+    }
+    p++;
+  }
+
+  // Broadcast each byte of the set across a word, then test one word of
+  // the string per step: a byte equals a set member iff the XOR with
+  // its broadcast word has a zero byte.
+  uintptr_t patterns[8];
+  for (int i = 0; i < nchars; i++) {
+    patterns[i] = byte_ones * (uintptr_t)(unsigned char)chars[i];
+  }
+  while (p + BytesPerWord <= end) {
+    uintptr_t w = *(const uintptr_t*)p;
+    uintptr_t hit = 0;
+    for (int i = 0; i < nchars; i++) {
+      hit |= has_zero_byte(w ^ patterns[i]);
+    }
+    if (hit != 0) {
+      break;  // some byte of this word matches; locate it below
+    }
+    p += BytesPerWord;
+  }
+
+  while (p < end) {
+    if (in_set(*p, chars, nchars)) {
+      return p;
+    }
+    p++;
+  }
+  return NULL;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_STRINGUTILS_HPP
+#define SHARE_VM_UTILITIES_STRINGUTILS_HPP
+
+#include "memory/allocation.hpp"
+
+// Helpers for scanning and comparing byte strings.  The scan works a
+// machine word at a time, which is the portable counterpart of the SIMD
+// string kernels: one load and a handful of ALU operations cover
+// BytesPerWord characters.
+class StringUtils : AllStatic {
+ public:
+  // Case-insensitive comparison of two byte strings of the same length,
+  // folding only the ASCII letters 'A'-'Z'/'a'-'z'.  All other bytes,
+  // including UTF8 continuation bytes, must match exactly.  Unlike
+  // strcasecmp this is independent of the process locale.
+  static bool equals_ignore_case_ascii(const char* a, const char* b, size_t len);
+
+  // Returns a pointer to the first byte in s that equals one of the
+  // nchars byte values in chars, or NULL if none occurs.  nchars must
+  // be at most 8.
+  static const char* find_first_of(const char* s, size_t len, const char* chars, int nchars);
+};
+
+#endif // SHARE_VM_UTILITIES_STRINGUTILS_HPP
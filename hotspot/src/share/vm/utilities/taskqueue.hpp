@@ -479,6 +479,8 @@ public:
 
   TASKQUEUE_STATS_ONLY(using taskqueue_t::stats;)
 
+  OverflowTaskQueue() : _overflow_pushes(0) { }
+
   // Push task t onto the queue or onto the overflow stack.  Return true.
   inline bool push(E t);
 
@@ -487,6 +489,13 @@ public:
 
   inline overflow_t* overflow_stack() { return &_overflow_stack; }
 
+  // Number of pushes that spilled to the overflow stack since the last
+  // reset.  Maintained in all builds (unlike TASKQUEUE_STATS) so GC
+  // phase reporting can show overflow behavior in product runs; only
+  // the owning thread pushes, so a plain counter suffices.
+  size_t overflow_pushes() const      { return _overflow_pushes; }
+  void reset_overflow_pushes()        { _overflow_pushes = 0; }
+
   inline bool taskqueue_empty() const { return taskqueue_t::is_empty(); }
   inline bool overflow_empty()  const { return _overflow_stack.is_empty(); }
   inline bool is_empty()        const {
@@ -495,6 +504,7 @@ public:
 
 private:
   overflow_t _overflow_stack;
+  size_t     _overflow_pushes;
 };
 
 template <class E, MEMFLAGS F, unsigned int N>
@@ -502,6 +512,7 @@ bool OverflowTaskQueue<E, F, N>::push(E t)
 {
   if (!taskqueue_t::push(t)) {
     overflow_stack()->push(t);
+    ++_overflow_pushes;
     TASKQUEUE_STATS_ONLY(stats.record_overflow(overflow_stack()->size()));
   }
   return true;
@@ -93,12 +93,37 @@ char* UTF8::next_character(const char* str, jint* value) {
   return next_ch;
 }
 
+// High (0x80) bit of every byte in a word.  A word of UTF-8 bytes with
+// none of these bits set is pure ASCII and, in particular, contains no
+// 10xxxxxx continuation bytes.
+#ifdef _LP64
+static const uintptr_t ascii_high_bits = UCONST64(0x8080808080808080);
+#else
+static const uintptr_t ascii_high_bits = 0x80808080;
+#endif
+
 // Count bytes of the form 10xxxxxx and deduct this count
 // from the total byte count.  The utf8 string must be in
 // legal form which has been verified in the format checker.
 int UTF8::unicode_length(const char* str, int len) {
   int num_chars = len;
-  for (int i = 0; i < len; i++) {
+  int i = 0;
+  // ASCII fast path: step bytewise up to a word boundary, then skip a
+  // word at a time while no byte has its high bit set.  Class names and
+  // JNI strings are almost always pure ASCII, where this never deducts.
+  if (len >= (int)BytesPerWord) {
+    while (i < len && ((uintptr_t)(str + i) & (BytesPerWord - 1)) != 0) {
+      if ((str[i] & 0xC0) == 0x80) {
+        --num_chars;
+      }
+      i++;
+    }
+    while (i + (int)BytesPerWord <= len &&
+           (*(const uintptr_t*)(str + i) & ascii_high_bits) == 0) {
+      i += BytesPerWord;
+    }
+  }
+  for (; i < len; i++) {
     if ((str[i] & 0xC0) == 0x80) {
       --num_chars;
     }
@@ -151,10 +176,27 @@ void UTF8::convert_to_unicode(const char* utf8_str, jchar* unicode_str, int unic
   int index = 0;
 
   /* ASCII case loop optimization */
-  for (; index < unicode_length; index++) {
-    if((ch = ptr[0]) > 0x7F) { break; }
-    unicode_str[index] = ch;
-    ptr = (const char *)(ptr + 1);
+  // Step bytewise until the source is word aligned, then a word at a
+  // time: a word with no byte high bit set is pure ASCII (the wide
+  // equivalent of testing each byte against 0x7F) and each of its bytes
+  // expands to one jchar.  The first non-ASCII byte drops through to
+  // the character-at-a-time loop below.
+  while (index < unicode_length) {
+    if (((uintptr_t)ptr & (BytesPerWord - 1)) == 0 &&
+        unicode_length - index >= (int)BytesPerWord) {
+      if ((*(const uintptr_t*)ptr & ascii_high_bits) != 0) {
+        break;
+      }
+      for (int i = 0; i < (int)BytesPerWord; i++) {
+        unicode_str[index + i] = (jchar)(unsigned char)ptr[i];
+      }
+      index += BytesPerWord;
+      ptr += BytesPerWord;
+    } else {
+      if ((ch = ptr[0]) > 0x7F) { break; }
+      unicode_str[index++] = ch;
+      ptr = (const char *)(ptr + 1);
+    }
   }
 
   for (; index < unicode_length; index++) {
@@ -663,7 +663,11 @@ void VMError::report(outputStream* st) {
 
      // all threads
      if (_verbose && _thread) {
-       Threads::print_on_error(st, _thread, buf, sizeof(buf));
+       if (reporting_over_budget()) {
+         st->print_cr("(thread listing skipped: ErrorLogTimeout exceeded)");
+       } else {
+         Threads::print_on_error(st, _thread, buf, sizeof(buf));
+       }
        st->cr();
      }
 
@@ -700,7 +704,11 @@ void VMError::report(outputStream* st) {
   STEP(190, "(printing heap information)" )
 
      if (_verbose && Universe::is_fully_initialized()) {
-       Universe::heap()->print_on_error(st);
+       if (reporting_over_budget()) {
+         st->print_cr("(heap information skipped: ErrorLogTimeout exceeded)");
+       } else {
+         Universe::heap()->print_on_error(st);
+       }
        st->cr();
 
        st->print_cr("Polling page: " INTPTR_FORMAT, os::get_polling_page());
@@ -710,8 +718,12 @@ void VMError::report(outputStream* st) {
   STEP(195, "(printing code cache information)" )
 
      if (_verbose && Universe::is_fully_initialized()) {
-       // print code cache information before vm abort
-       CodeCache::print_summary(st);
+       if (reporting_over_budget()) {
+         st->print_cr("(code cache information skipped: ErrorLogTimeout exceeded)");
+       } else {
+         // print code cache information before vm abort
+         CodeCache::print_summary(st);
+       }
        st->cr();
      }
 
@@ -725,8 +737,12 @@ void VMError::report(outputStream* st) {
   STEP(205, "(printing dynamic libraries)" )
 
      if (_verbose) {
-       // dynamic libraries, or memory map
-       os::print_dll_info(st);
+       if (reporting_over_budget()) {
+         st->print_cr("(dynamic libraries skipped: ErrorLogTimeout exceeded)");
+       } else {
+         // dynamic libraries, or memory map
+         os::print_dll_info(st);
+       }
        st->cr();
      }
 
@@ -810,6 +826,19 @@ void VMError::report(outputStream* st) {
 
 VMError* volatile VMError::first_error = NULL;
 volatile jlong VMError::first_error_tid = -1;
+jlong VMError::reporting_start_time = -1;
+
+// Has hs_err composition exceeded ErrorLogTimeout?  This is only checked
+// between report sections; a section that hangs outright cannot be
+// interrupted without a watchdog thread, and no other thread can be
+// trusted in a crashed process.
+bool VMError::reporting_over_budget() {
+  if (ErrorLogTimeout == 0 || reporting_start_time < 0) {
+    return false;
+  }
+  return (os::javaTimeMillis() - reporting_start_time) >
+         (jlong)ErrorLogTimeout * 1000;
+}
 
 // An error could happen before tty is initialized or after it has been
 // destroyed. Here we use a very simple unbuffered fdStream for printing.
@@ -895,6 +924,7 @@ void VMError::report_and_die() {
     // first time
     first_error_tid = mytid;
     set_error_reported();
+    reporting_start_time = os::javaTimeMillis();
 
     if (ShowMessageBoxOnError || PauseAtExit) {
       show_message_box(buffer, sizeof(buffer));
@@ -64,6 +64,10 @@ class VMError : public StackObj {
   static VMError* volatile first_error;
   static volatile jlong    first_error_tid;
 
+  // Millis when error reporting began; bounds the report with ErrorLogTimeout.
+  static jlong             reporting_start_time;
+  static bool reporting_over_budget();
+
   // Core dump status, false if we have been unable to write a core/minidump for some reason
   static bool coredump_status;
 
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test MicroBenchApi
+ * @summary verify that the whitebox microbenchmark kernels run and report sane numbers
+ * @library /testlibrary /testlibrary/whitebox
+ * @build MicroBenchApi
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI MicroBenchApi
+ */
+
+import sun.hotspot.WhiteBox;
+public class MicroBenchApi {
+    public static void main(String... args) {
+        WhiteBox wb = WhiteBox.getWhiteBox();
+        String[] kernels = { "alloc.tlab", "barrier.write", "monitor.enterexit" };
+        for (String kernel : kernels) {
+            long meanNs = wb.runMicroBenchmark(kernel, 10000);
+            System.out.printf("%s: %d ns/op%n", kernel, meanNs);
+            if (meanNs < 0) {
+                throw new RuntimeException(kernel + " reported negative mean: " + meanNs);
+            }
+        }
+        try {
+            wb.runMicroBenchmark("no.such.kernel", 10000);
+            throw new RuntimeException("unknown kernel was not rejected");
+        } catch (IllegalArgumentException expected) {
+        }
+        try {
+            wb.runMicroBenchmark("alloc.tlab", 0);
+            throw new RuntimeException("zero iterations were not rejected");
+        } catch (IllegalArgumentException expected) {
+        }
+    }
+}
@@ -79,6 +79,7 @@ public class WhiteBox {
 
   // G1
   public native boolean g1InConcurrentMark();
+  public native boolean g1StartConcMarkCycle();
   public native boolean g1IsHumongous(Object o);
   public native long    g1NumFreeRegions();
   public native int     g1RegionSize();
@@ -134,6 +135,22 @@ public class WhiteBox {
   }
   public native boolean enqueueMethodForCompilation(Executable method, int compLevel, int entry_bci);
   public native void    clearMethodState(Executable method);
+  public        int     compileMethodAtLevel(Executable method, int compLevel) {
+    return compileMethodAtLevel(method, compLevel, -1 /*InvocationEntryBci*/);
+  }
+  // Compiles method at the given level, waits for a background
+  // compilation to finish and returns the resulting compilation level
+  // (CompLevel_none if the compilation failed).
+  public native int     compileMethodAtLevel(Executable method, int compLevel, int entry_bci);
+  // Blocks until the compile queues are empty and all compiler threads
+  // are idle.
+  public native void    drainCompileQueue();
+  public        long[]  getNMethodInfo(Executable method) {
+    return getNMethodInfo(method, false /*not osr*/);
+  }
+  // Returns {comp_level, code address, code size, total nmethod size}
+  // for the method's current nmethod, or null if it has none.
+  public native long[]  getNMethodInfo(Executable method, boolean isOsr);
   public native int     getMethodEntryBci(Executable method);
 
   // Intered strings
@@ -145,9 +162,24 @@ public class WhiteBox {
   // force Full GC
   public native void fullGC();
 
+  // Performance counters
+  // Reads the current value of a long-valued jvmstat counter, e.g.
+  // "sun.gc.g1.lastPause.time". Throws IllegalArgumentException
+  // if no such counter exists.
+  public native long getPerfCounterLong(String name);
+
   // Tests on ReservedSpace/VirtualSpace classes
   public native int stressVirtualSpaceResize(long reservedSpaceSize, long magnitude, long iterations);
   public native void runMemoryUnitTests();
   public native void readFromNoaccessArea();
 
+  // Microbenchmarks
+  // Runs an in-VM microbenchmark kernel ("alloc.tlab", "barrier.write",
+  // "barrier.g1" or "monitor.enterexit") for the given number of
+  // iterations, prints per-run timings with their variance to the VM
+  // output and returns the mean ns/op. Throws IllegalArgumentException
+  // for an unknown kernel and UnsupportedOperationException if the
+  // kernel does not apply to the running collector.
+  public native long runMicroBenchmark(String name, long iterations);
+
 }
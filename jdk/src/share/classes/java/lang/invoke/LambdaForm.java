@@ -443,6 +443,22 @@ class LambdaForm {
         // TO DO: Maybe add invokeGeneric, invokeWithArguments
     }
 
+    /**
+     * Eagerly spin bytecode for this form if eager compilation of shared
+     * forms is enabled.  Forms installed in the per-type caches (see
+     * {@link MethodTypeForm#setCachedLambdaForm}) are by construction
+     * reused by every method handle of the same basic type, so they are
+     * certain to outlive the interpretation threshold; compiling them at
+     * first resolution avoids thousands of interpreted invocations on
+     * startup paths.  A negative COMPILE_THRESHOLD forces interpretation
+     * and is respected here as well.
+     */
+    void compileEagerlyIfShared() {
+        if (COMPILE_CACHED_EAGERLY && COMPILE_THRESHOLD >= 0 && !isCompiled) {
+            compileToBytecode();
+        }
+    }
+
     /** Generate optimizable bytecode for this form. */
     MemberName compileToBytecode() {
         MethodType invokerType = methodType();
@@ -46,8 +46,9 @@ import sun.misc.Unsafe;
     static final boolean TRACE_INTERPRETER;
     static final boolean TRACE_METHOD_LINKAGE;
     static final Integer COMPILE_THRESHOLD;
+    static final boolean COMPILE_CACHED_EAGERLY;
     static {
-        final Object[] values = { false, false, false, false, null };
+        final Object[] values = { false, false, false, false, null, "true" };
         AccessController.doPrivileged(new PrivilegedAction<Void>() {
                 public Void run() {
                     values[0] = Boolean.getBoolean("java.lang.invoke.MethodHandle.DEBUG_NAMES");
@@ -55,6 +56,7 @@ import sun.misc.Unsafe;
                     values[2] = Boolean.getBoolean("java.lang.invoke.MethodHandle.TRACE_INTERPRETER");
                     values[3] = Boolean.getBoolean("java.lang.invoke.MethodHandle.TRACE_METHOD_LINKAGE");
                     values[4] = Integer.getInteger("java.lang.invoke.MethodHandle.COMPILE_THRESHOLD");
+                    values[5] = System.getProperty("java.lang.invoke.MethodHandle.COMPILE_CACHED_EAGERLY", "true");
                     return null;
                 }
             });
@@ -63,6 +65,7 @@ import sun.misc.Unsafe;
         TRACE_INTERPRETER         = (Boolean) values[2];
         TRACE_METHOD_LINKAGE      = (Boolean) values[3];
         COMPILE_THRESHOLD         = (Integer) values[4];
+        COMPILE_CACHED_EAGERLY    = Boolean.parseBoolean((String) values[5]);
     }
 
     /*non-public*/ static String getNameString(MethodHandle target, MethodType type) {
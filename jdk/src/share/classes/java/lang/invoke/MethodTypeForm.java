@@ -92,6 +92,10 @@ final class MethodTypeForm {
 
     public LambdaForm setCachedLambdaForm(int which, LambdaForm form) {
         // Should we perform some sort of CAS, to avoid racy duplication?
+        // A form that reaches this cache is shared by all method handles
+        // of this basic type, so spin its bytecode right away instead of
+        // interpreting it until the invocation counter trips.
+        form.compileEagerlyIfShared();
         return lambdaForms[which] = form;
     }
 
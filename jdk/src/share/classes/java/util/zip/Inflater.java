@@ -83,6 +83,14 @@ class Inflater {
 
     private static final byte[] defaultBuf = new byte[0];
 
+    /*
+     * inflateBytes packs its results into the returned long: bits 0-30
+     * hold the number of bytes written, bits 31-61 the number of bytes
+     * consumed, and the top two bits the stream state flags.
+     */
+    private static final long FINISHED_BIT = 1L << 62;
+    private static final long NEED_DICT_BIT = 1L << 63;
+
     static {
         /* Zip library is loaded from System.initializeSystemClass */
         initIDs();
@@ -255,11 +263,22 @@ class Inflater {
         }
         synchronized (zsRef) {
             ensureOpen();
-            int thisLen = this.len;
-            int n = inflateBytes(zsRef.address(), b, off, len);
-            bytesWritten += n;
-            bytesRead += (thisLen - this.len);
-            return n;
+            long result = inflateBytes(zsRef.address(),
+                                       this.buf, this.off, this.len,
+                                       b, off, len);
+            int written  = (int) (result & 0x7fffffffL);
+            int consumed = (int) ((result >>> 31) & 0x7fffffffL);
+            this.off += consumed;
+            this.len -= consumed;
+            if ((result & FINISHED_BIT) != 0) {
+                finished = true;
+            }
+            if ((result & NEED_DICT_BIT) != 0) {
+                needDict = true;
+            }
+            bytesWritten += written;
+            bytesRead += consumed;
+            return written;
         }
     }
 
@@ -399,7 +418,10 @@ class Inflater {
     private native static long init(boolean nowrap);
     private native static void setDictionary(long addr, byte[] b, int off,
                                              int len);
-    private native int inflateBytes(long addr, byte[] b, int off, int len)
+    private native static long inflateBytes(long addr,
+                                             byte[] inputBuf, int inputOff,
+                                             int inputLen, byte[] b, int off,
+                                             int len)
             throws DataFormatException;
     private native static int getAdler(long addr);
     private native static void reset(long addr);
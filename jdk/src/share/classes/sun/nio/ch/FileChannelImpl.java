@@ -392,7 +392,7 @@ public class FileChannelImpl
     //
     private static volatile boolean fileSupported = true;
 
-    private long transferToDirectly(long position, int icount,
+    private long transferToDirectly(long position, long count,
                                     WritableByteChannel target)
         throws IOException
     {
@@ -425,7 +425,7 @@ public class FileChannelImpl
             if (!isOpen())
                 return -1;
             do {
-                n = transferTo0(thisFDVal, position, icount, targetFDVal);
+                n = transferTo0(thisFDVal, position, count, targetFDVal);
             } while ((n == IOStatus.INTERRUPTED) && isOpen());
             if (n == IOStatus.UNSUPPORTED_CASE) {
                 if (target instanceof SinkChannelImpl)
@@ -550,14 +550,16 @@ public class FileChannelImpl
         long sz = size();
         if (position > sz)
             return 0;
+        if ((sz - position) < count)
+            count = sz - position;
         int icount = (int)Math.min(count, Integer.MAX_VALUE);
-        if ((sz - position) < icount)
-            icount = (int)(sz - position);
 
         long n;
 
-        // Attempt a direct transfer, if the kernel supports it
-        if ((n = transferToDirectly(position, icount, target)) >= 0)
+        // Attempt a direct transfer, if the kernel supports it. The native
+        // code chunks large requests, so this path is not limited to
+        // Integer.MAX_VALUE bytes per call.
+        if ((n = transferToDirectly(position, count, target)) >= 0)
             return n;
 
         // Attempt a mapped transfer, but only to trusted channel types
@@ -805,6 +807,44 @@ public class FileChannelImpl
     private static final int MAP_RW = 1;
     private static final int MAP_PV = 2;
 
+    // Access-pattern advice codes, translated to MADV_* values natively
+    public static final int ADVISE_NORMAL     = 0;
+    public static final int ADVISE_RANDOM     = 1;
+    public static final int ADVISE_SEQUENTIAL = 2;
+    public static final int ADVISE_WILLNEED   = 3;
+
+    // Advice applied to new mappings, configured by the
+    // "sun.nio.ch.map.advise" property; ADVISE_NORMAL leaves the kernel
+    // default in place
+    private static final int mapAdvice = mapAdvice(AccessController.doPrivileged(
+        new GetPropertyAction("sun.nio.ch.map.advise")));
+
+    private static int mapAdvice(String value) {
+        if (value != null) {
+            if (value.equalsIgnoreCase("random"))
+                return ADVISE_RANDOM;
+            if (value.equalsIgnoreCase("sequential"))
+                return ADVISE_SEQUENTIAL;
+            if (value.equalsIgnoreCase("willneed"))
+                return ADVISE_WILLNEED;
+        }
+        return ADVISE_NORMAL;
+    }
+
+    /**
+     * Advises the kernel on the expected access pattern for the given
+     * mapped buffer. The advice is a hint only: it never fails, and on
+     * platforms without madvise it is ignored.
+     */
+    public static void advise(MappedByteBuffer bb, int advice) {
+        if ((advice < ADVISE_NORMAL) || (advice > ADVISE_WILLNEED))
+            throw new IllegalArgumentException("Unknown advice");
+        long address = ((DirectBuffer)bb).address();
+        long offset = address % allocationGranularity;
+        // madvise requires a page-aligned starting address
+        advise0(address - offset, bb.capacity() + offset, advice);
+    }
+
     public MappedByteBuffer map(MapMode mode, long position, long size)
         throws IOException
     {
@@ -893,6 +933,10 @@ public class FileChannelImpl
                 }
             }
 
+            // Apply the configured access advice to the new mapping
+            if (mapAdvice != ADVISE_NORMAL)
+                advise0(addr, mapSize, mapAdvice);
+
             // On Windows, and potentially other platforms, we need an open
             // file descriptor for some mapping operations.
             FileDescriptor mfd;
@@ -1160,6 +1204,10 @@ public class FileChannelImpl
     // Removes an existing mapping
     private static native int unmap0(long address, long length);
 
+    // Advises the kernel on the expected access pattern for a mapping;
+    // best effort, never throws
+    private static native void advise0(long address, long length, int advice);
+
     // Transfers from src to dst, or returns -2 if kernel can't do that
     private native long transferTo0(int src, long position, long count, int dst);
 
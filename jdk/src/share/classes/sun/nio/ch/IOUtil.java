@@ -107,6 +107,11 @@ public class IOUtil {
                       NativeDispatcher nd)
         throws IOException
     {
+        // Degenerate gather: a single buffer does not need the iovec
+        // machinery or the per-element bookkeeping that goes with it
+        if (length == 1)
+            return write(fd, bufs[offset], -1, nd);
+
         IOVecWrapper vec = IOVecWrapper.get(length);
 
         boolean completed = false;
@@ -237,6 +242,11 @@ public class IOUtil {
                      NativeDispatcher nd)
         throws IOException
     {
+        // Degenerate scatter: a single buffer does not need the iovec
+        // machinery or the per-element bookkeeping that goes with it
+        if (length == 1)
+            return read(fd, bufs[offset], -1, nd);
+
         IOVecWrapper vec = IOVecWrapper.get(length);
 
         boolean completed = false;
@@ -92,6 +92,9 @@ class IOVecWrapper {
         this.address   = vecArray.address();
     }
 
+    // Minimum number of elements to allocate
+    private static final int MIN_SIZE = 8;
+
     static IOVecWrapper get(int size) {
         IOVecWrapper wrapper = cached.get();
         if (wrapper != null && wrapper.size < size) {
@@ -100,7 +103,18 @@ class IOVecWrapper {
             wrapper = null;
         }
         if (wrapper == null) {
-            wrapper = new IOVecWrapper(size);
+            // Round the capacity up so that gather operations of varying
+            // sizes on the same thread reuse the array instead of freeing
+            // and reallocating it on every size change.
+            int capacity = MIN_SIZE;
+            while (capacity < size) {
+                capacity <<= 1;
+                if (capacity <= 0) {
+                    capacity = size;
+                    break;
+                }
+            }
+            wrapper = new IOVecWrapper(capacity);
             Cleaner.create(wrapper, new Deallocator(wrapper.vecArray));
             cached.set(wrapper);
         }
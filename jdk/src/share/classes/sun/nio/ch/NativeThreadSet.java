@@ -35,6 +35,11 @@ class NativeThreadSet {
     private int used = 0;
     private boolean waitingToEmpty;
 
+    // Index to start the free-slot search at. A thread doing repeated I/O
+    // operations tends to reuse the slot it just released, so the common
+    // case finds a slot without scanning.
+    private int hint = 0;
+
     NativeThreadSet(int n) {
         elts = new long[n];
     }
@@ -48,7 +53,7 @@ class NativeThreadSet {
         if (th == 0)
             th = -1;
         synchronized (this) {
-            int start = 0;
+            int start = hint;
             if (used >= elts.length) {
                 int on = elts.length;
                 int nn = on * 2;
@@ -57,10 +62,14 @@ class NativeThreadSet {
                 elts = nelts;
                 start = on;
             }
-            for (int i = start; i < elts.length; i++) {
+            for (int k = 0; k < elts.length; k++) {
+                int i = start + k;
+                if (i >= elts.length)
+                    i -= elts.length;
                 if (elts[i] == 0) {
                     elts[i] = th;
                     used++;
+                    hint = (i + 1 < elts.length) ? i + 1 : 0;
                     return i;
                 }
             }
@@ -74,6 +83,7 @@ class NativeThreadSet {
     void remove(int i) {
         synchronized (this) {
             elts[i] = 0;
+            hint = i;
             used--;
             if (used == 0 && waitingToEmpty)
                 notifyAll();
@@ -27,12 +27,175 @@
  * Native method support for java.util.zip.CRC32
  */
 
+#include <string.h>
+
 #include "jni.h"
 #include "jni_util.h"
 #include <zlib.h>
 
 #include "java_util_zip_CRC32.h"
 
+/*
+ * Hardware-assisted CRC kernels, used when the CPU supports them.
+ * CRC-32 (the zlib polynomial 0xEDB88320) is computed by folding
+ * 16-byte blocks with carry-less multiplication; CRC-32C (polynomial
+ * 0x82F63B78, exported as ZIP_CRC32C for native callers) maps directly
+ * onto the SSE4.2 crc32 instruction.  Everything falls back to the
+ * zlib table code on other hardware and toolchains.  The JIT has its
+ * own intrinsic for java.util.zip.CRC32 (UseCRC32Intrinsics); these
+ * kernels cover the interpreter and the native callers.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8))
+#define CRC32_X86_ACCEL 1
+#include <cpuid.h>
+#include <wmmintrin.h>
+#include <smmintrin.h>
+
+#define CRC32_ACCEL_THRESHOLD 64  /* below this the table code wins */
+
+static int cpu_has_clmul = -1;  /* PCLMULQDQ + SSE4.1 */
+static int cpu_has_sse42 = -1;
+
+static void crc32_cpu_probe()
+{
+    unsigned int eax, ebx, ecx = 0, edx;
+    cpu_has_clmul = cpu_has_sse42 = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        cpu_has_sse42 = (ecx & bit_SSE4_2) != 0;
+        cpu_has_clmul = (ecx & bit_PCLMUL) != 0 && (ecx & bit_SSE4_1) != 0;
+    }
+}
+
+/*
+ * Folds 16-byte blocks of the message into a 128-bit remainder with
+ * carry-less multiplication (reflected CRC-32), then reduces the final
+ * block through one zlib table pass.  crc is the conditioned value as
+ * passed to and returned from zlib's crc32(); *lenp must be >= 32 on
+ * entry and holds the unprocessed tail length (< 16) on return.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static uLong crc32_clmul(uLong crc, const Bytef *buf, uInt *lenp)
+{
+    /* x^(128+32) mod P and x^(128-32) mod P, bit-reflected and
+     * pre-multiplied by x */
+    const __m128i fold = _mm_set_epi64x((jlong)0x00000000ccaa009eULL,
+                                        (jlong)0x00000001751997d0ULL);
+    Bytef block[16];
+    uInt len = *lenp;
+    __m128i x, t0, t1;
+
+    x = _mm_loadu_si128((const __m128i *)buf);
+    x = _mm_xor_si128(x, _mm_cvtsi32_si128((jint)~crc));
+    buf += 16;
+    len -= 16;
+
+    while (len >= 16) {
+        t0 = _mm_clmulepi64_si128(x, fold, 0x00);
+        t1 = _mm_clmulepi64_si128(x, fold, 0x11);
+        x = _mm_xor_si128(_mm_xor_si128(t0, t1),
+                          _mm_loadu_si128((const __m128i *)buf));
+        buf += 16;
+        len -= 16;
+    }
+
+    /* crc32() with a conditioned value of ~0 is a raw update of a zero
+     * register, which is exactly the reduction of the remainder. */
+    _mm_storeu_si128((__m128i *)block, x);
+    *lenp = len;
+    return crc32(0xffffffffUL, block, 16);
+}
+
+__attribute__((target("sse4.2")))
+static uLong crc32c_sse42(uLong crc, const Bytef *buf, uInt len)
+{
+#ifdef __x86_64__
+    unsigned long long c = crc;
+    while (len >= 8) {
+        unsigned long long v;
+        memcpy(&v, buf, 8);
+        c = _mm_crc32_u64(c, v);
+        buf += 8;
+        len -= 8;
+    }
+    crc = (uLong)c;
+#else
+    while (len >= 4) {
+        unsigned int v;
+        memcpy(&v, buf, 4);
+        crc = _mm_crc32_u32((unsigned int)crc, v);
+        buf += 4;
+        len -= 4;
+    }
+#endif
+    while (len > 0) {
+        crc = _mm_crc32_u8((unsigned int)crc, *buf);
+        buf++;
+        len--;
+    }
+    return crc;
+}
+#endif /* CRC32_X86_ACCEL */
+
+/*
+ * CRC-32 with the zlib polynomial and calling convention, taking the
+ * hardware path for large enough buffers.
+ */
+static uLong ZIP_CRC32_accel(uLong crc, const Bytef *buf, uInt len)
+{
+#ifdef CRC32_X86_ACCEL
+    if (cpu_has_clmul == -1)
+        crc32_cpu_probe();
+    if (cpu_has_clmul && len >= CRC32_ACCEL_THRESHOLD) {
+        uInt tail = len;
+        crc = crc32_clmul(crc, buf, &tail);
+        buf += len - tail;
+        len = tail;
+    }
+#endif
+    return crc32(crc, buf, len);
+}
+
+static unsigned int crc32c_table[256];
+static int crc32c_table_built = 0;
+
+/* CRC-32C software fallback, one table, byte at a time. */
+static uLong crc32c_sw(uLong crc, const Bytef *buf, uInt len)
+{
+    if (!crc32c_table_built) {
+        unsigned int i, j, c;
+        for (i = 0; i < 256; i++) {
+            c = i;
+            for (j = 0; j < 8; j++)
+                c = (c >> 1) ^ (0x82f63b78U & (0U - (c & 1)));
+            crc32c_table[i] = c;
+        }
+        crc32c_table_built = 1;
+    }
+    while (len-- > 0)
+        crc = crc32c_table[(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+    return crc;
+}
+
+/*
+ * CRC-32C (the iSCSI polynomial) with the same conditioned-value
+ * convention as ZIP_CRC32.  Exported for native code that checksums
+ * with the polynomial the hardware instruction implements.
+ */
+JNIEXPORT jint ZIP_CRC32C(jint crc, const jbyte *buf, jint len)
+{
+    uLong c = ((uLong)crc ^ 0xffffffffUL) & 0xffffffffUL;
+#ifdef CRC32_X86_ACCEL
+    if (cpu_has_sse42 == -1)
+        crc32_cpu_probe();
+    if (cpu_has_sse42)
+        c = crc32c_sse42(c, (const Bytef *)buf, len);
+    else
+#endif
+        c = crc32c_sw(c, (const Bytef *)buf, len);
+    return (jint)(c ^ 0xffffffffUL);
+}
+
 JNIEXPORT jint JNICALL
 Java_java_util_zip_CRC32_update(JNIEnv *env, jclass cls, jint crc, jint b)
 {
@@ -48,7 +211,7 @@ Java_java_util_zip_CRC32_updateBytes(JNIEnv *env, jclass cls, jint crc,
 {
     Bytef *buf = (*env)->GetPrimitiveArrayCritical(env, b, 0);
     if (buf) {
-        crc = crc32(crc, buf + off, len);
+        crc = ZIP_CRC32_accel(crc, buf + off, len);
         (*env)->ReleasePrimitiveArrayCritical(env, b, buf, 0);
     }
     return crc;
@@ -56,7 +219,7 @@ Java_java_util_zip_CRC32_updateBytes(JNIEnv *env, jclass cls, jint crc,
 
 JNIEXPORT jint ZIP_CRC32(jint crc, const jbyte *buf, jint len)
 {
-    return crc32(crc, (Bytef*)buf, len);
+    return ZIP_CRC32_accel(crc, (Bytef*)buf, len);
 }
 
 JNIEXPORT jint JNICALL
@@ -65,7 +228,7 @@ Java_java_util_zip_CRC32_updateByteBuffer(JNIEnv *env, jclass cls, jint crc,
 {
     Bytef *buf = (Bytef *)jlong_to_ptr(address);
     if (buf) {
-        crc = crc32(crc, buf + off, len);
+        crc = ZIP_CRC32_accel(crc, buf + off, len);
     }
     return crc;
 }
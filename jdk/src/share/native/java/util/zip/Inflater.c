@@ -42,18 +42,11 @@
 #define ThrowDataFormatException(env, msg) \
         JNU_ThrowByName(env, "java/util/zip/DataFormatException", msg)
 
-static jfieldID needDictID;
-static jfieldID finishedID;
-static jfieldID bufID, offID, lenID;
-
 JNIEXPORT void JNICALL
 Java_java_util_zip_Inflater_initIDs(JNIEnv *env, jclass cls)
 {
-    needDictID = (*env)->GetFieldID(env, cls, "needDict", "Z");
-    finishedID = (*env)->GetFieldID(env, cls, "finished", "Z");
-    bufID = (*env)->GetFieldID(env, cls, "buf", "[B");
-    offID = (*env)->GetFieldID(env, cls, "off", "I");
-    lenID = (*env)->GetFieldID(env, cls, "len", "I");
+    /* inflateBytes no longer reaches back into the Inflater object, so
+     * there are no field IDs to cache anymore. */
 }
 
 JNIEXPORT jlong JNICALL
@@ -112,56 +105,64 @@ Java_java_util_zip_Inflater_setDictionary(JNIEnv *env, jclass cls, jlong addr,
     }
 }
 
-JNIEXPORT jint JNICALL
-Java_java_util_zip_Inflater_inflateBytes(JNIEnv *env, jobject this, jlong addr,
+/*
+ * The results are packed into the returned jlong: bits 0-30 hold the
+ * number of bytes written, bits 31-61 the number of bytes consumed and
+ * the top two bits the finished and need-dictionary flags.  With the
+ * buffer positions passed in and the state handed back this way, a call
+ * only pins the two arrays instead of crossing JNI another seven times
+ * for field accesses - this is the hot path of class loading, crossed
+ * once per buffer of every jar entry.
+ */
+#define INFLATE_FINISHED  (((jlong)1) << 62)
+#define INFLATE_NEED_DICT (((jlong)1) << 63)
+
+JNIEXPORT jlong JNICALL
+Java_java_util_zip_Inflater_inflateBytes(JNIEnv *env, jclass cls, jlong addr,
+                                         jarray inputBuf, jint inputOff,
+                                         jint inputLen,
                                          jarray b, jint off, jint len)
 {
     z_stream *strm = jlong_to_ptr(addr);
-    jarray this_buf = (jarray)(*env)->GetObjectField(env, this, bufID);
-    jint this_off = (*env)->GetIntField(env, this, offID);
-    jint this_len = (*env)->GetIntField(env, this, lenID);
 
     jbyte *in_buf;
     jbyte *out_buf;
     int ret;
+    jlong consumed, written, result;
 
-    in_buf  = (*env)->GetPrimitiveArrayCritical(env, this_buf, 0);
+    in_buf  = (*env)->GetPrimitiveArrayCritical(env, inputBuf, 0);
     if (in_buf == NULL) {
-        if (this_len != 0)
+        if (inputLen != 0)
             JNU_ThrowOutOfMemoryError(env, 0);
         return 0;
     }
     out_buf = (*env)->GetPrimitiveArrayCritical(env, b, 0);
     if (out_buf == NULL) {
-        (*env)->ReleasePrimitiveArrayCritical(env, this_buf, in_buf, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, inputBuf, in_buf, 0);
         if (len != 0)
             JNU_ThrowOutOfMemoryError(env, 0);
         return 0;
     }
-    strm->next_in  = (Bytef *) (in_buf + this_off);
+    strm->next_in  = (Bytef *) (in_buf + inputOff);
     strm->next_out = (Bytef *) (out_buf + off);
-    strm->avail_in  = this_len;
+    strm->avail_in  = inputLen;
     strm->avail_out = len;
     ret = inflate(strm, Z_PARTIAL_FLUSH);
     (*env)->ReleasePrimitiveArrayCritical(env, b, out_buf, 0);
-    (*env)->ReleasePrimitiveArrayCritical(env, this_buf, in_buf, 0);
+    (*env)->ReleasePrimitiveArrayCritical(env, inputBuf, in_buf, 0);
 
     switch (ret) {
     case Z_STREAM_END:
-        (*env)->SetBooleanField(env, this, finishedID, JNI_TRUE);
-        /* fall through */
     case Z_OK:
-        this_off += this_len - strm->avail_in;
-        (*env)->SetIntField(env, this, offID, this_off);
-        (*env)->SetIntField(env, this, lenID, strm->avail_in);
-        return len - strm->avail_out;
     case Z_NEED_DICT:
-        (*env)->SetBooleanField(env, this, needDictID, JNI_TRUE);
-        /* Might have consumed some input here! */
-        this_off += this_len - strm->avail_in;
-        (*env)->SetIntField(env, this, offID, this_off);
-        (*env)->SetIntField(env, this, lenID, strm->avail_in);
-        return 0;
+        consumed = inputLen - strm->avail_in;
+        written  = len - strm->avail_out;
+        result = (consumed << 31) | written;
+        if (ret == Z_STREAM_END)
+            result |= INFLATE_FINISHED;
+        if (ret == Z_NEED_DICT)
+            result |= INFLATE_NEED_DICT;
+        return result;
     case Z_BUF_ERROR:
         return 0;
     case Z_DATA_ERROR:
@@ -54,6 +54,12 @@
 /* USE_MMAP means mmap the CEN & ENDHDR part of the zip file. */
 #ifdef USE_MMAP
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef _ALLBSD_SOURCE
+#define stat64 stat
+#define fstat64 fstat
+#endif
 #endif
 
 #define MAXREFS 0xFFFF  /* max number of open zip file references */
@@ -69,6 +75,7 @@ static jzfile *zfiles = 0;      /* currently open zip files */
 static void *zfiles_lock = 0;
 
 static void freeCEN(jzfile *);
+static unsigned int hash(const char *s);
 
 #ifndef PATH_MAX
 #define PATH_MAX 1024
@@ -76,6 +83,243 @@ static void freeCEN(jzfile *);
 
 static jint INITIAL_META_COUNT = 2;   /* initial number of entries in meta name array */
 
+#ifdef USE_MMAP
+
+/*
+ * On-disk cache of the CEN hash structures built by readCEN().  When
+ * the directory named by JDK_ZIP_CEN_CACHE_DIR exists, the entries and
+ * table arrays for a jar are written there once and then mmapped
+ * read-only by every process that opens the same jar, so the hashing
+ * pass is done once per host and the index pages are shared clean
+ * memory instead of per-process private heap.  A cache file is valid
+ * only for the jar with the exact path, length and mtime recorded in
+ * its header; anything that fails validation is silently rebuilt.
+ */
+
+#define CENCACHE_DIR_ENV  "JDK_ZIP_CEN_CACHE_DIR"
+#define CENCACHE_MAGIC    0x4E45435A  /* "ZCEN", little endian */
+#define CENCACHE_VERSION  2
+
+typedef struct cenCacheHeader {
+    jint  magic;
+    jint  version;
+    jlong size;           /* length of the jar the index was built from */
+    jlong mtime;          /* mtime (seconds) of that jar */
+    jlong mtimeNsec;      /* nanosecond part of that mtime */
+    jlong inode;          /* inode of that jar */
+    jint  total;          /* number of entries */
+    jint  tablelen;       /* number of hash chain heads */
+    jint  pathlen;        /* length of the jar path stored after the header */
+    jint  pad;
+} cenCacheHeader;
+
+/* The stored path is padded so the jzcell array stays 8-byte aligned. */
+#define CENCACHE_PATHROOM(pathlen) (((pathlen) + 8) & ~7)
+
+static const char *
+cenCacheDir()
+{
+    static const char *dir = NULL;
+    static int checked = 0;
+    if (!checked) {
+        dir = getenv(CENCACHE_DIR_ENV);
+        checked = 1;
+    }
+    return dir;
+}
+
+/*
+ * Cache files are named by a hash of the jar path; the full path in the
+ * header disambiguates collisions (a colliding jar simply misses and
+ * overwrites, last writer wins).  Caller frees the result.
+ */
+static char *
+cenCacheFileName(const char *dir, const char *path)
+{
+    char *name = malloc(strlen(dir) + sizeof("/00000000.zcen"));
+    if (name != NULL)
+        sprintf(name, "%s/%08x.zcen", dir, hash(path));
+    return name;
+}
+
+/*
+ * The key must change whenever the jar does.  Seconds-granularity mtime
+ * is not enough: a jar rewritten to the same length within the same
+ * second would be accepted stale, so include the nanosecond part and
+ * the inode (rewrites via rename get a fresh inode).
+ */
+static int
+cenCacheKey(jzfile *zip, jlong *mtime, jlong *mtimeNsec, jlong *inode)
+{
+    struct stat64 sb;
+    if (fstat64(zip->zfd, &sb) != 0)
+        return -1;
+    *mtime     = (jlong)sb.st_mtim.tv_sec;
+    *mtimeNsec = (jlong)sb.st_mtim.tv_nsec;
+    *inode     = (jlong)sb.st_ino;
+    return 0;
+}
+
+/*
+ * Maps the index cache file for this jar, if present and valid, and
+ * points zip->entries/zip->table into the mapping.  cenpos/cenlen
+ * delimit the jar's central directory, which the caller has already
+ * mapped at zip->maddr.
+ *
+ * The cache file comes from a world-readable directory chosen by an
+ * environment variable, so nothing in it can be trusted: everything
+ * newEntry() and the chain walks will later consume - every hash chain
+ * index and every stored CEN header offset - is validated here against
+ * the real central directory before the mapping is adopted.  This
+ * preserves the invariant documented above newEntry() that a jzcell
+ * never refers to an unchecked CEN header.
+ */
+static jboolean
+loadCENCache(jzfile *zip, jlong cenpos, jlong cenlen)
+{
+    const char *dir = cenCacheDir();
+    char *fname;
+    int fd;
+    struct stat64 sb;
+    jlong mtime, mtimeNsec, inode, expected;
+    unsigned char *addr;
+    cenCacheHeader *hdr;
+    jzcell *entries;
+    jint *table;
+    jint i;
+
+    if (dir == NULL || cenCacheKey(zip, &mtime, &mtimeNsec, &inode) != 0)
+        return JNI_FALSE;
+    if ((fname = cenCacheFileName(dir, zip->name)) == NULL)
+        return JNI_FALSE;
+    fd = open(fname, O_RDONLY);
+    free(fname);
+    if (fd == -1)
+        return JNI_FALSE;
+    if (fstat64(fd, &sb) != 0 || sb.st_size < (jlong)sizeof(cenCacheHeader)) {
+        close(fd);
+        return JNI_FALSE;
+    }
+    addr = (unsigned char *)mmap64(0, sb.st_size, PROT_READ, MAP_SHARED,
+                                   fd, (off64_t)0);
+    close(fd);
+    if (addr == (unsigned char *)MAP_FAILED)
+        return JNI_FALSE;
+    hdr = (cenCacheHeader *)addr;
+    expected = (hdr->magic == CENCACHE_MAGIC &&
+                hdr->version == CENCACHE_VERSION &&
+                hdr->total > 0 && hdr->tablelen > 0 && hdr->pathlen > 0)
+        ? (jlong)sizeof(cenCacheHeader) + CENCACHE_PATHROOM(hdr->pathlen) +
+          hdr->total * (jlong)sizeof(jzcell) +
+          hdr->tablelen * (jlong)sizeof(jint)
+        : (jlong)-1;
+    if (expected != (jlong)sb.st_size ||
+        hdr->size != zip->len || hdr->mtime != mtime ||
+        hdr->mtimeNsec != mtimeNsec || hdr->inode != inode ||
+        hdr->pathlen != (jint)strlen(zip->name) ||
+        memcmp(addr + sizeof(cenCacheHeader), zip->name, hdr->pathlen) != 0)
+        goto Invalid;
+
+    entries = (jzcell *)(addr + sizeof(cenCacheHeader) +
+                         CENCACHE_PATHROOM(hdr->pathlen));
+    table = (jint *)((unsigned char *)entries + hdr->total * sizeof(jzcell));
+
+    /* Every chain head must be a valid entry index or end the chain. */
+    for (i = 0; i < hdr->tablelen; i++) {
+        if (table[i] != ZIP_ENDCHAIN &&
+            ((unsigned int)table[i]) >= (unsigned int)hdr->total)
+            goto Invalid;
+    }
+    /* Every cell must chain to a valid index and point at a complete,
+     * in-bounds CEN header of the mapped central directory. */
+    for (i = 0; i < hdr->total; i++) {
+        const jzcell *zc = &entries[i];
+        const char *cen;
+        if (zc->next != (unsigned int)ZIP_ENDCHAIN &&
+            zc->next >= (unsigned int)hdr->total)
+            goto Invalid;
+        if (zc->cenpos < cenpos || zc->cenpos > cenpos + cenlen - CENHDR)
+            goto Invalid;
+        cen = (char *)zip->maddr + zc->cenpos - zip->offset;
+        if (GETSIG(cen) != CENSIG ||
+            zc->cenpos + CENHDR + CENNAM(cen) + CENEXT(cen) + CENCOM(cen) >
+                cenpos + cenlen)
+            goto Invalid;
+    }
+
+    zip->cenCacheAddr = addr;
+    zip->cenCacheLen = sb.st_size;
+    zip->entries = entries;
+    zip->table = table;
+    zip->total = hdr->total;
+    zip->tablelen = hdr->tablelen;
+    return JNI_TRUE;
+
+ Invalid:
+    munmap((char *)addr, sb.st_size);
+    return JNI_FALSE;
+}
+
+/*
+ * Writes the freshly built index for this jar into the cache directory.
+ * The file is written under a temporary name and renamed into place, so
+ * readers only ever see complete files; concurrent writers of the same
+ * jar produce identical content.  All failures are silent - the cache
+ * is strictly an optimization.
+ */
+static void
+saveCENCache(jzfile *zip)
+{
+    const char *dir = cenCacheDir();
+    char *fname, *tmpname;
+    static const char zeros[8];
+    cenCacheHeader hdr;
+    jlong mtime, mtimeNsec, inode;
+    jint padlen;
+    int fd;
+    jboolean ok;
+
+    if (dir == NULL || cenCacheKey(zip, &mtime, &mtimeNsec, &inode) != 0)
+        return;
+    if ((fname = cenCacheFileName(dir, zip->name)) == NULL)
+        return;
+    if ((tmpname = malloc(strlen(fname) + 32)) == NULL) {
+        free(fname);
+        return;
+    }
+    sprintf(tmpname, "%s.%d", fname, (int)getpid());
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic    = CENCACHE_MAGIC;
+    hdr.version  = CENCACHE_VERSION;
+    hdr.size     = zip->len;
+    hdr.mtime    = mtime;
+    hdr.mtimeNsec = mtimeNsec;
+    hdr.inode    = inode;
+    hdr.total    = zip->total;
+    hdr.tablelen = zip->tablelen;
+    hdr.pathlen  = (jint)strlen(zip->name);
+    padlen = CENCACHE_PATHROOM(hdr.pathlen) - hdr.pathlen;
+
+    fd = open(tmpname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ok = fd != -1 &&
+        write(fd, &hdr, sizeof(hdr)) == (ssize_t)sizeof(hdr) &&
+        write(fd, zip->name, hdr.pathlen) == (ssize_t)hdr.pathlen &&
+        write(fd, zeros, padlen) == (ssize_t)padlen &&
+        write(fd, zip->entries, zip->total * sizeof(jzcell)) ==
+            (ssize_t)(zip->total * sizeof(jzcell)) &&
+        write(fd, zip->table, zip->tablelen * sizeof(jint)) ==
+            (ssize_t)(zip->tablelen * sizeof(jint));
+    if (fd != -1)
+        close(fd);
+    if (!ok || rename(tmpname, fname) != 0)
+        unlink(tmpname);
+    free(tmpname);
+    free(fname);
+}
+
+#endif /* USE_MMAP */
+
 /*
  * The ZFILE_* functions exist to provide some platform-independence with
  * respect to file access needs.
@@ -511,8 +755,20 @@ freeMetaNames(jzfile *zip)
 static void
 freeCEN(jzfile *zip)
 {
-    free(zip->entries); zip->entries = NULL;
-    free(zip->table);   zip->table   = NULL;
+#ifdef USE_MMAP
+    if (zip->cenCacheAddr != NULL) {
+        /* entries and table point into the mapped index cache file */
+        munmap((char *)zip->cenCacheAddr, zip->cenCacheLen);
+        zip->cenCacheAddr = NULL;
+        zip->cenCacheLen = 0;
+        zip->entries = NULL;
+        zip->table = NULL;
+    } else
+#endif
+    {
+        free(zip->entries); zip->entries = NULL;
+        free(zip->table);   zip->table   = NULL;
+    }
     freeMetaNames(zip);
 }
 
@@ -644,6 +900,28 @@ readCEN(jzfile *zip, jint knownTotal)
 
     cenend = cenbuf + cenlen;
 
+#ifdef USE_MMAP
+    /* With the central directory mapped, the hash structures can come
+     * straight out of the shared on-disk index cache; only the META-INF
+     * name list still needs a (hash- and allocation-free) pass over the
+     * headers. */
+    if (zip->usemmap && knownTotal == -1 && loadCENCache(zip, cenpos, cenlen)) {
+        for (cp = cenbuf; cp <= cenend - CENHDR; cp += CENSIZE(cp)) {
+            jint nlen = CENNAM(cp);
+            if (GETSIG(cp) != CENSIG || cp + CENHDR + nlen > cenend)
+                break;
+            if (isMetaName((char *)cp+CENHDR, nlen))
+                if (addMetaName(zip, (char *)cp+CENHDR, nlen) != 0)
+                    goto Catch;
+        }
+        if (cp == cenend)
+            goto Finally;
+        /* The cached index disagrees with the directory (stale or
+         * colliding cache file); drop it and rebuild below. */
+        freeCEN(zip);
+    }
+#endif
+
     /* Initialize zip file data structures based on the total number
      * of central directory entries as stored in ENDTOT.  Since this
      * is a 2-byte field, but we (and other zip implementations)
@@ -707,6 +985,10 @@ readCEN(jzfile *zip, jint knownTotal)
         ZIP_FORMAT_ERROR("invalid CEN header (bad header size)");
 
     zip->total = i;
+#ifdef USE_MMAP
+    if (zip->usemmap && knownTotal == -1 && i > 0)
+        saveCENCache(zip);
+#endif
     goto Finally;
 
  Catch:
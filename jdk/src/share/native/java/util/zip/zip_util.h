@@ -209,6 +209,8 @@ typedef struct jzfile {   /* Zip file */
     jlong offset;         /* offset of the mmapped region from the
                              start of the file. */
     jboolean usemmap;     /* if mmap is used. */
+    unsigned char *cenCacheAddr; /* mapped CEN index cache file, if any */
+    jlong cenCacheLen;    /* length (in bytes) of the index mapping */
 #endif
     jboolean locsig;      /* if zip file starts with LOCSIG */
     cencache cencache;    /* CEN header cache */
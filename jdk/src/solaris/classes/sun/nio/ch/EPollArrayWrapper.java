@@ -79,6 +79,15 @@ class EPollArrayWrapper {
     // Initial size of arrays for fd registration changes
     private static final int INITIAL_PENDING_UPDATE_SIZE = 64;
 
+    // Number of pending registration changes replayed per native call.
+    // Each entry in the native update array is three ints: opcode, file
+    // descriptor and events.
+    private static final int UPDATE_BATCH_SIZE    = 256;
+    private static final int SIZE_UPDATE_ENTRY    = 12;
+    private static final int UPDATE_OPCODE_OFFSET = 0;
+    private static final int UPDATE_FD_OFFSET     = 4;
+    private static final int UPDATE_EVENTS_OFFSET = 8;
+
     // maximum size of updatesLow
     private static final int MAX_UPDATE_ARRAY_SIZE = AccessController.doPrivileged(
         new GetIntegerAction("sun.nio.ch.maxUpdateArraySize", Math.min(OPEN_MAX, 64*1024)));
@@ -92,6 +101,13 @@ class EPollArrayWrapper {
     // Base address of the epoll_event array
     private final long pollArrayAddress;
 
+    // Native array of pending registration changes, replayed in batches
+    // by epollCtlBatch to avoid one JNI call per changed file descriptor
+    private final AllocatedNativeObject updateArray;
+
+    // Base address of the update array
+    private final long updateArrayAddress;
+
     // The fd of the interrupt line going out
     private int outgoingInterruptFD;
 
@@ -134,6 +150,10 @@ class EPollArrayWrapper {
         pollArray = new AllocatedNativeObject(allocationSize, true);
         pollArrayAddress = pollArray.address();
 
+        // the update array passed to epollCtlBatch
+        updateArray = new AllocatedNativeObject(UPDATE_BATCH_SIZE * SIZE_UPDATE_ENTRY, true);
+        updateArrayAddress = updateArray.address();
+
         // eventHigh needed when using file descriptors > 64k
         if (OPEN_MAX > MAX_UPDATE_ARRAY_SIZE)
             eventsHigh = new HashMap<>();
@@ -262,6 +282,7 @@ class EPollArrayWrapper {
     void closeEPollFD() throws IOException {
         FileDispatcherImpl.closeIntFD(epfd);
         pollArray.free();
+        updateArray.free();
     }
 
     int poll(long timeout) throws IOException {
@@ -278,11 +299,14 @@ class EPollArrayWrapper {
     }
 
     /**
-     * Update the pending registrations.
+     * Update the pending registrations. The updates are packed into the
+     * native update array and replayed by epoll_ctl in batches so that the
+     * cost is one JNI call per batch rather than one per file descriptor.
      */
     private void updateRegistrations() {
         synchronized (updateLock) {
             int j = 0;
+            int batched = 0;
             while (j < updateCount) {
                 int fd = updateDescriptors[j];
                 short events = getUpdateEvents(fd);
@@ -296,7 +320,14 @@ class EPollArrayWrapper {
                         opcode = (events != 0) ? EPOLL_CTL_ADD : 0;
                     }
                     if (opcode != 0) {
-                        epollCtl(epfd, opcode, fd, events);
+                        int offset = SIZE_UPDATE_ENTRY * batched;
+                        updateArray.putInt(offset + UPDATE_OPCODE_OFFSET, opcode);
+                        updateArray.putInt(offset + UPDATE_FD_OFFSET, fd);
+                        updateArray.putInt(offset + UPDATE_EVENTS_OFFSET, events);
+                        if (++batched == UPDATE_BATCH_SIZE) {
+                            epollCtlBatch(epfd, updateArrayAddress, batched);
+                            batched = 0;
+                        }
                         if (opcode == EPOLL_CTL_ADD) {
                             registered.set(fd);
                         } else if (opcode == EPOLL_CTL_DEL) {
@@ -306,6 +337,9 @@ class EPollArrayWrapper {
                 }
                 j++;
             }
+            if (batched > 0) {
+                epollCtlBatch(epfd, updateArrayAddress, batched);
+            }
             updateCount = 0;
         }
     }
@@ -336,6 +370,7 @@ class EPollArrayWrapper {
 
     private native int epollCreate();
     private native void epollCtl(int epfd, int opcode, int fd, int events);
+    private native void epollCtlBatch(int epfd, long address, int count);
     private native int epollWait(long pollAddress, int numfds, long timeout,
                                  int epfd) throws IOException;
     private static native int sizeofEPollEvent();
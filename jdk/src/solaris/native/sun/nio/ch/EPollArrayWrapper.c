@@ -129,6 +129,40 @@ Java_sun_nio_ch_EPollArrayWrapper_epollCtl(JNIEnv *env, jobject this, jint epfd,
     }
 }
 
+/*
+ * Entry layout in the update array, see EPollArrayWrapper.SIZE_UPDATE_ENTRY
+ */
+struct epoll_update {
+    jint opcode;
+    jint fd;
+    jint events;
+};
+
+JNIEXPORT void JNICALL
+Java_sun_nio_ch_EPollArrayWrapper_epollCtlBatch(JNIEnv *env, jobject this,
+                                                jint epfd, jlong address,
+                                                jint count)
+{
+    struct epoll_update *updates = jlong_to_ptr(address);
+    struct epoll_event event;
+    int res;
+    jint i;
+
+    for (i = 0; i < count; i++) {
+        event.events = updates[i].events;
+        event.data.fd = updates[i].fd;
+
+        RESTARTABLE(epoll_ctl(epfd, (int)updates[i].opcode,
+                              (int)updates[i].fd, &event), res);
+
+        /* Errors tolerated for the same reason as in epollCtl above */
+        if (res < 0 && errno != EBADF && errno != ENOENT && errno != EPERM) {
+            JNU_ThrowIOExceptionWithLastError(env, "epoll_ctl failed");
+            return;
+        }
+    }
+}
+
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_EPollArrayWrapper_epollWait(JNIEnv *env, jobject this,
                                             jlong address, jint numfds,
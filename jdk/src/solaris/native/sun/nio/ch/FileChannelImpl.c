@@ -39,6 +39,9 @@
 
 #if defined(__linux__) || defined(__solaris__)
 #include <sys/sendfile.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 #elif defined(_ALLBSD_SOURCE)
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -111,6 +114,33 @@ Java_sun_nio_ch_FileChannelImpl_map0(JNIEnv *env, jobject this,
 }
 
 
+JNIEXPORT void JNICALL
+Java_sun_nio_ch_FileChannelImpl_advise0(JNIEnv *env, jclass clazz,
+                                        jlong address, jlong len, jint advice)
+{
+    void *a = (void *)jlong_to_ptr(address);
+    int madv;
+
+    switch (advice) {
+    case sun_nio_ch_FileChannelImpl_ADVISE_RANDOM:
+        madv = MADV_RANDOM;
+        break;
+    case sun_nio_ch_FileChannelImpl_ADVISE_SEQUENTIAL:
+        madv = MADV_SEQUENTIAL;
+        break;
+    case sun_nio_ch_FileChannelImpl_ADVISE_WILLNEED:
+        madv = MADV_WILLNEED;
+        break;
+    default:
+        madv = MADV_NORMAL;
+        break;
+    }
+
+    /* Access advice is only a hint; failure leaves the mapping usable */
+    madvise((caddr_t)a, (size_t)len, madv);
+}
+
+
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_FileChannelImpl_unmap0(JNIEnv *env, jobject this,
                                        jlong address, jlong len)
@@ -150,6 +180,28 @@ Java_sun_nio_ch_FileChannelImpl_close0(JNIEnv *env, jobject this, jobject fdo)
     }
 }
 
+/* sendfile(2) transfers at most this many bytes per call; larger requests
+ * are chunked here rather than per-chunk calls from Java. */
+#define MAX_SENDFILE_CHUNK ((jlong)0x7ffff000)
+
+#if defined(__linux__)
+
+/* SPLICE_F_MOVE | SPLICE_F_MORE; the flag macros need _GNU_SOURCE */
+#define SPLICE_FLAGS (0x01 | 0x04)
+
+static jlong
+splice_from_file(int srcFD, off64_t *offset, int dstFD, size_t len)
+{
+#if defined(__NR_splice)
+    return syscall(__NR_splice, srcFD, offset, dstFD, NULL, len, SPLICE_FLAGS);
+#else
+    errno = EINVAL;
+    return -1;
+#endif
+}
+
+#endif /* __linux__ */
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
                                             jint srcFD,
@@ -158,19 +210,37 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 {
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
-    if (n < 0) {
-        if (errno == EAGAIN)
-            return IOS_UNAVAILABLE;
-        if ((errno == EINVAL) && ((ssize_t)count >= 0))
-            return IOS_UNSUPPORTED_CASE;
-        if (errno == EINTR) {
-            return IOS_INTERRUPTED;
+    jlong tw = 0;
+    while (count > 0) {
+        size_t chunk = (size_t)((count > MAX_SENDFILE_CHUNK) ?
+                                MAX_SENDFILE_CHUNK : count);
+        jlong n = sendfile64(dstFD, srcFD, &offset, chunk);
+        if ((n < 0) && (errno == EINVAL)) {
+            /* Some kernels refuse sendfile when the target is a pipe;
+             * splice covers that combination. */
+            n = splice_from_file(srcFD, &offset, dstFD, chunk);
         }
-        JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
-        return IOS_THROWN;
+        if (n < 0) {
+            if (tw > 0)
+                break;          /* report the bytes already transferred */
+            if (errno == EAGAIN)
+                return IOS_UNAVAILABLE;
+            if ((errno == EINVAL) && ((ssize_t)count >= 0))
+                return IOS_UNSUPPORTED_CASE;
+            if (errno == EINTR) {
+                return IOS_INTERRUPTED;
+            }
+            JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
+            return IOS_THROWN;
+        }
+        if (n == 0)
+            break;              /* end of file on the source */
+        tw += n;
+        count -= n;
+        if (n < (jlong)chunk)
+            break;              /* short write, e.g. a full socket buffer */
     }
-    return n;
+    return tw;
 #elif defined (__solaris__)
     sendfilevec64_t sfv;
     size_t numBytes = 0;
@@ -179,7 +249,9 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
     sfv.sfv_fd = srcFD;
     sfv.sfv_flag = 0;
     sfv.sfv_off = (off64_t)position;
-    sfv.sfv_len = count;
+    /* clamp to avoid size_t truncation; the caller retries for the rest */
+    sfv.sfv_len = (size_t)((count > MAX_SENDFILE_CHUNK) ? MAX_SENDFILE_CHUNK
+                                                        : count);
 
     result = sendfilev64(dstFD, &sfv, 1, &numBytes);
 
@@ -121,6 +121,13 @@ Java_sun_nio_ch_FileChannelImpl_map0(JNIEnv *env, jobject this,
     return ptr_to_jlong(mapAddress);
 }
 
+JNIEXPORT void JNICALL
+Java_sun_nio_ch_FileChannelImpl_advise0(JNIEnv *env, jclass clazz,
+                                 jlong address, jlong len, jint advice)
+{
+    /* no madvise equivalent; access advice is ignored */
+}
+
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_FileChannelImpl_unmap0(JNIEnv *env, jobject this,
                                  jlong address, jlong len)